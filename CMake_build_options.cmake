@@ -16,6 +16,11 @@ if (ENABLE_HPMC_MIXED_PRECISION)
     add_definitions(-DENABLE_HPMC_MIXED_PRECISION)
 endif()
 
+option(ENABLE_MD_MIXED_PRECISION "Evaluate md pair potentials in single precision in double precision builds" OFF)
+if (ENABLE_MD_MIXED_PRECISION)
+    add_definitions(-DENABLE_MD_MIXED_PRECISION)
+endif()
+
 #####################3
 ## CUDA related options
 option(ENABLE_CUDA "Enable the compilation of the CUDA GPU code" off)
@@ -12,6 +12,7 @@
 #include "BondedGroupData.h"
 #include "ParticleData.h"
 #include "Index1D.h"
+#include <algorithm>
 
 #include "hoomd/extern/pybind/include/pybind11/numpy.h"
 
@@ -44,7 +45,8 @@ template<unsigned int group_size, typename Group, const char *name, bool has_typ
 BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
     std::shared_ptr<ParticleData> pdata,
     unsigned int n_group_types)
-    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_groups(0), m_n_ghost(0), m_nglobal(0), m_groups_dirty(true)
+    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_groups(0), m_n_ghost(0), m_nglobal(0), m_groups_dirty(true),
+      m_index_table_dirty(true)
     {
     m_exec_conf->msg->notice(5) << "Constructing BondedGroupData (" << name<< "s, n=" << group_size << ") "
         << endl;
@@ -94,7 +96,8 @@ template<unsigned int group_size, typename Group, const char *name, bool has_typ
 BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
     std::shared_ptr<ParticleData> pdata,
     const Snapshot& snapshot)
-    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_groups(0), m_n_ghost(0), m_nglobal(0), m_groups_dirty(true)
+    : m_exec_conf(pdata->getExecConf()), m_pdata(pdata), m_n_groups(0), m_n_ghost(0), m_nglobal(0), m_groups_dirty(true),
+      m_index_table_dirty(true)
     {
     m_exec_conf->msg->notice(5) << "Constructing BondedGroupData (" << name << ") " << endl;
 
@@ -177,6 +180,13 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initialize()
     GPUVector<unsigned int> n_groups(m_exec_conf);
     m_gpu_n_groups.swap(n_groups);
 
+    // Local groups by particle index
+    GPUVector<members_t> index_table(m_exec_conf);
+    m_index_table.swap(index_table);
+
+    GPUVector<typeval_t> index_table_typeval(m_exec_conf);
+    m_index_table_typeval.swap(index_table_typeval);
+
     #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
@@ -841,6 +851,79 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable
         }
     }
 
+/*! Translates the member tags of all local groups to particle indices and orders the groups by their lowest member
+    index with a counting sort. The table is used by the CPU force computes, which can then loop over direct
+    indices without going through the reverse tag lookup.
+*/
+template<unsigned int group_size, typename Group, const char *name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildIndexTable()
+    {
+    if (m_prof) m_prof->push("update " + std::string(name) + " index table");
+
+    const unsigned int n_groups = m_n_groups;
+    const unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
+
+    m_index_table.resize(n_groups);
+    m_index_table_typeval.resize(n_groups);
+    m_index_table_count.assign(max_local+1, 0);
+
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_group_typeval, access_location::host, access_mode::read);
+    ArrayHandle<members_t> h_index_table(m_index_table, access_location::host, access_mode::overwrite);
+    ArrayHandle<typeval_t> h_index_table_typeval(m_index_table_typeval, access_location::host,
+        access_mode::overwrite);
+
+    // count the groups by their lowest member index
+    for (unsigned int cur_group = 0; cur_group < n_groups; cur_group++)
+        {
+        const members_t& g = h_groups.data[cur_group];
+        unsigned int min_idx = max_local;
+        for (unsigned int i = 0; i < group_size; ++i)
+            {
+            unsigned int idx = h_rtag.data[g.tag[i]];
+
+            if (idx >= max_local)
+                {
+                // incomplete group
+                std::ostringstream oss;
+                oss << name << ".*: " << name << " ";
+                for (unsigned int k = 0; k < group_size; ++k)
+                    oss << g.tag[k] << ((k != group_size - 1) ? ", " : " ");
+                oss << "incomplete!" << std::endl;
+                m_exec_conf->msg->error() << oss.str();
+                throw std::runtime_error("Error building group index table.");
+                }
+
+            min_idx = std::min(min_idx, idx);
+            }
+        m_index_table_count[min_idx+1]++;
+        }
+
+    // the prefix sum gives the first position of each lowest member index in the table
+    for (unsigned int i = 0; i < max_local; i++)
+        m_index_table_count[i+1] += m_index_table_count[i];
+
+    // fill in the table, groups with the same lowest member index keep their relative order
+    for (unsigned int cur_group = 0; cur_group < n_groups; cur_group++)
+        {
+        const members_t& g = h_groups.data[cur_group];
+        members_t h;
+        unsigned int min_idx = max_local;
+        for (unsigned int i = 0; i < group_size; ++i)
+            {
+            h.idx[i] = h_rtag.data[g.tag[i]];
+            min_idx = std::min(min_idx, h.idx[i]);
+            }
+
+        unsigned int pos = m_index_table_count[min_idx]++;
+        h_index_table.data[pos] = h;
+        h_index_table_typeval.data[pos] = h_typeval.data[cur_group];
+        }
+
+    if (m_prof) m_prof->pop();
+    }
+
 #ifdef ENABLE_CUDA
 template<unsigned int group_size, typename Group, const char *name, bool has_type_mapping>
 void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTableGPU()
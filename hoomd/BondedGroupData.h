@@ -547,6 +547,40 @@ class BondedGroupData
             return m_gpu_n_groups;
             }
 
+        /*
+         * CPU index table
+         */
+
+        //! Return the local groups with their members translated to particle indices
+        /*! The table holds one entry per local group (getN()) and is rebuilt when the particles or the groups
+            are reordered. Entries are ordered by the lowest member index, so that neighboring entries access
+            neighboring particle data. The order does not correspond to the order of getMembersArray().
+        */
+        const GPUArray<members_t>& getIndexTable()
+            {
+            // rebuild index table if necessary
+            if (m_index_table_dirty)
+                {
+                rebuildIndexTable();
+                m_index_table_dirty = false;
+                }
+
+            return m_index_table;
+            }
+
+        //! Return the types/constraint values of the groups in the order of getIndexTable()
+        const GPUArray<typeval_t>& getIndexTableTypeVal()
+            {
+            // rebuild index table if necessary
+            if (m_index_table_dirty)
+                {
+                rebuildIndexTable();
+                m_index_table_dirty = false;
+                }
+
+            return m_index_table_typeval;
+            }
+
         /*
          * add/remove groups globally
          */
@@ -585,17 +619,19 @@ class BondedGroupData
         //! Notify subscribers that groups have been reordered
         void notifyGroupReorder()
             {
-            // set flag to trigger rebuild of GPU table
+            // set flags to trigger rebuild of GPU and index tables
             m_groups_dirty = true;
+            m_index_table_dirty = true;
 
             // notify subscribers
             m_group_reorder_signal.emit();
             }
 
-        //! Indicate that GPU table needs to be rebuilt
+        //! Indicate that GPU and index tables need to be rebuilt
         void setDirty()
             {
             m_groups_dirty = true;
+            m_index_table_dirty = true;
             }
 
     protected:
@@ -619,6 +655,8 @@ class BondedGroupData
         GPUVector<unsigned int> m_gpu_pos_table;     //!< Position of particle idx in group table
         Index2D m_gpu_table_indexer;                 //!< Indexer for GPU table
         GPUVector<unsigned int> m_gpu_n_groups;      //!< Number of entries in lookup table per particle
+        GPUVector<members_t> m_index_table;          //!< Local groups by member particle index, ordered for locality
+        GPUVector<typeval_t> m_index_table_typeval;  //!< Group types/constraint values in index table order
         std::vector<std::string> m_type_mapping;     //!< Mapping of types of bonded groups
 
         unsigned int m_n_groups;                     //!< Number of local groups
@@ -645,6 +683,8 @@ class BondedGroupData
 
     private:
         bool m_groups_dirty;                         //!< Is it necessary to rebuild the lookup-by-index table?
+        bool m_index_table_dirty;                    //!< Is it necessary to rebuild the CPU index table?
+        std::vector<unsigned int> m_index_table_count;   //!< Scratch space for ordering the index table
 
         Nano::Signal<void ()> m_group_num_change_signal; //!< Signal that is triggered when groups are added or deleted (globally)
         Nano::Signal<void ()> m_group_reorder_signal;    //!< Signal that is triggered when groups are added or deleted locally
@@ -658,6 +698,9 @@ class BondedGroupData
         //! Helper function to rebuild lookup by index table
         void rebuildGPUTable();
 
+        //! Helper function to rebuild the CPU index table
+        void rebuildIndexTable();
+
         //! Resize internal tables
         /*! \param new_size New size of local group tables, new_size = n_local + n_ghost
          */
@@ -1094,7 +1094,11 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
             m_dihedral_comm(*this, m_sysdef->getDihedralData()),
             m_improper_comm(*this, m_sysdef->getImproperData()),
             m_constraint_comm(*this, m_sysdef->getConstraintData()),
-            m_pair_comm(*this, m_sysdef->getPairData())
+            m_pair_comm(*this, m_sysdef->getPairData()),
+            m_ghost_update_sendbuf(m_exec_conf),
+            m_ghost_update_recvbuf(m_exec_conf),
+            m_ghost_update_stride(0),
+            m_ghost_position_mode(full)
     {
     // initialize array of neighbor processor ids
     assert(m_mpi_comm);
@@ -1113,6 +1117,14 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
         m_copy_ghosts[dir].swap(copy_ghosts);
         m_num_copy_ghosts[dir] = 0;
         m_num_recv_ghosts[dir] = 0;
+
+        GPUVector<unsigned int> ghost_send_idx(m_exec_conf);
+        m_ghost_send_idx[dir].swap(ghost_send_idx);
+        m_ghost_update_offset[dir] = 0;
+        m_ghost_update_recv_offset[dir] = 0;
+
+        for (unsigned int field = 0; field < NUM_GHOST_UPDATE_FIELDS; ++field)
+            m_ghost_update_reqs[field][dir].active = false;
         }
 
     // All buffers corresponding to sending ghosts in reverse
@@ -1202,6 +1214,8 @@ Communicator::~Communicator()
     m_sysdef->getImproperData()->getGroupNumChangeSignal().disconnect<Communicator, &Communicator::setImpropersChanged>(this);
     m_sysdef->getConstraintData()->getGroupNumChangeSignal().disconnect<Communicator, &Communicator::setConstraintsChanged>(this);
     m_sysdef->getPairData()->getGroupNumChangeSignal().disconnect<Communicator, &Communicator::setPairsChanged>(this);
+
+    freeGhostUpdateRequests();
     }
 
 void Communicator::initializeNeighborArrays()
@@ -1683,6 +1697,7 @@ void Communicator::exchangeGhosts()
         // resize array of ghost particle tags
         unsigned int max_copy_ghosts = m_pdata->getN() + m_pdata->getNGhosts();
         m_copy_ghosts[dir].resize(max_copy_ghosts);
+        m_ghost_send_idx[dir].resize(max_copy_ghosts);
 
         // resize buffers
         m_plan_copybuf.resize(max_copy_ghosts);
@@ -1718,11 +1733,12 @@ void Communicator::exchangeGhosts()
             ArrayHandle<unsigned int> h_body(m_pdata->getBodies(), access_location::host, access_mode::read);
             ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
             ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::host, access_mode::read);
             ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
             ArrayHandle<unsigned int>  h_plan(m_plan, access_location::host, access_mode::readwrite);
 
             ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir], access_location::host, access_mode::overwrite);
+            ArrayHandle<unsigned int> h_ghost_send_idx(m_ghost_send_idx[dir], access_location::host, access_mode::overwrite);
             ArrayHandle<unsigned int> h_plan_copybuf(m_plan_copybuf, access_location::host, access_mode::overwrite);
             ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf, access_location::host, access_mode::overwrite);
             ArrayHandle<Scalar> h_charge_copybuf(m_charge_copybuf, access_location::host, access_mode::overwrite);
@@ -1748,6 +1764,7 @@ void Communicator::exchangeGhosts()
                     h_plan_copybuf.data[m_num_copy_ghosts[dir]] = h_plan.data[idx];
 
                     h_copy_ghosts.data[m_num_copy_ghosts[dir]] = h_tag.data[idx];
+                    h_ghost_send_idx.data[m_num_copy_ghosts[dir]] = idx;
                     m_num_copy_ghosts[dir]++;
                     }
                 }
@@ -1824,7 +1841,7 @@ void Communicator::exchangeGhosts()
             ArrayHandle<unsigned int> h_body(m_pdata->getBodies(), access_location::host, access_mode::readwrite);
             ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
             ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::readwrite);
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
+            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::host, access_mode::readwrite);
             ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::readwrite);
 
             // Clear out the mpi variables for new statuses and requests
@@ -2053,6 +2070,9 @@ void Communicator::exchangeGhosts()
 
     m_last_flags = flags;
 
+    // the ghost send lists are now fixed until the next exchange
+    initGhostUpdatePlan();
+
     /***********************************************************************************************************************************************************
      * For multi-body force fields we must allow particles to send information back through their ghosts.
      * For this purpose, we implement a system for ghosts to be sent back to their original domain with forces on them that can then be added back to the original local particle.
@@ -2294,84 +2314,153 @@ void Communicator::exchangeGhosts()
         m_prof->pop();
     }
 
-//! update positions of ghost particles
-void Communicator::beginUpdateGhosts(unsigned int timestep)
-    {
-    // we have a current m_copy_ghosts liss which contain the indices of particles
-    // to send to neighboring processors
-    if (m_prof)
-        m_prof->push("comm_ghost_update");
-
-    m_exec_conf->msg->notice(7) << "Communicator: update ghosts" << std::endl;
-
-    // update data in these arrays
+//! Allocate the send buffer for the ghost updates after a ghost exchange
+/*! The lists of particles sent as ghosts only change in exchangeGhosts(). Between two exchanges, the send buffer
+    and the persistent requests bound to it are reused, so that a ghost update consists only of packing the data,
+    starting the requests and waiting for their completion.
 
-    unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
+    Every direction reserves one extra element, which holds the message header for reduced precision positions.
+ */
+void Communicator::initGhostUpdatePlan()
+    {
+    // the buffers are reallocated, invalidating all requests bound to them
+    freeGhostUpdateRequests();
 
-    for (unsigned int dir = 0; dir < 6; dir ++)
+    unsigned int offset = 0;
+    unsigned int recv_offset = 0;
+    for (unsigned int dir = 0; dir < 6; ++dir)
         {
-        if (! isCommunicating(dir) ) continue;
+        m_ghost_update_offset[dir] = offset;
+        m_ghost_update_recv_offset[dir] = recv_offset;
+        if (isCommunicating(dir))
+            {
+            offset += m_num_copy_ghosts[dir] + 1;
+            recv_offset += m_num_recv_ghosts[dir] + 1;
+            }
+        }
+    m_ghost_update_stride = offset;
 
-        CommFlags flags = getFlags();
+    m_ghost_update_sendbuf.resize(NUM_GHOST_UPDATE_FIELDS*m_ghost_update_stride);
+    m_ghost_update_recvbuf.resize(recv_offset);
+    }
 
-        if (flags[comm_flag::position])
+//! Release all persistent ghost update requests
+void Communicator::freeGhostUpdateRequests()
+    {
+    for (unsigned int field = 0; field < NUM_GHOST_UPDATE_FIELDS; ++field)
+        for (unsigned int dir = 0; dir < 6; ++dir)
             {
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf, access_location::host, access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir], access_location::host, access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
-
-            // copy positions of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            ghost_update_request& r = m_ghost_update_reqs[field][dir];
+            if (r.active)
                 {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
-
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
-
-                // copy position into send buffer
-                h_pos_copybuf.data[ghost_idx] = h_pos.data[idx];
+                MPI_Request_free(&r.reqs[0]);
+                MPI_Request_free(&r.reqs[1]);
+                r.active = false;
                 }
             }
+    }
 
-        if (flags[comm_flag::velocity])
+/*! \param field Index of the field (0: position, 1: velocity, 2: orientation), also used as the message tag
+    \param dir Direction to send to
+    \param data The particle data array to send from and receive into
+    \param start_idx Index of the first ghost received along this direction
+
+    Positions are sent according to the current ghostPositionMode. In the reduced modes, the type stored in the
+    w component of the ghost positions is kept from the last ghost exchange.
+ */
+void Communicator::updateGhostField(unsigned int field,
+                                    unsigned int dir,
+                                    const GPUArray<Scalar4>& data,
+                                    unsigned int start_idx)
+    {
+    ArrayHandle<Scalar4> h_data(data, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_sendbuf(m_ghost_update_sendbuf, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_recvbuf(m_ghost_update_recvbuf, access_location::host, access_mode::readwrite);
+    ArrayHandle<unsigned int> h_ghost_send_idx(m_ghost_send_idx[dir], access_location::host, access_mode::read);
+
+    const unsigned int num_copy = m_num_copy_ghosts[dir];
+    const unsigned int num_recv = m_num_recv_ghosts[dir];
+
+    ghostPositionMode mode = (field == 0) ? m_ghost_position_mode : full;
+
+    #ifdef SINGLE_PRECISION
+    // offsets do not reduce the message size in single precision
+    if (mode == xyz_offset)
+        mode = xyz;
+    #endif
+
+    Scalar4 *send_ptr = h_sendbuf.data + field*m_ghost_update_stride + m_ghost_update_offset[dir];
+    Scalar4 *recv_ptr = (mode == full) ? h_data.data + start_idx
+        : h_recvbuf.data + m_ghost_update_recv_offset[dir];
+
+    // gather the data of the ghost particles using the index list of the last exchange
+    unsigned int send_bytes = 0;
+    unsigned int recv_bytes = 0;
+    if (mode == full)
+        {
+        for (unsigned int ghost_idx = 0; ghost_idx < num_copy; ghost_idx++)
             {
-            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
-            ArrayHandle<Scalar4> h_velocity_copybuf(m_velocity_copybuf, access_location::host, access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir], access_location::host, access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
-
-            // copy velocity of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
-                {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
-
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
-
-                // copy velocityition into send buffer
-                h_velocity_copybuf.data[ghost_idx] = h_vel.data[idx];
-                }
+            unsigned int idx = h_ghost_send_idx.data[ghost_idx];
+            assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+            send_ptr[ghost_idx] = h_data.data[idx];
             }
 
-        if (flags[comm_flag::orientation])
+        send_bytes = num_copy*sizeof(Scalar4);
+        recv_bytes = num_recv*sizeof(Scalar4);
+        }
+    else if (mode == xyz)
+        {
+        Scalar *out = (Scalar *) send_ptr;
+        for (unsigned int ghost_idx = 0; ghost_idx < num_copy; ghost_idx++)
             {
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
-            ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf, access_location::host, access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir], access_location::host, access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+            unsigned int idx = h_ghost_send_idx.data[ghost_idx];
+            assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+            const Scalar4 postype = h_data.data[idx];
+            out[3*ghost_idx] = postype.x;
+            out[3*ghost_idx+1] = postype.y;
+            out[3*ghost_idx+2] = postype.z;
+            }
 
-            // copy orientation of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
-                {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+        send_bytes = 3*num_copy*sizeof(Scalar);
+        recv_bytes = 3*num_recv*sizeof(Scalar);
+        }
+    else
+        {
+        // the header holds the origin of this domain in full precision
+        const Scalar3 lo = m_pdata->getBox().getLo();
+        Scalar *header = (Scalar *) send_ptr;
+        header[0] = lo.x;
+        header[1] = lo.y;
+        header[2] = lo.z;
+
+        float *out = (float *)(header + 3);
+        for (unsigned int ghost_idx = 0; ghost_idx < num_copy; ghost_idx++)
+            {
+            unsigned int idx = h_ghost_send_idx.data[ghost_idx];
+            assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+            const Scalar4 postype = h_data.data[idx];
+            out[3*ghost_idx] = float(postype.x - lo.x);
+            out[3*ghost_idx+1] = float(postype.y - lo.y);
+            out[3*ghost_idx+2] = float(postype.z - lo.z);
+            }
 
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+        send_bytes = 3*sizeof(Scalar) + 3*num_copy*sizeof(float);
+        recv_bytes = 3*sizeof(Scalar) + 3*num_recv*sizeof(float);
+        }
 
-                // copy orientation into send buffer
-                h_orientation_copybuf.data[ghost_idx] = h_orientation.data[idx];
-                }
-            }
+    ghost_update_request& r = m_ghost_update_reqs[field][dir];
 
+    // the requests remain valid as long as the buffers they are bound to and the message sizes do not change
+    if (r.active && (r.send_ptr != send_ptr || r.recv_ptr != recv_ptr
+        || r.send_bytes != send_bytes || r.recv_bytes != recv_bytes))
+        {
+        MPI_Request_free(&r.reqs[0]);
+        MPI_Request_free(&r.reqs[1]);
+        r.active = false;
+        }
 
+    if (! r.active)
+        {
         unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
 
         // we receive from the direction opposite to the one we send to
@@ -2381,13 +2470,67 @@ void Communicator::beginUpdateGhosts(unsigned int timestep)
         else
             recv_neighbor = m_decomposition->getNeighborRank(dir-1);
 
+        MPI_Send_init(send_ptr, send_bytes, MPI_BYTE, send_neighbor, field+1, m_mpi_comm, &r.reqs[0]);
+        MPI_Recv_init(recv_ptr, recv_bytes, MPI_BYTE, recv_neighbor, field+1, m_mpi_comm, &r.reqs[1]);
+        r.send_ptr = send_ptr;
+        r.recv_ptr = recv_ptr;
+        r.send_bytes = send_bytes;
+        r.recv_bytes = recv_bytes;
+        r.active = true;
+        }
 
-        unsigned int start_idx;
+    MPI_Status stats[2];
+    MPI_Startall(2, r.reqs);
+    MPI_Waitall(2, r.reqs, stats);
+
+    // scatter reduced precision positions into the ghost particle data
+    if (mode == xyz)
+        {
+        const Scalar *in = (const Scalar *) recv_ptr;
+        for (unsigned int i = 0; i < num_recv; ++i)
+            {
+            Scalar4& postype = h_data.data[start_idx + i];
+            postype.x = in[3*i];
+            postype.y = in[3*i+1];
+            postype.z = in[3*i+2];
+            }
+        }
+    else if (mode == xyz_offset)
+        {
+        const Scalar *header = (const Scalar *) recv_ptr;
+        const float *in = (const float *)(header + 3);
+        for (unsigned int i = 0; i < num_recv; ++i)
+            {
+            Scalar4& postype = h_data.data[start_idx + i];
+            postype.x = header[0] + Scalar(in[3*i]);
+            postype.y = header[1] + Scalar(in[3*i+1]);
+            postype.z = header[2] + Scalar(in[3*i+2]);
+            }
+        }
+    }
+
+//! update positions of ghost particles
+void Communicator::beginUpdateGhosts(unsigned int timestep)
+    {
+    // we have current lists of local indices of particles to send to neighboring processors,
+    // which are valid until the next call to exchangeGhosts()
+    if (m_prof)
+        m_prof->push("comm_ghost_update");
+
+    m_exec_conf->msg->notice(7) << "Communicator: update ghosts" << std::endl;
+
+    unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
+
+    CommFlags flags = getFlags();
+
+    for (unsigned int dir = 0; dir < 6; dir ++)
+        {
+        if (! isCommunicating(dir) ) continue;
 
         if (m_prof)
             m_prof->push("MPI send/recv");
 
-        start_idx = m_pdata->getN() + num_tot_recv_ghosts;
+        unsigned int start_idx = m_pdata->getN() + num_tot_recv_ghosts;
 
         num_tot_recv_ghosts += m_num_recv_ghosts[dir];
 
@@ -2396,56 +2539,30 @@ void Communicator::beginUpdateGhosts(unsigned int timestep)
         // charge, body, image and diameter are not updated between neighbor list builds
         if (flags[comm_flag::position])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
-
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf, access_location::host, access_mode::read);
-
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_pos_copybuf.data, m_num_copy_ghosts[dir]*sizeof(Scalar4), MPI_BYTE, send_neighbor, 1, m_mpi_comm, &m_reqs[0]);
-            MPI_Irecv(h_pos.data + start_idx, m_num_recv_ghosts[dir]*sizeof(Scalar4), MPI_BYTE, recv_neighbor, 1, m_mpi_comm, &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-
-            sz += sizeof(Scalar4);
+            updateGhostField(0, dir, m_pdata->getPositions(), start_idx);
+            if (m_ghost_position_mode == full)
+                sz += sizeof(Scalar4);
+            else if (m_ghost_position_mode == xyz)
+                sz += 3*sizeof(Scalar);
+            else
+                sz += 3*sizeof(float);
             }
 
         if (flags[comm_flag::velocity])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
-
-            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::readwrite);
-            ArrayHandle<Scalar4> h_vel_copybuf(m_velocity_copybuf, access_location::host, access_mode::read);
-
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_vel_copybuf.data, m_num_copy_ghosts[dir]*sizeof(Scalar4), MPI_BYTE, send_neighbor, 2, m_mpi_comm, &m_reqs[0]);
-            MPI_Irecv(h_vel.data + start_idx, m_num_recv_ghosts[dir]*sizeof(Scalar4), MPI_BYTE, recv_neighbor, 2, m_mpi_comm, &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-
+            updateGhostField(1, dir, m_pdata->getVelocities(), start_idx);
             sz += sizeof(Scalar4);
             }
 
         if (flags[comm_flag::orientation])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
-
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
-            ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf, access_location::host, access_mode::read);
-
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_orientation_copybuf.data, m_num_copy_ghosts[dir]*sizeof(Scalar4), MPI_BYTE, send_neighbor, 3, m_mpi_comm, &m_reqs[0]);
-            MPI_Irecv(h_orientation.data + start_idx, m_num_recv_ghosts[dir]*sizeof(Scalar4), MPI_BYTE, recv_neighbor, 3, m_mpi_comm, &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-
+            updateGhostField(2, dir, m_pdata->getOrientationArray(), start_idx);
             sz += sizeof(Scalar4);
             }
 
         if (m_prof)
             m_prof->pop(0, (m_num_recv_ghosts[dir]+m_num_copy_ghosts[dir])*sz);
 
-
         // wrap particle positions (only if copying positions)
         if (flags[comm_flag::position])
             {
@@ -2890,7 +3007,17 @@ const BoxDim Communicator::getShiftedBox() const
 //! Export Communicator class to python
 void export_Communicator(py::module& m)
     {
-    py::class_<Communicator, std::shared_ptr<Communicator> >(m,"Communicator")
-    .def(py::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<DomainDecomposition> >());
+    py::class_<Communicator, std::shared_ptr<Communicator> > communicator(m,"Communicator");
+    communicator.def(py::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<DomainDecomposition> >())
+    .def("setGhostPositionMode", &Communicator::setGhostPositionMode)
+    .def("getGhostPositionMode", &Communicator::getGhostPositionMode)
+    ;
+
+    py::enum_<Communicator::ghostPositionMode>(communicator, "ghostPositionMode")
+        .value("full", Communicator::ghostPositionMode::full)
+        .value("xyz", Communicator::ghostPositionMode::xyz)
+        .value("xyz_offset", Communicator::ghostPositionMode::xyz_offset)
+        .export_values()
+    ;
     }
 #endif // ENABLE_MPI
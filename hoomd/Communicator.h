@@ -371,8 +371,36 @@ class PYBIND11_EXPORT Communicator
             send_down = 32
             };
 
+        //! Modes for sending ghost positions in a ghost update
+        /*! The type of a ghost particle cannot change between two ghost exchanges. It is therefore sufficient
+            to update only the coordinates. In double precision builds, the coordinates can further be sent as
+            single precision offsets relative to the origin of the sending domain.
+         */
+        enum ghostPositionMode
+            {
+            full = 0,   //!< Send the full position and type
+            xyz,        //!< Send only the coordinates
+            xyz_offset  //!< Send the coordinates as 32-bit offsets relative to the domain origin
+            };
+
         //@}
 
+        //! Set the mode for sending ghost positions in ghost updates
+        /*! \param mode The new mode
+
+            This setting only applies to the CPU code path.
+         */
+        void setGhostPositionMode(ghostPositionMode mode)
+            {
+            m_ghost_position_mode = mode;
+            }
+
+        //! Get the mode for sending ghost positions in ghost updates
+        ghostPositionMode getGhostPositionMode() const
+            {
+            return m_ghost_position_mode;
+            }
+
         //! Set autotuner parameters
         /*! \param enable Enable/disable autotuning
             \param period period (approximate) in time steps when returning occurs
@@ -654,6 +682,46 @@ class PYBIND11_EXPORT Communicator
         //! Helper function to initialize adjacency arrays
         void initializeNeighborArrays();
 
+        /* Steady-state ghost updates */
+
+        //! Number of per-particle fields that can be sent in a ghost update (position, velocity, orientation)
+        static const unsigned int NUM_GHOST_UPDATE_FIELDS = 3;
+
+        //! A pair of persistent MPI requests bound to the send and receive buffers of one field and direction
+        struct ghost_update_request
+            {
+            MPI_Request reqs[2];     //!< The persistent send and receive requests
+            const void *send_ptr;    //!< Send buffer the requests are bound to
+            void *recv_ptr;          //!< Receive buffer the requests are bound to
+            unsigned int send_bytes; //!< Size of the send message
+            unsigned int recv_bytes; //!< Size of the receive message
+            bool active;             //!< True if the requests have been initialized
+            };
+
+        GPUVector<unsigned int> m_ghost_send_idx[6]; //!< Per-direction local indices of the particles sent as ghosts
+        GPUVector<Scalar4> m_ghost_update_sendbuf;   //!< Contiguous send buffer for all fields and directions
+        GPUVector<Scalar4> m_ghost_update_recvbuf;   //!< Receive buffer for reduced precision positions
+        unsigned int m_ghost_update_offset[6];       //!< Offset of every direction in a field of the send buffer
+        unsigned int m_ghost_update_recv_offset[6];  //!< Offset of every direction in the receive buffer
+        unsigned int m_ghost_update_stride;          //!< Number of elements per field in the send buffer
+
+        ghostPositionMode m_ghost_position_mode;     //!< How ghost positions are sent in ghost updates
+
+        //! Persistent requests per field and direction
+        ghost_update_request m_ghost_update_reqs[NUM_GHOST_UPDATE_FIELDS][6];
+
+        //! Allocate the send buffer for the ghost updates after a ghost exchange
+        void initGhostUpdatePlan();
+
+        //! Release all persistent ghost update requests
+        void freeGhostUpdateRequests();
+
+        //! Pack, start and complete the persistent send/receive of one field along one direction
+        void updateGhostField(unsigned int field,
+                              unsigned int dir,
+                              const GPUArray<Scalar4>& data,
+                              unsigned int start_idx);
+
         //! Method that is called when ghost particles are requested to be removed
         void slotGhostParticlesRemoved()
             {
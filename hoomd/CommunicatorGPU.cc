@@ -1980,7 +1980,7 @@ void CommunicatorGPU::exchangeGhosts()
             ArrayHandle<Scalar> d_charge(m_pdata->getCharges(), access_location::device, access_mode::read);
             ArrayHandle<unsigned int> d_body(m_pdata->getBodies(), access_location::device, access_mode::read);
             ArrayHandle<Scalar> d_diameter(m_pdata->getDiameters(), access_location::device, access_mode::read);
-            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(), access_location::device, access_mode::read);
+            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::device, access_mode::read);
             ArrayHandle<unsigned int> d_rtag(m_pdata->getRTags(), access_location::device, access_mode::read);
 
             // access ghost send indices
@@ -2129,7 +2129,7 @@ void CommunicatorGPU::exchangeGhosts()
             ArrayHandle<Scalar> diameter_ghost_recvbuf_handle(m_pdata->getDiameters(), access_location::device, access_mode::readwrite);
             ArrayHandle<unsigned int> body_ghost_recvbuf_handle(m_pdata->getBodies(), access_location::device, access_mode::readwrite);
             ArrayHandle<int3> image_ghost_recvbuf_handle(m_pdata->getImages(), access_location::device, access_mode::readwrite);
-            ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_pdata->getOrientationArray(), access_location::device, access_mode::readwrite);
+            ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::device, access_mode::readwrite);
 
             // send buffers
             ArrayHandle<unsigned int> tag_ghost_sendbuf_handle(m_tag_ghost_sendbuf, access_location::device, access_mode::read);
@@ -2438,7 +2438,7 @@ void CommunicatorGPU::exchangeGhosts()
             ArrayHandle<unsigned int> d_body(m_pdata->getBodies(), access_location::device, access_mode::readwrite);
             ArrayHandle<int3> d_image(m_pdata->getImages(), access_location::device, access_mode::readwrite);
             ArrayHandle<Scalar> d_diameter(m_pdata->getDiameters(), access_location::device, access_mode::readwrite);
-            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(), access_location::device, access_mode::readwrite);
+            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::device, access_mode::readwrite);
 
             // copy recv buf into particle data
             gpu_exchange_ghosts_copy_buf(
@@ -2576,7 +2576,7 @@ void CommunicatorGPU::beginUpdateGhosts(unsigned int timestep)
             // access particle data
             ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
             ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(), access_location::device, access_mode::read);
-            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(), access_location::device, access_mode::read);
+            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::device, access_mode::read);
 
             // access ghost send indices
             ArrayHandle<uint2> d_ghost_idx_adj(m_ghost_idx_adj, access_location::device, access_mode::read);
@@ -2653,7 +2653,7 @@ void CommunicatorGPU::beginUpdateGhosts(unsigned int timestep)
             // recv buffers, directly write into particle data arrays
             ArrayHandle<Scalar4> pos_ghost_recvbuf_handle(m_pdata->getPositions(), access_location::device, access_mode::readwrite);
             ArrayHandle<Scalar4> vel_ghost_recvbuf_handle(m_pdata->getVelocities(), access_location::device, access_mode::readwrite);
-            ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_pdata->getOrientationArray(), access_location::device, access_mode::readwrite);
+            ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::device, access_mode::readwrite);
 
             // send buffers
             ArrayHandle<Scalar4> pos_ghost_sendbuf_handle(m_pos_ghost_sendbuf, access_location::device, access_mode::read);
@@ -2822,7 +2822,7 @@ void CommunicatorGPU::beginUpdateGhosts(unsigned int timestep)
                 // access particle data
                 ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::readwrite);
                 ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(), access_location::device, access_mode::readwrite);
-                ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(), access_location::device, access_mode::readwrite);
+                ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::device, access_mode::readwrite);
 
                 // copy recv buf into particle data
                 gpu_exchange_ghosts_copy_buf(
@@ -2904,7 +2904,7 @@ void CommunicatorGPU::finishUpdateGhosts(unsigned int timestep)
             // access particle data
             ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::readwrite);
             ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(), access_location::device, access_mode::readwrite);
-            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(), access_location::device, access_mode::readwrite);
+            ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(flags[comm_flag::orientation]), access_location::device, access_mode::readwrite);
 
             // copy recv buf into particle data
             gpu_exchange_ghosts_copy_buf(
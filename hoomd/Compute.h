@@ -127,6 +127,52 @@ class PYBIND11_EXPORT Compute
             {
             return Scalar(0.0);
             }
+
+        //! Resolves a log quantity to an integer handle
+        /*! \param quantity Name of the log quantity
+            \returns A non-negative handle to pass to getLogValueByHandle(), or -1 if the quantity is only
+                     available through getLogValue()
+
+            The Logger resolves every logged quantity once when the list of quantities changes. Derived classes
+            that provide many quantities can override this (together with getLogValueByHandle()) to avoid
+            string comparisons on every logging step. The base class returns -1.
+        */
+        virtual int getLogHandle(const std::string& quantity)
+            {
+            return -1;
+            }
+
+        //! Calculates the log value for a handle returned by getLogHandle()
+        /*! \param handle Handle of the log quantity
+            \param timestep Current time step of the simulation
+        */
+        virtual Scalar getLogValueByHandle(int handle, unsigned int timestep)
+            {
+            return Scalar(0.0);
+            }
+
+#ifdef ENABLE_MPI
+        //! Appends local partial sums that still need to be reduced over all ranks
+        /*! \param buf Buffer to append this rank's contributions to
+            \returns Number of values appended
+
+            The Logger calls this after compute() and before requesting any log values. The values of all
+            computes are summed together in a single MPI_Allreduce and handed back with finishLogReduction().
+            The base class appends nothing, in which case the compute performs its own reductions.
+        */
+        virtual unsigned int beginLogReduction(std::vector<double>& buf)
+            {
+            return 0;
+            }
+
+        //! Accepts the reduced values appended by beginLogReduction()
+        /*! \param buf Pointer to the first reduced value of this compute
+        */
+        virtual void finishLogReduction(const double *buf)
+            {
+            }
+#endif
+
         //! Returns a list of log matrix quantities this compute calculates
         /*! The base class implementation just returns an empty vector. Derived classes should override
             this behavior and return a list of quantities that they log.
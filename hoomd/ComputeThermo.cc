@@ -11,6 +11,10 @@
 #include "ComputeThermo.h"
 #include "VectorMath.h"
 
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
+
 #ifdef ENABLE_MPI
 #include "Communicator.h"
 #include "HOOMDMPI.h"
@@ -28,7 +32,8 @@ using namespace std;
 ComputeThermo::ComputeThermo(std::shared_ptr<SystemDefinition> sysdef,
                              std::shared_ptr<ParticleGroup> group,
                              const std::string& suffix)
-    : Compute(sysdef), m_group(group), m_ndof(1), m_ndof_rot(0), m_logging_enabled(true)
+    : Compute(sysdef), m_group(group), m_ndof(1), m_ndof_rot(0), m_logging_enabled(true), m_deterministic(false),
+      m_provided_kinetic_timestep(0), m_has_provided_kinetic(false), m_use_provided_kinetic(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing ComputeThermo" << endl;
 
@@ -87,7 +92,10 @@ void ComputeThermo::compute(unsigned int timestep)
     if (!shouldCompute(timestep))
         return;
 
+    // use the kinetic tensor provided by an integration method if it is valid for this step
+    m_use_provided_kinetic = m_has_provided_kinetic && m_provided_kinetic_timestep == timestep;
     computeProperties();
+    m_use_provided_kinetic = false;
     }
 
 std::vector< std::string > ComputeThermo::getProvidedLogQuantities()
@@ -104,87 +112,220 @@ std::vector< std::string > ComputeThermo::getProvidedLogQuantities()
 
 Scalar ComputeThermo::getLogValue(const std::string& quantity, unsigned int timestep)
     {
-    compute(timestep);
-    if (quantity == m_logname_list[0])
-        {
-        return getTemperature();
-        }
-    else if (quantity == m_logname_list[1])
-        {
-        return getTranslationalTemperature();
-        }
-    else if (quantity == m_logname_list[2])
-        {
-        return getRotationalTemperature();
-        }
-    else if (quantity == m_logname_list[3])
+    int handle = getLogHandle(quantity);
+    if (handle < 0)
         {
-        return getKineticEnergy();
-        }
-    else if (quantity == m_logname_list[4])
-        {
-        return getTranslationalKineticEnergy();
-        }
-    else if (quantity == m_logname_list[5])
-        {
-        return getRotationalKineticEnergy();
-        }
-    else if (quantity == m_logname_list[6])
-        {
-        return getPotentialEnergy();
-        }
-    else if (quantity == m_logname_list[7])
-        {
-        return Scalar(m_ndof + m_ndof_rot);
-        }
-    else if (quantity == m_logname_list[8])
-        {
-        return Scalar(m_ndof);
-        }
-    else if (quantity == m_logname_list[9])
-        {
-        return Scalar(m_ndof_rot);
-        }
-    else if (quantity == m_logname_list[10])
-        {
-        return Scalar(m_group->getNumMembersGlobal());
-        }
-    else if (quantity == m_logname_list[11])
-        {
-        return getPressure();
-        }
-    else if (quantity == m_logname_list[12])
-        {
-        return Scalar(getPressureTensor().xx);
-        }
-    else if (quantity == m_logname_list[13])
-        {
-        return Scalar(getPressureTensor().xy);
+        m_exec_conf->msg->error() << "compute.thermo: " << quantity << " is not a valid log quantity" << endl;
+        throw runtime_error("Error getting log value");
         }
-    else if (quantity == m_logname_list[14])
+
+    return getLogValueByHandle(handle, timestep);
+    }
+
+/*! \param quantity Name of the log quantity
+    \returns The index of \a quantity in m_logname_list, or -1 if this compute does not provide it
+*/
+int ComputeThermo::getLogHandle(const std::string& quantity)
+    {
+    for (unsigned int i = 0; i < m_logname_list.size(); i++)
         {
-        return Scalar(getPressureTensor().xz);
+        if (quantity == m_logname_list[i])
+            return int(i);
         }
-    else if (quantity == m_logname_list[15])
+    return -1;
+    }
+
+/*! \param handle Index of the quantity in m_logname_list
+    \param timestep Current time step of the simulation
+*/
+Scalar ComputeThermo::getLogValueByHandle(int handle, unsigned int timestep)
+    {
+    compute(timestep);
+    switch (handle)
         {
-        return Scalar(getPressureTensor().yy);
+        case 0:
+            return getTemperature();
+        case 1:
+            return getTranslationalTemperature();
+        case 2:
+            return getRotationalTemperature();
+        case 3:
+            return getKineticEnergy();
+        case 4:
+            return getTranslationalKineticEnergy();
+        case 5:
+            return getRotationalKineticEnergy();
+        case 6:
+            return getPotentialEnergy();
+        case 7:
+            return Scalar(m_ndof + m_ndof_rot);
+        case 8:
+            return Scalar(m_ndof);
+        case 9:
+            return Scalar(m_ndof_rot);
+        case 10:
+            return Scalar(m_group->getNumMembersGlobal());
+        case 11:
+            return getPressure();
+        case 12:
+            return Scalar(getPressureTensor().xx);
+        case 13:
+            return Scalar(getPressureTensor().xy);
+        case 14:
+            return Scalar(getPressureTensor().xz);
+        case 15:
+            return Scalar(getPressureTensor().yy);
+        case 16:
+            return Scalar(getPressureTensor().yz);
+        case 17:
+            return Scalar(getPressureTensor().zz);
+        default:
+            m_exec_conf->msg->error() << "compute.thermo: " << handle << " is not a valid log handle" << endl;
+            throw runtime_error("Error getting log value");
         }
-    else if (quantity == m_logname_list[16])
+    }
+
+namespace
+{
+//! Terms accumulated over the group members by ComputeThermo
+struct ThermoTerms
+    {
+    bool kinetic;           //!< Accumulate the kinetic tensor
+    bool rotational;        //!< Accumulate the rotational kinetic energy
+    bool potential_energy;  //!< Accumulate the potential energy
+    bool virial;            //!< Accumulate the virial tensor
+    bool isotropic_virial;  //!< Accumulate only the diagonal of the virial tensor
+    };
+
+//! Partial sums over group members
+struct ThermoSums
+    {
+    double kinetic[6];      //!< sum(m v_a v_b), xx, xy, xz, yy, yz, zz
+    double ke_rot;          //!< Twice the rotational kinetic energy
+    double pe;              //!< Potential energy
+    double virial[6];       //!< Virial tensor, xx, xy, xz, yy, yz, zz
+
+    //! Zero all sums
+    ThermoSums()
         {
-        return Scalar(getPressureTensor().yz);
+        for (unsigned int i = 0; i < 6; i++)
+            {
+            kinetic[i] = 0.0;
+            virial[i] = 0.0;
+            }
+        ke_rot = 0.0;
+        pe = 0.0;
         }
-    else if (quantity == m_logname_list[17])
+
+    //! Combine two partial sums
+    ThermoSums& operator+=(const ThermoSums& other)
         {
-        return Scalar(getPressureTensor().zz);
+        for (unsigned int i = 0; i < 6; i++)
+            {
+            kinetic[i] += other.kinetic[i];
+            virial[i] += other.virial[i];
+            }
+        ke_rot += other.ke_rot;
+        pe += other.pe;
+        return *this;
         }
-    else
+    };
+
+//! Per-particle arrays read by ComputeThermo
+struct ThermoArrays
+    {
+    const unsigned int *index;      //!< Indices of the group members
+    const Scalar4 *vel;             //!< Velocities and masses
+    const Scalar4 *net_force;       //!< Net force and potential energy
+    const Scalar *net_virial;       //!< Net virial
+    unsigned int virial_pitch;      //!< Pitch of the net virial
+    const Scalar4 *orientation;     //!< Orientations
+    const Scalar4 *angmom;          //!< Angular momenta
+    const Scalar3 *inertia;         //!< Moments of inertia
+    };
+
+//! Accumulate the terms of the group members in [begin, end) in a single pass
+void sumThermoTerms(ThermoSums& sums,
+                    const ThermoTerms& terms,
+                    const ThermoArrays& arrays,
+                    unsigned int begin,
+                    unsigned int end)
+    {
+    // accumulate in local variables so that the compiler can keep them in registers
+    double k_xx = 0.0, k_xy = 0.0, k_xz = 0.0, k_yy = 0.0, k_yz = 0.0, k_zz = 0.0;
+    double w_xx = 0.0, w_xy = 0.0, w_xz = 0.0, w_yy = 0.0, w_yz = 0.0, w_zz = 0.0;
+    double ke_rot = 0.0;
+    double pe = 0.0;
+
+    const unsigned int pitch = arrays.virial_pitch;
+
+    for (unsigned int group_idx = begin; group_idx < end; group_idx++)
         {
-        m_exec_conf->msg->error() << "compute.thermo: " << quantity << " is not a valid log quantity" << endl;
-        throw runtime_error("Error getting log value");
+        unsigned int j = arrays.index[group_idx];
+
+        if (terms.kinetic)
+            {
+            Scalar4 v = arrays.vel[j];
+            double mass = v.w;
+            double vx = v.x, vy = v.y, vz = v.z;
+            k_xx += mass*vx*vx;
+            k_xy += mass*vx*vy;
+            k_xz += mass*vx*vz;
+            k_yy += mass*vy*vy;
+            k_yz += mass*vy*vz;
+            k_zz += mass*vz*vz;
+            }
+
+        if (terms.rotational)
+            {
+            Scalar3 I = arrays.inertia[j];
+            quat<Scalar> q(arrays.orientation[j]);
+            quat<Scalar> p(arrays.angmom[j]);
+            quat<Scalar> s(Scalar(0.5)*conj(q)*p);
+
+            // only if the moment of inertia along one principal axis is non-zero, that axis carries angular momentum
+            if (I.x >= EPSILON)
+                ke_rot += s.v.x*s.v.x/I.x;
+            if (I.y >= EPSILON)
+                ke_rot += s.v.y*s.v.y/I.y;
+            if (I.z >= EPSILON)
+                ke_rot += s.v.z*s.v.z/I.z;
+            }
+
+        if (terms.potential_energy)
+            pe += (double)arrays.net_force[j].w;
+
+        if (terms.virial)
+            {
+            w_xx += (double)arrays.net_virial[j+0*pitch];
+            w_xy += (double)arrays.net_virial[j+1*pitch];
+            w_xz += (double)arrays.net_virial[j+2*pitch];
+            w_yy += (double)arrays.net_virial[j+3*pitch];
+            w_yz += (double)arrays.net_virial[j+4*pitch];
+            w_zz += (double)arrays.net_virial[j+5*pitch];
+            }
+        else if (terms.isotropic_virial)
+            {
+            w_xx += (double)arrays.net_virial[j+0*pitch];
+            w_yy += (double)arrays.net_virial[j+3*pitch];
+            w_zz += (double)arrays.net_virial[j+5*pitch];
+            }
         }
+
+    sums.kinetic[0] += k_xx; sums.kinetic[1] += k_xy; sums.kinetic[2] += k_xz;
+    sums.kinetic[3] += k_yy; sums.kinetic[4] += k_yz; sums.kinetic[5] += k_zz;
+    sums.virial[0] += w_xx; sums.virial[1] += w_xy; sums.virial[2] += w_xz;
+    sums.virial[3] += w_yy; sums.virial[4] += w_yz; sums.virial[5] += w_zz;
+    sums.ke_rot += ke_rot;
+    sums.pe += pe;
     }
+} // end anonymous namespace
 
 /*! Computes all thermodynamic properties of the system in one fell swoop.
+
+    All per-particle terms are accumulated in a single pass over the group members. With TBB, the pass is split
+    over threads and the partial sums are combined in a reduction tree. setDeterministic() selects a tree that only
+    depends on the group size.
 */
 void ComputeThermo::computeProperties()
     {
@@ -199,7 +340,18 @@ void ComputeThermo::computeProperties()
     assert(m_pdata);
     assert(m_ndof != 0);
 
-    // access the particle data
+    PDataFlags flags = m_pdata->getFlags();
+
+    ThermoTerms terms;
+    terms.kinetic = !m_use_provided_kinetic;
+    // without the anisotropic arrays, every particle has zero angular momentum
+    terms.rotational = flags[pdata_flag::rotational_kinetic_energy] && m_pdata->hasAnisotropicArrays();
+    terms.potential_energy = flags[pdata_flag::potential_energy];
+    terms.virial = flags[pdata_flag::pressure_tensor];
+    terms.isotropic_virial = flags[pdata_flag::isotropic_virial];
+
+    // access the group members and particle data
+    ArrayHandle<unsigned int> h_index(m_group->getIndexArray(), access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
 
     // access the net force, pe, and virial
@@ -208,10 +360,60 @@ void ComputeThermo::computeProperties()
     ArrayHandle<Scalar4> h_net_force(net_force, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_net_virial(net_virial, access_location::host, access_mode::read);
 
-    // total kinetic energy
-    double ke_trans_total = 0.0;
+    // the rotational arrays are only accessed when needed
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(terms.rotational), access_location::host,
+        access_mode::read);
+    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(terms.rotational), access_location::host,
+        access_mode::read);
+    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(terms.rotational), access_location::host,
+        access_mode::read);
+
+    ThermoArrays arrays;
+    arrays.index = h_index.data;
+    arrays.vel = h_vel.data;
+    arrays.net_force = h_net_force.data;
+    arrays.net_virial = h_net_virial.data;
+    arrays.virial_pitch = net_virial.getPitch();
+    arrays.orientation = h_orientation.data;
+    arrays.angmom = h_angmom.data;
+    arrays.inertia = h_inertia.data;
+
+    ThermoSums sums;
+
+    #ifdef ENABLE_TBB
+    auto body = [&terms, &arrays](const tbb::blocked_range<unsigned int>& r, ThermoSums partial) -> ThermoSums
+        {
+        sumThermoTerms(partial, terms, arrays, r.begin(), r.end());
+        return partial;
+        };
+    auto join = [](ThermoSums a, const ThermoSums& b) -> ThermoSums
+        {
+        a += b;
+        return a;
+        };
 
-    PDataFlags flags = m_pdata->getFlags();
+    if (m_deterministic)
+        {
+        // fixed grain size, the split only depends on group_size
+        sums = tbb::parallel_deterministic_reduce(tbb::blocked_range<unsigned int>(0, group_size, 1024),
+            ThermoSums(), body, join);
+        }
+    else
+        {
+        sums = tbb::parallel_reduce(tbb::blocked_range<unsigned int>(0, group_size, 1024), ThermoSums(), body, join);
+        }
+    #else
+    sumThermoTerms(sums, terms, arrays, 0, group_size);
+    #endif
+
+    if (m_use_provided_kinetic)
+        {
+        for (unsigned int i = 0; i < 6; i++)
+            sums.kinetic[i] = m_provided_kinetic[i];
+        }
+
+    // kinetic energy = 1/2 trace of kinetic part of pressure tensor
+    double ke_trans_total = 0.5*(sums.kinetic[0] + sums.kinetic[3] + sums.kinetic[5]);
 
     double pressure_kinetic_xx = 0.0;
     double pressure_kinetic_xy = 0.0;
@@ -222,83 +424,22 @@ void ComputeThermo::computeProperties()
 
     if (flags[pdata_flag::pressure_tensor])
         {
-        // Calculate kinetic part of pressure tensor
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-            {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            double mass = h_vel.data[j].w;
-            pressure_kinetic_xx += mass*(  (double)h_vel.data[j].x * (double)h_vel.data[j].x );
-            pressure_kinetic_xy += mass*(  (double)h_vel.data[j].x * (double)h_vel.data[j].y );
-            pressure_kinetic_xz += mass*(  (double)h_vel.data[j].x * (double)h_vel.data[j].z );
-            pressure_kinetic_yy += mass*(  (double)h_vel.data[j].y * (double)h_vel.data[j].y );
-            pressure_kinetic_yz += mass*(  (double)h_vel.data[j].y * (double)h_vel.data[j].z );
-            pressure_kinetic_zz += mass*(  (double)h_vel.data[j].z * (double)h_vel.data[j].z );
-            }
-        // kinetic energy = 1/2 trace of kinetic part of pressure tensor
-        ke_trans_total = Scalar(0.5)*(pressure_kinetic_xx + pressure_kinetic_yy + pressure_kinetic_zz);
-        }
-    else
-        {
-        // total kinetic energy
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-            {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            ke_trans_total += (double)h_vel.data[j].w*( (double)h_vel.data[j].x * (double)h_vel.data[j].x
-                                                + (double)h_vel.data[j].y * (double)h_vel.data[j].y
-                                                + (double)h_vel.data[j].z * (double)h_vel.data[j].z);
-
-            }
-
-        ke_trans_total *= Scalar(0.5);
+        pressure_kinetic_xx = sums.kinetic[0];
+        pressure_kinetic_xy = sums.kinetic[1];
+        pressure_kinetic_xz = sums.kinetic[2];
+        pressure_kinetic_yy = sums.kinetic[3];
+        pressure_kinetic_yz = sums.kinetic[4];
+        pressure_kinetic_zz = sums.kinetic[5];
         }
 
     // total rotational kinetic energy
-    double ke_rot_total = 0.0;
-
-    if (flags[pdata_flag::rotational_kinetic_energy])
-        {
-        // Calculate rotational part of kinetic energy
-        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
-        ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(), access_location::host, access_mode::read);
-        ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(), access_location::host, access_mode::read);
-
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-            {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            Scalar3 I = h_inertia.data[j];
-            quat<Scalar> q(h_orientation.data[j]);
-            quat<Scalar> p(h_angmom.data[j]);
-            quat<Scalar> s(Scalar(0.5)*conj(q)*p);
-
-            // only if the moment of inertia along one principal axis is non-zero, that axis carries angular momentum
-            if (I.x >= EPSILON)
-                {
-                ke_rot_total += s.v.x*s.v.x/I.x;
-                }
-            if (I.y >= EPSILON)
-                {
-                ke_rot_total += s.v.y*s.v.y/I.y;
-                }
-            if (I.z >= EPSILON)
-                {
-                ke_rot_total += s.v.z*s.v.z/I.z;
-                }
-            }
-
-        ke_rot_total /= Scalar(2.0);
-        }
+    double ke_rot_total = sums.ke_rot / Scalar(2.0);
 
     // total potential energy
     double pe_total = 0.0;
     if (flags[pdata_flag::potential_energy])
         {
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-            {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            pe_total += (double)h_net_force.data[j].w;
-            }
-
-        pe_total += m_pdata->getExternalEnergy();
+        pe_total = sums.pe + m_pdata->getExternalEnergy();
         }
 
     double W = 0.0;
@@ -311,18 +452,13 @@ void ComputeThermo::computeProperties()
 
     if (flags[pdata_flag::pressure_tensor])
         {
-        // Calculate upper triangular virial tensor
-        unsigned int virial_pitch = net_virial.getPitch();
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-            {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            virial_xx += (double)h_net_virial.data[j+0*virial_pitch];
-            virial_xy += (double)h_net_virial.data[j+1*virial_pitch];
-            virial_xz += (double)h_net_virial.data[j+2*virial_pitch];
-            virial_yy += (double)h_net_virial.data[j+3*virial_pitch];
-            virial_yz += (double)h_net_virial.data[j+4*virial_pitch];
-            virial_zz += (double)h_net_virial.data[j+5*virial_pitch];
-            }
+        // upper triangular virial tensor
+        virial_xx += sums.virial[0];
+        virial_xy += sums.virial[1];
+        virial_xz += sums.virial[2];
+        virial_yy += sums.virial[3];
+        virial_yz += sums.virial[4];
+        virial_zz += sums.virial[5];
 
         if (flags[pdata_flag::isotropic_virial])
             {
@@ -332,15 +468,8 @@ void ComputeThermo::computeProperties()
         }
      else if (flags[pdata_flag::isotropic_virial])
         {
-        // only sum up isotropic part of virial tensor
-        unsigned int virial_pitch = net_virial.getPitch();
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-            {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            W += Scalar(1./3.)* ((double)h_net_virial.data[j+0*virial_pitch] +
-                                 (double)h_net_virial.data[j+3*virial_pitch] +
-                                 (double)h_net_virial.data[j+5*virial_pitch] );
-            }
+        // only the isotropic part of virial tensor was summed up
+        W = Scalar(1./3.) * (sums.virial[0] + sums.virial[3] + sums.virial[5]);
         }
 
     // compute the pressure
@@ -406,6 +535,32 @@ void ComputeThermo::reduceProperties()
 
     m_properties_reduced = true;
     }
+
+/*! \param buf Buffer to append the local properties to
+    \returns Number of values appended
+
+    Nothing is appended when the properties have already been reduced (or need no reduction).
+*/
+unsigned int ComputeThermo::beginLogReduction(std::vector<double>& buf)
+    {
+    if (m_properties_reduced)
+        return 0;
+
+    ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::read);
+    buf.insert(buf.end(), h_properties.data, h_properties.data + thermo_index::num_quantities);
+    return thermo_index::num_quantities;
+    }
+
+/*! \param buf Pointer to the reduced properties
+*/
+void ComputeThermo::finishLogReduction(const double *buf)
+    {
+    ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::overwrite);
+    for (unsigned int i = 0; i < thermo_index::num_quantities; i++)
+        h_properties.data[i] = Scalar(buf[i]);
+
+    m_properties_reduced = true;
+    }
 #endif
 
 void export_ComputeThermo(py::module& m)
@@ -421,5 +576,6 @@ void export_ComputeThermo(py::module& m)
     .def("getRotationalKineticEnergy", &ComputeThermo::getRotationalKineticEnergy)
     .def("getPotentialEnergy", &ComputeThermo::getPotentialEnergy)
     .def("setLoggingEnabled", &ComputeThermo::setLoggingEnabled)
+    .def("setDeterministic", &ComputeThermo::setDeterministic)
     ;
     }
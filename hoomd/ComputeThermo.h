@@ -291,6 +291,20 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
         //! Calculates the requested log value and returns it
         virtual Scalar getLogValue(const std::string& quantity, unsigned int timestep);
 
+        //! Resolves a log quantity to an integer handle
+        virtual int getLogHandle(const std::string& quantity);
+
+        //! Calculates the log value for a handle returned by getLogHandle()
+        virtual Scalar getLogValueByHandle(int handle, unsigned int timestep);
+
+        #ifdef ENABLE_MPI
+        //! Appends the unreduced properties for a batched reduction
+        virtual unsigned int beginLogReduction(std::vector<double>& buf);
+
+        //! Accepts the reduced properties
+        virtual void finishLogReduction(const double *buf);
+        #endif
+
         //! Control the enable_logging flag
         /*! Set this flag to false to prevent this compute from providing logged quantities.
             This is useful for internal computes that should not appear in the logs.
@@ -302,6 +316,42 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
             m_logging_enabled = enable;
             }
 
+        //! Get the group this compute operates on
+        std::shared_ptr<ParticleGroup> getGroup()
+            {
+            return m_group;
+            }
+
+        //! Select the deterministic reduction
+        /*! When TBB is enabled, the sums over the group members are computed in parallel. By default, the order of
+            the partial sums depends on the scheduling of the threads, which changes the results in the last digits
+            from run to run. With \a deterministic set, the members are split and summed in a fixed tree that only
+            depends on the group size, so repeated runs give bitwise identical results.
+
+            \param deterministic Flag to set
+        */
+        void setDeterministic(bool deterministic)
+            {
+            m_deterministic = deterministic;
+            }
+
+        //! Provide the kinetic part of the pressure tensor for a time step
+        /*! Integration methods that already loop over the final velocities of the group members can accumulate
+            sum(m v_a v_b) on the fly and provide it here, so that computing the properties at \a timestep does not
+            read the velocities again. The values must be the sums over the local members of this compute's group,
+            evaluated with the velocities at \a timestep.
+
+            \param timestep Time step the sums are valid for
+            \param kinetic Kinetic tensor components xx, xy, xz, yy, yz, zz
+        */
+        void setKineticTensor(unsigned int timestep, const double kinetic[6])
+            {
+            for (unsigned int i = 0; i < 6; i++)
+                m_provided_kinetic[i] = kinetic[i];
+            m_provided_kinetic_timestep = timestep;
+            m_has_provided_kinetic = true;
+            }
+
     protected:
         std::shared_ptr<ParticleGroup> m_group;     //!< Group to compute properties for
         GPUArray<Scalar> m_properties;  //!< Stores the computed properties
@@ -309,6 +359,12 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
         unsigned int m_ndof_rot;        //!< Stores the number of rotational degrees of freedom in the system
         std::vector<std::string> m_logname_list;  //!< Cache all generated logged quantities names
         bool m_logging_enabled;         //!< Set to false to disable communication with the logger
+        bool m_deterministic;           //!< True if the parallel reduction must be deterministic
+
+        double m_provided_kinetic[6];               //!< Kinetic tensor provided by setKineticTensor()
+        unsigned int m_provided_kinetic_timestep;   //!< Time step m_provided_kinetic is valid for
+        bool m_has_provided_kinetic;                //!< True if m_provided_kinetic has been set
+        bool m_use_provided_kinetic;                //!< True if computeProperties() may use m_provided_kinetic
 
         //! Does the actual computation
         virtual void computeProperties();
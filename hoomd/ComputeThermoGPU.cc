@@ -89,9 +89,15 @@ void ComputeThermoGPU::computeProperties()
     const GPUArray< Scalar >& net_virial = m_pdata->getNetVirial();
     ArrayHandle<Scalar4> d_net_force(net_force, access_location::device, access_mode::read);
     ArrayHandle<Scalar> d_net_virial(net_virial, access_location::device, access_mode::read);
-    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(), access_location::device, access_mode::read);
-    ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(), access_location::device, access_mode::read);
-    ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(), access_location::device, access_mode::read);
+
+    // without the anisotropic arrays, every particle has zero angular momentum
+    const bool rotational = flags[pdata_flag::rotational_kinetic_energy] && m_pdata->hasAnisotropicArrays();
+    ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(rotational), access_location::device,
+        access_mode::read);
+    ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(rotational), access_location::device,
+        access_mode::read);
+    ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(rotational), access_location::device,
+        access_mode::read);
     ArrayHandle<Scalar4> d_scratch(m_scratch, access_location::device, access_mode::overwrite);
     ArrayHandle<Scalar> d_scratch_pressure_tensor(m_scratch_pressure_tensor, access_location::device, access_mode::overwrite);
     ArrayHandle<Scalar> d_scratch_rot(m_scratch_rot, access_location::device, access_mode::overwrite);
@@ -132,7 +138,7 @@ void ComputeThermoGPU::computeProperties()
                         box,
                         args,
                         flags[pdata_flag::pressure_tensor],
-                        flags[pdata_flag::rotational_kinetic_energy]);
+                        rotational);
 
     if(m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -532,6 +532,11 @@ cudaError_t gpu_compute_thermo(Scalar *d_properties,
                                                d_group_members,
                                                group_size);
         }
+    else
+        {
+        // the final sums always read the rotational partial sums
+        cudaMemset(args.d_scratch_rot, 0, sizeof(Scalar)*args.n_blocks);
+        }
 
 
     // setup the grid to run the final kernel
@@ -55,6 +55,12 @@ ForceCompute::ForceCompute(std::shared_ptr<SystemDefinition> sysdef) : Compute(s
         m_external_virial[i] = Scalar(0.0);
 
     m_external_energy = Scalar(0.0);
+
+#ifdef ENABLE_MPI
+    m_energy_sum_reduced = false;
+    m_energy_sum = 0.0;
+    m_energy_sum_requested = false;
+#endif
     }
 
 /*! \post m_force, m_virial and m_torque are resized to the current maximum particle number
@@ -77,9 +83,9 @@ ForceCompute::~ForceCompute()
     m_pdata->getMaxParticleNumberChangeSignal().disconnect<ForceCompute, &ForceCompute::reallocate>(this);
     }
 
-/*! Sums the total potential energy calculated by the last call to compute() and returns it.
+/*! Sums the potential energy of the local particles calculated by the last call to compute().
 */
-Scalar ForceCompute::calcEnergySum()
+double ForceCompute::calcEnergySumLocal()
     {
     ArrayHandle<Scalar4> h_force(m_force,access_location::host,access_mode::read);
     // always perform the sum in double precision for better accuracy
@@ -91,6 +97,23 @@ Scalar ForceCompute::calcEnergySum()
         {
         pe_total += (double)h_force.data[i].w;
         }
+    return pe_total;
+    }
+
+/*! Sums the total potential energy calculated by the last call to compute() and returns it.
+*/
+Scalar ForceCompute::calcEnergySum()
+    {
+#ifdef ENABLE_MPI
+    // remember that the energy is in use, so that the Logger reduces it together with the other quantities
+    m_energy_sum_requested = true;
+
+    // the Logger has already reduced the sum for the current forces
+    if (m_energy_sum_reduced)
+        return Scalar(m_energy_sum);
+#endif
+
+    double pe_total = calcEnergySumLocal();
 #ifdef ENABLE_MPI
     if (m_comm)
         {
@@ -101,6 +124,40 @@ Scalar ForceCompute::calcEnergySum()
     return Scalar(pe_total);
     }
 
+#ifdef ENABLE_MPI
+/*! \param buf Buffer to append the local potential energy sum to
+    \returns Number of values appended
+
+    Only the energy sum is reduced here, and only if calcEnergySum() was called since the previous logging step.
+    Computes whose logged quantities do not include the energy sum (or which stopped logging it) add neither the O(N)
+    local sum nor a value to the reduction. When the energy is first logged, calcEnergySum() reduces it by itself
+    once. All ranks request the same log values, so they all append the same number of values.
+
+    Nothing is appended when the simulation is not domain decomposed, calcEnergySum() needs no reduction then.
+*/
+unsigned int ForceCompute::beginLogReduction(std::vector<double>& buf)
+    {
+    bool requested = m_energy_sum_requested;
+    m_energy_sum_requested = false;
+
+    if (!m_comm || !requested)
+        return 0;
+
+    buf.push_back(calcEnergySumLocal());
+    return 1;
+    }
+
+/*! \param buf Pointer to the reduced potential energy sum
+
+    calcEnergySum() returns the reduced value until the forces are computed again.
+*/
+void ForceCompute::finishLogReduction(const double *buf)
+    {
+    m_energy_sum = buf[0];
+    m_energy_sum_reduced = true;
+    }
+#endif
+
 /*! Sums the potential energy of a particle group calculated by the last call to compute() and returns it.
 */
 Scalar ForceCompute::calcEnergyGroup(std::shared_ptr<ParticleGroup> group)
@@ -140,6 +197,10 @@ void ForceCompute::compute(unsigned int timestep)
     if (!m_particles_sorted && !shouldCompute(timestep))
         return;
 
+#ifdef ENABLE_MPI
+    m_energy_sum_reduced = false;
+#endif
+
     computeForces(timestep);
     m_particles_sorted = false;
     }
@@ -153,6 +214,11 @@ void ForceCompute::compute(unsigned int timestep)
 double ForceCompute::benchmark(unsigned int num_iters)
     {
     ClockSource t;
+
+#ifdef ENABLE_MPI
+    m_energy_sum_reduced = false;
+#endif
+
     // warm up run
     computeForces(0);
 
@@ -77,6 +77,14 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         //! Total the potential energy
         Scalar calcEnergySum();
 
+#ifdef ENABLE_MPI
+        //! Appends the local potential energy sum for a batched reduction
+        virtual unsigned int beginLogReduction(std::vector<double>& buf);
+
+        //! Accepts the reduced potential energy sum
+        virtual void finishLogReduction(const double *buf);
+#endif
+
         //! Sum the potential energy of a group
         Scalar calcEnergyGroup(std::shared_ptr<ParticleGroup> group);
 
@@ -177,6 +185,15 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         Scalar m_external_virial[6]; //!< Stores external contribution to virial
         Scalar m_external_energy;    //!< Stores external contribution to potential energy
 
+#ifdef ENABLE_MPI
+        bool m_energy_sum_reduced;   //!< True when m_energy_sum holds the reduced sum of the current forces
+        double m_energy_sum;         //!< Potential energy sum reduced by the Logger
+        bool m_energy_sum_requested; //!< True when calcEnergySum() was called since the last beginLogReduction()
+#endif
+
+        //! Sums the potential energy of the local particles
+        double calcEnergySumLocal();
+
         //! Actually perform the computation of the forces
         /*! This is pure virtual here. Sub-classes must implement this function. It will be called by
             the base class compute() when the forces need to be computed.
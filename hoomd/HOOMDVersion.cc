@@ -39,6 +39,9 @@ std::string hoomd_compile_flags()
     #ifdef ENABLE_HPMC_MIXED_PRECISION
     o << "HPMC_MIXED ";
     #endif
+    #ifdef ENABLE_MD_MIXED_PRECISION
+    o << "MD_MIXED ";
+    #endif
     #endif
 
     #ifdef ENABLE_MPI
@@ -10,6 +10,8 @@
 
 #include "Integrator.h"
 
+#include <algorithm>
+
 namespace py = pybind11;
 
 #ifdef ENABLE_CUDA
@@ -25,7 +27,9 @@ using namespace std;
 /*! \param sysdef System to update
     \param deltaT Time step to use
 */
-Integrator::Integrator(std::shared_ptr<SystemDefinition> sysdef, Scalar deltaT) : Updater(sysdef), m_deltaT(deltaT)
+Integrator::Integrator(std::shared_ptr<SystemDefinition> sysdef, Scalar deltaT) : Updater(sysdef), m_deltaT(deltaT),
+    m_slow_period(1), m_last_slow_step(0), m_last_slow_period(1), m_last_slow_weight(0.0), m_slow_evaluated(false),
+    m_slow_restart(true)
     {
     if (m_deltaT <= 0.0)
         m_exec_conf->msg->warning() << "integrate.*: A timestep of less than 0.0 was specified" << endl;
@@ -60,6 +64,99 @@ void Integrator::addForceConstraint(std::shared_ptr<ForceConstraint> fc)
     fc->setDeltaT(m_deltaT);
     }
 
+/*! \param fc ForceCompute to evaluate only every getSlowForcePeriod() steps
+
+    \a fc must already have been added with addForceCompute().
+*/
+void Integrator::addSlowForceCompute(std::shared_ptr<ForceCompute> fc)
+    {
+    assert(fc);
+    if (std::find(m_forces.begin(), m_forces.end(), fc) == m_forces.end())
+        {
+        m_exec_conf->msg->error() << "integrate.*: A slow force must also be added to the integrator" << endl;
+        throw runtime_error("Error adding slow force");
+        }
+
+    if (! isSlowForce(fc))
+        m_slow_forces.push_back(fc);
+    }
+
+/*! \param period Number of steps between evaluations of the slow forces
+*/
+void Integrator::setSlowForcePeriod(unsigned int period)
+    {
+    if (period == 0)
+        {
+        m_exec_conf->msg->error() << "integrate.*: The slow force period must be at least 1" << endl;
+        throw runtime_error("Error setting slow force period");
+        }
+
+    m_slow_period = period;
+    }
+
+/*! \param fc ForceCompute to test
+    \returns true if \a fc was added with addSlowForceCompute()
+*/
+bool Integrator::isSlowForce(std::shared_ptr<ForceCompute> fc) const
+    {
+    return std::find(m_slow_forces.begin(), m_slow_forces.end(), fc) != m_slow_forces.end();
+    }
+
+/*! \param timestep Current time step
+    \returns true if the slow forces must be computed on \a timestep
+
+    Besides the slow steps, the slow forces are computed on every step where the potential energy or the virial is
+    requested, so that logged thermodynamic quantities include them.
+*/
+bool Integrator::needSlowForces(unsigned int timestep) const
+    {
+    if (isSlowStep(timestep))
+        return true;
+
+    PDataFlags flags = m_pdata->getFlags();
+    return flags[pdata_flag::potential_energy] || flags[pdata_flag::pressure_tensor]
+        || flags[pdata_flag::isotropic_virial];
+    }
+
+/*! \param timestep Current time step, must be a slow step
+    \returns The weight of the slow forces in the net force
+
+    The net force of a step is applied in the half kick at the end of the previous step and in the half kick at the
+    beginning of the step. With weight k, a slow step thus gives k/2 steps worth of impulse to each of the intervals
+    before and after it. When a run ends between two slow steps, the half kick at the end of the interval is missing,
+    and the first slow step of the next run, whose net force is only applied in the half kick at the beginning of the
+    run, makes up for it.
+
+    When the net force of the last slow step is computed again (prepRun() does so at the start of every run), the
+    weight of that step is kept. Only a change of the period since then is applied to the half kick that follows.
+*/
+Scalar Integrator::beginSlowStep(unsigned int timestep)
+    {
+    assert(isSlowStep(timestep));
+
+    Scalar weight = Scalar(m_slow_period);
+
+    if (m_slow_evaluated && timestep == m_last_slow_step)
+        {
+        // the half kick before this step has already been given with m_last_slow_weight
+        weight = m_last_slow_weight - Scalar(m_last_slow_period) + Scalar(m_slow_period);
+        }
+    else if (m_slow_restart && m_slow_evaluated && timestep > m_last_slow_step
+        && timestep - m_last_slow_step < m_last_slow_period)
+        {
+        // the steps since the last slow step received m_last_slow_period/2 instead of (timestep - m_last_slow_step)
+        weight = Scalar(2*(timestep - m_last_slow_step)) - Scalar(m_last_slow_period) + Scalar(m_slow_period);
+        }
+
+    m_last_slow_step = timestep;
+    m_last_slow_period = m_slow_period;
+    m_last_slow_weight = weight;
+    m_slow_evaluated = true;
+    m_slow_restart = false;
+
+    return weight;
+    }
+
 /*! \param hook HalfStepHook to set
 */
 void Integrator::setHalfStepHook(std::shared_ptr<HalfStepHook> hook)
@@ -74,6 +171,7 @@ void Integrator::setHalfStepHook(std::shared_ptr<HalfStepHook> hook)
 void Integrator::removeForceComputes()
     {
     m_forces.clear();
+    m_slow_forces.clear();
     m_constraint_forces.clear();
     }
 
@@ -309,9 +407,18 @@ Scalar Integrator::computeTotalMomentum(unsigned int timestep)
 */
 void Integrator::computeNetForce(unsigned int timestep)
     {
+    // slow forces only enter the net force on slow steps, but they are computed whenever the thermodynamics need them
+    const bool compute_slow = m_slow_forces.size() && needSlowForces(timestep);
+    const Scalar slow_weight = (m_slow_forces.size() && isSlowStep(timestep)) ? beginSlowStep(timestep) : Scalar(0.0);
+
     std::vector< std::shared_ptr<ForceCompute> >::iterator force_compute;
     for (force_compute = m_forces.begin(); force_compute != m_forces.end(); ++force_compute)
+        {
+        if (! compute_slow && isSlowForce(*force_compute))
+            continue;
+
         (*force_compute)->compute(timestep);
+        }
 
     if (m_prof)
         {
@@ -350,6 +457,15 @@ void Integrator::computeNetForce(unsigned int timestep)
 
         for (force_compute = m_forces.begin(); force_compute != m_forces.end(); ++force_compute)
             {
+            // slow forces are applied as an impulse that covers the steps around their evaluation
+            Scalar scale(1.0);
+            if (isSlowForce(*force_compute))
+                {
+                if (! compute_slow)
+                    continue;
+                scale = slow_weight;
+                }
+
             //phasing out ForceDataArrays
             //ForceDataArrays force_arrays = (*force_compute)->acquire();
             GPUArray<Scalar4>& h_force_array = (*force_compute)->getForceArray();
@@ -363,15 +479,15 @@ void Integrator::computeNetForce(unsigned int timestep)
             unsigned int virial_pitch = h_virial_array.getPitch();
             for (unsigned int j = 0; j < nparticles; j++)
                 {
-                h_net_force.data[j].x += h_force.data[j].x;
-                h_net_force.data[j].y += h_force.data[j].y;
-                h_net_force.data[j].z += h_force.data[j].z;
+                h_net_force.data[j].x += scale*h_force.data[j].x;
+                h_net_force.data[j].y += scale*h_force.data[j].y;
+                h_net_force.data[j].z += scale*h_force.data[j].z;
                 h_net_force.data[j].w += h_force.data[j].w;
 
-                h_net_torque.data[j].x += h_torque.data[j].x;
-                h_net_torque.data[j].y += h_torque.data[j].y;
-                h_net_torque.data[j].z += h_torque.data[j].z;
-                h_net_torque.data[j].w += h_torque.data[j].w;
+                h_net_torque.data[j].x += scale*h_torque.data[j].x;
+                h_net_torque.data[j].y += scale*h_torque.data[j].y;
+                h_net_torque.data[j].z += scale*h_torque.data[j].z;
+                h_net_torque.data[j].w += scale*h_torque.data[j].w;
 
                 for (unsigned int k = 0; k < 6; k++)
                     {
@@ -495,6 +611,12 @@ void Integrator::computeNetForceGPU(unsigned int timestep)
         throw runtime_error("Error computing accelerations");
         }
 
+    if (m_slow_forces.size() && m_slow_period > 1)
+        {
+        m_exec_conf->msg->error() << "integrate.*: Multiple time step integration is not supported on the GPU" << endl;
+        throw runtime_error("Error computing accelerations");
+        }
+
     // compute all the normal forces first
     std::vector< std::shared_ptr<ForceCompute> >::iterator force_compute;
 
@@ -847,10 +969,12 @@ void Integrator::update(unsigned int timestep)
     Specifically, updated net_force and net_virial in this call is a must for logged quantities to properly carry
     over in restarted jobs.
 
-    The base class does nothing, it is up to derived classes to implement the correct behavior.
+    The base class only restarts the slow force schedule, it is up to derived classes to implement the correct behavior.
 */
 void Integrator::prepRun(unsigned int timestep)
     {
+    // the slow forces are applied on the first step of every run
+    m_slow_restart = true;
     }
 
 #ifdef ENABLE_MPI
@@ -900,7 +1024,12 @@ void Integrator::computeCallback(unsigned int timestep)
     std::vector< std::shared_ptr<ForceCompute> >::iterator force_compute;
 
     for (force_compute = m_forces.begin(); force_compute != m_forces.end(); ++force_compute)
+        {
+        if (isSlowForce(*force_compute) && ! needSlowForces(timestep))
+            continue;
+
         (*force_compute)->preCompute(timestep);
+        }
     }
 #endif
 
@@ -927,6 +1056,9 @@ void export_Integrator(py::module& m)
     .def(py::init< std::shared_ptr<SystemDefinition>, Scalar >())
     .def("addForceCompute", &Integrator::addForceCompute)
     .def("addForceConstraint", &Integrator::addForceConstraint)
+    .def("addSlowForceCompute", &Integrator::addSlowForceCompute)
+    .def("setSlowForcePeriod", &Integrator::setSlowForcePeriod)
+    .def("getSlowForcePeriod", &Integrator::getSlowForcePeriod)
     .def("setHalfStepHook", &Integrator::setHalfStepHook)
     .def("removeForceComputes", &Integrator::removeForceComputes)
     .def("removeHalfStepHook", &Integrator::removeHalfStepHook)
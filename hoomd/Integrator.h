@@ -42,6 +42,14 @@
     for use with this integrator. They are added via calling
     addForceCompute(). Any number of forces can be added in this way.
 
+    Forces can additionally be marked as slow with addSlowForceCompute(). Slow forces are evaluated on the first step of
+    every run and then every k steps, where k is the slow force period, and enter the net force multiplied by k. Because
+    the net force is applied in two half kicks around each step, this is the impulse form of the r-RESPA multiple time
+    step method. When a run ends between two slow steps, the first slow step of the next run makes up for the missing
+    half kick, so that the total impulse of the slow forces is the same as with k = 1. On steps where the potential
+    energy or the virial is requested, the slow forces are also evaluated, but only their energies and virials enter
+    the net force and virial. The per-particle energies and virials of the slow forces are never scaled.
+
     All forces added via addForceCompute() are computed independantly and then totaled up to calculate the net force
     and enrgy on each particle. Constraint forces (ForceConstraint) are unique in that they need to be computed
     \b after the net forces is already available. To implement this behavior, call addForceConstraint() to add any
@@ -81,6 +89,18 @@ class PYBIND11_EXPORT Integrator : public Updater
         //! Add a ForceConstraint to the list
         virtual void addForceConstraint(std::shared_ptr<ForceConstraint> fc);
 
+        //! Evaluate a ForceCompute only on the outer steps of a multiple time step scheme
+        virtual void addSlowForceCompute(std::shared_ptr<ForceCompute> fc);
+
+        //! Set the number of steps between evaluations of the slow forces
+        void setSlowForcePeriod(unsigned int period);
+
+        //! Get the number of steps between evaluations of the slow forces
+        unsigned int getSlowForcePeriod()
+            {
+            return m_slow_period;
+            }
+
         //! Set HalfStepHook
         virtual void setHalfStepHook(std::shared_ptr<HalfStepHook> hook);
 
@@ -145,6 +165,14 @@ class PYBIND11_EXPORT Integrator : public Updater
 
         std::vector< std::shared_ptr<ForceConstraint> > m_constraint_forces;    //!< List of all the constraints
 
+        std::vector< std::shared_ptr<ForceCompute> > m_slow_forces; //!< Subset of m_forces evaluated every m_slow_period steps
+        unsigned int m_slow_period;                                 //!< Number of steps between slow force evaluations
+        unsigned int m_last_slow_step;      //!< Time step of the last slow force evaluation
+        unsigned int m_last_slow_period;    //!< Slow force period at the last slow force evaluation
+        Scalar m_last_slow_weight;          //!< Weight of the slow forces at the last slow force evaluation
+        bool m_slow_evaluated;              //!< True after the first slow force evaluation
+        bool m_slow_restart;                //!< True until the first slow force evaluation of a run
+
         std::shared_ptr<HalfStepHook> m_half_step_hook;    //!< The HalfStepHook, if active
 
 
@@ -154,6 +182,21 @@ class PYBIND11_EXPORT Integrator : public Updater
         //! helper function to compute net force/virial
         void computeNetForce(unsigned int timestep);
 
+        //! Test if a force is only evaluated on the outer steps
+        bool isSlowForce(std::shared_ptr<ForceCompute> fc) const;
+
+        //! Test if the slow forces are applied on the given step
+        bool isSlowStep(unsigned int timestep) const
+            {
+            return m_slow_restart || timestep <= m_last_slow_step || timestep - m_last_slow_step >= m_slow_period;
+            }
+
+        //! Test if the slow forces are needed on the given step, either for the force or for the thermodynamics
+        bool needSlowForces(unsigned int timestep) const;
+
+        //! Record a slow step and get the weight of the slow forces in the net force
+        Scalar beginSlowStep(unsigned int timestep);
+
 #ifdef ENABLE_CUDA
         //! helper function to compute net force/virial on the GPU
         void computeNetForceGPU(unsigned int timestep);
@@ -0,0 +1,247 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+/*! \file LogBinary.cc
+    \brief Defines the LogBinary class
+*/
+
+#include "LogBinary.h"
+#include "Filesystem.h"
+
+namespace py = pybind11;
+
+#include <stdexcept>
+#include <cstring>
+using namespace std;
+
+//! Magic string at the beginning of every binary log file
+static const char log_binary_magic[8] = {'H','O','O','M','D','L','O','G'};
+
+//! Version of the binary log file format
+static const uint32_t log_binary_version = 1;
+
+/*! \param sysdef Specified for Logger, but not used directly by LogBinary
+    \param fname File name to write the log to
+    \param buffer_rows Number of rows to buffer in memory before they are written to the file
+    \param overwrite Will overwrite an exiting file if true (default is to append)
+*/
+LogBinary::LogBinary(std::shared_ptr<SystemDefinition> sysdef,
+                     const std::string& fname,
+                     unsigned int buffer_rows,
+                     bool overwrite)
+    : Logger(sysdef), m_filename(fname), m_buffer_rows(buffer_rows), m_overwrite(overwrite), m_is_initialized(false)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing LogBinary: " << fname << " " << buffer_rows << " " << overwrite << endl;
+
+    if (m_buffer_rows == 0)
+        m_buffer_rows = 1;
+    }
+
+LogBinary::~LogBinary()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying LogBinary" << endl;
+
+    // write out what is left, errors have already been reported by flush()
+    try
+        {
+        flush();
+        }
+    catch (const std::exception&)
+        {
+        }
+    }
+
+/*! Opens the file and either writes a new header or verifies that the header of the existing file matches the
+    logged quantities. Must only be called on the root rank.
+*/
+void LogBinary::openOutputFile()
+    {
+    const uint32_t num_columns = m_columns.size();
+    const uint64_t row_bytes = uint64_t(num_columns) * sizeof(double);
+
+    if (filesystem::exists(m_filename) && !m_overwrite)
+        {
+        m_exec_conf->msg->notice(3) << "analyze.log_binary: Appending log to existing file \"" << m_filename << "\""
+                                    << endl;
+
+        ifstream in(m_filename.c_str(), ios_base::in | ios_base::binary);
+        char magic[8];
+        uint32_t version = 0, file_columns = 0;
+        uint64_t offset = 0;
+        in.read(magic, sizeof(magic));
+        in.read((char *)&version, sizeof(version));
+        in.read((char *)&file_columns, sizeof(file_columns));
+        in.read((char *)&offset, sizeof(offset));
+
+        if (!in.good() || memcmp(magic, log_binary_magic, sizeof(magic)) != 0 || version != log_binary_version)
+            {
+            m_exec_conf->msg->error() << "analyze.log_binary: " << m_filename << " is not a binary log file" << endl;
+            throw runtime_error("Error initializing LogBinary");
+            }
+
+        vector<string> columns(file_columns);
+        for (unsigned int i = 0; i < file_columns; i++)
+            getline(in, columns[i], '\0');
+
+        if (!in.good() || columns != m_columns)
+            {
+            m_exec_conf->msg->error() << "analyze.log_binary: The logged quantities do not match the columns of "
+                                      << m_filename << endl;
+            throw runtime_error("Error initializing LogBinary");
+            }
+
+        // continue after the last complete row, an incomplete row at the end is overwritten
+        in.seekg(0, ios_base::end);
+        uint64_t file_size = in.tellg();
+        uint64_t num_rows = (file_size > offset) ? (file_size - offset) / row_bytes : 0;
+        in.close();
+
+        m_file.open(m_filename.c_str(), ios_base::in | ios_base::out | ios_base::binary);
+        m_file.seekp(offset + num_rows * row_bytes);
+        }
+    else
+        {
+        m_exec_conf->msg->notice(3) << "analyze.log_binary: Creating new log in file \"" << m_filename << "\""
+                                    << endl;
+        m_file.open(m_filename.c_str(), ios_base::out | ios_base::trunc | ios_base::binary);
+
+        // column names, padded so that the rows are aligned to 8 bytes
+        string names;
+        for (unsigned int i = 0; i < num_columns; i++)
+            {
+            names += m_columns[i];
+            names.push_back('\0');
+            }
+        uint64_t offset = sizeof(log_binary_magic) + 2*sizeof(uint32_t) + sizeof(uint64_t) + names.size();
+        offset = (offset + 7) / 8 * 8;
+        names.resize(offset - sizeof(log_binary_magic) - 2*sizeof(uint32_t) - sizeof(uint64_t), '\0');
+
+        m_file.write(log_binary_magic, sizeof(log_binary_magic));
+        m_file.write((const char *)&log_binary_version, sizeof(log_binary_version));
+        m_file.write((const char *)&num_columns, sizeof(num_columns));
+        m_file.write((const char *)&offset, sizeof(offset));
+        m_file.write(names.data(), names.size());
+        m_file.flush();
+        }
+
+    if (!m_file.good())
+        {
+        m_exec_conf->msg->error() << "analyze.log_binary: Error opening log file " << m_filename << endl;
+        throw runtime_error("Error initializing LogBinary");
+        }
+    }
+
+/*! \param quantities A list of quantities to log
+
+    The columns of a binary log are fixed once the file is opened. Later calls must pass the same list.
+*/
+void LogBinary::setLoggedQuantities(const std::vector< std::string >& quantities)
+    {
+    vector<string> columns(1, "timestep");
+    columns.insert(columns.end(), quantities.begin(), quantities.end());
+
+    if (m_is_initialized && columns != m_columns)
+        {
+        m_exec_conf->msg->error() << "analyze.log_binary: The logged quantities cannot be changed after the file is "
+                                  << "created" << endl;
+        throw runtime_error("Error setting logged quantities");
+        }
+
+    Logger::setLoggedQuantities(quantities);
+    m_columns = columns;
+
+    if (quantities.size() == 0)
+        m_exec_conf->msg->warning() << "analyze.log_binary: No quantities specified for logging" << endl;
+
+    if (!m_is_initialized)
+        {
+        // only output to file on root processor
+        if (m_exec_conf->isRoot())
+            {
+            openOutputFile();
+            m_buffer.reserve(m_buffer_rows * m_columns.size());
+            }
+        m_is_initialized = true;
+        }
+    }
+
+/*! \param timestep Time step to write out data for
+
+    Appends a row to the buffer and starts writing the buffer out once it holds the requested number of rows.
+*/
+void LogBinary::analyze(unsigned int timestep)
+    {
+    // call the base class to cache all values, this is collective over all ranks
+    Logger::analyze(timestep);
+
+    // only output to file on root processor
+    if (!m_is_initialized || !m_exec_conf->isRoot())
+        return;
+
+    if (m_prof) m_prof->push("LogBinary");
+
+    m_buffer.push_back(double(timestep));
+    for (unsigned int i = 0; i < m_logged_quantities.size(); i++)
+        m_buffer.push_back(double(m_cached_quantities[i]));
+
+    if (m_buffer.size() >= size_t(m_buffer_rows) * m_columns.size())
+        startWrite();
+
+    if (m_prof) m_prof->pop();
+    }
+
+/*! The rows are in the file when flush() returns.
+*/
+void LogBinary::flush()
+    {
+    if (!m_is_initialized || !m_exec_conf->isRoot())
+        return;
+
+    if (m_buffer.size() > 0)
+        startWrite();
+    waitForWrite();
+    }
+
+/*! Waits for the previous block, then hands the buffer to a background thread. Only one block is written at a
+    time, so rows reach the file in order.
+*/
+void LogBinary::startWrite()
+    {
+    waitForWrite();
+
+    m_write_buffer.swap(m_buffer);
+    m_buffer.clear();
+
+    m_write_result = std::async(std::launch::async, [this]
+        {
+        m_file.write((const char *)m_write_buffer.data(), m_write_buffer.size() * sizeof(double));
+        m_file.flush();
+
+        if (!m_file.good())
+            throw runtime_error("Error writing log file");
+        });
+    }
+
+void LogBinary::waitForWrite()
+    {
+    if (!m_write_result.valid())
+        return;
+
+    try
+        {
+        m_write_result.get();
+        }
+    catch (const std::exception&)
+        {
+        m_exec_conf->msg->error() << "analyze.log_binary: I/O error while writing log file " << m_filename << endl;
+        throw;
+        }
+    }
+
+void export_LogBinary(py::module& m)
+    {
+    py::class_<LogBinary, std::shared_ptr<LogBinary> >(m,"LogBinary", py::base<Logger>())
+    .def(py::init< std::shared_ptr<SystemDefinition>, const std::string&, unsigned int, bool >())
+    .def("flush", &LogBinary::flush)
+    ;
+    }
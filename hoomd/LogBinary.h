@@ -0,0 +1,87 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+/*! \file LogBinary.h
+    \brief Declares the LogBinary class
+*/
+
+#ifdef NVCC
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "Logger.h"
+
+#include <future>
+
+#ifndef __LOGBINARY_H__
+#define __LOGBINARY_H__
+
+//! Logs registered quantities to a binary columnar file
+/*! LogBinary writes one row per call to analyze(): the timestep followed by every logged quantity, each stored as
+    an 8 byte double in native byte order. Rows are collected in a memory buffer. When the buffer is full, it is
+    handed to a background thread that writes it to the file while the simulation continues, so that analyze()
+    only waits on the file system when the previous block is still being written.
+
+    File layout:
+     - 8 byte magic string "HOOMDLOG"
+     - uint32 format version
+     - uint32 number of columns, including the timestep
+     - uint64 byte offset of the first row, a multiple of 8
+     - the null terminated column names, zero padded up to the first row
+     - rows of (number of columns) doubles
+
+    Readers can memory map the rows directly without parsing (see hoomd.analyze.read_log_binary). An incomplete
+    row at the end of the file is ignored.
+
+    The columns are fixed when the file is created. Appending to an existing file requires the same list of
+    logged quantities.
+
+    \ingroup analyzers
+*/
+class LogBinary : public Logger
+    {
+    public:
+        //! Constructs a logger
+        LogBinary(std::shared_ptr<SystemDefinition> sysdef,
+                  const std::string& fname,
+                  unsigned int buffer_rows,
+                  bool overwrite=false);
+
+        //! Destructor
+        ~LogBinary();
+
+        //! Selects which quantities to log
+        virtual void setLoggedQuantities(const std::vector< std::string >& quantities);
+
+        //! Buffer the data for the current timestep
+        void analyze(unsigned int timestep);
+
+        //! Write all buffered rows to the file and wait until they are written
+        void flush();
+
+    private:
+        std::string m_filename;                     //!< The output file name
+        unsigned int m_buffer_rows;                 //!< Number of rows to buffer before writing
+        bool m_overwrite;                           //!< True if an existing file is overwritten
+        std::ofstream m_file;                       //!< The file we write out to
+        bool m_is_initialized;                      //!< True once the file has been opened
+        std::vector< std::string > m_columns;       //!< Names of the columns in the file
+
+        std::vector<double> m_buffer;               //!< Rows collected since the last write
+        std::vector<double> m_write_buffer;         //!< Rows being written by the background thread
+        std::future<void> m_write_result;           //!< Result of the background write
+
+        //! Open the file and write or verify the header
+        void openOutputFile();
+
+        //! Start writing the buffered rows in the background
+        void startWrite();
+
+        //! Wait for the background write to complete
+        void waitForWrite();
+    };
+
+//! Exports the LogBinary class to python
+void export_LogBinary(pybind11::module& m);
+
+#endif
@@ -0,0 +1,275 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+/*! \file LogCorrelator.cc
+    \brief Defines the LogCorrelator class
+*/
+
+#include "LogCorrelator.h"
+
+namespace py = pybind11;
+
+#include <stdexcept>
+using namespace std;
+
+/*! \param sysdef System definition
+    \param num_points Number of points per correlator level
+    \param averaging Number of samples averaged when passing on to the next correlator level
+    \param num_levels Number of correlator and blocking levels
+*/
+LogCorrelator::LogCorrelator(std::shared_ptr<SystemDefinition> sysdef,
+                             unsigned int num_points,
+                             unsigned int averaging,
+                             unsigned int num_levels)
+    : Logger(sysdef), m_num_points(num_points), m_averaging(averaging), m_num_levels(num_levels)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing LogCorrelator: " << num_points << " " << averaging << " "
+                                << num_levels << endl;
+    }
+
+LogCorrelator::~LogCorrelator()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying LogCorrelator" << endl;
+    }
+
+/*! \param quantities A list of quantities to correlate
+
+    Accumulated data of quantities that remain in the list is kept.
+*/
+void LogCorrelator::setLoggedQuantities(const std::vector< std::string >& quantities)
+    {
+    std::vector<MultipleTauCorrelator> correlators;
+    std::vector<BlockAverage> block_averages;
+
+    for (unsigned int i = 0; i < quantities.size(); i++)
+        {
+        std::vector<std::string>::iterator it = std::find(m_logged_quantities.begin(), m_logged_quantities.end(),
+                                                          quantities[i]);
+        if (it != m_logged_quantities.end())
+            {
+            unsigned int j = it - m_logged_quantities.begin();
+            correlators.push_back(m_correlators[j]);
+            block_averages.push_back(m_block_averages[j]);
+            }
+        else
+            {
+            correlators.push_back(MultipleTauCorrelator(1, m_num_points, m_averaging, m_num_levels));
+            block_averages.push_back(BlockAverage(m_num_levels));
+            }
+        }
+
+    Logger::setLoggedQuantities(quantities);
+    m_correlators.swap(correlators);
+    m_block_averages.swap(block_averages);
+    }
+
+/*! \param quantity Either "velocity" or "msd"
+    \param group Group of particles to correlate
+*/
+void LogCorrelator::addParticleCorrelation(const std::string& quantity, std::shared_ptr<ParticleGroup> group)
+    {
+    MultipleTauCorrelator::Mode mode;
+    if (quantity == "velocity")
+        mode = MultipleTauCorrelator::product;
+    else if (quantity == "msd")
+        mode = MultipleTauCorrelator::squared_difference;
+    else
+        {
+        m_exec_conf->msg->error() << "analyze.correlator: " << quantity << " is not a valid particle quantity"
+                                  << endl;
+        throw runtime_error("Error adding particle correlation");
+        }
+
+    #ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        m_exec_conf->msg->error() << "analyze.correlator: Particle correlations are not supported with domain "
+                                  << "decomposition" << endl;
+        throw runtime_error("Error adding particle correlation");
+        }
+    #endif
+
+    unsigned int num_members = group->getNumMembersGlobal();
+    ParticleCorrelation corr(quantity, group,
+                             MultipleTauCorrelator(3*num_members, m_num_points, m_averaging, m_num_levels, mode));
+    corr.tags.resize(num_members);
+    for (unsigned int i = 0; i < num_members; i++)
+        corr.tags[i] = group->getMemberTag(i);
+
+    m_particle_correlations.push_back(corr);
+    }
+
+/*! \param timestep Current time step
+*/
+void LogCorrelator::analyze(unsigned int timestep)
+    {
+    // evaluate the logged quantities
+    Logger::analyze(timestep);
+
+    if (m_prof) m_prof->push("Correlator");
+
+    for (unsigned int i = 0; i < m_logged_quantities.size(); i++)
+        {
+        double value = m_cached_quantities[i];
+        m_correlators[i].add(&value);
+        m_block_averages[i].add(value);
+        }
+
+    if (m_particle_correlations.size() > 0)
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+        const BoxDim& box = m_pdata->getGlobalBox();
+
+        for (unsigned int i = 0; i < m_particle_correlations.size(); i++)
+            {
+            ParticleCorrelation& corr = m_particle_correlations[i];
+            bool velocity = (corr.quantity == "velocity");
+
+            m_sample.resize(3*corr.tags.size());
+            for (unsigned int j = 0; j < corr.tags.size(); j++)
+                {
+                // particles may have been removed since the group was added
+                unsigned int tag = corr.tags[j];
+                unsigned int idx = (tag < m_pdata->getRTags().size()) ? h_rtag.data[tag] : NOT_LOCAL;
+                if (idx >= m_pdata->getN())
+                    {
+                    m_exec_conf->msg->error() << "analyze.correlator: Particle " << tag << " of the " << corr.quantity
+                                              << " correlation no longer exists" << endl;
+                    throw runtime_error("Error computing particle correlation");
+                    }
+
+                Scalar3 v;
+                if (velocity)
+                    {
+                    v = make_scalar3(h_vel.data[idx].x, h_vel.data[idx].y, h_vel.data[idx].z);
+                    }
+                else
+                    {
+                    Scalar4 postype = h_pos.data[idx];
+                    v = box.shift(make_scalar3(postype.x, postype.y, postype.z), h_image.data[idx]);
+                    }
+
+                m_sample[3*j] = v.x;
+                m_sample[3*j+1] = v.y;
+                m_sample[3*j+2] = v.z;
+                }
+
+            corr.correlator.add(&m_sample.front());
+            }
+        }
+
+    if (m_prof) m_prof->pop();
+    }
+
+void LogCorrelator::reset()
+    {
+    for (unsigned int i = 0; i < m_correlators.size(); i++)
+        {
+        m_correlators[i].reset();
+        m_block_averages[i].reset();
+        }
+
+    for (unsigned int i = 0; i < m_particle_correlations.size(); i++)
+        m_particle_correlations[i].correlator.reset();
+    }
+
+/*! \param quantity Name of a logged quantity
+    \returns Index of the quantity in m_logged_quantities
+*/
+unsigned int LogCorrelator::findQuantity(const std::string& quantity)
+    {
+    for (unsigned int i = 0; i < m_logged_quantities.size(); i++)
+        {
+        if (m_logged_quantities[i] == quantity)
+            return i;
+        }
+
+    m_exec_conf->msg->error() << "analyze.correlator: " << quantity << " is not correlated" << endl;
+    throw runtime_error("Error getting correlation");
+    }
+
+/*! \param quantity Name of a logged quantity or particle correlation
+    \param scale Factor to multiply the channel averaged correlation with (output)
+
+    Per-particle correlations are averaged over the three components, \a scale converts them to per-particle values.
+*/
+const MultipleTauCorrelator& LogCorrelator::findCorrelator(const std::string& quantity, double& scale)
+    {
+    for (unsigned int i = 0; i < m_particle_correlations.size(); i++)
+        {
+        if (m_particle_correlations[i].quantity == quantity)
+            {
+            scale = 3.0;
+            return m_particle_correlations[i].correlator;
+            }
+        }
+
+    scale = 1.0;
+    return m_correlators[findQuantity(quantity)];
+    }
+
+/*! \param quantity Name of a logged quantity or particle correlation
+    \returns Lag times in units of the sampling interval
+*/
+py::array_t<double> LogCorrelator::getLags(const std::string& quantity)
+    {
+    double scale;
+    std::vector<double> lags, values;
+    findCorrelator(quantity, scale).getResult(lags, values);
+
+    py::array_t<double> result(lags.size());
+    std::copy(lags.begin(), lags.end(), result.mutable_data());
+    return result;
+    }
+
+/*! \param quantity Name of a logged quantity or particle correlation
+    \returns Correlation function at the lag times returned by getLags()
+*/
+py::array_t<double> LogCorrelator::getCorrelation(const std::string& quantity)
+    {
+    double scale;
+    std::vector<double> lags, values;
+    findCorrelator(quantity, scale).getResult(lags, values);
+
+    py::array_t<double> result(values.size());
+    double *data = result.mutable_data();
+    for (unsigned int i = 0; i < values.size(); i++)
+        data[i] = scale*values[i];
+    return result;
+    }
+
+/*! \param quantity Name of a logged quantity
+*/
+double LogCorrelator::getMean(const std::string& quantity)
+    {
+    return m_block_averages[findQuantity(quantity)].getMean();
+    }
+
+/*! \param quantity Name of a logged quantity
+    \returns Standard error of the mean estimated with blocks of 2^k samples, k = 0, 1, ...
+*/
+py::array_t<double> LogCorrelator::getBlockErrors(const std::string& quantity)
+    {
+    std::vector<double> errors;
+    m_block_averages[findQuantity(quantity)].getErrors(errors);
+
+    py::array_t<double> result(errors.size());
+    std::copy(errors.begin(), errors.end(), result.mutable_data());
+    return result;
+    }
+
+void export_LogCorrelator(py::module& m)
+    {
+    py::class_<LogCorrelator, std::shared_ptr<LogCorrelator> >(m,"LogCorrelator", py::base<Logger>())
+    .def(py::init< std::shared_ptr<SystemDefinition>, unsigned int, unsigned int, unsigned int >())
+    .def("addParticleCorrelation", &LogCorrelator::addParticleCorrelation)
+    .def("reset", &LogCorrelator::reset)
+    .def("getLags", &LogCorrelator::getLags)
+    .def("getCorrelation", &LogCorrelator::getCorrelation)
+    .def("getMean", &LogCorrelator::getMean)
+    .def("getBlockErrors", &LogCorrelator::getBlockErrors)
+    ;
+    }
@@ -0,0 +1,111 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+/*! \file LogCorrelator.h
+    \brief Declares the LogCorrelator class
+*/
+
+#ifdef NVCC
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "Logger.h"
+#include "MultipleTauCorrelator.h"
+#include "ParticleGroup.h"
+
+#include <hoomd/extern/pybind/include/pybind11/numpy.h>
+
+#ifndef __LOGCORRELATOR_H__
+#define __LOGCORRELATOR_H__
+
+//! Computes time correlation functions and block averages of logged quantities during the simulation
+/*! LogCorrelator evaluates the logged quantities like Logger. Instead of writing them out, each value is fed to a
+    MultipleTauCorrelator, which accumulates its autocorrelation function, and to a BlockAverage, which accumulates
+    its mean and error estimates. Memory use grows only logarithmically with the length of the run.
+
+    In addition, per-particle correlations can be accumulated for the members of a group:
+     - \c velocity: velocity autocorrelation function <v(0).v(t)>
+     - \c msd: mean squared displacement <|r(t)-r(0)|^2> of the unwrapped positions
+
+    The per-particle correlations store a history for every member and are only available when the simulation is
+    not domain decomposed.
+
+    Lag times are reported in units of the sampling interval. Results accumulate across runs until reset() is
+    called.
+
+    \ingroup analyzers
+*/
+class LogCorrelator : public Logger
+    {
+    public:
+        //! Constructs the correlator
+        LogCorrelator(std::shared_ptr<SystemDefinition> sysdef,
+                      unsigned int num_points,
+                      unsigned int averaging,
+                      unsigned int num_levels);
+
+        //! Destructor
+        ~LogCorrelator();
+
+        //! Selects which quantities to correlate
+        virtual void setLoggedQuantities(const std::vector< std::string >& quantities);
+
+        //! Accumulate a per-particle correlation function
+        void addParticleCorrelation(const std::string& quantity, std::shared_ptr<ParticleGroup> group);
+
+        //! Sample the quantities at the current timestep
+        virtual void analyze(unsigned int timestep);
+
+        //! Discard all accumulated samples
+        void reset();
+
+        //! Get the lag times of a correlation function
+        pybind11::array_t<double> getLags(const std::string& quantity);
+
+        //! Get the values of a correlation function
+        pybind11::array_t<double> getCorrelation(const std::string& quantity);
+
+        //! Get the mean of a logged quantity
+        double getMean(const std::string& quantity);
+
+        //! Get the blocking error estimates of the mean of a logged quantity
+        pybind11::array_t<double> getBlockErrors(const std::string& quantity);
+
+    private:
+        unsigned int m_num_points;      //!< Number of points per correlator level
+        unsigned int m_averaging;       //!< Averaging factor between correlator levels
+        unsigned int m_num_levels;      //!< Number of correlator and blocking levels
+
+        std::vector<MultipleTauCorrelator> m_correlators;   //!< Correlator for each logged quantity
+        std::vector<BlockAverage> m_block_averages;         //!< Block average for each logged quantity
+
+        //! Per-particle correlation
+        struct ParticleCorrelation
+            {
+            std::string quantity;                       //!< Name of the correlated quantity
+            std::shared_ptr<ParticleGroup> group;       //!< Group of particles to correlate
+            std::vector<unsigned int> tags;             //!< Tags of the group members, fixes the channel order
+            MultipleTauCorrelator correlator;           //!< Correlator for all members
+
+            //! Constructor
+            ParticleCorrelation(const std::string& _quantity,
+                                std::shared_ptr<ParticleGroup> _group,
+                                const MultipleTauCorrelator& _correlator)
+                : quantity(_quantity), group(_group), correlator(_correlator)
+                {
+                }
+            };
+        std::vector<ParticleCorrelation> m_particle_correlations;   //!< Per-particle correlations
+        std::vector<double> m_sample;                               //!< Per-particle sample buffer
+
+        //! Find a correlator by quantity name
+        const MultipleTauCorrelator& findCorrelator(const std::string& quantity, double& scale);
+
+        //! Find the index of a logged quantity
+        unsigned int findQuantity(const std::string& quantity);
+    };
+
+//! Exports the LogCorrelator class to python
+void export_LogCorrelator(pybind11::module& m);
+
+#endif
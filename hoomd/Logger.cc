@@ -19,12 +19,13 @@ namespace py = pybind11;
 
 #include <stdexcept>
 #include <iomanip>
+#include <algorithm>
 using namespace std;
 
 /*! \param sysdef Specified for Analyzer, but not used directly by Logger
 */
 Logger::Logger(std::shared_ptr<SystemDefinition> sysdef)
-    : Analyzer(sysdef)
+    : Analyzer(sysdef), m_sources_dirty(true)
     {
     m_exec_conf->msg->notice(5) << "Constructing Logger: " << endl;
     }
@@ -56,6 +57,7 @@ void Logger::registerCompute(std::shared_ptr<Compute> compute)
         m_compute_quantities[provided_quantities[i]] = compute;
         m_exec_conf->msg->notice(6) << "analyze.log: Registering log quantity " << provided_quantities[i] << endl;
         }
+    m_sources_dirty = true;
     }
 
 /*! \param updater The Updater to register
@@ -79,6 +81,7 @@ void Logger::registerUpdater(std::shared_ptr<Updater> updater)
                  " has been registered more than once. Only the most recent registration takes effect" << endl;
         m_updater_quantities[provided_quantities[i]] = updater;
         }
+    m_sources_dirty = true;
     }
 
 /*! \param name Name of the quantity
@@ -97,6 +100,7 @@ void Logger::registerCallback(std::string name, py::object callback)
     m_exec_conf->msg->warning() << "analyze.log: The log quantity " << name <<
                          " has been registered more than once. Only the most recent registration takes effect" << endl;
     m_callback_quantities[name] = callback;
+    m_sources_dirty = true;
     }
 
 /*! After calling removeAll(), no quantities are registered for logging
@@ -108,6 +112,7 @@ void Logger::removeAll()
     //The callbacks are intentionally not cleared, because before each
     //run all compute and updaters should be cleared, but the python
     //callbacks should not be cleared for this.
+    m_sources_dirty = true;
     }
 
 /*! \param quantities A list of quantities to log
@@ -122,6 +127,99 @@ void Logger::setLoggedQuantities(const std::vector< std::string >& quantities)
     // prepare or adjust storage for caching the logger properties.
     m_cached_timestep = -1;
     m_cached_quantities.resize(quantities.size());
+    m_sources_dirty = true;
+    }
+
+/*! Looks up the source of every logged quantity and resolves it to an integer handle where possible, so that
+    updateCache() performs no string lookups.
+*/
+void Logger::resolveLoggedQuantities()
+    {
+    m_log_sources.resize(m_logged_quantities.size());
+    m_log_computes.clear();
+
+    for (unsigned int i = 0; i < m_logged_quantities.size(); i++)
+        {
+        const std::string& quantity = m_logged_quantities[i];
+        LogSource source;
+        source.handle = -1;
+
+        if (quantity == "time")
+            {
+            source.kind = LogSource::time;
+            }
+        else if (m_compute_quantities.count(quantity))
+            {
+            source.kind = LogSource::compute;
+            source.compute_src = m_compute_quantities[quantity];
+            source.handle = source.compute_src->getLogHandle(quantity);
+
+            if (std::find(m_log_computes.begin(), m_log_computes.end(), source.compute_src) == m_log_computes.end())
+                m_log_computes.push_back(source.compute_src);
+            }
+        else if (m_updater_quantities.count(quantity))
+            {
+            source.kind = LogSource::updater;
+            source.updater_src = m_updater_quantities[quantity];
+            source.handle = source.updater_src->getLogHandle(quantity);
+            }
+        else if (m_callback_quantities.count(quantity))
+            {
+            source.kind = LogSource::callback;
+            source.callback_src = m_callback_quantities[quantity];
+            }
+        else
+            {
+            source.kind = LogSource::unknown;
+            }
+
+        m_log_sources[i] = source;
+        }
+
+    m_sources_dirty = false;
+    }
+
+/*! \param timestep Time step to evaluate the logged quantities at
+
+    All logged computes are updated first. In MPI simulations, the partial sums of all computes are then reduced
+    with a single MPI_Allreduce before the values are requested.
+*/
+void Logger::updateCache(unsigned int timestep)
+    {
+    if (m_sources_dirty)
+        resolveLoggedQuantities();
+
+    // update the computes
+    for (unsigned int i = 0; i < m_log_computes.size(); i++)
+        m_log_computes[i]->compute(timestep);
+
+    #ifdef ENABLE_MPI
+    // gather all outstanding reductions
+    m_reduction_buf.clear();
+    m_reduction_count.resize(m_log_computes.size());
+    for (unsigned int i = 0; i < m_log_computes.size(); i++)
+        m_reduction_count[i] = m_log_computes[i]->beginLogReduction(m_reduction_buf);
+
+    // every rank logs the same quantities, so either all or none of the ranks get here
+    if (m_reduction_buf.size() > 0)
+        {
+        MPI_Allreduce(MPI_IN_PLACE, &m_reduction_buf.front(), m_reduction_buf.size(), MPI_DOUBLE, MPI_SUM,
+            m_exec_conf->getMPICommunicator());
+
+        unsigned int offset = 0;
+        for (unsigned int i = 0; i < m_log_computes.size(); i++)
+            {
+            if (m_reduction_count[i] > 0)
+                m_log_computes[i]->finishLogReduction(&m_reduction_buf[offset]);
+            offset += m_reduction_count[i];
+            }
+        }
+    #endif
+
+    for (unsigned int i = 0; i < m_logged_quantities.size(); i++)
+        m_cached_quantities[i] = getValue(m_log_sources[i], m_logged_quantities[i], timestep);
+
+    m_cached_timestep = timestep;
     }
 
 /*! \param timestep Time step to write out data for
@@ -134,10 +232,7 @@ void Logger::analyze(unsigned int timestep)
     if (m_prof) m_prof->push("Log");
 
     // update info in cache for later use and for immediate output.
-    for (unsigned int i = 0; i < m_logged_quantities.size(); i++)
-        m_cached_quantities[i] = getValue(m_logged_quantities[i], timestep);
-
-    m_cached_timestep = timestep;
+    updateCache(timestep);
 
     if (m_prof) m_prof->pop();
     }
@@ -148,11 +243,7 @@ Scalar Logger::getQuantity(const std::string &quantity, unsigned int timestep, b
     {
     // update info in cache for later use
     if (!use_cache && timestep != m_cached_timestep)
-        {
-        for (unsigned int i = 0; i < m_logged_quantities.size(); i++)
-            m_cached_quantities[i] = getValue(m_logged_quantities[i], timestep);
-        m_cached_timestep = timestep;
-        }
+        updateCache(timestep);
 
     // first see if it is the timestep number
     if (quantity == "timestep")
@@ -169,49 +260,40 @@ Scalar Logger::getQuantity(const std::string &quantity, unsigned int timestep, b
     return Scalar(0.0);
     }
 
-/*! \param quantity Quantity to get
+/*! \param source Resolved source of the quantity
+    \param quantity Quantity to get
     \param timestep Time step to compute value for (needed for Compute classes)
 */
-Scalar Logger::getValue(const std::string &quantity, int timestep)
+Scalar Logger::getValue(const LogSource& source, const std::string &quantity, unsigned int timestep)
     {
-    // first see if it is the built-in time quantity
-    if (quantity == "time")
+    switch (source.kind)
         {
-        return Scalar(double(m_clk.getTime())/1e9);
-        }
-    // check to see if the quantity exists in the compute list
-    else if (m_compute_quantities.count(quantity))
-        {
-        // update the compute
-        m_compute_quantities[quantity]->compute(timestep);
-        // get the log value
-        return m_compute_quantities[quantity]->getLogValue(quantity, timestep);
-        }
-    // check to see if the quantity exists in the updaters list
-    else if (m_updater_quantities.count(quantity))
-        {
-        // get the log value
-        return m_updater_quantities[quantity]->getLogValue(quantity, timestep);
-        }
-    else if (m_callback_quantities.count(quantity))
-        {
-        // get a quantity from a callback
-        try
-            {
-            py::object rv = m_callback_quantities[quantity](timestep);
-            Scalar extracted_rv = rv.cast<Scalar>();
-            return extracted_rv;
-            }
-        catch (const py::cast_error&)
-            {
+        case LogSource::time:
+            return Scalar(double(m_clk.getTime())/1e9);
+        case LogSource::compute:
+            if (source.handle >= 0)
+                return source.compute_src->getLogValueByHandle(source.handle, timestep);
+            return source.compute_src->getLogValue(quantity, timestep);
+        case LogSource::updater:
+            if (source.handle >= 0)
+                return source.updater_src->getLogValueByHandle(source.handle, timestep);
+            return source.updater_src->getLogValue(quantity, timestep);
+        case LogSource::callback:
+            // get a quantity from a callback
+            try
+                {
+                py::object rv = source.callback_src(timestep);
+                Scalar extracted_rv = rv.cast<Scalar>();
+                return extracted_rv;
+                }
+            catch (const py::cast_error&)
+                {
                 m_exec_conf->msg->warning() << "analyze.log: Log callback " << quantity << " returned invalid value, logging 0." << endl;
                 return Scalar(0.0);
-            }
-        }
-    else
-        {
-        m_exec_conf->msg->warning() << "analyze.log: Log quantity " << quantity << " is not registered, logging a value of 0" << endl;
-        return Scalar(0.0);
+                }
+        default:
+            m_exec_conf->msg->warning() << "analyze.log: Log quantity " << quantity << " is not registered, logging a value of 0" << endl;
+            return Scalar(0.0);
         }
     }
 
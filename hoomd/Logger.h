@@ -43,6 +43,12 @@
     The removeAll method can be used to clear all registered computes and updaters. hoomd_script will
     removeAll() and re-register all active computes and updaters before every run()
 
+    Logged quantities are resolved to their source (and, where the source supports it, to an integer handle via
+    getLogHandle()) once, the first time they are needed after the registrations or the logged quantities change.
+    Each analyze() then brings every logged compute up to date, gathers all partial sums that still need to be
+    summed over MPI ranks (see Compute::beginLogReduction()) into a single MPI_Allreduce, and only then
+    evaluates the individual quantities.
+
     \ingroup analyzers
 */
 class __attribute__ ((visibility ("hidden"))) Logger : public Analyzer
@@ -107,9 +113,44 @@ class __attribute__ ((visibility ("hidden"))) Logger : public Analyzer
         //! The values of the logged quantities at the last logger update.
         std::vector< Scalar > m_cached_quantities;
 
+        //! Evaluates all logged quantities and stores them in m_cached_quantities
+        void updateCache(unsigned int timestep);
+
     private:
+        //! Source of a logged quantity, resolved once by resolveLoggedQuantities()
+        struct LogSource
+            {
+            //! Kinds of log quantity sources
+            enum Kind
+                {
+                time,           //!< The built-in wall clock time
+                compute,        //!< A registered Compute
+                updater,        //!< A registered Updater
+                callback,       //!< A python callback
+                unknown         //!< The quantity is not registered
+                };
+
+            Kind kind;                                  //!< Kind of the source
+            std::shared_ptr<Compute> compute_src;       //!< Compute providing the quantity
+            std::shared_ptr<Updater> updater_src;       //!< Updater providing the quantity
+            pybind11::object callback_src;              //!< Callback providing the quantity
+            int handle;                                 //!< Handle from getLogHandle(), -1 to request by name
+            };
+
+        std::vector<LogSource> m_log_sources;           //!< Resolved source of each logged quantity
+        std::vector< std::shared_ptr<Compute> > m_log_computes; //!< Unique computes among the logged sources
+        bool m_sources_dirty;                           //!< True when m_log_sources must be resolved again
+
+        #ifdef ENABLE_MPI
+        std::vector<double> m_reduction_buf;            //!< Partial sums to reduce over MPI ranks
+        std::vector<unsigned int> m_reduction_count;    //!< Number of values appended by each compute
+        #endif
+
+        //! Resolves the source of every logged quantity
+        void resolveLoggedQuantities();
+
         //! Helper function to get a value for a given quantity
-        Scalar getValue(const std::string &quantity, int timestep);
+        Scalar getValue(const LogSource& source, const std::string &quantity, unsigned int timestep);
     };
 
 //! exports the Logger class to python
@@ -0,0 +1,281 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+/*! \file MultipleTauCorrelator.h
+    \brief Declares the MultipleTauCorrelator and BlockAverage classes
+*/
+
+#ifndef __MULTIPLE_TAU_CORRELATOR_H__
+#define __MULTIPLE_TAU_CORRELATOR_H__
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+//! Computes time correlation functions on the fly with the multiple-tau scheme
+/*! The correlator follows Ramirez et al., J. Chem. Phys. 133, 154103 (2010). Level 0 keeps the last \a p samples
+    and correlates the newest with each of them. Every \a m samples of a level are averaged and passed on to the
+    next level, which therefore resolves lag times that are \a m times longer with \a m times coarser resolution.
+    With L levels, lags up to p*m^(L-1) samples are covered with O(p*L) memory per channel.
+
+    Each sample consists of \a num_channels values. The correlation is averaged over all channels, e.g. over the
+    3N velocity components of N particles. Two operations are supported: the product a(t)*a(t+tau) for
+    autocorrelation functions, and the squared difference (a(t+tau)-a(t))^2 for mean squared displacements. On the
+    levels above 0, the squared difference is evaluated with block averaged values and is an approximation.
+
+    \ingroup analyzers
+*/
+class MultipleTauCorrelator
+    {
+    public:
+        //! Operation applied to pairs of samples
+        enum Mode
+            {
+            product,            //!< a(t) * a(t+tau)
+            squared_difference  //!< (a(t+tau) - a(t))^2
+            };
+
+        //! Constructor
+        /*! \param num_channels Number of values in each sample
+            \param num_points Number of points per level (p)
+            \param averaging Number of samples averaged when passing to the next level (m)
+            \param num_levels Number of levels (L)
+            \param mode Operation applied to pairs of samples
+        */
+        MultipleTauCorrelator(unsigned int num_channels,
+                              unsigned int num_points,
+                              unsigned int averaging,
+                              unsigned int num_levels,
+                              Mode mode=product)
+            : m_num_channels(num_channels), m_p(num_points), m_m(averaging), m_num_levels(num_levels), m_mode(mode)
+            {
+            // p must be a multiple of m so that the levels do not overlap
+            m_m = std::max(m_m, 2u);
+            m_p = std::max(m_p, m_m);
+            m_p = m_p / m_m * m_m;
+
+            m_shift.resize(m_num_levels*m_p*m_num_channels);
+            m_accum.resize(m_num_levels*m_num_channels);
+            m_average.resize(m_num_levels*m_num_channels);
+            m_head.resize(m_num_levels);
+            m_num_shift.resize(m_num_levels);
+            m_num_accum.resize(m_num_levels);
+            m_corr.resize(m_num_levels*m_p);
+            m_num_corr.resize(m_num_levels*m_p);
+            reset();
+            }
+
+        //! Discard all samples
+        void reset()
+            {
+            std::fill(m_shift.begin(), m_shift.end(), 0.0);
+            std::fill(m_accum.begin(), m_accum.end(), 0.0);
+            std::fill(m_head.begin(), m_head.end(), 0);
+            std::fill(m_num_shift.begin(), m_num_shift.end(), 0);
+            std::fill(m_num_accum.begin(), m_num_accum.end(), 0);
+            std::fill(m_corr.begin(), m_corr.end(), 0.0);
+            std::fill(m_num_corr.begin(), m_num_corr.end(), 0);
+            m_num_samples = 0;
+            }
+
+        //! Add a sample
+        /*! \param values Pointer to num_channels values
+        */
+        void add(const double *values)
+            {
+            m_num_samples++;
+            addToLevel(0, values);
+            }
+
+        //! Get the number of samples added since the last reset
+        unsigned long getNumSamples() const
+            {
+            return m_num_samples;
+            }
+
+        //! Get the correlation function
+        /*! \param lags Lag times in units of the sample interval (output)
+            \param values Channel averaged correlation at each lag (output)
+
+            Only lags that have received at least one contribution are returned, in increasing order.
+        */
+        void getResult(std::vector<double>& lags, std::vector<double>& values) const
+            {
+            lags.clear();
+            values.clear();
+
+            double stride = 1.0;
+            for (unsigned int k = 0; k < m_num_levels; k++)
+                {
+                unsigned int jmin = (k == 0) ? 0 : m_p / m_m;
+                for (unsigned int j = jmin; j < m_p; j++)
+                    {
+                    unsigned int i = k*m_p + j;
+                    if (m_num_corr[i] > 0)
+                        {
+                        lags.push_back(j*stride);
+                        values.push_back(m_corr[i] / double(m_num_corr[i]));
+                        }
+                    }
+                stride *= m_m;
+                }
+            }
+
+    private:
+        unsigned int m_num_channels;        //!< Number of values per sample
+        unsigned int m_p;                   //!< Number of points per level
+        unsigned int m_m;                   //!< Averaging factor between levels
+        unsigned int m_num_levels;          //!< Number of levels
+        Mode m_mode;                        //!< Operation applied to pairs of samples
+        unsigned long m_num_samples;        //!< Number of samples added
+
+        std::vector<double> m_shift;        //!< Circular shift registers [level][point][channel]
+        std::vector<double> m_accum;        //!< Sums to pass to the next level [level][channel]
+        std::vector<double> m_average;      //!< Averages passed to the next level [level][channel]
+        std::vector<unsigned int> m_head;   //!< Position of the newest value in each shift register
+        std::vector<unsigned int> m_num_shift;  //!< Number of values in each shift register
+        std::vector<unsigned int> m_num_accum;  //!< Number of values in each accumulator
+        std::vector<double> m_corr;         //!< Correlation sums [level][point]
+        std::vector<unsigned long> m_num_corr;  //!< Number of contributions to the correlation sums
+
+        //! Insert a value into a level and correlate it with the stored values
+        void addToLevel(unsigned int k, const double *values)
+            {
+            if (k >= m_num_levels)
+                return;
+
+            const unsigned int C = m_num_channels;
+
+            // insert into the shift register
+            unsigned int head = (m_num_shift[k] == 0) ? 0 : (m_head[k] + 1) % m_p;
+            m_head[k] = head;
+            if (m_num_shift[k] < m_p)
+                m_num_shift[k]++;
+            double *newest = &m_shift[(k*m_p + head)*C];
+            std::copy(values, values + C, newest);
+
+            // correlate the newest value with all stored values, lags below p/m are covered by the previous level
+            unsigned int jmin = (k == 0) ? 0 : m_p / m_m;
+            for (unsigned int j = jmin; j < m_num_shift[k]; j++)
+                {
+                const double *old = &m_shift[(k*m_p + (head + m_p - j) % m_p)*C];
+                double sum = 0.0;
+                if (m_mode == product)
+                    {
+                    for (unsigned int c = 0; c < C; c++)
+                        sum += newest[c]*old[c];
+                    }
+                else
+                    {
+                    for (unsigned int c = 0; c < C; c++)
+                        {
+                        double d = newest[c] - old[c];
+                        sum += d*d;
+                        }
+                    }
+                m_corr[k*m_p + j] += sum / double(C);
+                m_num_corr[k*m_p + j]++;
+                }
+
+            // pass the average of every m values on to the next level
+            double *accum = &m_accum[k*C];
+            for (unsigned int c = 0; c < C; c++)
+                accum[c] += values[c];
+
+            if (++m_num_accum[k] == m_m)
+                {
+                double *average = &m_average[k*C];
+                for (unsigned int c = 0; c < C; c++)
+                    {
+                    average[c] = accum[c] / double(m_m);
+                    accum[c] = 0.0;
+                    }
+                m_num_accum[k] = 0;
+                addToLevel(k+1, average);
+                }
+            }
+    };
+
+//! Estimates the statistical error of a time average by blocking
+/*! Implements the blocking transformation of Flyvbjerg and Petersen, J. Chem. Phys. 91, 461 (1989). Level k
+    holds averages over blocks of 2^k consecutive samples. The standard error estimate of level k increases with k
+    until the blocks are longer than the correlation time and then reaches a plateau, which is the error of the mean.
+    Memory use is O(number of levels).
+
+    \ingroup analyzers
+*/
+class BlockAverage
+    {
+    public:
+        //! Constructor
+        /*! \param num_levels Number of blocking levels
+        */
+        BlockAverage(unsigned int num_levels)
+            : m_sum(num_levels), m_sum_sq(num_levels), m_count(num_levels), m_pending(num_levels),
+              m_has_pending(num_levels)
+            {
+            reset();
+            }
+
+        //! Discard all samples
+        void reset()
+            {
+            std::fill(m_sum.begin(), m_sum.end(), 0.0);
+            std::fill(m_sum_sq.begin(), m_sum_sq.end(), 0.0);
+            std::fill(m_count.begin(), m_count.end(), 0);
+            std::fill(m_pending.begin(), m_pending.end(), 0.0);
+            std::fill(m_has_pending.begin(), m_has_pending.end(), false);
+            }
+
+        //! Add a sample
+        void add(double x)
+            {
+            for (unsigned int k = 0; k < m_sum.size(); k++)
+                {
+                m_sum[k] += x;
+                m_sum_sq[k] += x*x;
+                m_count[k]++;
+
+                if (!m_has_pending[k])
+                    {
+                    m_pending[k] = x;
+                    m_has_pending[k] = true;
+                    return;
+                    }
+
+                // a pair is complete, pass its average on to the next level
+                x = 0.5*(m_pending[k] + x);
+                m_has_pending[k] = false;
+                }
+            }
+
+        //! Get the mean of all samples
+        double getMean() const
+            {
+            return (m_count[0] > 0) ? m_sum[0] / double(m_count[0]) : 0.0;
+            }
+
+        //! Get the error estimate at each level
+        /*! \param errors Standard error of the mean estimated at each level that holds at least two blocks (output)
+        */
+        void getErrors(std::vector<double>& errors) const
+            {
+            errors.clear();
+            for (unsigned int k = 0; k < m_sum.size() && m_count[k] >= 2; k++)
+                {
+                double n = double(m_count[k]);
+                double mean = m_sum[k] / n;
+                double var = std::max(m_sum_sq[k] / n - mean*mean, 0.0);
+                errors.push_back(std::sqrt(var / (n - 1.0)));
+                }
+            }
+
+    private:
+        std::vector<double> m_sum;          //!< Sum of the block averages at each level
+        std::vector<double> m_sum_sq;       //!< Sum of the squared block averages at each level
+        std::vector<unsigned long> m_count; //!< Number of blocks at each level
+        std::vector<double> m_pending;      //!< First half of an incomplete pair at each level
+        std::vector<bool> m_has_pending;    //!< True if m_pending holds a value
+    };
+
+#endif
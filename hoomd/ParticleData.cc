@@ -313,7 +313,7 @@ void ParticleData::setTypeName(unsigned int type, const std::string& name)
 
 /*! \param N Number of particles to allocate memory for
     \pre No memory is allocated and the per-particle GPUArrays are unitialized
-    \post All per-particle GPUArrays are allocated
+    \post All mandatory per-particle GPUArrays are allocated
 */
 void ParticleData::allocate(unsigned int N)
     {
@@ -358,18 +358,18 @@ void ParticleData::allocate(unsigned int N)
     m_net_virial.swap(net_virial);
     GPUArray< Scalar4 > net_torque(N, m_exec_conf);
     m_net_torque.swap(net_torque);
-    GPUArray< Scalar4 > orientation(N, m_exec_conf);
-    m_orientation.swap(orientation);
-    GPUArray< Scalar4 > angmom(N, m_exec_conf);
-    m_angmom.swap(angmom);
-    GPUArray< Scalar3 > inertia(N, m_exec_conf);
-    m_inertia.swap(inertia);
 
     GPUArray< unsigned int > comm_flags(N, m_exec_conf);
     m_comm_flags.swap(comm_flags);
 
-    // allocate alternate particle data arrays (for swapping in-out)
-    allocateAlternateArrays(N);
+    // the orientations, angular momenta, moments of inertia and the alternate particle data arrays
+    // are allocated on first use
+    GPUArray< Scalar4 > orientation;
+    m_orientation.swap(orientation);
+    GPUArray< Scalar4 > angmom;
+    m_angmom.swap(angmom);
+    GPUArray< Scalar3 > inertia;
+    m_inertia.swap(inertia);
 
     // notify observers
     m_max_particle_num_signal.emit();
@@ -377,69 +377,115 @@ void ParticleData::allocate(unsigned int N)
     m_arrays_allocated = true;
     }
 
-/*! \param N Number of particles to allocate memory for
-    \pre No memory is allocated and the alternate per-particle GPUArrays are unitialized
+/*! The alternate arrays are allocated with the current maximum particle number. The alternate arrays for the
+    orientations, angular momenta and moments of inertia are only allocated if the corresponding arrays are.
+
     \post All alternate per-particle GPUArrays are allocated
 */
-void ParticleData::allocateAlternateArrays(unsigned int N)
+void ParticleData::allocateAlternateArrays() const
     {
-    // positions
-    GPUArray< Scalar4 > pos_alt(N, m_exec_conf);
-    m_pos_alt.swap(pos_alt);
+    if (! m_arrays_allocated)
+        return;
 
-    // velocities
-    GPUArray< Scalar4 > vel_alt(N, m_exec_conf);
-    m_vel_alt.swap(vel_alt);
+    const unsigned int N = m_max_nparticles;
 
-    // accelerations
-    GPUArray< Scalar3 > accel_alt(N, m_exec_conf);
-    m_accel_alt.swap(accel_alt);
+    if (m_pos_alt.isNull())
+        {
+        m_exec_conf->msg->notice(7) << "ParticleData: allocating alternate particle data" << std::endl;
 
-    // charge
-    GPUArray< Scalar > charge_alt(N, m_exec_conf);
-    m_charge_alt.swap(charge_alt);
+        // positions
+        GPUArray< Scalar4 > pos_alt(N, m_exec_conf);
+        m_pos_alt.swap(pos_alt);
 
-    // diameter
-    GPUArray< Scalar > diameter_alt(N, m_exec_conf);
-    m_diameter_alt.swap(diameter_alt);
+        // velocities
+        GPUArray< Scalar4 > vel_alt(N, m_exec_conf);
+        m_vel_alt.swap(vel_alt);
 
-    // image
-    GPUArray< int3 > image_alt(N, m_exec_conf);
-    m_image_alt.swap(image_alt);
+        // accelerations
+        GPUArray< Scalar3 > accel_alt(N, m_exec_conf);
+        m_accel_alt.swap(accel_alt);
 
-    // global tag
-    GPUArray< unsigned int> tag_alt(N, m_exec_conf);
-    m_tag_alt.swap(tag_alt);
+        // charge
+        GPUArray< Scalar > charge_alt(N, m_exec_conf);
+        m_charge_alt.swap(charge_alt);
 
-    // body ID
-    GPUArray< unsigned int > body_alt(N, m_exec_conf);
-    m_body_alt.swap(body_alt);
+        // diameter
+        GPUArray< Scalar > diameter_alt(N, m_exec_conf);
+        m_diameter_alt.swap(diameter_alt);
 
-    // orientation
-    GPUArray< Scalar4 > orientation_alt(N, m_exec_conf);
-    m_orientation_alt.swap(orientation_alt);
+        // image
+        GPUArray< int3 > image_alt(N, m_exec_conf);
+        m_image_alt.swap(image_alt);
 
-    // angular momentum
-    GPUArray< Scalar4 > angmom_alt(N, m_exec_conf);
-    m_angmom_alt.swap(angmom_alt);
+        // global tag
+        GPUArray< unsigned int> tag_alt(N, m_exec_conf);
+        m_tag_alt.swap(tag_alt);
 
-    // moments of inertia
-    GPUArray< Scalar3 > inertia_alt(N, m_exec_conf);
-    m_inertia_alt.swap(inertia_alt);
+        // body ID
+        GPUArray< unsigned int > body_alt(N, m_exec_conf);
+        m_body_alt.swap(body_alt);
+
+        // Net force
+        GPUArray< Scalar4 > net_force_alt(N, m_exec_conf);
+        m_net_force_alt.swap(net_force_alt);
 
-    // Net force
-    GPUArray< Scalar4 > net_force_alt(N, m_exec_conf);
-    m_net_force_alt.swap(net_force_alt);
+        // Net virial
+        GPUArray< Scalar > net_virial_alt(N,6, m_exec_conf);
+        m_net_virial_alt.swap(net_virial_alt);
 
-    // Net virial
-    GPUArray< Scalar > net_virial_alt(N,6, m_exec_conf);
-    m_net_virial_alt.swap(net_virial_alt);
+        // Net torque
+        GPUArray< Scalar4 > net_torque_alt(N, m_exec_conf);
+        m_net_torque_alt.swap(net_torque_alt);
+        }
+
+    if (! m_orientation.isNull() && m_orientation_alt.isNull())
+        {
+        // orientation
+        GPUArray< Scalar4 > orientation_alt(N, m_exec_conf);
+        m_orientation_alt.swap(orientation_alt);
 
-    // Net torque
-    GPUArray< Scalar4 > net_torque_alt(N, m_exec_conf);
-    m_net_torque_alt.swap(net_torque_alt);
+        // angular momentum
+        GPUArray< Scalar4 > angmom_alt(N, m_exec_conf);
+        m_angmom_alt.swap(angmom_alt);
+
+        // moments of inertia
+        GPUArray< Scalar3 > inertia_alt(N, m_exec_conf);
+        m_inertia_alt.swap(inertia_alt);
+        }
     }
 
+/*! \pre The mandatory per-particle arrays are allocated
+    \post The orientations are initialized to the identity quaternion, and the angular momenta and moments of
+           inertia to zero
+*/
+void ParticleData::initializeAnisotropicArrays() const
+    {
+    m_exec_conf->msg->notice(7) << "ParticleData: allocating anisotropic particle data" << std::endl;
+
+    GPUArray< Scalar4 > orientation(m_max_nparticles, m_exec_conf);
+    m_orientation.swap(orientation);
+    GPUArray< Scalar4 > angmom(m_max_nparticles, m_exec_conf);
+    m_angmom.swap(angmom);
+    GPUArray< Scalar3 > inertia(m_max_nparticles, m_exec_conf);
+    m_inertia.swap(inertia);
+
+        {
+        ArrayHandle< Scalar4 > h_orientation(m_orientation, access_location::host, access_mode::overwrite);
+        ArrayHandle< Scalar4 > h_angmom(m_angmom, access_location::host, access_mode::overwrite);
+        ArrayHandle< Scalar3 > h_inertia(m_inertia, access_location::host, access_mode::overwrite);
+
+        for (unsigned int idx = 0; idx < m_max_nparticles; ++idx)
+            {
+            h_orientation.data[idx] = make_scalar4(1,0,0,0);
+            h_angmom.data[idx] = make_scalar4(0,0,0,0);
+            h_inertia.data[idx] = make_scalar3(0,0,0);
+            }
+        }
+
+    // keep the alternate arrays consistent if they are already in use
+    if (! m_pos_alt.isNull())
+        allocateAlternateArrays();
+    }
 
 //! Set global number of particles
 /*! \param nglobal Global number of particles
@@ -521,9 +567,13 @@ void ParticleData::reallocate(unsigned int max_n)
     m_net_force.resize(max_n);
     m_net_virial.resize(max_n,6);
     m_net_torque.resize(max_n);
-    m_orientation.resize(max_n);
-    m_angmom.resize(max_n);
-    m_inertia.resize(max_n);
+
+    if (! m_orientation.isNull())
+        {
+        m_orientation.resize(max_n);
+        m_angmom.resize(max_n);
+        m_inertia.resize(max_n);
+        }
 
     m_comm_flags.resize(max_n);
 
@@ -538,14 +588,18 @@ void ParticleData::reallocate(unsigned int max_n)
         m_image_alt.resize(max_n);
         m_tag_alt.resize(max_n);
         m_body_alt.resize(max_n);
-        m_orientation_alt.resize(max_n);
-        m_angmom_alt.resize(max_n);
-        m_inertia_alt.resize(max_n);
         m_net_force_alt.resize(max_n);
         m_net_torque_alt.resize(max_n);
         m_net_virial_alt.resize(max_n, 6);
         }
 
+    if (! m_orientation_alt.isNull())
+        {
+        m_orientation_alt.resize(max_n);
+        m_angmom_alt.resize(max_n);
+        m_inertia_alt.resize(max_n);
+        }
+
     // notify observers
     m_max_particle_num_signal.emit();
     }
@@ -612,6 +666,38 @@ bool ParticleData::inBox(const SnapshotParticleData<Real> &snap)
     return in_box;
     }
 
+//! Test if a particle has a non-default orientation, angular momentum or moment of inertia
+static inline bool isAnisotropic(const Scalar4& orientation, const Scalar4& angmom, const Scalar3& inertia)
+    {
+    return orientation.x != Scalar(1.0) || orientation.y != Scalar(0.0) || orientation.z != Scalar(0.0)
+        || orientation.w != Scalar(0.0) || angmom.x != Scalar(0.0) || angmom.y != Scalar(0.0)
+        || angmom.z != Scalar(0.0) || angmom.w != Scalar(0.0) || inertia.x != Scalar(0.0)
+        || inertia.y != Scalar(0.0) || inertia.z != Scalar(0.0);
+    }
+
+/*! \param allocated True if the anisotropic arrays should be allocated, false to release them
+
+    Releasing the arrays resets all particles to the default orientation, angular momentum and moment of inertia.
+*/
+void ParticleData::setAnisotropicArraysAllocated(bool allocated)
+    {
+    if (allocated)
+        {
+        allocateAnisotropicArrays();
+        return;
+        }
+
+    GPUArray< Scalar4 > orientation, orientation_alt;
+    m_orientation.swap(orientation);
+    m_orientation_alt.swap(orientation_alt);
+    GPUArray< Scalar4 > angmom, angmom_alt;
+    m_angmom.swap(angmom);
+    m_angmom_alt.swap(angmom_alt);
+    GPUArray< Scalar3 > inertia, inertia_alt;
+    m_inertia.swap(inertia);
+    m_inertia_alt.swap(inertia_alt);
+    }
+
 //! Initialize from a snapshot
 /*! \param snapshot the initial particle data
     \param ignore_bodies If True, ignore particles that have a body flag set
@@ -860,6 +946,12 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         // resize particle data
         resize(m_nparticles);
 
+        // only store orientations, angular momenta and moments of inertia if any of them differ from the defaults
+        bool aniso = false;
+        for (unsigned int idx = 0; idx < m_nparticles && !aniso; idx++)
+            aniso = isAnisotropic(orientation[idx], angmom[idx], inertia[idx]);
+        setAnisotropicArraysAllocated(aniso);
+
         // Load particle data
         ArrayHandle< Scalar4 > h_pos(m_pos, access_location::host, access_mode::overwrite);
         ArrayHandle< Scalar4 > h_vel(m_vel, access_location::host, access_mode::overwrite);
@@ -886,9 +978,12 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
             h_tag.data[idx] = tag[idx];
             h_rtag.data[tag[idx]] = idx;
             h_body.data[idx] = body[idx];
-            h_orientation.data[idx] = orientation[idx];
-            h_angmom.data[idx] = angmom[idx];
-            h_inertia.data[idx] = inertia[idx];
+            if (aniso)
+                {
+                h_orientation.data[idx] = orientation[idx];
+                h_angmom.data[idx] = angmom[idx];
+                h_inertia.data[idx] = inertia[idx];
+                }
 
             h_comm_flag.data[idx] = 0; // initialize with zero
             }
@@ -912,6 +1007,14 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         // allocate particle data such that we can accomodate the particles
         resize(snapshot.size);
 
+        // only store orientations, angular momenta and moments of inertia if any of them differ from the defaults
+        bool aniso = false;
+        for (unsigned int snap_idx = 0; snap_idx < snapshot.size && !aniso; snap_idx++)
+            aniso = isAnisotropic(quat_to_scalar4(snapshot.orientation[snap_idx]),
+                                  quat_to_scalar4(snapshot.angmom[snap_idx]),
+                                  vec_to_scalar3(snapshot.inertia[snap_idx]));
+        setAnisotropicArraysAllocated(aniso);
+
         ArrayHandle< Scalar4 > h_pos(m_pos, access_location::host, access_mode::overwrite);
         ArrayHandle< Scalar4 > h_vel(m_vel, access_location::host, access_mode::overwrite);
         ArrayHandle< Scalar3 > h_accel(m_accel, access_location::host, access_mode::overwrite);
@@ -948,9 +1051,12 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
             h_tag.data[nglobal] = nglobal;
             h_rtag.data[nglobal] = nglobal;
             h_body.data[nglobal] = snapshot.body[snap_idx];
-            h_orientation.data[nglobal] = quat_to_scalar4(snapshot.orientation[snap_idx]);
-            h_angmom.data[nglobal] = quat_to_scalar4(snapshot.angmom[snap_idx]);
-            h_inertia.data[nglobal] = vec_to_scalar3(snapshot.inertia[snap_idx]);
+            if (aniso)
+                {
+                h_orientation.data[nglobal] = quat_to_scalar4(snapshot.orientation[snap_idx]);
+                h_angmom.data[nglobal] = quat_to_scalar4(snapshot.angmom[snap_idx]);
+                h_inertia.data[nglobal] = vec_to_scalar3(snapshot.inertia[snap_idx]);
+                }
             nglobal++;
             }
 
@@ -1007,6 +1113,8 @@ std::map<unsigned int, unsigned int> ParticleData::takeSnapshot(SnapshotParticle
     ArrayHandle< Scalar > h_charge(m_charge, access_location::host, access_mode::read);
     ArrayHandle< Scalar > h_diameter(m_diameter, access_location::host, access_mode::read);
     ArrayHandle< unsigned int > h_body(m_body, access_location::host, access_mode::read);
+    // the orientations, angular momenta and moments of inertia take their default values if not allocated
+    const bool aniso = hasAnisotropicArrays();
     ArrayHandle< Scalar4 >  h_orientation(m_orientation, access_location::host, access_mode::read);
     ArrayHandle< Scalar4 >  h_angmom(m_angmom, access_location::host, access_mode::read);
     ArrayHandle< Scalar3 >  h_inertia(m_inertia, access_location::host, access_mode::read);
@@ -1045,9 +1153,9 @@ std::map<unsigned int, unsigned int> ParticleData::takeSnapshot(SnapshotParticle
             image[idx].y -= m_o_image.y;
             image[idx].z -= m_o_image.z;
             body[idx] = h_body.data[idx];
-            orientation[idx] = h_orientation.data[idx];
-            angmom[idx] = h_angmom.data[idx];
-            inertia[idx] = h_inertia.data[idx];
+            orientation[idx] = aniso ? h_orientation.data[idx] : make_scalar4(1,0,0,0);
+            angmom[idx] = aniso ? h_angmom.data[idx] : make_scalar4(0,0,0,0);
+            inertia[idx] = aniso ? h_inertia.data[idx] : make_scalar3(0,0,0);
 
             // insert reverse lookup global tag -> idx
             rtag_map.insert(std::pair<unsigned int, unsigned int>(h_tag.data[idx], idx));
@@ -1203,9 +1311,9 @@ std::map<unsigned int, unsigned int> ParticleData::takeSnapshot(SnapshotParticle
             snapshot.image[snap_id].y -= m_o_image.y;
             snapshot.image[snap_id].z -= m_o_image.z;
             snapshot.body[snap_id] = h_body.data[idx];
-            snapshot.orientation[snap_id] = quat<Real>(h_orientation.data[idx]);
-            snapshot.angmom[snap_id] = quat<Real>(h_angmom.data[idx]);
-            snapshot.inertia[snap_id] = vec3<Real>(h_inertia.data[idx]);
+            snapshot.orientation[snap_id] = aniso ? quat<Real>(h_orientation.data[idx]) : quat<Real>();
+            snapshot.angmom[snap_id] = aniso ? quat<Real>(h_angmom.data[idx]) : quat<Real>(0, vec3<Real>(0,0,0));
+            snapshot.inertia[snap_id] = aniso ? vec3<Real>(h_inertia.data[idx]) : vec3<Real>(0,0,0);
 
             // make sure the position stored in the snapshot is within the boundaries
             Scalar3 tmp = vec_to_scalar3(snapshot.pos[snap_id]);
@@ -1530,7 +1638,11 @@ Scalar4 ParticleData::getOrientation(unsigned int tag) const
     unsigned int idx = getRTag(tag);
     bool found = (idx < getN());
     Scalar4 result = make_scalar4(0.0,0.0,0.0,0.0);
-    if (found)
+    if (found && m_orientation.isNull())
+        {
+        result = make_scalar4(1,0,0,0);
+        }
+    else if (found)
         {
         ArrayHandle< Scalar4 > h_orientation(m_orientation, access_location::host, access_mode::read);
         result = h_orientation.data[idx];
@@ -1553,7 +1665,11 @@ Scalar4 ParticleData::getAngularMomentum(unsigned int tag) const
     unsigned int idx = getRTag(tag);
     bool found = (idx < getN());
     Scalar4 result = make_scalar4(0.0,0.0,0.0,0.0);
-    if (found)
+    if (found && m_angmom.isNull())
+        {
+        result = make_scalar4(0,0,0,0);
+        }
+    else if (found)
         {
         ArrayHandle< Scalar4 > h_angmom(m_angmom, access_location::host, access_mode::read);
         result = h_angmom.data[idx];
@@ -1576,7 +1692,11 @@ Scalar3 ParticleData::getMomentsOfInertia(unsigned int tag) const
     unsigned int idx = getRTag(tag);
     bool found = (idx < getN());
     Scalar3 result = make_scalar3(0.0,0.0,0.0);
-    if (found)
+    if (found && m_inertia.isNull())
+        {
+        result = make_scalar3(0,0,0);
+        }
+    else if (found)
         {
         ArrayHandle< Scalar3 > h_inertia(m_inertia, access_location::host, access_mode::read);
         result = h_inertia.data[idx];
@@ -1940,7 +2060,7 @@ void ParticleData::setOrientation(unsigned int tag, const Scalar4& orientation)
 #endif
     if (found)
         {
-        ArrayHandle< Scalar4 > h_orientation(m_orientation, access_location::host, access_mode::readwrite);
+        ArrayHandle< Scalar4 > h_orientation(getOrientationArray(), access_location::host, access_mode::readwrite);
         h_orientation.data[idx] = orientation;
         }
     }
@@ -1958,7 +2078,7 @@ void ParticleData::setAngularMomentum(unsigned int tag, const Scalar4& angmom)
 #endif
     if (found)
         {
-        ArrayHandle< Scalar4 > h_angmom(m_angmom, access_location::host, access_mode::readwrite);
+        ArrayHandle< Scalar4 > h_angmom(getAngularMomentumArray(), access_location::host, access_mode::readwrite);
         h_angmom.data[idx] = angmom;
         }
     }
@@ -1976,7 +2096,7 @@ void ParticleData::setMomentsOfInertia(unsigned int tag, const Scalar3& inertia)
 #endif
     if (found)
         {
-        ArrayHandle< Scalar3 > h_inertia(m_inertia, access_location::host, access_mode::readwrite);
+        ArrayHandle< Scalar3 > h_inertia(getMomentsOfInertiaArray(), access_location::host, access_mode::readwrite);
         h_inertia.data[idx] = inertia;
         }
     }
@@ -2061,7 +2181,7 @@ unsigned int ParticleData::addParticle(unsigned int type)
         ArrayHandle<Scalar> h_diameter(getDiameters(), access_location::host, access_mode::readwrite);
         ArrayHandle<int3> h_image(getImages(), access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_body(getBodies(), access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar4> h_orientation(getOrientationArray(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_orientation(getOrientationArray(false), access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_tag(getTags(), access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_comm_flag(m_comm_flags, access_location::host, access_mode::readwrite);
 
@@ -2075,7 +2195,8 @@ unsigned int ParticleData::addParticle(unsigned int type)
         h_diameter.data[idx] = 0.0;
         h_image.data[idx] = make_int3(0,0,0);
         h_body.data[idx] = NO_BODY;
-        h_orientation.data[idx] = make_scalar4(1.0,0.0,0.0,0.0);
+        if (hasAnisotropicArrays())
+            h_orientation.data[idx] = make_scalar4(1.0,0.0,0.0,0.0);
         h_tag.data[idx] = tag;
         h_comm_flag.data[idx] = 0;
         }
@@ -2161,7 +2282,7 @@ void ParticleData::removeParticle(unsigned int tag)
             ArrayHandle<Scalar> h_diameter(getDiameters(), access_location::host, access_mode::readwrite);
             ArrayHandle<int3> h_image(getImages(), access_location::host, access_mode::readwrite);
             ArrayHandle<unsigned int> h_body(getBodies(), access_location::host, access_mode::readwrite);
-            ArrayHandle<Scalar4> h_orientation(getOrientationArray(), access_location::host, access_mode::readwrite);
+            ArrayHandle<Scalar4> h_orientation(getOrientationArray(false), access_location::host, access_mode::readwrite);
             ArrayHandle<unsigned int> h_tag(getTags(), access_location::host, access_mode::readwrite);
             ArrayHandle<unsigned int> h_rtag(getRTags(), access_location::host, access_mode::readwrite);
             ArrayHandle<unsigned int> h_comm_flag(m_comm_flags, access_location::host, access_mode::readwrite);
@@ -2173,7 +2294,8 @@ void ParticleData::removeParticle(unsigned int tag)
             h_diameter.data[idx] = h_diameter.data[size-1];
             h_image.data[idx] = h_image.data[size-1];
             h_body.data[idx] = h_body.data[size-1];
-            h_orientation.data[idx] = h_orientation.data[size-1];
+            if (hasAnisotropicArrays())
+                h_orientation.data[idx] = h_orientation.data[size-1];
             h_tag.data[idx] = h_tag.data[size-1];
             h_comm_flag.data[idx] = h_comm_flag.data[size-1];
 
@@ -2281,6 +2403,175 @@ template void ParticleData::initializeFromSnapshot<float>(const SnapshotParticle
 template std::map<unsigned int, unsigned int> ParticleData::takeSnapshot<float>(SnapshotParticleData<float> &snapshot);
 
 
+/*! \param pdata Particle data to access
+    \param read_only True to expose read only arrays
+*/
+LocalParticleDataAccess::LocalParticleDataAccess(std::shared_ptr<ParticleData> pdata, bool read_only)
+    : m_pdata(pdata), m_read_only(read_only), m_entered(false)
+    {
+    }
+
+LocalParticleDataAccess::~LocalParticleDataAccess()
+    {
+    exit();
+    }
+
+void LocalParticleDataAccess::enter()
+    {
+    if (m_entered)
+        {
+        m_pdata->getExecConf()->msg->error() << "Local particle data access blocks cannot be nested" << endl;
+        throw runtime_error("Error accessing local particle data");
+        }
+    m_entered = true;
+    }
+
+void LocalParticleDataAccess::exit()
+    {
+    m_pos_handle.reset();
+    m_vel_handle.reset();
+    m_net_force_handle.reset();
+    m_tag_handle.reset();
+    m_rtag_handle.reset();
+    m_entered = false;
+    }
+
+void LocalParticleDataAccess::checkEntered() const
+    {
+    if (! m_entered)
+        {
+        m_pdata->getExecConf()->msg->error() << "Local particle data can only be accessed inside a with block" << endl;
+        throw runtime_error("Error accessing local particle data");
+        }
+    }
+
+/*! \param self Python object holding this LocalParticleDataAccess, kept alive by the returned array
+    \param data Pointer to the Scalar4 array
+    \param ncol Number of columns to expose
+    \param offset Index of the first exposed column
+    \returns A N x ncol array (or a N length array if ncol == 1) that references \a data
+*/
+py::object LocalParticleDataAccess::wrapScalar4(py::object self, Scalar4 *data, unsigned int ncol, unsigned int offset)
+    {
+    std::vector<size_t> dims, strides;
+    dims.push_back(m_pdata->getN());
+    strides.push_back(sizeof(Scalar4));
+    if (ncol > 1)
+        {
+        dims.push_back(ncol);
+        strides.push_back(sizeof(Scalar));
+        }
+
+    py::array result = py::array_t<Scalar>(dims, strides, ((Scalar *)data) + offset, self);
+    if (m_read_only)
+        result.attr("setflags")(py::arg("write") = false);
+    return result;
+    }
+
+/*! \param self Python object holding this LocalParticleDataAccess, kept alive by the returned array
+    \param data Pointer to the array
+    \param n Number of elements to expose
+    \returns A read only array that references \a data
+*/
+py::object LocalParticleDataAccess::wrapUInt(py::object self, unsigned int *data, unsigned int n)
+    {
+    std::vector<size_t> dims(1, n);
+    std::vector<size_t> strides(1, sizeof(unsigned int));
+    py::array result = py::array_t<unsigned int>(dims, strides, data, self);
+    result.attr("setflags")(py::arg("write") = false);
+    return result;
+    }
+
+/*! \returns a numpy array that references the x,y,z components of the local particle positions
+*/
+py::object LocalParticleDataAccess::getPositionNP(py::object self)
+    {
+    auto self_cpp = self.cast<LocalParticleDataAccess *>();
+    self_cpp->checkEntered();
+
+    if (! self_cpp->m_pos_handle)
+        {
+        self_cpp->m_pos_handle.reset(new ArrayHandle<Scalar4>(self_cpp->m_pdata->getPositions(), access_location::host,
+            self_cpp->m_read_only ? access_mode::read : access_mode::readwrite));
+        }
+    return self_cpp->wrapScalar4(self, self_cpp->m_pos_handle->data, 3, 0);
+    }
+
+/*! \returns a numpy array that references the local particle velocities
+*/
+py::object LocalParticleDataAccess::getVelocityNP(py::object self)
+    {
+    auto self_cpp = self.cast<LocalParticleDataAccess *>();
+    self_cpp->checkEntered();
+
+    if (! self_cpp->m_vel_handle)
+        {
+        self_cpp->m_vel_handle.reset(new ArrayHandle<Scalar4>(self_cpp->m_pdata->getVelocities(), access_location::host,
+            self_cpp->m_read_only ? access_mode::read : access_mode::readwrite));
+        }
+    return self_cpp->wrapScalar4(self, self_cpp->m_vel_handle->data, 3, 0);
+    }
+
+/*! \returns a numpy array that references the local particle masses
+*/
+py::object LocalParticleDataAccess::getMassNP(py::object self)
+    {
+    auto self_cpp = self.cast<LocalParticleDataAccess *>();
+    self_cpp->checkEntered();
+
+    if (! self_cpp->m_vel_handle)
+        {
+        self_cpp->m_vel_handle.reset(new ArrayHandle<Scalar4>(self_cpp->m_pdata->getVelocities(), access_location::host,
+            self_cpp->m_read_only ? access_mode::read : access_mode::readwrite));
+        }
+    return self_cpp->wrapScalar4(self, self_cpp->m_vel_handle->data, 1, 3);
+    }
+
+/*! \returns a numpy array that references the x,y,z components of the local net forces
+*/
+py::object LocalParticleDataAccess::getNetForceNP(py::object self)
+    {
+    auto self_cpp = self.cast<LocalParticleDataAccess *>();
+    self_cpp->checkEntered();
+
+    if (! self_cpp->m_net_force_handle)
+        {
+        self_cpp->m_net_force_handle.reset(new ArrayHandle<Scalar4>(self_cpp->m_pdata->getNetForce(),
+            access_location::host, self_cpp->m_read_only ? access_mode::read : access_mode::readwrite));
+        }
+    return self_cpp->wrapScalar4(self, self_cpp->m_net_force_handle->data, 3, 0);
+    }
+
+/*! \returns a numpy array that references the local particle tags
+*/
+py::object LocalParticleDataAccess::getTagNP(py::object self)
+    {
+    auto self_cpp = self.cast<LocalParticleDataAccess *>();
+    self_cpp->checkEntered();
+
+    if (! self_cpp->m_tag_handle)
+        {
+        self_cpp->m_tag_handle.reset(new ArrayHandle<unsigned int>(self_cpp->m_pdata->getTags(), access_location::host,
+            access_mode::read));
+        }
+    return self_cpp->wrapUInt(self, self_cpp->m_tag_handle->data, self_cpp->m_pdata->getN());
+    }
+
+/*! \returns a numpy array that references the reverse-lookup tags, which are NOT_LOCAL for particles on other ranks
+*/
+py::object LocalParticleDataAccess::getRTagNP(py::object self)
+    {
+    auto self_cpp = self.cast<LocalParticleDataAccess *>();
+    self_cpp->checkEntered();
+
+    if (! self_cpp->m_rtag_handle)
+        {
+        self_cpp->m_rtag_handle.reset(new ArrayHandle<unsigned int>(self_cpp->m_pdata->getRTags(), access_location::host,
+            access_mode::read));
+        }
+    return self_cpp->wrapUInt(self, self_cpp->m_rtag_handle->data, self_cpp->m_pdata->getRTags().size());
+    }
+
 void export_ParticleData(py::module& m)
     {
     py::class_<ParticleData, std::shared_ptr<ParticleData> >(m,"ParticleData")
@@ -2336,6 +2627,18 @@ void export_ParticleData(py::module& m)
 #endif
     .def("addType", &ParticleData::addType)
     ;
+
+    py::class_<LocalParticleDataAccess, std::shared_ptr<LocalParticleDataAccess> >(m,"LocalParticleDataAccess")
+    .def(py::init<std::shared_ptr<ParticleData>, bool>())
+    .def("enter", &LocalParticleDataAccess::enter)
+    .def("exit", &LocalParticleDataAccess::exit)
+    .def_property_readonly("position", &LocalParticleDataAccess::getPositionNP)
+    .def_property_readonly("velocity", &LocalParticleDataAccess::getVelocityNP)
+    .def_property_readonly("mass", &LocalParticleDataAccess::getMassNP)
+    .def_property_readonly("net_force", &LocalParticleDataAccess::getNetForceNP)
+    .def_property_readonly("tag", &LocalParticleDataAccess::getTagNP)
+    .def_property_readonly("rtag", &LocalParticleDataAccess::getRTagNP)
+    ;
     }
 
 //! Constructor for SnapshotParticleData
@@ -2450,6 +2753,9 @@ void ParticleData::removeParticles(std::vector<pdata_element>& out, std::vector<
     resize(new_nparticles);
 
         {
+        // the orientations, angular momenta and moments of inertia are only moved if they are allocated
+        const bool aniso = hasAnisotropicArrays();
+
         // access particle data arrays
         ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_vel(getVelocities(), access_location::host, access_mode::readwrite);
@@ -2458,9 +2764,9 @@ void ParticleData::removeParticles(std::vector<pdata_element>& out, std::vector<
         ArrayHandle<Scalar> h_diameter(getDiameters(), access_location::host, access_mode::readwrite);
         ArrayHandle<int3> h_image(getImages(), access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_body(getBodies(), access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar4> h_orientation(getOrientationArray(), access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar4> h_angmom(getAngularMomentumArray(), access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar3> h_inertia(getMomentsOfInertiaArray(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_orientation(getOrientationArray(false), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_angmom(getAngularMomentumArray(false), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar3> h_inertia(getMomentsOfInertiaArray(false), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_net_force(getNetForce(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_net_torque(getNetTorqueArray(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar> h_net_virial(getNetVirial(), access_location::host, access_mode::readwrite);
@@ -2471,21 +2777,7 @@ void ParticleData::removeParticles(std::vector<pdata_element>& out, std::vector<
 
         ArrayHandle<unsigned int> h_comm_flags(getCommFlags(), access_location::host, access_mode::readwrite);
 
-        ArrayHandle<Scalar4> h_pos_alt(m_pos_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar4> h_vel_alt(m_vel_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar3> h_accel_alt(m_accel_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar> h_charge_alt(m_charge_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar> h_diameter_alt(m_diameter_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<int3> h_image_alt(m_image_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<unsigned int> h_body_alt(m_body_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar4> h_orientation_alt(m_orientation_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar4> h_angmom_alt(m_angmom_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar3> h_inertia_alt(m_inertia_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar4> h_net_force_alt(m_net_force_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar4> h_net_torque_alt(m_net_torque_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<Scalar> h_net_virial_alt(m_net_virial_alt, access_location::host, access_mode::overwrite);
-        ArrayHandle<unsigned int> h_tag_alt(m_tag_alt, access_location::host, access_mode::overwrite);
-
+        // compact the remaining particles in place, the write index n never overtakes the read index i
         unsigned int n =0;
         unsigned int m = 0;
         unsigned int net_virial_pitch = m_net_virial.getPitch();
@@ -2494,22 +2786,27 @@ void ParticleData::removeParticles(std::vector<pdata_element>& out, std::vector<
             unsigned int tag = h_tag.data[i];
             if (h_rtag.data[tag] != NOT_LOCAL)
                 {
-                // copy over to alternate pdata arrays
-                h_pos_alt.data[n] = h_pos.data[i];
-                h_vel_alt.data[n] = h_vel.data[i];
-                h_accel_alt.data[n] = h_accel.data[i];
-                h_charge_alt.data[n] = h_charge.data[i];
-                h_diameter_alt.data[n] = h_diameter.data[i];
-                h_image_alt.data[n] = h_image.data[i];
-                h_body_alt.data[n] = h_body.data[i];
-                h_orientation_alt.data[n] = h_orientation.data[i];
-                h_angmom_alt.data[n] = h_angmom.data[i];
-                h_inertia_alt.data[n] = h_inertia.data[i];
-                h_net_force_alt.data[n] = h_net_force.data[i];
-                h_net_torque_alt.data[n] = h_net_torque.data[i];
-                for (unsigned int j = 0; j < 6; ++j)
-                    h_net_virial_alt.data[net_virial_pitch*j+n] = h_net_virial.data[net_virial_pitch*j+i];
-                h_tag_alt.data[n] = h_tag.data[i];
+                if (n != i)
+                    {
+                    h_pos.data[n] = h_pos.data[i];
+                    h_vel.data[n] = h_vel.data[i];
+                    h_accel.data[n] = h_accel.data[i];
+                    h_charge.data[n] = h_charge.data[i];
+                    h_diameter.data[n] = h_diameter.data[i];
+                    h_image.data[n] = h_image.data[i];
+                    h_body.data[n] = h_body.data[i];
+                    if (aniso)
+                        {
+                        h_orientation.data[n] = h_orientation.data[i];
+                        h_angmom.data[n] = h_angmom.data[i];
+                        h_inertia.data[n] = h_inertia.data[i];
+                        }
+                    h_net_force.data[n] = h_net_force.data[i];
+                    h_net_torque.data[n] = h_net_torque.data[i];
+                    for (unsigned int j = 0; j < 6; ++j)
+                        h_net_virial.data[net_virial_pitch*j+n] = h_net_virial.data[net_virial_pitch*j+i];
+                    h_tag.data[n] = h_tag.data[i];
+                    }
                 ++n;
                 }
             else
@@ -2523,9 +2820,9 @@ void ParticleData::removeParticles(std::vector<pdata_element>& out, std::vector<
                 p.diameter = h_diameter.data[i];
                 p.image = h_image.data[i];
                 p.body = h_body.data[i];
-                p.orientation = h_orientation.data[i];
-                p.angmom = h_angmom.data[i];
-                p.inertia = h_inertia.data[i];
+                p.orientation = aniso ? h_orientation.data[i] : make_scalar4(1,0,0,0);
+                p.angmom = aniso ? h_angmom.data[i] : make_scalar4(0,0,0,0);
+                p.inertia = aniso ? h_inertia.data[i] : make_scalar3(0,0,0);
                 p.net_force = h_net_force.data[i];
                 p.net_torque = h_net_torque.data[i];
                 for (unsigned int j = 0; j < 6; ++j)
@@ -2543,22 +2840,6 @@ void ParticleData::removeParticles(std::vector<pdata_element>& out, std::vector<
         std::fill(h_comm_flags.data, h_comm_flags.data + new_nparticles, 0);
         }
 
-    // swap particle data arrays
-    swapPositions();
-    swapVelocities();
-    swapAccelerations();
-    swapCharges();
-    swapDiameters();
-    swapImages();
-    swapBodies();
-    swapOrientations();
-    swapAngularMomenta();
-    swapMomentsOfInertia();
-    swapNetForce();
-    swapNetTorque();
-    swapNetVirial();
-    swapTags();
-
         {
         ArrayHandle<unsigned int> h_rtag(getRTags(), access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_tag(getTags(), access_location::host, access_mode::read);
@@ -2592,7 +2873,16 @@ void ParticleData::addParticles(const std::vector<pdata_element>& in)
     // resize particle data using amortized O(1) array resizing
     resize(new_nparticles);
 
+    // only allocate the anisotropic arrays if a received particle needs them
+    for (std::vector<pdata_element>::const_iterator it = in.begin(); it != in.end() && !hasAnisotropicArrays(); ++it)
         {
+        if (isAnisotropic(it->orientation, it->angmom, it->inertia))
+            allocateAnisotropicArrays();
+        }
+
+        {
+        const bool aniso = hasAnisotropicArrays();
+
         // access particle data arrays
         ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_vel(getVelocities(), access_location::host, access_mode::readwrite);
@@ -2601,9 +2891,9 @@ void ParticleData::addParticles(const std::vector<pdata_element>& in)
         ArrayHandle<Scalar> h_diameter(getDiameters(), access_location::host, access_mode::readwrite);
         ArrayHandle<int3> h_image(getImages(), access_location::host, access_mode::readwrite);
         ArrayHandle<unsigned int> h_body(getBodies(), access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar4> h_orientation(getOrientationArray(), access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar4> h_angmom(getAngularMomentumArray(), access_location::host, access_mode::readwrite);
-        ArrayHandle<Scalar3> h_inertia(getMomentsOfInertiaArray(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_orientation(getOrientationArray(false), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_angmom(getAngularMomentumArray(false), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar3> h_inertia(getMomentsOfInertiaArray(false), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_net_force(getNetForce(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_net_torque(getNetTorqueArray(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar> h_net_virial(getNetVirial(), access_location::host, access_mode::readwrite);
@@ -2624,9 +2914,12 @@ void ParticleData::addParticles(const std::vector<pdata_element>& in)
             h_diameter.data[n] = p.diameter;
             h_image.data[n] = p.image;
             h_body.data[n] = p.body;
-            h_orientation.data[n] = p.orientation;
-            h_angmom.data[n] = p.angmom;
-            h_inertia.data[n] = p.inertia;
+            if (aniso)
+                {
+                h_orientation.data[n] = p.orientation;
+                h_angmom.data[n] = p.angmom;
+                h_inertia.data[n] = p.inertia;
+                }
             h_net_force.data[n] = p.net_force;
             h_net_torque.data[n] = p.net_torque;
             for (unsigned int j = 0; j < 6; ++j)
@@ -2664,6 +2957,9 @@ void ParticleData::removeParticlesGPU(GPUVector<pdata_element>& out, GPUVector<u
     {
     if (m_prof) m_prof->push(m_exec_conf, "pack");
 
+    // the GPU kernel compacts into the alternate arrays, the anisotropic ones only if they are allocated
+    allocateAlternateArrays();
+
     // this is the maximum number of elements we can possibly write to out
     unsigned int max_n_out = out.getNumElements();
     if (comm_flags.getNumElements() < max_n_out)
@@ -2694,9 +2990,9 @@ void ParticleData::removeParticlesGPU(GPUVector<pdata_element>& out, GPUVector<u
         ArrayHandle<Scalar> d_diameter(getDiameters(), access_location::device, access_mode::read);
         ArrayHandle<int3> d_image(getImages(), access_location::device, access_mode::read);
         ArrayHandle<unsigned int> d_body(getBodies(), access_location::device, access_mode::read);
-        ArrayHandle<Scalar4> d_orientation(getOrientationArray(), access_location::device, access_mode::read);
-        ArrayHandle<Scalar4> d_angmom(getAngularMomentumArray(), access_location::device, access_mode::read);
-        ArrayHandle<Scalar3> d_inertia(getMomentsOfInertiaArray(), access_location::device, access_mode::read);
+        ArrayHandle<Scalar4> d_orientation(getOrientationArray(false), access_location::device, access_mode::read);
+        ArrayHandle<Scalar4> d_angmom(getAngularMomentumArray(false), access_location::device, access_mode::read);
+        ArrayHandle<Scalar3> d_inertia(getMomentsOfInertiaArray(false), access_location::device, access_mode::read);
         ArrayHandle<Scalar4> d_net_force(getNetForce(), access_location::device, access_mode::read);
         ArrayHandle<Scalar4> d_net_torque(getNetTorqueArray(), access_location::device, access_mode::read);
         ArrayHandle<Scalar> d_net_virial(getNetVirial(), access_location::device, access_mode::read);
@@ -2819,6 +3115,17 @@ void ParticleData::addParticlesGPU(const GPUVector<pdata_element>& in)
     // amortized resizing of particle data
     resize(new_nparticles);
 
+    // only allocate the anisotropic arrays if a received particle needs them
+    if (! hasAnisotropicArrays())
+        {
+        ArrayHandle<pdata_element> h_in(in, access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < num_add_ptls && !hasAnisotropicArrays(); ++i)
+            {
+            if (isAnisotropic(h_in.data[i].orientation, h_in.data[i].angmom, h_in.data[i].inertia))
+                allocateAnisotropicArrays();
+            }
+        }
+
         {
         // access particle data arrays
         ArrayHandle<Scalar4> d_pos(getPositions(), access_location::device, access_mode::readwrite);
@@ -2828,9 +3135,12 @@ void ParticleData::addParticlesGPU(const GPUVector<pdata_element>& in)
         ArrayHandle<Scalar> d_diameter(getDiameters(), access_location::device, access_mode::readwrite);
         ArrayHandle<int3> d_image(getImages(), access_location::device, access_mode::readwrite);
         ArrayHandle<unsigned int> d_body(getBodies(), access_location::device, access_mode::readwrite);
-        ArrayHandle<Scalar4> d_orientation(getOrientationArray(), access_location::device, access_mode::readwrite);
-        ArrayHandle<Scalar4> d_angmom(getAngularMomentumArray(), access_location::device, access_mode::readwrite);
-        ArrayHandle<Scalar3> d_inertia(getMomentsOfInertiaArray(), access_location::device, access_mode::readwrite);
+        ArrayHandle<Scalar4> d_orientation(getOrientationArray(false), access_location::device,
+            access_mode::readwrite);
+        ArrayHandle<Scalar4> d_angmom(getAngularMomentumArray(false), access_location::device,
+            access_mode::readwrite);
+        ArrayHandle<Scalar3> d_inertia(getMomentsOfInertiaArray(false), access_location::device,
+            access_mode::readwrite);
         ArrayHandle<Scalar4> d_net_force(getNetForce(), access_location::device, access_mode::readwrite);
         ArrayHandle<Scalar4> d_net_torque(getNetTorqueArray(), access_location::device, access_mode::readwrite);
         ArrayHandle<Scalar> d_net_virial(getNetVirial(), access_location::device, access_mode::readwrite);
@@ -78,9 +78,19 @@ __global__ void gpu_scatter_particle_data_kernel(
         p.diameter = d_diameter[idx];
         p.image = d_image[idx];
         p.body = d_body[idx];
-        p.orientation = d_orientation[idx];
-        p.angmom = d_angmom[idx];
-        p.inertia = d_inertia[idx];
+        if (d_orientation != NULL)
+            {
+            p.orientation = d_orientation[idx];
+            p.angmom = d_angmom[idx];
+            p.inertia = d_inertia[idx];
+            }
+        else
+            {
+            // the anisotropic arrays are not allocated, use the defaults
+            p.orientation = make_scalar4(1,0,0,0);
+            p.angmom = make_scalar4(0,0,0,0);
+            p.inertia = make_scalar3(0,0,0);
+            }
         p.net_force = d_net_force[idx];
         p.net_torque = d_net_torque[idx];
         for (unsigned int j = 0; j < 6; ++j)
@@ -104,9 +114,12 @@ __global__ void gpu_scatter_particle_data_kernel(
         d_diameter_alt[scan_keep] = d_diameter[idx];
         d_image_alt[scan_keep] = d_image[idx];
         d_body_alt[scan_keep] = d_body[idx];
-        d_orientation_alt[scan_keep] = d_orientation[idx];
-        d_angmom_alt[scan_keep] = d_angmom[idx];
-        d_inertia_alt[scan_keep] = d_inertia[idx];
+        if (d_orientation != NULL)
+            {
+            d_orientation_alt[scan_keep] = d_orientation[idx];
+            d_angmom_alt[scan_keep] = d_angmom[idx];
+            d_inertia_alt[scan_keep] = d_inertia[idx];
+            }
         d_net_force_alt[scan_keep] = d_net_force[idx];
         d_net_torque_alt[scan_keep] = d_net_torque[idx];
         for (unsigned int j = 0; j < 6; ++j)
@@ -306,9 +319,12 @@ __global__ void gpu_pdata_add_particles_kernel(unsigned int old_nparticles,
     d_diameter[add_idx] = p.diameter;
     d_image[add_idx] = p.image;
     d_body[add_idx] = p.body;
-    d_orientation[add_idx] = p.orientation;
-    d_angmom[add_idx] = p.angmom;
-    d_inertia[add_idx] = p.inertia;
+    if (d_orientation != NULL)
+        {
+        d_orientation[add_idx] = p.orientation;
+        d_angmom[add_idx] = p.angmom;
+        d_inertia[add_idx] = p.inertia;
+        }
     d_net_force[add_idx] = p.net_force;
     d_net_torque[add_idx] = p.net_torque;
     for (unsigned int j = 0; j < 6; ++j)
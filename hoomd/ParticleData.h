@@ -618,85 +618,108 @@ class PYBIND11_EXPORT ParticleData
          * m_pdata->swapPositions(); // swap in reordered data at no extra cost
          * notifyParticleSort();     // ensures that ghosts will be restored at next communication step
          * \endcode
+         *
+         * The alternate arrays are only allocated on first access.
          */
 
         //! Return positions and types (alternate array)
-        const GPUArray< Scalar4 >& getAltPositions() const { return m_pos_alt; }
+        const GPUArray< Scalar4 >& getAltPositions() const { allocateAlternateArrays(); return m_pos_alt; }
 
         //! Swap in positions
         inline void swapPositions() { m_pos.swap(m_pos_alt); }
 
         //! Return velocities and masses (alternate array)
-        const GPUArray< Scalar4 >& getAltVelocities() const { return m_vel_alt; }
+        const GPUArray< Scalar4 >& getAltVelocities() const { allocateAlternateArrays(); return m_vel_alt; }
 
         //! Swap in velocities
         inline void swapVelocities() { m_vel.swap(m_vel_alt); }
 
         //! Return accelerations (alternate array)
-        const GPUArray< Scalar3 >& getAltAccelerations() const { return m_accel_alt; }
+        const GPUArray< Scalar3 >& getAltAccelerations() const { allocateAlternateArrays(); return m_accel_alt; }
 
         //! Swap in accelerations
         inline void swapAccelerations() { m_accel.swap(m_accel_alt); }
 
         //! Return charges (alternate array)
-        const GPUArray< Scalar >& getAltCharges() const { return m_charge_alt; }
+        const GPUArray< Scalar >& getAltCharges() const { allocateAlternateArrays(); return m_charge_alt; }
 
         //! Swap in accelerations
         inline void swapCharges() { m_charge.swap(m_charge_alt); }
 
         //! Return diameters (alternate array)
-        const GPUArray< Scalar >& getAltDiameters() const { return m_diameter_alt; }
+        const GPUArray< Scalar >& getAltDiameters() const { allocateAlternateArrays(); return m_diameter_alt; }
 
         //! Swap in diameters
         inline void swapDiameters() { m_diameter.swap(m_diameter_alt); }
 
         //! Return images (alternate array)
-        const GPUArray< int3 >& getAltImages() const { return m_image_alt; }
+        const GPUArray< int3 >& getAltImages() const { allocateAlternateArrays(); return m_image_alt; }
 
         //! Swap in images
         inline void swapImages() { m_image.swap(m_image_alt); }
 
         //! Return tags (alternate array)
-        const GPUArray< unsigned int >& getAltTags() const { return m_tag_alt; }
+        const GPUArray< unsigned int >& getAltTags() const { allocateAlternateArrays(); return m_tag_alt; }
 
         //! Swap in tags
         inline void swapTags() { m_tag.swap(m_tag_alt); }
 
         //! Return body ids (alternate array)
-        const GPUArray< unsigned int >& getAltBodies() const { return m_body_alt; }
+        const GPUArray< unsigned int >& getAltBodies() const { allocateAlternateArrays(); return m_body_alt; }
 
         //! Swap in bodies
         inline void swapBodies() { m_body.swap(m_body_alt); }
 
         //! Get the net force array (alternate array)
-        const GPUArray< Scalar4 >& getAltNetForce() const { return m_net_force_alt; }
+        const GPUArray< Scalar4 >& getAltNetForce() const { allocateAlternateArrays(); return m_net_force_alt; }
 
         //! Swap in net force
         inline void swapNetForce() { m_net_force.swap(m_net_force_alt); }
 
         //! Get the net virial array (alternate array)
-        const GPUArray< Scalar >& getAltNetVirial() const { return m_net_virial_alt; }
+        const GPUArray< Scalar >& getAltNetVirial() const { allocateAlternateArrays(); return m_net_virial_alt; }
 
         //! Swap in net virial
         inline void swapNetVirial() { m_net_virial.swap(m_net_virial_alt); }
 
         //! Get the net torque array (alternate array)
-        const GPUArray< Scalar4 >& getAltNetTorqueArray() const { return m_net_torque_alt; }
+        const GPUArray< Scalar4 >& getAltNetTorqueArray() const { allocateAlternateArrays(); return m_net_torque_alt; }
 
         //! Swap in net torque
         inline void swapNetTorque() { m_net_torque.swap(m_net_torque_alt); }
 
         //! Get the orientations (alternate array)
-        const GPUArray< Scalar4 >& getAltOrientationArray() const { return m_orientation_alt; }
+        /*! \param allocate Set to false to get a null array if the anisotropic arrays have not been allocated yet
+         */
+        const GPUArray< Scalar4 >& getAltOrientationArray(bool allocate=true) const
+            {
+            if (allocate) allocateAnisotropicArrays();
+            allocateAlternateArrays();
+            return m_orientation_alt;
+            }
 
         //! Swap in orientations
         inline void swapOrientations() { m_orientation.swap(m_orientation_alt); }
 
         //! Get the angular momenta (alternate array)
-        const GPUArray< Scalar4 >& getAltAngularMomentumArray() const { return m_angmom_alt; }
+        /*! \param allocate Set to false to get a null array if the anisotropic arrays have not been allocated yet
+         */
+        const GPUArray< Scalar4 >& getAltAngularMomentumArray(bool allocate=true) const
+            {
+            if (allocate) allocateAnisotropicArrays();
+            allocateAlternateArrays();
+            return m_angmom_alt;
+            }
 
         //! Get the moments of inertia array (alternate array)
-        const GPUArray< Scalar3 >& getAltMomentsOfInertiaArray() const { return m_inertia_alt; }
+        /*! \param allocate Set to false to get a null array if the anisotropic arrays have not been allocated yet
+         */
+        const GPUArray< Scalar3 >& getAltMomentsOfInertiaArray(bool allocate=true) const
+            {
+            if (allocate) allocateAnisotropicArrays();
+            allocateAlternateArrays();
+            return m_inertia_alt;
+            }
 
         //! Swap in angular momenta
         inline void swapAngularMomenta() { m_angmom.swap(m_angmom_alt); }
@@ -789,13 +812,40 @@ class PYBIND11_EXPORT ParticleData
         const GPUArray< Scalar4 >& getNetTorqueArray() const { return m_net_torque; }
 
         //! Get the orientation array
-        const GPUArray< Scalar4 >& getOrientationArray() const { return m_orientation; }
+        /*! \param allocate Set to false to get a null array if the anisotropic arrays have not been allocated yet
+         */
+        const GPUArray< Scalar4 >& getOrientationArray(bool allocate=true) const
+            {
+            if (allocate) allocateAnisotropicArrays();
+            return m_orientation;
+            }
 
         //! Get the angular momentum array
-        const GPUArray< Scalar4 >& getAngularMomentumArray() const { return m_angmom; }
+        /*! \param allocate Set to false to get a null array if the anisotropic arrays have not been allocated yet
+         */
+        const GPUArray< Scalar4 >& getAngularMomentumArray(bool allocate=true) const
+            {
+            if (allocate) allocateAnisotropicArrays();
+            return m_angmom;
+            }
 
         //! Get the angular momentum array
-        const GPUArray< Scalar3 >& getMomentsOfInertiaArray() const { return m_inertia; }
+        /*! \param allocate Set to false to get a null array if the anisotropic arrays have not been allocated yet
+         */
+        const GPUArray< Scalar3 >& getMomentsOfInertiaArray(bool allocate=true) const
+            {
+            if (allocate) allocateAnisotropicArrays();
+            return m_inertia;
+            }
+
+        //! Test if the orientations, angular momenta and moments of inertia are allocated
+        /*! Until a class accesses them, all particles have the identity orientation, zero angular momentum and zero
+            moments of inertia, and the arrays are not allocated.
+         */
+        bool hasAnisotropicArrays() const
+            {
+            return !m_orientation.isNull();
+            }
 
         //! Get the communication flags array
         const GPUArray< unsigned int >& getCommFlags() const { return m_comm_flags; }
@@ -1124,9 +1174,9 @@ class PYBIND11_EXPORT ParticleData
         GPUArray<unsigned int> m_tag;               //!< particle tags
         GPUVector<unsigned int> m_rtag;             //!< reverse lookup tags
         GPUArray<unsigned int> m_body;              //!< rigid body ids
-        GPUArray< Scalar4 > m_orientation;          //!< Orientation quaternion for each particle (ignored if not anisotropic)
-        GPUArray< Scalar4 > m_angmom;               //!< Angular momementum quaternion for each particle
-        GPUArray< Scalar3 > m_inertia;              //!< Principal moments of inertia for each particle
+        mutable GPUArray< Scalar4 > m_orientation;  //!< Orientation quaternion for each particle (allocated on first use)
+        mutable GPUArray< Scalar4 > m_angmom;       //!< Angular momementum quaternion for each particle (allocated on first use)
+        mutable GPUArray< Scalar3 > m_inertia;      //!< Principal moments of inertia for each particle (allocated on first use)
         GPUArray<unsigned int> m_comm_flags;        //!< Array of communication flags
 
         std::stack<unsigned int> m_recycled_tags;    //!< Global tags of removed particles
@@ -1142,21 +1192,24 @@ class PYBIND11_EXPORT ParticleData
            array and copying to the main particle data subsequently, the re-ordered particle
            data can be written to the alternate arrays, which are then swapped in for
            the real particle data at effectively zero cost.
+
+           The alternate arrays are only allocated when they are first accessed, which currently only the GPU code
+           paths do. The CPU code paths reorder particle data in place or through temporary arrays.
          */
-        GPUArray<Scalar4> m_pos_alt;                //!< particle positions and type (swap-in)
-        GPUArray<Scalar4> m_vel_alt;                //!< particle velocities and masses (swap-in)
-        GPUArray<Scalar3> m_accel_alt;              //!< particle accelerations (swap-in)
-        GPUArray<Scalar> m_charge_alt;              //!< particle charges (swap-in)
-        GPUArray<Scalar> m_diameter_alt;            //!< particle diameters (swap-in)
-        GPUArray<int3> m_image_alt;                 //!< particle images (swap-in)
-        GPUArray<unsigned int> m_tag_alt;           //!< particle tags (swap-in)
-        GPUArray<unsigned int> m_body_alt;          //!< rigid body ids (swap-in)
-        GPUArray<Scalar4> m_orientation_alt;        //!< orientations (swap-in)
-        GPUArray<Scalar4> m_angmom_alt;             //!< angular momenta (swap-in)
-        GPUArray<Scalar3> m_inertia_alt;             //!< Principal moments of inertia for each particle (swap-in)
-        GPUArray<Scalar4> m_net_force_alt;          //!< Net force (swap-in)
-        GPUArray<Scalar> m_net_virial_alt;          //!< Net virial (swap-in)
-        GPUArray<Scalar4> m_net_torque_alt;         //!< Net torque (swap-in)
+        mutable GPUArray<Scalar4> m_pos_alt;                //!< particle positions and type (swap-in)
+        mutable GPUArray<Scalar4> m_vel_alt;                //!< particle velocities and masses (swap-in)
+        mutable GPUArray<Scalar3> m_accel_alt;              //!< particle accelerations (swap-in)
+        mutable GPUArray<Scalar> m_charge_alt;              //!< particle charges (swap-in)
+        mutable GPUArray<Scalar> m_diameter_alt;            //!< particle diameters (swap-in)
+        mutable GPUArray<int3> m_image_alt;                 //!< particle images (swap-in)
+        mutable GPUArray<unsigned int> m_tag_alt;           //!< particle tags (swap-in)
+        mutable GPUArray<unsigned int> m_body_alt;          //!< rigid body ids (swap-in)
+        mutable GPUArray<Scalar4> m_orientation_alt;        //!< orientations (swap-in)
+        mutable GPUArray<Scalar4> m_angmom_alt;             //!< angular momenta (swap-in)
+        mutable GPUArray<Scalar3> m_inertia_alt;             //!< Principal moments of inertia for each particle (swap-in)
+        mutable GPUArray<Scalar4> m_net_force_alt;          //!< Net force (swap-in)
+        mutable GPUArray<Scalar> m_net_virial_alt;          //!< Net virial (swap-in)
+        mutable GPUArray<Scalar4> m_net_torque_alt;         //!< Net torque (swap-in)
 
         std::shared_ptr<Profiler> m_prof;         //!< Pointer to the profiler. NULL if there is no profiler.
 
@@ -1182,7 +1235,20 @@ class PYBIND11_EXPORT ParticleData
         void allocate(unsigned int N);
 
         //! Helper function to allocate alternate particle data
-        void allocateAlternateArrays(unsigned int N);
+        void allocateAlternateArrays() const;
+
+        //! Helper function to allocate the anisotropic particle data on first use
+        void allocateAnisotropicArrays() const
+            {
+            if (m_arrays_allocated && m_orientation.isNull())
+                initializeAnisotropicArrays();
+            }
+
+        //! Helper function to allocate and initialize the anisotropic particle data
+        void initializeAnisotropicArrays() const;
+
+        //! Helper function to allocate or release the anisotropic particle data
+        void setAnisotropicArraysAllocated(bool allocated);
 
         //! Helper function for amortized array resizing
         void resize(unsigned int new_nparticles);
@@ -1202,6 +1268,70 @@ class PYBIND11_EXPORT ParticleData
     };
 
 #ifndef NVCC
+//! Provides NumPy views of the local particle data arrays to python
+/*! LocalParticleDataAccess acquires host ArrayHandles on the particle data arrays between enter() and exit() and
+    exposes them as NumPy arrays without a copy or an MPI gather. Only the particles local to this rank are included,
+    in the current (sorted) local index order. Use the tag and rtag arrays to map between local indices and tags.
+
+    Handles are acquired on the first access to a given array and all of them are released in exit(). NumPy arrays
+    obtained inside the block reference the particle data memory directly and must not be used after exit(), nor
+    may any other code access the particle data while the handles are held.
+
+    In read only mode, all arrays are flagged as not writeable and the handles are acquired with access_mode::read.
+    Otherwise, positions, velocities and net forces are writeable and acquired with access_mode::readwrite. The tag
+    and reverse-lookup tag arrays are always read only.
+
+    \ingroup data_structs
+*/
+class PYBIND11_EXPORT LocalParticleDataAccess
+    {
+    public:
+        //! Constructor
+        LocalParticleDataAccess(std::shared_ptr<ParticleData> pdata, bool read_only);
+
+        //! Destructor
+        ~LocalParticleDataAccess();
+
+        //! Start a block of array access
+        void enter();
+
+        //! Release all acquired handles
+        void exit();
+
+        //! Get the local particle positions as a Nx3 array
+        static pybind11::object getPositionNP(pybind11::object self);
+        //! Get the local particle velocities as a Nx3 array
+        static pybind11::object getVelocityNP(pybind11::object self);
+        //! Get the local particle masses as a N length array
+        static pybind11::object getMassNP(pybind11::object self);
+        //! Get the local net forces as a Nx3 array
+        static pybind11::object getNetForceNP(pybind11::object self);
+        //! Get the local particle tags as a N length array
+        static pybind11::object getTagNP(pybind11::object self);
+        //! Get the reverse-lookup tags as a (maximum tag + 1) length array
+        static pybind11::object getRTagNP(pybind11::object self);
+
+    private:
+        std::shared_ptr<ParticleData> m_pdata;  //!< The particle data to access
+        bool m_read_only;                       //!< True if the arrays are exposed read only
+        bool m_entered;                         //!< True between enter() and exit()
+
+        std::unique_ptr< ArrayHandle<Scalar4> > m_pos_handle;             //!< Handle to the positions
+        std::unique_ptr< ArrayHandle<Scalar4> > m_vel_handle;             //!< Handle to the velocities
+        std::unique_ptr< ArrayHandle<Scalar4> > m_net_force_handle;       //!< Handle to the net force
+        std::unique_ptr< ArrayHandle<unsigned int> > m_tag_handle;        //!< Handle to the tags
+        std::unique_ptr< ArrayHandle<unsigned int> > m_rtag_handle;       //!< Handle to the reverse-lookup tags
+
+        //! Check that the access is used inside a block
+        void checkEntered() const;
+
+        //! Wrap a column view of a Scalar4 array
+        pybind11::object wrapScalar4(pybind11::object self, Scalar4 *data, unsigned int ncol, unsigned int offset);
+
+        //! Wrap an unsigned int array
+        pybind11::object wrapUInt(pybind11::object self, unsigned int *data, unsigned int n);
+    };
+
 //! Exports the BoxDim class to python
 void export_BoxDim(pybind11::module& m);
 //! Exports ParticleData to python
@@ -285,7 +285,10 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
       m_global_ptl_num_change(false),
       m_selector(selector),
       m_update_tags(update_tags),
-      m_warning_printed(false)
+      m_warning_printed(false),
+      m_is_all(false),
+      m_is_tag_range(false),
+      m_num_identity(0)
     {
     #ifdef ENABLE_CUDA
     if (m_pdata->getExecConf()->isCUDAEnabled())
@@ -322,7 +325,10 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef, const std
       m_reallocated(false),
       m_global_ptl_num_change(false),
       m_update_tags(false),
-      m_warning_printed(false)
+      m_warning_printed(false),
+      m_is_all(false),
+      m_is_tag_range(false),
+      m_num_identity(0)
     {
     // check input
     unsigned int max_tag = m_pdata->getMaximumTag();
@@ -482,6 +488,7 @@ void ParticleGroup::updateMemberTags(bool force_update) const
     // one byte per particle to indicate membership in the group, initialize with current number of local particles
     GPUArray<unsigned char> is_member(m_pdata->getMaxN(), m_pdata->getExecConf());
     m_is_member.swap(is_member);
+    m_num_identity = 0;
 
     GPUArray<unsigned char> is_member_tag(m_pdata->getRTags().size(), m_pdata->getExecConf());
     m_is_member_tag.swap(is_member_tag);
@@ -699,7 +706,7 @@ std::shared_ptr<ParticleGroup> ParticleGroup::groupDifference(std::shared_ptr<Pa
     return new_group;
     }
 
-/*! Builds the by-tag-lookup table for group membership
+/*! Builds the by-tag-lookup table for group membership and detects if the members are a tag range or all particles
  */
 void ParticleGroup::buildTagHash() const
     {
@@ -709,11 +716,21 @@ void ParticleGroup::buildTagHash() const
     // reset member ship flags
     memset(h_is_member_tag.data, 0, sizeof(unsigned char)*(m_pdata->getRTags().size()));
 
+    // the sorted tags are a contiguous range if every tag is one larger than the previous one
     unsigned int num_members = m_member_tags.getNumElements();
+    bool is_tag_range = num_members > 0;
     for (unsigned int member = 0; member < num_members; member++)
         {
         h_is_member_tag.data[h_member_tags.data[member]] = 1;
+
+        if (member > 0 && h_member_tags.data[member] != h_member_tags.data[member-1] + 1)
+            is_tag_range = false;
         }
+
+    // a range [0,N) holds every particle if the particle tags are [0,N) as well
+    m_is_tag_range = is_tag_range;
+    m_is_all = is_tag_range && h_member_tags.data[0] == 0 && num_members == m_pdata->getNGlobal()
+        && m_pdata->getMaximumTag() == num_members - 1;
     }
 
 /*! \pre m_member_tags has been filled out, listing all particle tags in the group
@@ -726,6 +743,41 @@ void ParticleGroup::rebuildIndexList() const
     // notice message
     m_pdata->getExecConf()->msg->notice(10) << "ParticleGroup: rebuilding index" << std::endl;
 
+    unsigned int nparticles = m_pdata->getN();
+
+    if (m_is_all)
+        {
+        // the index list of all particles is the identity, sorting does not change it
+        if (nparticles > m_num_identity)
+            {
+            #ifdef ENABLE_CUDA
+            if (m_pdata->getExecConf()->isCUDAEnabled() )
+                {
+                rebuildIndexListGPU();
+                }
+            else
+            #endif
+                {
+                // only append the entries of the new particles
+                ArrayHandle<unsigned char> h_is_member(m_is_member, access_location::host, access_mode::readwrite);
+                ArrayHandle<unsigned int> h_member_idx(m_member_idx, access_location::host, access_mode::readwrite);
+                for (unsigned int idx = m_num_identity; idx < nparticles; idx++)
+                    {
+                    h_is_member.data[idx] = 1;
+                    h_member_idx.data[idx] = idx;
+                    }
+                }
+            m_num_identity = nparticles;
+            }
+
+        m_num_local_members = nparticles;
+        m_particles_sorted = false;
+        return;
+        }
+
+    // the lists written below are not the identity
+    m_num_identity = 0;
+
     #ifdef ENABLE_CUDA
     if (m_pdata->getExecConf()->isCUDAEnabled() )
         {
@@ -740,17 +792,37 @@ void ParticleGroup::rebuildIndexList() const
         ArrayHandle<unsigned char> h_is_member_tag(m_is_member_tag, access_location::host, access_mode::read);
         ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
         ArrayHandle<unsigned int> h_member_idx(m_member_idx, access_location::host, access_mode::readwrite);
-        unsigned int nparticles = m_pdata->getN();
         unsigned int cur_member = 0;
-        for (unsigned int idx = 0; idx < nparticles; idx ++)
+
+        if (m_is_tag_range)
+            {
+            // compare against the range instead of gathering from the tag table
+            ArrayHandle<unsigned int> h_member_tags(m_member_tags, access_location::host, access_mode::read);
+            unsigned int first_tag = h_member_tags.data[0];
+            unsigned int num_tags = m_member_tags.getNumElements();
+            for (unsigned int idx = 0; idx < nparticles; idx ++)
+                {
+                unsigned char is_member = (h_tag.data[idx] - first_tag) < num_tags;
+                h_is_member.data[idx] = is_member;
+                if (is_member)
+                    {
+                    h_member_idx.data[cur_member] = idx;
+                    cur_member++;
+                    }
+                }
+            }
+        else
             {
-            assert(h_tag.data[idx] <= m_pdata->getMaximumTag());
-            unsigned char is_member = h_is_member_tag.data[h_tag.data[idx]];
-            h_is_member.data[idx] =  is_member;
-            if (is_member)
+            for (unsigned int idx = 0; idx < nparticles; idx ++)
                 {
-                h_member_idx.data[cur_member] = idx;
-                cur_member++;
+                assert(h_tag.data[idx] <= m_pdata->getMaximumTag());
+                unsigned char is_member = h_is_member_tag.data[h_tag.data[idx]];
+                h_is_member.data[idx] =  is_member;
+                if (is_member)
+                    {
+                    h_member_idx.data[cur_member] = idx;
+                    cur_member++;
+                    }
                 }
             }
 
@@ -177,6 +177,13 @@ class PYBIND11_EXPORT ParticleSelectorRigidCenter : public ParticleSelector
     For that it needs a list of indices of all the particles in the group. To facilitates this, the list of indices
     in the group will be stored in a GPUArray.
 
+    Most groups in practice are either all particles or a single contiguous range of tags. Both cases are detected
+    when the member tags are set. For a tag range, membership is tested by comparing the tag against the range
+    instead of looking it up in the per-tag table. A group of all particles has the identity as its index list,
+    which does not change when the particles are sorted. Its index list is only extended when the number of local
+    particles grows, and getMemberIndex() and isMember() return without accessing any array. Callers can query
+    isAll() to skip the index indirection entirely.
+
     \ingroup data_structs
 */
 class PYBIND11_EXPORT ParticleGroup
@@ -186,7 +193,7 @@ class PYBIND11_EXPORT ParticleGroup
         // @{
 
         //! Constructs an empty particle group
-        ParticleGroup() : m_num_local_members(0) {};
+        ParticleGroup() : m_num_local_members(0), m_is_all(false), m_is_tag_range(false), m_num_identity(0) {};
 
         //! Constructs a particle group of all particles that meet the given selection
         ParticleGroup(std::shared_ptr<SystemDefinition> sysdef, std::shared_ptr<ParticleSelector> selector,
@@ -251,6 +258,9 @@ class PYBIND11_EXPORT ParticleGroup
             checkRebuild();
 
             assert(j < getNumMembers());
+            if (m_is_all)
+                return j;
+
             ArrayHandle<unsigned int> h_handle(m_member_idx, access_location::host, access_mode::read);
             unsigned int idx = h_handle.data[j];
             assert(idx < m_pdata->getN());
@@ -267,6 +277,9 @@ class PYBIND11_EXPORT ParticleGroup
             {
             checkRebuild();
 
+            if (m_is_all)
+                return idx < m_pdata->getN();
+
             ArrayHandle<unsigned char> h_handle(m_is_member, access_location::host, access_mode::read);
             return h_handle.data[idx] == 1;
             }
@@ -285,6 +298,26 @@ class PYBIND11_EXPORT ParticleGroup
             return m_member_idx;
             }
 
+        //! Test if the group contains every particle in the system
+        /*! \returns true if getMemberIndex(j) == j for all local members
+        */
+        bool isAll() const
+            {
+            checkRebuild();
+
+            return m_is_all;
+            }
+
+        //! Test if the member tags form a single contiguous range
+        /*! \returns true if the members are the tags getMemberTag(0) to getMemberTag(0) + getNumMembersGlobal() - 1
+        */
+        bool isTagRange() const
+            {
+            checkRebuild();
+
+            return m_is_tag_range;
+            }
+
         // @}
         //! \name Analysis methods
         // @{
@@ -328,6 +361,10 @@ class PYBIND11_EXPORT ParticleGroup
         bool m_update_tags;                             //!< True if tags should be updated when global number of particles changes
         mutable bool m_warning_printed;                         //!< True if warning about static groups has been printed
 
+        mutable bool m_is_all;                          //!< True if the group contains every particle
+        mutable bool m_is_tag_range;                    //!< True if the member tags are one contiguous range
+        mutable unsigned int m_num_identity;            //!< Number of leading entries that hold the identity index list
+
         #ifdef ENABLE_CUDA
         mgpu::ContextPtr m_mgpu_context;                //!< moderngpu context
         #endif
@@ -0,0 +1,237 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+// Maintainer: joaander
+
+/*!
+ * \file hoomd/Philox.h
+ * \brief Implementation of the Philox4x32-10 counter-based random number generator.
+ *
+ * Philox is described in
+ *
+ * J.K. Salmon, M.A. Moraes, R.O. Dror, and D.E. Shaw. "Parallel random numbers: as easy as 1, 2, 3",
+ * Proceedings of the International Conference for High Performance Computing, Networking, Storage and
+ * Analysis (SC11), 2011.
+ *
+ * The rounds and constants follow the Random123 reference implementation, and produce its known-answer vectors.
+ */
+
+#ifndef HOOMD_PHILOX_H_
+#define HOOMD_PHILOX_H_
+
+// pull in uint2 and uint4 types
+#include "HOOMDMath.h"
+
+#ifdef NVCC
+#define HOSTDEVICE __host__ __device__
+#else
+#define HOSTDEVICE
+#endif // NVCC
+
+namespace hoomd
+{
+namespace detail
+{
+
+//! Identifiers that keep the random streams of different methods independent for the same user seed
+namespace PhiloxStream
+    {
+    enum Enum
+        {
+        TwoStepLangevin = 1,
+        TwoStepBD,
+        PairDPDThermo,
+        PairDPDLJThermo
+        };
+    }
+
+//! Multiplier of the first Philox4x32 lane pair
+const unsigned int PHILOX_M4x32_0 = 0xD2511F53;
+//! Multiplier of the second Philox4x32 lane pair
+const unsigned int PHILOX_M4x32_1 = 0xCD9E8D57;
+//! Weyl increment of the first key word
+const unsigned int PHILOX_W32_0 = 0x9E3779B9;
+//! Weyl increment of the second key word
+const unsigned int PHILOX_W32_1 = 0xBB67AE85;
+
+//! Multiply two 32-bit words
+/*!
+ * \param a First factor
+ * \param b Second factor
+ * \param hi Set to the high word of the product
+ * \returns The low word of the product
+ */
+HOSTDEVICE inline unsigned int philox_mulhilo(const unsigned int a, const unsigned int b, unsigned int& hi)
+    {
+    #ifdef __CUDA_ARCH__
+    hi = __umulhi(a, b);
+    return a*b;
+    #else
+    const unsigned long long p = (unsigned long long)a * b;
+    hi = (unsigned int)(p >> 32);
+    return (unsigned int)p;
+    #endif
+    }
+
+//! Philox4x32-10 block function
+/*!
+ * \param ctr Counter
+ * \param key Key
+ * \returns Four random 32-bit words
+ *
+ * The output is a pure function of \a ctr and \a key, so any block of any stream can be generated independently
+ * of all other blocks.
+ */
+HOSTDEVICE inline uint4 philox4x32_10(uint4 ctr, uint2 key)
+    {
+    for (unsigned int round = 0; round < 10; ++round)
+        {
+        if (round > 0)
+            {
+            key.x += PHILOX_W32_0;
+            key.y += PHILOX_W32_1;
+            }
+
+        unsigned int hi0, hi1;
+        const unsigned int lo0 = philox_mulhilo(PHILOX_M4x32_0, ctr.x, hi0);
+        const unsigned int lo1 = philox_mulhilo(PHILOX_M4x32_1, ctr.z, hi1);
+        ctr = make_uint4(hi1 ^ ctr.y ^ key.x, lo1, hi0 ^ ctr.w ^ key.y, lo0);
+        }
+    return ctr;
+    }
+
+//! Convert a random 32-bit word to a uniform random number
+/*!
+ * \param x Random word
+ * \param a Lower bound
+ * \param b Upper bound
+ * \returns A uniform random number in (a, b)
+ */
+template<class Real>
+HOSTDEVICE inline Real philox_uniform(const unsigned int x, const Real a, const Real b)
+    {
+    // (x + 1/2) / 2^32 is never 0 or 1
+    const Real u = Real(x) * Real(2.3283064365386963e-10) + Real(1.1641532182693481e-10);
+    return a + (b - a) * u;
+    }
+
+//! Convert a block of four random words to four independent standard normal random numbers
+/*!
+ * \param x Random block
+ * \param r Set to the four normal random numbers
+ *
+ * The Box-Muller transform maps every pair of words to a pair of normal numbers, so, unlike gaussian_rng(), no
+ * draws are rejected and none are discarded.
+ */
+template<class Real>
+HOSTDEVICE inline void philox_normal4(const uint4& x, Real *r)
+    {
+    // single precision is plenty for thermal noise, and is what gaussian_rng() uses as well
+    const float two_pi = float(2.0*M_PI);
+
+    const float rho0 = slow::sqrt(-2.0f * slow::log(philox_uniform<float>(x.x, 0.0f, 1.0f)));
+    const float theta0 = two_pi * philox_uniform<float>(x.y, 0.0f, 1.0f);
+    r[0] = Real(rho0 * slow::cos(theta0));
+    r[1] = Real(rho0 * slow::sin(theta0));
+
+    const float rho1 = slow::sqrt(-2.0f * slow::log(philox_uniform<float>(x.z, 0.0f, 1.0f)));
+    const float theta1 = two_pi * philox_uniform<float>(x.w, 0.0f, 1.0f);
+    r[2] = Real(rho1 * slow::cos(theta1));
+    r[3] = Real(rho1 * slow::sin(theta1));
+    }
+
+//! Counter-based random number generator
+/*!
+ * Each generator is identified by a stream (see PhiloxStream), a user seed, two ids (e.g. a particle tag and 0, or
+ * the tags of a pair) and the timestep. Successive calls to block() return successive 128-bit blocks of the
+ * stream. Block \a n of a stream is always the same, no matter on which device, rank or thread it is drawn, or in
+ * which order the particles are processed. philox_generate() draws the same blocks for many particles at once.
+ */
+class PhiloxRNG
+    {
+    public:
+        //! Construct the generator
+        /*!
+         * \param stream Identifier of the method drawing the numbers
+         * \param seed User seed
+         * \param id0 First id
+         * \param id1 Second id
+         * \param timestep Current timestep
+         */
+        HOSTDEVICE PhiloxRNG(const unsigned int stream, const unsigned int seed, const unsigned int id0,
+                             const unsigned int id1, const unsigned int timestep)
+            : m_key(make_uint2(seed, stream)), m_ctr(make_uint4(id0, id1, timestep, 0))
+            {
+            }
+
+        //! Draw the next block of four random words
+        HOSTDEVICE inline uint4 block()
+            {
+            const uint4 x = philox4x32_10(m_ctr, m_key);
+            ++m_ctr.w;
+            return x;
+            }
+
+        //! Skip the next n blocks
+        HOSTDEVICE inline void skip(const unsigned int n)
+            {
+            m_ctr.w += n;
+            }
+
+        //! Draw four uniform random numbers in (a, b)
+        template<class Real>
+        HOSTDEVICE inline void uniform4(Real *r, const Real a, const Real b)
+            {
+            const uint4 x = block();
+            r[0] = philox_uniform<Real>(x.x, a, b);
+            r[1] = philox_uniform<Real>(x.y, a, b);
+            r[2] = philox_uniform<Real>(x.z, a, b);
+            r[3] = philox_uniform<Real>(x.w, a, b);
+            }
+
+        //! Draw four standard normal random numbers
+        template<class Real>
+        HOSTDEVICE inline void normal4(Real *r)
+            {
+            philox_normal4<Real>(block(), r);
+            }
+
+    private:
+        uint2 m_key;    //!< Seed and stream
+        uint4 m_ctr;    //!< Ids, timestep and block index
+    };
+
+#ifndef NVCC
+//! Generate the blocks of many particles
+/*!
+ * \param out Set to the block of each particle (\a n entries)
+ * \param stream Identifier of the method drawing the numbers
+ * \param seed User seed
+ * \param id0 First id of each particle (\a n entries)
+ * \param n Number of particles
+ * \param id1 Second id, common to all particles
+ * \param timestep Current timestep
+ * \param block Index of the block in the stream
+ *
+ * out[i] is the block that PhiloxRNG(stream, seed, id0[i], id1, timestep) draws after \a block calls to
+ * PhiloxRNG::block(). The blocks of different particles are independent and the loop body is branch free
+ * integer arithmetic, so the compiler vectorizes this loop across particles (4 or 8 lanes, depending on the
+ * instruction set). Drawing the blocks of all particles here, instead of inside the loop of an integrator, is what
+ * lets the generator run vectorized.
+ */
+inline void philox_generate(uint4 *out, const unsigned int stream, const unsigned int seed, const unsigned int *id0,
+                            const unsigned int n, const unsigned int id1, const unsigned int timestep,
+                            const unsigned int block)
+    {
+    const uint2 key = make_uint2(seed, stream);
+    for (unsigned int i = 0; i < n; ++i)
+        out[i] = philox4x32_10(make_uint4(id0[i], id1, timestep, block), key);
+    }
+#endif // NVCC
+
+} // end namespace detail
+} // end namespace hoomd
+
+#undef HOSTDEVICE
+
+#endif // HOOMD_PHILOX_H_
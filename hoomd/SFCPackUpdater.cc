@@ -18,21 +18,25 @@
 #include <fstream>
 #include <iostream>
 
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
+
 using namespace std;
 namespace py = pybind11;
 
 /*! \param sysdef System to perform sorts on
  */
 SFCPackUpdater::SFCPackUpdater(std::shared_ptr<SystemDefinition> sysdef)
-        : Updater(sysdef), m_last_grid(0), m_last_dim(0)
+        : Updater(sysdef), m_last_grid(0), m_last_dim(0), m_key_mode(grid), m_secondary_key(none),
+          m_adaptive(false), m_threshold(1.5), m_sorted_locality(0), m_num_sorts(0), m_num_checks(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing SFCPackUpdater" << endl;
 
     // perform lots of sanity checks
     assert(m_pdata);
 
-    m_sort_order.resize(m_pdata->getMaxN());
-    m_particle_bins.resize(m_pdata->getMaxN());
+    reallocate();
 
     // set the default grid
     // Grid dimension must always be a power of 2 and determines the memory usage for m_traversal_order
@@ -52,6 +56,9 @@ void SFCPackUpdater::reallocate()
     {
     m_sort_order.resize(m_pdata->getMaxN());
     m_particle_bins.resize(m_pdata->getMaxN());
+    m_keys.resize(m_pdata->getMaxN());
+    m_keys_alt.resize(m_pdata->getMaxN());
+    m_sort_order_alt.resize(m_pdata->getMaxN());
     }
 
 /*! Destructor
@@ -70,7 +77,17 @@ SFCPackUpdater::~SFCPackUpdater()
  */
 void SFCPackUpdater::update(unsigned int timestep)
     {
+    if (m_adaptive)
+        {
+        // skip the sort until the particles have lost enough locality
+        m_num_checks++;
+        Scalar locality = computeLocality();
+        if (m_sorted_locality > Scalar(0.0) && locality < m_threshold * m_sorted_locality)
+            return;
+        }
+
     m_exec_conf->msg->notice(6) << "SFCPackUpdater: particle sort" << std::endl;
+    m_num_sorts++;
 
     #ifdef ENABLE_MPI
     if (m_comm)
@@ -87,7 +104,9 @@ void SFCPackUpdater::update(unsigned int timestep)
     if (m_prof) m_prof->push(m_exec_conf, "SFCPack");
 
     // figure out the sort order we need to apply
-    if (m_sysdef->getNDimensions() == 2)
+    if (m_key_mode == hilbert)
+        getSortedOrderHilbert();
+    else if (m_sysdef->getNDimensions() == 2)
         getSortedOrder2D();
     else
         getSortedOrder3D();
@@ -95,6 +114,10 @@ void SFCPackUpdater::update(unsigned int timestep)
     // apply that sort order to the particles
     applySortOrder();
 
+    // record the locality of the sorted order
+    if (m_adaptive)
+        m_sorted_locality = computeLocality();
+
     // trigger sort signal (this also forces particle migration)
     m_pdata->notifyParticleSort();
 
@@ -109,6 +132,48 @@ void SFCPackUpdater::update(unsigned int timestep)
     if (m_prof) m_prof->pop(m_exec_conf);
     }
 
+/*! \returns The mean minimum image distance between local particles i and i+1, averaged over all ranks
+
+    This is a cheap O(N) measure of how well the memory order follows the spatial arrangement of the particles.
+    \note This method is collective over all MPI ranks.
+*/
+Scalar SFCPackUpdater::computeLocality()
+    {
+    const BoxDim& box = m_pdata->getGlobalBox();
+    const unsigned int N = m_pdata->getN();
+
+    double sum[2] = {0.0, 0.0};
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+        for (unsigned int i = 1; i < N; i++)
+            {
+            Scalar3 dr = make_scalar3(h_pos.data[i].x - h_pos.data[i-1].x,
+                                      h_pos.data[i].y - h_pos.data[i-1].y,
+                                      h_pos.data[i].z - h_pos.data[i-1].z);
+            dr = box.minImage(dr);
+            sum[0] += sqrt(dot(dr, dr));
+            }
+        sum[1] = (N > 1) ? double(N - 1) : 0.0;
+        }
+
+    #ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        MPI_Allreduce(MPI_IN_PLACE, sum, 2, MPI_DOUBLE, MPI_SUM, m_exec_conf->getMPICommunicator());
+    #endif
+
+    return (sum[1] > 0.0) ? Scalar(sum[0] / sum[1]) : Scalar(0.0);
+    }
+
+void SFCPackUpdater::printStats()
+    {
+    if (!m_adaptive)
+        return;
+
+    m_exec_conf->msg->notice(1) << "-- Sorter stats:" << endl;
+    m_exec_conf->msg->notice(1) << m_num_sorts << " sorts / " << m_num_checks << " locality checks" << endl;
+    }
+
 void SFCPackUpdater::applySortOrder()
     {
     assert(m_pdata);
@@ -120,8 +185,6 @@ void SFCPackUpdater::applySortOrder()
     ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::readwrite);
     ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
     ArrayHandle<unsigned int> h_body(m_pdata->getBodies(), access_location::host, access_mode::readwrite);
-    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(), access_location::host, access_mode::readwrite);
-    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(), access_location::host, access_mode::readwrite);
     ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::readwrite);
     ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::readwrite);
 
@@ -160,17 +223,28 @@ void SFCPackUpdater::applySortOrder()
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
         h_diameter.data[i] = scal_tmp[i];
 
-    // sort angular momentum
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal4_tmp[i] = h_angmom.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_angmom.data[i] = scal4_tmp[i];
+    // sort angular momentum, moment of inertia and orientation (if they are allocated)
+    if (m_pdata->hasAnisotropicArrays())
+        {
+        ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
 
-    // sort moment of inertia
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal3_tmp[i] = h_inertia.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_inertia.data[i] = scal3_tmp[i];
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            scal4_tmp[i] = h_angmom.data[m_sort_order[i]];
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            h_angmom.data[i] = scal4_tmp[i];
+
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            scal3_tmp[i] = h_inertia.data[m_sort_order[i]];
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            h_inertia.data[i] = scal3_tmp[i];
+
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            scal4_tmp[i] = h_orientation.data[m_sort_order[i]];
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            h_orientation.data[i] = scal4_tmp[i];
+        }
 
     // in case anyone access it from frame to frame, sort the net virial
         {
@@ -186,7 +260,7 @@ void SFCPackUpdater::applySortOrder()
             }
         }
 
-    // sort net force, net torque, and orientation
+    // sort net force and net torque
         {
         ArrayHandle<Scalar4> h_net_force(m_pdata->getNetForce(), access_location::host, access_mode::readwrite);
 
@@ -205,15 +279,6 @@ void SFCPackUpdater::applySortOrder()
             h_net_torque.data[i] = scal4_tmp[i];
         }
 
-        {
-        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
-
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
-            scal4_tmp[i] = h_orientation.data[m_sort_order[i]];
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
-            h_orientation.data[i] = scal4_tmp[i];
-        }
-
     // sort image
     int3 *int3_tmp = new int3[m_pdata->getN()];
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
@@ -582,6 +647,275 @@ void SFCPackUpdater::getSortedOrder3D()
         }
     }
 
+//! Compute the position of a point along the Hilbert curve
+/*! \param X Integer coordinates of the point, each with \a bits bits (overwritten)
+    \param n Number of dimensions
+    \param bits Number of bits per coordinate
+    \returns Hilbert key with n*bits bits
+
+    Converts the coordinates to the transposed Hilbert index following J. Skilling, AIP Conf. Proc. 707, 381 (2004)
+    and interleaves its bits. The leading n*k bits of the key are the Hilbert index of the enclosing cell on a grid
+    with 2^k cells per dimension.
+*/
+static uint64_t hilbertKey(unsigned int *X, unsigned int n, unsigned int bits)
+    {
+    const unsigned int M = 1u << (bits - 1);
+
+    // inverse undo
+    for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+        unsigned int P = Q - 1;
+        for (unsigned int i = 0; i < n; i++)
+            {
+            if (X[i] & Q)
+                {
+                // invert
+                X[0] ^= P;
+                }
+            else
+                {
+                // exchange
+                unsigned int t = (X[0] ^ X[i]) & P;
+                X[0] ^= t;
+                X[i] ^= t;
+                }
+            }
+        }
+
+    // gray encode
+    for (unsigned int i = 1; i < n; i++)
+        X[i] ^= X[i-1];
+    unsigned int t = 0;
+    for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+        if (X[n-1] & Q)
+            t ^= Q - 1;
+        }
+    for (unsigned int i = 0; i < n; i++)
+        X[i] ^= t;
+
+    // interleave, most significant bit first
+    uint64_t key = 0;
+    for (int b = bits - 1; b >= 0; b--)
+        {
+        for (unsigned int i = 0; i < n; i++)
+            key = (key << 1) | ((X[i] >> b) & 1);
+        }
+    return key;
+    }
+
+//! Map a fractional coordinate to an integer grid coordinate
+/*! \param f Fractional coordinate, nominally in [0,1)
+    \param bits Number of bits of the grid coordinate
+*/
+static inline unsigned int fractionToGrid(Scalar f, unsigned int bits)
+    {
+    const double n = double(1u << bits);
+    double x = double(f) * n;
+
+    // if the particle is slightly outside, move back into grid
+    if (!(x > 0.0))
+        return 0;
+    if (x >= n)
+        return (1u << bits) - 1;
+    return (unsigned int)x;
+    }
+
+//! Stable radix sort of 64 bit keys that carries along 32 bit values
+/*! \param keys Keys to sort
+    \param values Values to reorder with the keys
+    \param keys_alt Scratch space for the keys, at least \a n elements
+    \param values_alt Scratch space for the values, at least \a n elements
+    \param n Number of elements to sort
+    \param n_chunks Number of chunks that are counted and scattered in parallel
+
+    Sorts 8 bits per pass, starting with the least significant digit. Passes where all keys have the same digit are
+    skipped. The sorted elements are in \a keys and \a values on return, the vectors may have been swapped with the
+    scratch space.
+*/
+static void radixSort(std::vector<uint64_t>& keys,
+                      std::vector<unsigned int>& values,
+                      std::vector<uint64_t>& keys_alt,
+                      std::vector<unsigned int>& values_alt,
+                      unsigned int n,
+                      unsigned int n_chunks)
+    {
+    const unsigned int radix_bits = 8;
+    const unsigned int n_buckets = 1 << radix_bits;
+    std::vector<unsigned int> offsets(n_chunks*n_buckets);
+
+    for (unsigned int shift = 0; shift < 64; shift += radix_bits)
+        {
+        // histogram the digits of each chunk
+        std::fill(offsets.begin(), offsets.end(), 0);
+
+        #ifdef ENABLE_TBB
+        tbb::parallel_for((unsigned int)0, n_chunks, [&](unsigned int chunk)
+        #else
+        for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+        #endif
+            {
+            unsigned int *count = &offsets[chunk*n_buckets];
+            unsigned int first = (unsigned int)((uint64_t)n*chunk/n_chunks);
+            unsigned int last = (unsigned int)((uint64_t)n*(chunk+1)/n_chunks);
+            for (unsigned int i = first; i < last; i++)
+                count[(keys[i] >> shift) & (n_buckets-1)]++;
+            }
+        #ifdef ENABLE_TBB
+        );
+        #endif
+
+        // convert the counts to output offsets, chunks of the same digit are placed in order to keep the sort stable
+        unsigned int sum = 0;
+        bool same_digit = false;
+        for (unsigned int bucket = 0; bucket < n_buckets; bucket++)
+            {
+            unsigned int bucket_count = 0;
+            for (unsigned int chunk = 0; chunk < n_chunks; chunk++)
+                {
+                unsigned int count = offsets[chunk*n_buckets + bucket];
+                offsets[chunk*n_buckets + bucket] = sum;
+                sum += count;
+                bucket_count += count;
+                }
+            if (bucket_count == n)
+                same_digit = true;
+            }
+
+        if (same_digit)
+            continue;
+
+        // scatter
+        #ifdef ENABLE_TBB
+        tbb::parallel_for((unsigned int)0, n_chunks, [&](unsigned int chunk)
+        #else
+        for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+        #endif
+            {
+            unsigned int *offset = &offsets[chunk*n_buckets];
+            unsigned int first = (unsigned int)((uint64_t)n*chunk/n_chunks);
+            unsigned int last = (unsigned int)((uint64_t)n*(chunk+1)/n_chunks);
+            for (unsigned int i = first; i < last; i++)
+                {
+                unsigned int dst = offset[(keys[i] >> shift) & (n_buckets-1)]++;
+                keys_alt[dst] = keys[i];
+                values_alt[dst] = values[i];
+                }
+            }
+        #ifdef ENABLE_TBB
+        );
+        #endif
+
+        keys.swap(keys_alt);
+        values.swap(values_alt);
+        }
+    }
+
+/*! Every particle gets the Hilbert key of its position with 21 bits per dimension in 3D (31 bits in 2D).
+
+    With the \c type secondary key, the leading bits that identify the cell on the m_grid grid are followed by the
+    particle type and then the remaining bits of the Hilbert key, so that particles of the same type are contiguous
+    within each cell.
+
+    With the \c body secondary key, the keys are shifted by one bit. Constituent particles of rigid bodies take the
+    key of their central particle with the lowest bit set, so that they follow the central particle. Constituents
+    whose central particle is not local keep their own key.
+*/
+void SFCPackUpdater::getSortedOrderHilbert()
+    {
+    assert(m_pdata);
+    assert(m_sort_order.size() >= m_pdata->getN());
+    assert(m_keys.size() >= m_pdata->getN());
+
+    const unsigned int N = m_pdata->getN();
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const BoxDim& box = m_pdata->getBox();
+
+    // bits per dimension, the key needs to fit into 63 bits
+    const unsigned int bits = (ndim == 2) ? 31 : 21;
+    const unsigned int key_bits = ndim*bits;
+
+    // number of bits needed to store the type
+    unsigned int type_bits = 0;
+    if (m_secondary_key == type)
+        {
+        while ((1u << type_bits) < m_pdata->getNTypes())
+            type_bits++;
+        }
+
+    // number of leading key bits that identify the grid cell
+    unsigned int grid_bits = 0;
+    while ((1u << grid_bits) < m_grid && grid_bits < bits)
+        grid_bits++;
+    const unsigned int cell_bits = std::min(ndim*grid_bits, 64 - type_bits);
+    const uint64_t cell_mask = (cell_bits > 0) ? (~uint64_t(0) << (64 - cell_bits)) : 0;
+
+    unsigned int n_chunks = 1;
+    #ifdef ENABLE_TBB
+    n_chunks = std::max(1u, std::min(m_exec_conf->getNumThreads(), N / 1024));
+    #endif
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    // compute the keys
+    #ifdef ENABLE_TBB
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+        [&](const tbb::blocked_range<unsigned int>& r) {
+    for (unsigned int i = r.begin(); i != r.end(); ++i)
+    #else
+    for (unsigned int i = 0; i < N; ++i)
+    #endif
+        {
+        Scalar4 postype = h_pos.data[i];
+        Scalar3 f = box.makeFraction(make_scalar3(postype.x, postype.y, postype.z));
+        unsigned int X[3];
+        X[0] = fractionToGrid(f.x, bits);
+        X[1] = fractionToGrid(f.y, bits);
+        X[2] = fractionToGrid(f.z, bits);
+        uint64_t key = hilbertKey(X, ndim, bits);
+
+        if (m_secondary_key == type)
+            {
+            // left align the key and insert the type after the cell
+            uint64_t aligned_key = key << (64 - key_bits);
+            uint64_t type_key = (type_bits > 0) ? (uint64_t(__scalar_as_int(postype.w)) << (64 - cell_bits - type_bits))
+                                                : 0;
+            key = (aligned_key & cell_mask) | type_key | ((aligned_key & ~cell_mask) >> type_bits);
+            }
+        else if (m_secondary_key == body)
+            {
+            key <<= 1;
+            }
+
+        m_keys[i] = key;
+        m_sort_order[i] = i;
+        }
+    #ifdef ENABLE_TBB
+        });
+    #endif
+
+    if (m_secondary_key == body)
+        {
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+        // central particles keep their keys, so the constituents can be updated in any order
+        for (unsigned int i = 0; i < N; ++i)
+            {
+            unsigned int body_id = h_body.data[i];
+            if (body_id == NO_BODY || body_id == h_tag.data[i])
+                continue;
+
+            unsigned int central_idx = h_rtag.data[body_id];
+            if (central_idx < N)
+                m_keys[i] = m_keys[central_idx] | 1;
+            }
+        }
+
+    radixSort(m_keys, m_sort_order, m_keys_alt, m_sort_order_alt, N, n_chunks);
+    }
+
 void SFCPackUpdater::writeTraversalOrder(const std::string& fname, const vector< unsigned int >& reverse_order)
     {
     m_exec_conf->msg->notice(2) << "sorter: Writing space filling curve traversal order to " << fname << endl;
@@ -614,8 +948,25 @@ void SFCPackUpdater::writeTraversalOrder(const std::string& fname, const vector<
 
 void export_SFCPackUpdater(py::module& m)
     {
-    py::class_<SFCPackUpdater, std::shared_ptr<SFCPackUpdater> >(m,"SFCPackUpdater",py::base<Updater>())
-    .def(py::init< std::shared_ptr<SystemDefinition> >())
+    py::class_<SFCPackUpdater, std::shared_ptr<SFCPackUpdater> > sfcpack(m,"SFCPackUpdater",py::base<Updater>());
+    sfcpack.def(py::init< std::shared_ptr<SystemDefinition> >())
     .def("setGrid", &SFCPackUpdater::setGrid)
+    .def("setKeyMode", &SFCPackUpdater::setKeyMode)
+    .def("setSecondaryKey", &SFCPackUpdater::setSecondaryKey)
+    .def("setAdaptive", &SFCPackUpdater::setAdaptive)
+    .def("getNumSorts", &SFCPackUpdater::getNumSorts)
+    ;
+
+    py::enum_<SFCPackUpdater::keyMode>(sfcpack, "keyMode")
+        .value("grid", SFCPackUpdater::keyMode::grid)
+        .value("hilbert", SFCPackUpdater::keyMode::hilbert)
+        .export_values()
+    ;
+
+    py::enum_<SFCPackUpdater::secondaryKey>(sfcpack, "secondaryKey")
+        .value("none", SFCPackUpdater::secondaryKey::none)
+        .value("type", SFCPackUpdater::secondaryKey::type)
+        .value("body", SFCPackUpdater::secondaryKey::body)
+        .export_values()
     ;
     }
@@ -18,6 +18,7 @@
 #include <memory>
 #include <vector>
 #include <utility>
+#include <stdint.h>
 #include <hoomd/extern/pybind/include/pybind11/pybind11.h>
 
 #ifndef __SFCPACK_UPDATER_H__
@@ -44,6 +45,18 @@
     which those bins appear along a hilbert curve. It is very efficient, even when the box size changes often as the
     grid dimension is kept constant.
 
+    With setKeyMode(hilbert), every particle instead gets the 63 bit (62 bit in 2D) Hilbert key of its position at
+    full resolution and the keys are ordered with a radix sort, which is multithreaded with TBB. This needs no
+    traversal table, so memory use does not depend on the grid dimension, and particles within one grid cell are
+    also ordered along the curve. Optionally, a secondary key groups the particles of the same type within each
+    grid cell, or places the constituent particles of rigid bodies directly after their central particle.
+
+    In adaptive mode (setAdaptive()), the updater period only sets how often the locality of the particle order is
+    checked. The locality metric is the mean distance between particles that are adjacent in memory. It is recorded
+    after each sort, and the particles are sorted again once it has grown by the given factor. Diffusive systems
+    then sort rarely while flowing systems sort as often as they need. The number of sorts and checks is reported
+    by printStats().
+
     \ingroup updaters
 */
 class PYBIND11_EXPORT SFCPackUpdater : public Updater
@@ -67,16 +80,85 @@ class PYBIND11_EXPORT SFCPackUpdater : public Updater
             m_grid = (unsigned int)pow(2.0, ceil(log(double(grid)) / log(2.0)));;
             }
 
+        //! Keys used to order the particles
+        enum keyMode
+            {
+            grid,       //!< Position of the grid bin along a precomputed Hilbert curve
+            hilbert     //!< Hilbert key of the particle position at full resolution
+            };
+
+        //! Secondary keys applied with the full resolution Hilbert key
+        enum secondaryKey
+            {
+            none,       //!< Order by the Hilbert key only
+            type,       //!< Group particles of the same type within each grid cell
+            body        //!< Place the constituents of a rigid body right after its central particle
+            };
+
+        //! Set the key used to order the particles
+        void setKeyMode(keyMode mode)
+            {
+            m_key_mode = mode;
+            }
+
+        //! Set the secondary key
+        void setSecondaryKey(secondaryKey key)
+            {
+            m_secondary_key = key;
+            }
+
+        //! Only sort when the locality of the particle order has degraded
+        /*! \param adaptive True to enable the adaptive mode
+            \param threshold Sort when the locality metric exceeds \a threshold times its value after the last sort
+        */
+        void setAdaptive(bool adaptive, Scalar threshold)
+            {
+            m_adaptive = adaptive;
+            m_threshold = threshold;
+
+            // sort at the next check to record the locality of the sorted order
+            m_sorted_locality = Scalar(0.0);
+            }
+
+        //! Get the number of sorts performed since the last resetStats()
+        unsigned int getNumSorts() const
+            {
+            return m_num_sorts;
+            }
+
+        //! Print statistics on the number of sorts
+        virtual void printStats();
+
+        //! Reset the statistics
+        virtual void resetStats()
+            {
+            m_num_sorts = 0;
+            m_num_checks = 0;
+            }
+
     protected:
         unsigned int m_grid;        //!< Grid dimension to use
         unsigned int m_last_grid;   //!< The last value of MMax
         unsigned int m_last_dim;    //!< Check the last dimension we ran at
         GPUArray< unsigned int > m_traversal_order;      //!< Generated traversal order of bins
+        keyMode m_key_mode;         //!< Key used to order the particles
+        secondaryKey m_secondary_key;   //!< Secondary key applied with the Hilbert key
+        std::vector<unsigned int> m_sort_order;             //!< Generated sort order of the particles
+        bool m_adaptive;            //!< True if sorts are triggered by the locality metric
+        Scalar m_threshold;         //!< Relative increase of the locality metric that triggers a sort
+        Scalar m_sorted_locality;   //!< Locality metric right after the last sort
+        unsigned int m_num_sorts;   //!< Number of sorts since the last resetStats()
+        unsigned int m_num_checks;  //!< Number of locality checks since the last resetStats()
+
+        //! Compute the mean distance between particles that are adjacent in memory
+        Scalar computeLocality();
 
         //! Helper function that actually performs the sort
         virtual void getSortedOrder2D();
         //! Helper function that actually performs the sort
         virtual void getSortedOrder3D();
+        //! Compute the sort order from full resolution Hilbert keys
+        virtual void getSortedOrderHilbert();
 
         //! Apply the sorted order to the particle data
         virtual void applySortOrder();
@@ -91,8 +173,10 @@ class PYBIND11_EXPORT SFCPackUpdater : public Updater
         virtual void reallocate();
 
     private:
-        std::vector<unsigned int> m_sort_order;             //!< Generated sort order of the particles
         std::vector< std::pair<unsigned int, unsigned int> > m_particle_bins;    //!< Binned particles
+        std::vector<uint64_t> m_keys;                       //!< Sort keys of the particles
+        std::vector<uint64_t> m_keys_alt;                   //!< Radix sort scratch space for the keys
+        std::vector<unsigned int> m_sort_order_alt;         //!< Radix sort scratch space for the sort order
 
    };
 
@@ -48,6 +48,9 @@ SFCPackUpdaterGPU::SFCPackUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef)
  */
 void SFCPackUpdaterGPU::reallocate()
     {
+    // the host arrays are used for the Hilbert key sort
+    SFCPackUpdater::reallocate();
+
     m_gpu_sort_order.resize(m_pdata->getMaxN());
     m_gpu_particle_bins.resize(m_pdata->getMaxN());
     }
@@ -135,11 +138,24 @@ void SFCPackUpdaterGPU::getSortedOrder3D()
     if (m_exec_conf->isCUDAErrorCheckingEnabled()) CHECK_CUDA_ERROR();
     }
 
+/*! The Hilbert keys are computed and sorted on the host, only the resulting order is copied to the GPU
+*/
+void SFCPackUpdaterGPU::getSortedOrderHilbert()
+    {
+    SFCPackUpdater::getSortedOrderHilbert();
+
+    ArrayHandle<unsigned int> h_gpu_sort_order(m_gpu_sort_order, access_location::host, access_mode::overwrite);
+    std::copy(m_sort_order.begin(), m_sort_order.begin() + m_pdata->getN(), h_gpu_sort_order.data);
+    }
+
 void SFCPackUpdaterGPU::applySortOrder()
     {
     assert(m_pdata);
     assert(m_gpu_sort_order.getNumElements() >= m_pdata->getN());
 
+    // the orientations, angular momenta and moments of inertia are only sorted if they are allocated
+    const bool aniso = m_pdata->hasAnisotropicArrays();
+
         {
         // access alternate arrays to write to
         ArrayHandle<Scalar4> d_pos_alt(m_pdata->getAltPositions(), access_location::device, access_mode::overwrite);
@@ -150,10 +166,10 @@ void SFCPackUpdaterGPU::applySortOrder()
         ArrayHandle<int3> d_image_alt(m_pdata->getAltImages(), access_location::device, access_mode::overwrite);
         ArrayHandle<unsigned int> d_body_alt(m_pdata->getAltBodies(), access_location::device, access_mode::overwrite);
         ArrayHandle<unsigned int> d_tag_alt(m_pdata->getAltTags(), access_location::device, access_mode::overwrite);
-        ArrayHandle<Scalar4> d_orientation_alt(m_pdata->getAltOrientationArray(), access_location::device, access_mode::overwrite);
+        ArrayHandle<Scalar4> d_orientation_alt(m_pdata->getAltOrientationArray(aniso), access_location::device, access_mode::overwrite);
 
-        ArrayHandle<Scalar4> d_angmom_alt(m_pdata->getAltAngularMomentumArray(), access_location::device, access_mode::overwrite);
-        ArrayHandle<Scalar3> d_inertia_alt(m_pdata->getAltMomentsOfInertiaArray(), access_location::device, access_mode::overwrite);
+        ArrayHandle<Scalar4> d_angmom_alt(m_pdata->getAltAngularMomentumArray(aniso), access_location::device, access_mode::overwrite);
+        ArrayHandle<Scalar3> d_inertia_alt(m_pdata->getAltMomentsOfInertiaArray(aniso), access_location::device, access_mode::overwrite);
         ArrayHandle<Scalar> d_net_virial_alt(m_pdata->getAltNetVirial(), access_location::device, access_mode::overwrite);
         ArrayHandle<Scalar4> d_net_force_alt(m_pdata->getAltNetForce(), access_location::device, access_mode::overwrite);
         ArrayHandle<Scalar4> d_net_torque_alt(m_pdata->getAltNetTorqueArray(), access_location::device, access_mode::overwrite);
@@ -167,9 +183,9 @@ void SFCPackUpdaterGPU::applySortOrder()
         ArrayHandle<int3> d_image(m_pdata->getImages(), access_location::device, access_mode::read);
         ArrayHandle<unsigned int> d_body(m_pdata->getBodies(), access_location::device, access_mode::read);
         ArrayHandle<unsigned int> d_tag(m_pdata->getTags(), access_location::device, access_mode::read);
-        ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(), access_location::device, access_mode::read);
-        ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(), access_location::device, access_mode::read);
-        ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(), access_location::device, access_mode::read);
+        ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(aniso), access_location::device, access_mode::read);
+        ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(aniso), access_location::device, access_mode::read);
+        ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(aniso), access_location::device, access_mode::read);
 
         ArrayHandle<Scalar> d_net_virial(m_pdata->getNetVirial(), access_location::device, access_mode::read);
         ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(), access_location::device, access_mode::read);
@@ -148,9 +148,12 @@ __global__ void gpu_apply_sorted_order_kernel(
     d_body_alt[idx] = d_body[old_idx];
     unsigned int tag = d_tag[old_idx];
     d_tag_alt[idx] = tag;
-    d_orientation_alt[idx] = d_orientation[old_idx];
-    d_angmom_alt[idx] = d_angmom[old_idx];
-    d_inertia_alt[idx] = d_inertia[old_idx];
+    if (d_orientation != NULL)
+        {
+        d_orientation_alt[idx] = d_orientation[old_idx];
+        d_angmom_alt[idx] = d_angmom[old_idx];
+        d_inertia_alt[idx] = d_inertia[old_idx];
+        }
     d_net_virial_alt[0*virial_pitch+idx] = d_net_virial[0*virial_pitch+old_idx];
     d_net_virial_alt[1*virial_pitch+idx] = d_net_virial[1*virial_pitch+old_idx];
     d_net_virial_alt[2*virial_pitch+idx] = d_net_virial[2*virial_pitch+old_idx];
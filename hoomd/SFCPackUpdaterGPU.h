@@ -57,6 +57,9 @@ class PYBIND11_EXPORT SFCPackUpdaterGPU : public SFCPackUpdater
         //! Helper function that actually performs the sort
         virtual void getSortedOrder3D();
 
+        //! Compute the sort order from full resolution Hilbert keys
+        virtual void getSortedOrderHilbert();
+
         //! Apply the sorted order to the particle data
         virtual void applySortOrder();
 
@@ -106,6 +106,27 @@ class PYBIND11_EXPORT Updater
             return Scalar(0.0);
             }
 
+        //! Resolves a log quantity to an integer handle
+        /*! \param quantity Name of the log quantity
+            \returns A non-negative handle to pass to getLogValueByHandle(), or -1 if the quantity is only
+                     available through getLogValue()
+
+            See Compute::getLogHandle() for details. The base class returns -1.
+        */
+        virtual int getLogHandle(const std::string& quantity)
+            {
+            return -1;
+            }
+
+        //! Calculates the log value for a handle returned by getLogHandle()
+        /*! \param handle Handle of the log quantity
+            \param timestep Current time step of the simulation
+        */
+        virtual Scalar getLogValueByHandle(int handle, unsigned int timestep)
+            {
+            return Scalar(0.0);
+            }
+
         //! Returns a list of log matrix quantities this compute calculates
         /*! The base class implementation just returns an empty vector. Derived classes should override
             this behavior and return a list of quantities that they log.
@@ -199,6 +199,12 @@ def run(tsteps, profile=False, limit_hours=None, limit_multiple=1, callback_peri
     if not quiet:
         context.msg.notice(1, "** starting run **\n");
     context.current.system.run(int(tsteps), callback_period, callback, limit_hours, int(limit_multiple));
+
+    # write out buffered log rows
+    for logger in context.current.loggers:
+        if hasattr(logger, 'flush'):
+            logger.flush();
+
     if not quiet:
         context.msg.notice(1, "** run complete **\n");
 
@@ -13,6 +13,7 @@ to see what they do.
 from hoomd import _hoomd;
 import hoomd;
 import sys;
+import struct;
 import numpy
 
 ## \internal
@@ -573,6 +574,275 @@ class log(_analyzer):
 
         hoomd.context.current.loggers.append(self)
 
+class log_binary(log):
+    R""" Log a number of calculated quantities to a binary columnar file.
+
+    Args:
+        filename (str): File to write the log to.
+        quantities (list): List of quantities to log.
+        period (int): Quantities are logged every *period* time steps.
+        buffer_size (int): Number of rows to hold in memory before they are written to the file.
+        overwrite (bool): When False (the default) an existing log will be appended to. When True, an existing log file will be overwritten instead.
+        phase (int): When -1, start on the current time step. When >= 0, execute on steps where *(step + phase) % period == 0*.
+
+    :py:class:`log_binary` logs the same quantities as :py:class:`log`, but stores each row as the time step followed
+    by the logged quantities in 8 byte floating point numbers. Rows are buffered in memory and *buffer_size* rows at a
+    time are written to the file in a background thread, so logging many quantities every few steps costs little time
+    in the simulation. All buffered rows are written at the end of every :py:func:`hoomd.run()`, or when
+    :py:meth:`flush()` is called.
+
+    Use :py:func:`read_log_binary` to access the file as a numpy array. It maps the file into memory without parsing it.
+
+    The columns are fixed when the file is created. Use the same list of quantities, in the same order, when
+    appending to an existing file.
+
+    Examples::
+
+        logger = analyze.log_binary(filename='thermo.log', period=10,
+                                    quantities=['potential_energy', 'pressure_xy', 'pressure_xz', 'pressure_yz'])
+        run(100000)
+
+        data = analyze.read_log_binary('thermo.log')
+        p_xy = data['pressure_xy']
+
+    """
+
+    def __init__(self, filename, quantities, period, buffer_size=1024, overwrite=False, phase=0):
+        hoomd.util.print_status_line();
+
+        # initialize base class
+        _analyzer.__init__(self);
+
+        if filename is None or filename == "":
+            hoomd.context.msg.error("analyze.log_binary: A file name is required\n");
+            raise ValueError("Error creating binary log");
+
+        # create the c++ mirror class
+        self.cpp_analyzer = _hoomd.LogBinary(hoomd.context.current.system_definition, filename, int(buffer_size), overwrite);
+        self.setupAnalyzer(period, phase);
+
+        # set the logged quantities
+        quantity_list = _hoomd.std_vector_string();
+        for item in quantities:
+            quantity_list.append(str(item));
+        self.cpp_analyzer.setLoggedQuantities(quantity_list);
+
+        # add the logger to the list of loggers
+        hoomd.context.current.loggers.append(self);
+
+        # store metadata
+        self.metadata_fields = ['filename','period','buffer_size']
+        self.filename = filename
+        self.period = period
+        self.buffer_size = buffer_size
+
+    def set_params(self, quantities=None):
+        R""" Change the parameters of the log.
+
+        Args:
+            quantities (list): New list of quantities to log (if specified)
+
+        The logged quantities can only be changed before the file has been created. Setting the same list again is
+        allowed.
+        """
+        hoomd.util.print_status_line();
+
+        if quantities is not None:
+            quantity_list = _hoomd.std_vector_string();
+            for item in quantities:
+                quantity_list.append(str(item));
+            self.cpp_analyzer.setLoggedQuantities(quantity_list);
+
+    def flush(self):
+        R""" Write all buffered rows to the file.
+
+        Examples::
+
+            logger.flush()
+            data = analyze.read_log_binary('thermo.log')
+        """
+        self.cpp_analyzer.flush();
+
+def read_log_binary(filename):
+    R""" Map a file written by :py:class:`log_binary` into memory.
+
+    Args:
+        filename (str): Name of the file to read.
+
+    Returns:
+        A read-only numpy structured array (:py:class:`numpy.memmap`) with one record per logged row. The fields
+        are named after the logged quantities, and the first field is *timestep*.
+
+    The file is not parsed: the rows are accessed directly from the mapped file. An incomplete row at the end of the
+    file is ignored. :py:func:`read_log_binary` does not require an initialized simulation context.
+
+    Examples::
+
+        data = analyze.read_log_binary('thermo.log')
+        print(data.dtype.names)
+        U = data['potential_energy']
+        t = data['timestep'].astype(numpy.uint64)
+    """
+    with open(filename, 'rb') as f:
+        header = f.read(24);
+        if len(header) < 24 or header[0:8] != b'HOOMDLOG':
+            raise RuntimeError("{} is not a binary log file".format(filename));
+
+        version, num_columns, offset = struct.unpack('=IIQ', header[8:24]);
+        if version != 1:
+            raise RuntimeError("Unsupported binary log version {}".format(version));
+
+        names = f.read(offset - 24).split(b'\0')[0:num_columns];
+        names = [n.decode('utf-8') for n in names];
+
+        f.seek(0, 2);
+        num_rows = (f.tell() - offset) // (8*num_columns);
+
+    dtype = numpy.dtype([(n, numpy.float64) for n in names]);
+    if num_rows == 0:
+        return numpy.zeros(0, dtype=dtype);
+
+    return numpy.memmap(filename, dtype=dtype, mode='r', offset=offset, shape=(num_rows,));
+
+class correlator(log):
+    R""" Compute time correlation functions and block averages during the simulation.
+
+    Args:
+        quantities (list): List of logged quantities to correlate (see :py:class:`log`).
+        period (int): Quantities are sampled every *period* time steps.
+        particle_quantities (list): Per-particle correlations to compute, any of ``'velocity'`` and ``'msd'``.
+        group (:py:mod:`hoomd.group`): Particles to include in the per-particle correlations.
+        num_points (int): Number of lag times per correlator level.
+        averaging (int): Number of samples averaged when passing on to the next level.
+        num_levels (int): Number of correlator and blocking levels.
+        phase (int): When -1, start on the current time step. When >= 0, execute on steps where *(step + phase) % period == 0*.
+
+    :py:class:`correlator` samples logged quantities like :py:class:`log`. Instead of writing them to a file, it
+    accumulates for each quantity:
+
+    - The autocorrelation function :math:`\langle A(t_0) A(t_0 + \tau) \rangle`, computed with the multiple-tau
+      scheme (Ramirez et al., J. Chem. Phys. 133, 154103 (2010)). Lags from 0 to *num_points* - 1 samples are
+      resolved exactly. Each further level averages *averaging* consecutive samples and extends the lag range by
+      that factor. The largest lag is *num_points* \* *averaging* ^ (*num_levels* - 1) samples.
+    - The mean and blocking estimates of its statistical error (Flyvbjerg and Petersen, J. Chem. Phys. 91, 461
+      (1989)). The error estimate from blocks of :math:`2^k` samples grows with :math:`k` until the blocks are
+      longer than the correlation time, after which it plateaus at the error of the mean.
+
+    Memory use grows only with the logarithm of the run length, so high frequency logs need not be stored.
+
+    With *particle_quantities*, per-particle correlations of the members of *group* are accumulated:
+
+    - **velocity** - velocity autocorrelation function :math:`\langle \vec{v}_i(t_0) \cdot \vec{v}_i(t_0 + \tau) \rangle`
+    - **msd** - mean squared displacement :math:`\langle |\vec{r}_i(t_0 + \tau) - \vec{r}_i(t_0)|^2 \rangle` of the
+      unwrapped positions. Lags beyond the first level use block averaged positions and are approximate.
+
+    The per-particle correlations keep *num_points* \* *num_levels* positions or velocities of every particle in
+    the group and are not available with domain decomposition.
+
+    Results accumulate over consecutive runs until :py:meth:`reset()` is called. The sampling period must be
+    constant.
+
+    Examples::
+
+        # Green-Kubo shear viscosity
+        corr = analyze.correlator(quantities=['pressure_xy', 'pressure_xz', 'pressure_yz'], period=5)
+        run(1e6)
+        tau, c_xy = corr.get('pressure_xy')
+
+        # diffusion
+        corr = analyze.correlator(quantities=['potential_energy'], period=100,
+                                  particle_quantities=['msd', 'velocity'], group=group.all())
+        run(1e6)
+        tau, msd = corr.get('msd')
+        mean, errors = corr.get_block_average('potential_energy')
+
+    """
+
+    def __init__(self, quantities, period, particle_quantities=[], group=None, num_points=16, averaging=2,
+                 num_levels=20, phase=0):
+        hoomd.util.print_status_line();
+
+        # initialize base class
+        _analyzer.__init__(self);
+
+        if callable(period):
+            hoomd.context.msg.error("analyze.correlator: The period must be constant\n");
+            raise ValueError("Error creating correlator");
+
+        # create the c++ mirror class
+        self.cpp_analyzer = _hoomd.LogCorrelator(hoomd.context.current.system_definition, int(num_points),
+                                                 int(averaging), int(num_levels));
+        self.setupAnalyzer(period, phase);
+
+        # set the correlated quantities
+        quantity_list = _hoomd.std_vector_string();
+        for item in quantities:
+            quantity_list.append(str(item));
+        self.cpp_analyzer.setLoggedQuantities(quantity_list);
+
+        if len(particle_quantities) > 0:
+            if group is None:
+                hoomd.context.msg.error("analyze.correlator: A group is required for particle quantities\n");
+                raise ValueError("Error creating correlator");
+
+            for item in particle_quantities:
+                self.cpp_analyzer.addParticleCorrelation(str(item), group.cpp_group);
+
+        # add the logger to the list of loggers
+        hoomd.context.current.loggers.append(self);
+
+        # store metadata
+        self.metadata_fields = ['period','num_points','averaging','num_levels']
+        self.filename = None
+        self.period = period
+        self.num_points = num_points
+        self.averaging = averaging
+        self.num_levels = num_levels
+
+    def set_params(self, quantities=None):
+        R""" Change the parameters of the correlator.
+
+        Args:
+            quantities (list): New list of quantities to correlate (if specified)
+
+        Accumulated data is kept for quantities that remain in the list.
+        """
+        hoomd.util.print_status_line();
+
+        if quantities is not None:
+            quantity_list = _hoomd.std_vector_string();
+            for item in quantities:
+                quantity_list.append(str(item));
+            self.cpp_analyzer.setLoggedQuantities(quantity_list);
+
+    def get(self, quantity):
+        R""" Get a correlation function.
+
+        Args:
+            quantity (str): Name of a correlated quantity, or ``'velocity'`` or ``'msd'``.
+
+        Returns:
+            A tuple of numpy arrays: the lag times in time steps and the correlation function at these lags.
+        """
+        lags = self.cpp_analyzer.getLags(quantity);
+        return (lags * self.period, self.cpp_analyzer.getCorrelation(quantity));
+
+    def get_block_average(self, quantity):
+        R""" Get the mean of a quantity and estimates of its statistical error.
+
+        Args:
+            quantity (str): Name of a correlated quantity.
+
+        Returns:
+            A tuple with the mean and a numpy array with the error estimates from blocks of 1, 2, 4, ... samples.
+        """
+        return (self.cpp_analyzer.getMean(quantity), self.cpp_analyzer.getBlockErrors(quantity));
+
+    def reset(self):
+        R""" Discard all accumulated samples.
+        """
+        self.cpp_analyzer.reset();
+
 class callback(_analyzer):
     R""" Callback analyzer.
 
@@ -82,6 +82,51 @@ def barrier():
     if _hoomd.is_MPI_available():
         hoomd.context.exec_conf.barrier()
 
+def set_ghost_position_mode(mode):
+    """ Set how ghost particle positions are sent between ranks on time steps without a ghost exchange.
+
+    Args:
+        mode (str): One of ``'full'``, ``'xyz'`` or ``'xyz_offset'``
+
+    Between two neighbor list builds, only the positions of ghost particles change. By default (``'full'``),
+    the complete position and type of every ghost particle is sent. With ``'xyz'``, only the coordinates are sent,
+    because the type of a ghost particle cannot change before the next exchange. With ``'xyz_offset'``, the
+    coordinates are sent as single precision offsets relative to the origin of the sending domain, plus one origin per
+    message. In double precision builds, a ghost position update sends 32 bytes per particle with ``'full'``, 24 with
+    ``'xyz'`` and 12 with ``'xyz_offset'``. In single precision builds, ``'full'`` sends 16 bytes per particle and
+    both reduced modes send 12.
+
+    ``'xyz_offset'`` rounds ghost coordinates to single precision relative to the domain. Check the energy
+    conservation of your system in NVE simulations before using it in production runs.
+
+    Examples::
+
+        comm.set_ghost_position_mode('xyz_offset')
+
+    Note:
+        The system must be initialized before calling this method. The setting only affects the CPU code path
+        and is ignored in non-MPI builds and on a single rank.
+    """
+    hoomd.util.print_status_line();
+
+    if not hoomd.init.is_initialized():
+        hoomd.context.msg.error("comm.set_ghost_position_mode: cannot set mode before system is initialized\n");
+        raise RuntimeError('Error setting ghost position mode');
+
+    modes = ['full', 'xyz', 'xyz_offset'];
+    if mode not in modes:
+        hoomd.context.msg.error("comm.set_ghost_position_mode: mode must be one of " + str(modes) + "\n");
+        raise ValueError('Error setting ghost position mode');
+
+    if not _hoomd.is_MPI_available():
+        return;
+
+    cpp_comm = hoomd.context.current.system.getCommunicator();
+    if cpp_comm is None:
+        return;
+
+    cpp_comm.setGhostPositionMode(getattr(_hoomd.Communicator.ghostPositionMode, mode));
+
 class decomposition(object):
     """ Set the domain decomposition.
 
@@ -266,6 +266,27 @@ class thermo(_compute):
 
         hoomd.context.current.thermo.append(self)
 
+    def set_params(self, deterministic=None):
+        R""" Change thermo parameters.
+
+        Args:
+            deterministic (bool): When True, sum the per-particle terms in a fixed order that depends only on the
+              group size, so that runs give bitwise identical results with any number of threads (CPU only).
+
+        When HOOMD is built with TBB, the sums over the particles in the group are split among the threads. By
+        default, the partial sums are combined in the order the threads finish, which is the fastest option but may
+        change the last bits of the result from run to run. Set *deterministic* to True to combine them in a fixed
+        tree order instead. The tree does not depend on the number of threads.
+
+        Examples::
+
+            my_thermo.set_params(deterministic=True)
+        """
+        hoomd.util.print_status_line()
+
+        if deterministic is not None:
+            self.cpp_compute.setDeterministic(deterministic)
+
 ## \internal
 # \brief Returns the previously created compute.thermo with the same group, if created. Otherwise, creates a new
 # compute.thermo
@@ -468,6 +468,28 @@ Forces can be accessed in a similar way::
 In this manner, forces due to the lj pair force, bonds, and any other force commands in hoomd can be accessed
 independently from one another. See :py:class:`hoomd.data.force_data_proxy` for a definition of each data field.
 
+.. rubric:: Local array access
+
+Proxies access one particle at a time, and snapshots copy and gather the whole system. To process all particles
+quickly, for example in an :py:class:`hoomd.analyze.callback`, access the local particle arrays directly as numpy
+arrays inside a ``with`` block::
+
+    with system.particles.local_access() as local:
+        com = numpy.mean(local.position, axis=0)
+        ke = 0.5 * numpy.sum(local.mass * numpy.sum(local.velocity**2, axis=1))
+
+    with system.particles.local_access(readonly=False) as local:
+        local.velocity[:] *= 0.5
+
+The arrays reference the simulation memory directly and include only the particles local to this MPI rank, in
+their current (sorted) order. Use ``local.tag`` to get the tag of each local particle, and ``local.rtag[tag]`` to get
+the local index of a tag (or 4294967295 if the particle is on another rank). The available arrays are ``position``,
+``velocity``, ``mass``, ``net_force``, ``tag`` and ``rtag``.
+
+.. warning::
+    Do not store references to the arrays beyond the ``with`` block, and do not access particle data through other
+    means (proxies, snapshots, or running the simulation) inside it. ``tag`` and ``rtag`` are always read only.
+
 .. Proxy references
 
 For advanced code using the particle data access from python, it is important to understand that the hoomd
@@ -1123,6 +1145,13 @@ class particle_data(hoomd.meta._metadata):
     def __len__(self):
         return self.pdata.getNGlobal();
 
+    ## \internal
+    # \brief Access the local particle arrays as numpy arrays
+    # \param readonly Set to False to allow modification of the positions, velocities, masses and net forces
+    # \returns A context manager, see hoomd.data for usage
+    def local_access(self, readonly=True):
+        return local_particle_data(self.pdata, readonly);
+
     ## \internal
     # \brief Get an informal string representing the object
     def __str__(self):
@@ -1142,6 +1171,27 @@ class particle_data(hoomd.meta._metadata):
         data['types'] = list(self.types);
         return data
 
+## \internal
+# \brief Context manager that provides numpy views of the local particle data
+#
+# Handles on the particle data arrays are held from the first access to an array until the end of the with block.
+class local_particle_data(object):
+    ## \internal
+    # \brief create a local_particle_data
+    #
+    # \param pdata ParticleData to access
+    # \param readonly True to expose read only arrays
+    def __init__(self, pdata, readonly):
+        self.cpp_access = _hoomd.LocalParticleDataAccess(pdata, readonly);
+
+    def __enter__(self):
+        self.cpp_access.enter();
+        return self.cpp_access;
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.cpp_access.exit();
+        return False;
+
 class particle_data_proxy(object):
     R""" Access a single particle via a proxy.
 
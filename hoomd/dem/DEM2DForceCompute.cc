@@ -12,6 +12,11 @@
 #include <hoomd/extern/pybind/include/pybind11/pybind11.h>
 
 #include <stdexcept>
+#include <algorithm>
+
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
 
 #ifdef ENABLE_OPENMP
 #include <omp.h>
@@ -169,155 +174,212 @@ void DEM2DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
     // get a local copy of the simulation box too
     const BoxDim& box = m_pdata->getBox();
 
-    // create a temporary copy of r_cut sqaured
-    Scalar r_cut_sq = m_r_cut * m_r_cut;
-
-    // tally up the number of forces calculated
-    int64_t n_calc = 0;
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_all = N + m_pdata->getNGhosts();
+    const unsigned int ntypes = m_pdata->getNTypes();
 
-    // for each particle
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    // number of vertices and bounding radius (the largest distance of a vertex from the center of mass) of each type
+    std::vector<unsigned int> type_verts(ntypes, 0);
+    std::vector<Real> type_radius(ntypes, Real(0));
+    Real max_radius(0);
+    for (unsigned int t = 0; t < ntypes && t < m_shapes.size(); t++)
         {
-        // access the particle's position and type (MEM TRANSFER: 4 scalars)
-        vec3<Scalar> pi(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        quat<Scalar> quati(h_orientation.data[i]);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
-
-        // initialize current particle force, potential energy, and virial to 0
-        vec2<Real> fi;
-        Real ti(0), pei(0);
-        Real viriali[6];
-        for (int k = 0; k < 6; k++)
-            viriali[k] = 0.0;
-
-        // If the evaluator needs the diameters of the particles to evaluate, grab particle_i's here
-        // MEM TRANSFER (1 scalar)
-        Scalar di;
-        if (Potential::needsDiameter())
-            {
-            di = h_diameter.data[i];
-            }
+        type_verts[t] = m_shapes[t].size();
+        for (unsigned int v = 0; v < type_verts[t]; v++)
+            type_radius[t] = std::max(type_radius[t], Real(sqrt(dot(m_shapes[t][v], m_shapes[t][v]))));
+        max_radius = std::max(max_radius, type_radius[t]);
+        }
 
-        vec3<Scalar> vi;
-        if(Potential::needsVelocity())
-            vi = vec3<Scalar>(h_velocity.data[i]);
+    // r_cut covers the two largest shapes plus the range of the contact potential
+    const Real contact_range(std::max(m_r_cut - 2*max_radius, Real(0)));
 
-        // Make a local copy for the rotated vertices for particle i
-        vector<vec2<Real> > vertices_i(m_shapes[typei]);
-        for(typename vector<vec2<Real> >::iterator vertIter(vertices_i.begin());
-            vertIter != vertices_i.end(); ++vertIter)
-            *vertIter = rotate(quati, *vertIter);
+    // lay out the world-frame vertices of every particle consecutively
+    m_worldVertOffset.resize(n_all);
+    unsigned int n_world_verts = 0;
+    for (unsigned int i = 0; i < n_all; i++)
+        {
+        m_worldVertOffset[i] = n_world_verts;
+        n_world_verts += type_verts[__scalar_as_int(h_pos.data[i].w)];
+        }
+    m_worldVerts.resize(n_world_verts);
+
+    // rotate the vertices of each particle once, rather than once per pair they take part in
+    #ifdef ENABLE_TBB
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_all),
+        [&](const tbb::blocked_range<unsigned int>& r) {
+    for (unsigned int i = r.begin(); i != r.end(); ++i)
+    #else
+    for (unsigned int i = 0; i < n_all; i++)
+    #endif
+        {
+        const quat<Scalar> quati(h_orientation.data[i]);
+        const unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        vec2<Real> *world_verts = m_worldVerts.data() + m_worldVertOffset[i];
 
-        // loop over all of the neighbors of this particle
-        const unsigned int myHead = h_head_list.data[i];
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int j = 0; j < size; j++)
-            {
-            // increment our calculation counter
-            n_calc++;
+        for (unsigned int v = 0; v < type_verts[typei]; v++)
+            world_verts[v] = rotate(quati, m_shapes[typei][v]);
+        }
+    #ifdef ENABLE_TBB
+        });
+    #endif
+
+    // with a half neighbor list forces act on j as well as on i, so all but one chunk of particles
+    // accumulate into private arrays
+    unsigned int n_chunks = 1;
+    #ifdef ENABLE_TBB
+    // limit the memory used by the private arrays; contacts are expensive enough to split small systems
+    const unsigned int max_chunks = 16;
+    n_chunks = std::max(1u, std::min(std::min(m_exec_conf->getNumThreads(), N/64), max_chunks));
+    #endif
+    const bool private_arrays = third_law && n_chunks > 1;
+
+    if (private_arrays)
+        {
+        m_force_scratch.resize((n_chunks-1)*N);
+        m_torque_scratch.resize((n_chunks-1)*N);
+        m_virial_scratch.resize((n_chunks-1)*6*N);
+        }
 
-            // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-            unsigned int k = h_nlist.data[myHead + j];
-            // sanity check
-            assert(k < m_pdata->getN());
+    //! Compute the forces on particles first to last-1 (and their half-list neighbors) into force, torque and virial
+    auto compute_range = [&](unsigned int first, unsigned int last, Scalar4 *force, Scalar4 *torque,
+                             Scalar *virial, unsigned int pitch)
+        {
+        // the evaluator carries per-pair diameter and velocity state, so every chunk needs its own
+        DEMEvaluator<Real, Real4, Potential> evaluator(m_evaluator);
 
-            // calculate dr (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            vec3<Scalar> pj(h_pos.data[k].x, h_pos.data[k].y, 0);
-            quat<Scalar> quatj(h_orientation.data[k]);
-            vec3<Scalar> dx3(pj - pi);
+        const vec2<Real> *world_verts = m_worldVerts.data();
 
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar
-            unsigned int typej = __scalar_as_int(h_pos.data[k].w);
+        for (unsigned int i = first; i < last; i++)
+            {
+            // access the particle's position and type (MEM TRANSFER: 4 scalars)
+            vec3<Scalar> pi(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
             // sanity check
-            assert(typej < m_pdata->getNTypes());
+            assert(typei < m_pdata->getNTypes());
 
-            // apply periodic boundary conditions (FLOPS: 9 (worst case: first branch is missed, the 2nd is taken and the add is done)
-            dx3 = vec3<Scalar>(box.minImage(vec_to_scalar3(dx3)));
-            vec2<Real> dx(dx3.x, dx3.y);
+            // initialize current particle force, potential energy, and virial to 0
+            vec2<Real> fi;
+            Real ti(0), pei(0);
+            Real viriali[6];
+            for (int l = 0; l < 6; l++)
+                viriali[l] = 0.0;
 
-            // If the evaluator needs the diameters of the particles to evaluate, grab particle_j's and
-            // pass in the diameters of the particles here
+            // If the evaluator needs the diameters of the particles to evaluate, grab particle_i's here
             // MEM TRANSFER (1 scalar)
-            Scalar dj;
+            Scalar di;
             if (Potential::needsDiameter())
                 {
-                dj = h_diameter.data[k];
-                m_evaluator.setDiameter(di,dj);
+                di = h_diameter.data[i];
                 }
 
+            vec3<Scalar> vi;
             if(Potential::needsVelocity())
-                m_evaluator.setVelocity(vi - vec3<Scalar>(h_velocity.data[k]));
+                vi = vec3<Scalar>(h_velocity.data[i]);
 
-            // start computing the force
-            // calculate r squared (FLOPS: 5)
-            Scalar rsq = dot(dx, dx);
+            // the rotated vertices of particle i
+            const vec2<Real> *vertices_i = world_verts + m_worldVertOffset[i];
+            const unsigned int numVerts_i = type_verts[typei];
 
-            // only compute the force if the particles are closer than the cuttoff (FLOPS: 1)
-            if (m_evaluator.withinCutoff(rsq,r_cut_sq))
+            // loop over all of the neighbors of this particle
+            const unsigned int myHead = h_head_list.data[i];
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            for (unsigned int j = 0; j < size; j++)
                 {
+                // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                unsigned int k = h_nlist.data[myHead + j];
+                // sanity check
+                assert(k < m_pdata->getN() + m_pdata->getNGhosts());
+
+                // calculate dr (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                vec3<Scalar> pj(h_pos.data[k].x, h_pos.data[k].y, 0);
+                vec3<Scalar> dx3(pj - pi);
+
+                // access the type of the neighbor particle (MEM TRANSFER: 1 scalar
+                unsigned int typej = __scalar_as_int(h_pos.data[k].w);
+                // sanity check
+                assert(typej < m_pdata->getNTypes());
+
+                // apply periodic boundary conditions (FLOPS: 9 (worst case: first branch is missed, the 2nd is taken and the add is done)
+                dx3 = vec3<Scalar>(box.minImage(vec_to_scalar3(dx3)));
+                vec2<Real> dx(dx3.x, dx3.y);
+
+                // If the evaluator needs the diameters of the particles to evaluate, grab particle_j's and
+                // pass in the diameters of the particles here
+                // MEM TRANSFER (1 scalar)
+                Scalar dj;
+                if (Potential::needsDiameter())
+                    {
+                    dj = h_diameter.data[k];
+                    evaluator.setDiameter(di,dj);
+                    }
+
+                // start computing the force
+                // calculate r squared (FLOPS: 5)
+                Scalar rsq = dot(dx, dx);
+
+                // skip the pair unless the bounding disks of the two shapes are within contact range (FLOPS: 3)
+                const Real r_bound(std::min(type_radius[typei] + type_radius[typej] + contact_range, m_r_cut));
+                if (!evaluator.withinCutoff(rsq, r_bound*r_bound))
+                    continue;
+
+                if(Potential::needsVelocity())
+                    evaluator.setVelocity(vi - vec3<Scalar>(h_velocity.data[k]));
+
                 // local forces and torques for particles i and j
                 vec2<Real> forceij, forceji;
                 Real torqueij(0), torqueji(0), potentialij(0);
 
-                // Make a local copy for the rotated vertices for particle j
-                vector<vec2<Real> > vertices_j(m_shapes[typej]);
-                for(typename vector<vec2<Real> >::iterator vertIter(vertices_j.begin());
-                    vertIter != vertices_j.end(); ++vertIter)
-                    *vertIter = rotate(quatj, *vertIter);
+                // the rotated vertices of particle j
+                const vec2<Real> *vertices_j = world_verts + m_worldVertOffset[k];
+                const unsigned int numVerts_j = type_verts[typej];
 
                 // Iterate over each vertex of particle i, if particle j has any edges
-                if (vertices_j.size()>1)
+                if (numVerts_j > 1)
                     {
-                    for(typename vector<vec2<Real> >::const_iterator viIter(vertices_i.begin());
-                        viIter != vertices_i.end(); ++viIter)
+                    for (unsigned int vi_idx = 0; vi_idx < numVerts_i; vi_idx++)
                         {
                         // iterate over each edge of particle j
-                        for(typename vector<vec2<Real> >::const_iterator vjIter(vertices_j.begin());
-                            vjIter + 1 != vertices_j.end(); ++vjIter)
+                        for (unsigned int vj_idx = 0; vj_idx + 1 < numVerts_j; vj_idx++)
                             {
-                            m_evaluator.vertexEdge(dx, *viIter, *vjIter, *(vjIter + 1),
+                            evaluator.vertexEdge(dx, vertices_i[vi_idx], vertices_j[vj_idx], vertices_j[vj_idx + 1],
                                 potentialij, forceij, torqueij,
                                 forceji, torqueji);
                             }
                         // evaluate for the last edge, but only if we
                         // didn't just evaluate that edge (i.e. the
                         // shape isn't a spherocylinder)
-                        if(vertices_j.size() > 2)
-                            m_evaluator.vertexEdge(dx, *viIter, vertices_j.back(), vertices_j.front(),
+                        if(numVerts_j > 2)
+                            evaluator.vertexEdge(dx, vertices_i[vi_idx], vertices_j[numVerts_j - 1], vertices_j[0],
                                 potentialij, forceij, torqueij,
                                 forceji, torqueji);
                         }
                     }
                 // iterate over each vertex of particle j, if vi has any edges
-                if (vertices_i.size()>1)
+                if (numVerts_i > 1)
                     {
-                    for(typename vector<vec2<Real> >::const_iterator vjIter(vertices_j.begin());
-                        vjIter != vertices_j.end(); ++vjIter)
+                    for (unsigned int vj_idx = 0; vj_idx < numVerts_j; vj_idx++)
                         {
                         // iterate over each edge of particle i
-                        for(typename vector<vec2<Real> >::const_iterator viIter(vertices_i.begin());
-                            viIter + 1 != vertices_i.end(); ++viIter)
+                        for (unsigned int vi_idx = 0; vi_idx + 1 < numVerts_i; vi_idx++)
                             {
-                            m_evaluator.vertexEdge(-dx, *vjIter, *viIter, *(viIter + 1),
+                            evaluator.vertexEdge(-dx, vertices_j[vj_idx], vertices_i[vi_idx], vertices_i[vi_idx + 1],
                                 potentialij, forceji, torqueji,
                                 forceij, torqueij);
                             }
                         // evaluate for the last edge, but only if we
                         // didn't just evaluate that edge (i.e. the
                         // shape isn't a spherocylinder)
-                        if(vertices_i.size() > 2)
-                            m_evaluator.vertexEdge(-dx, *vjIter, vertices_i.back(), vertices_i.front(),
+                        if(numVerts_i > 2)
+                            evaluator.vertexEdge(-dx, vertices_j[vj_idx], vertices_i[numVerts_i - 1], vertices_i[0],
                                 potentialij, forceji, torqueji,
                                 forceij, torqueij);
                         }
                     }
                 // if i doesn't have any edges and j doesn't have any
                 // edges, both are disks
-                else if(vertices_j.size() <= 1)
+                else if(numVerts_i == 1 && numVerts_j == 1)
                     {
-                    m_evaluator.vertexVertex(dx, vertices_i[0], dx + vertices_j[0],
+                    evaluator.vertexVertex(dx, vertices_i[0], dx + vertices_j[0],
                         potentialij, forceij, torqueij,
                         forceji, torqueji);
                     }
@@ -342,36 +404,100 @@ void DEM2DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
                 viriali[3] += pair_virial[3];
 
                 // add the force to particle j if we are using the third law (MEM TRANSFER: 10 scalars / FLOPS: 8)
-                if (third_law && k < m_pdata->getN())
+                if (third_law && k < N)
                     {
-                    h_force.data[k].x  += forceji.x;
-                    h_force.data[k].y  += forceji.y;
-                    h_force.data[k].w  += potentialij;
-                    h_torque.data[k].z += torqueji;
-                    h_virial.data[0*virial_pitch + k] += pair_virial[0];
-                    h_virial.data[1*virial_pitch + k] += pair_virial[1];
-                    h_virial.data[3*virial_pitch + k] += pair_virial[3];
+                    force[k].x  += forceji.x;
+                    force[k].y  += forceji.y;
+                    force[k].w  += potentialij;
+                    torque[k].z += torqueji;
+                    virial[0*pitch + k] += pair_virial[0];
+                    virial[1*pitch + k] += pair_virial[1];
+                    virial[3*pitch + k] += pair_virial[3];
                     }
                 }
 
+            // finally, increment the force, potential energy and virial for particle i
+            // (MEM TRANSFER: 10 scalars / FLOPS: 5)
+            force[i].x  += fi.x;
+            force[i].y  += fi.y;
+            force[i].w  += pei;
+            torque[i].z += ti;
+            virial[0*pitch + i] += viriali[0];
+            virial[1*pitch + i] += viriali[1];
+            virial[3*pitch + i] += viriali[3];
             }
+        };
 
-        // finally, increment the force, potential energy and virial for particle i
-        // (MEM TRANSFER: 10 scalars / FLOPS: 5)
-        h_force.data[i].x  += fi.x;
-        h_force.data[i].y  += fi.y;
-        h_force.data[i].w  += pei;
-        h_torque.data[i].z += ti;
-        h_virial.data[0*virial_pitch + i] += viriali[0];
-        h_virial.data[1*virial_pitch + i] += viriali[1];
-        h_virial.data[3*virial_pitch + i] += viriali[3];
+    #ifdef ENABLE_TBB
+    tbb::parallel_for((unsigned int)0, n_chunks, [&](unsigned int chunk)
+    #else
+    for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+    #endif
+        {
+        Scalar4 *force = h_force.data;
+        Scalar4 *torque = h_torque.data;
+        Scalar *virial = h_virial.data;
+        unsigned int pitch = virial_pitch;
+        if (private_arrays && chunk > 0)
+            {
+            force = &m_force_scratch[(chunk-1)*N];
+            torque = &m_torque_scratch[(chunk-1)*N];
+            virial = &m_virial_scratch[(chunk-1)*6*N];
+            pitch = N;
+            memset(force, 0, sizeof(Scalar4)*N);
+            memset(torque, 0, sizeof(Scalar4)*N);
+            memset(virial, 0, sizeof(Scalar)*6*N);
+            }
+
+        unsigned int first = (unsigned int)((unsigned long)N*chunk/n_chunks);
+        unsigned int last = (unsigned int)((unsigned long)N*(chunk+1)/n_chunks);
+        compute_range(first, last, force, torque, virial, pitch);
         }
+    #ifdef ENABLE_TBB
+    );
+    #endif
 
-    int64_t flops = m_pdata->getN() * 5 + n_calc * (3+5+9+1+14+6+8);
-    if (third_law) flops += n_calc * 8;
-    int64_t mem_transfer = m_pdata->getN() * (5+4+10)*sizeof(Scalar) + n_calc * (1+3+1)*sizeof(Scalar);
-    if (third_law) mem_transfer += n_calc*10*sizeof(Scalar);
-    if (m_prof) m_prof->pop(flops, mem_transfer);
+    // sum up the private arrays in a fixed order
+    if (private_arrays)
+        {
+        #ifdef ENABLE_TBB
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+            [&](const tbb::blocked_range<unsigned int>& r) {
+        for (unsigned int i = r.begin(); i != r.end(); ++i)
+        #else
+        for (unsigned int i = 0; i < N; ++i)
+        #endif
+            {
+            for (unsigned int chunk = 1; chunk < n_chunks; ++chunk)
+                {
+                const Scalar4& f = m_force_scratch[(chunk-1)*N + i];
+                h_force.data[i].x += f.x;
+                h_force.data[i].y += f.y;
+                h_force.data[i].w += f.w;
+                h_torque.data[i].z += m_torque_scratch[(chunk-1)*N + i].z;
+
+                for (unsigned int l = 0; l < 6; ++l)
+                    h_virial.data[l*virial_pitch + i] += m_virial_scratch[((chunk-1)*6 + l)*N + i];
+                }
+            }
+        #ifdef ENABLE_TBB
+            });
+        #endif
+        }
+
+    if (m_prof)
+        {
+        // tally up the number of pairs considered
+        int64_t n_calc = 0;
+        for (unsigned int i = 0; i < N; i++)
+            n_calc += h_n_neigh.data[i];
+
+        int64_t flops = N * 5 + n_calc * (3+5+9+3+14+6+8);
+        if (third_law) flops += n_calc * 8;
+        int64_t mem_transfer = N * (5+4+10)*sizeof(Scalar) + n_calc * (1+3+1)*sizeof(Scalar);
+        if (third_law) mem_transfer += n_calc*10*sizeof(Scalar);
+        m_prof->pop(flops, mem_transfer);
+        }
     }
 
 #ifdef WIN32
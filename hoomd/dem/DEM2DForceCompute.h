@@ -35,6 +35,10 @@
   Forces can be computed directly by calling compute() and then retrieved with a call to acquire(), but
   a more typical usage will be to add the force compute to NVEUpdater or NVTUpdater.
 
+  The vertices of every local and ghost particle are rotated into the world frame once per step, and pairs
+  whose bounding disks do not come within contact range are skipped before any contact is evaluated. With TBB,
+  particles are split into chunks that are evaluated in parallel, as in DEM3DForceCompute.
+
   \ingroup computes
 */
 template<typename Real, typename Real4, typename Potential>
@@ -86,6 +90,11 @@ class DEM2DForceCompute : public ForceCompute
         Real m_r_cut;         //!< Cutoff radius beyond which the force is set to 0
         DEMEvaluator<Real, Real4, Potential> m_evaluator; //!< Object holding parameters and computation method for the potential
         std::vector<std::vector<vec2<Real> > > m_shapes; //!< Vertices for each type
+        std::vector<vec2<Real> > m_worldVerts; //!< World-frame vertices of each local and ghost particle
+        std::vector<unsigned int> m_worldVertOffset; //!< particle->first vertex in m_worldVerts
+        std::vector<Scalar4> m_force_scratch; //!< Private force arrays of all but the first chunk
+        std::vector<Scalar4> m_torque_scratch; //!< Private torque arrays of all but the first chunk
+        std::vector<Scalar> m_virial_scratch; //!< Private virial arrays of all but the first chunk
 
         //! Actually compute the forces
         virtual void computeForces(unsigned int timestep);
@@ -16,6 +16,11 @@
 #include <stdexcept>
 #include <utility>
 #include <set>
+#include <algorithm>
+
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
 
 #ifdef ENABLE_OPENMP
 #include <omp.h>
@@ -541,10 +546,6 @@ void DEM3DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
     // GPU array handles
     ArrayHandle<Real4> h_verts(m_verts, access_location::host,
         access_mode::read);
-    ArrayHandle<Real> h_faceRcutSq(m_faceRcutSq, access_location::host,
-        access_mode::read);
-    ArrayHandle<Real> h_edgeRcutSq(m_edgeRcutSq, access_location::host,
-        access_mode::read);
     ArrayHandle<unsigned int> h_nextFaceVert(m_nextFaceVert, access_location::host,
         access_mode::read);
     ArrayHandle<unsigned int> h_realVertIndex(m_realVertIndex, access_location::host,
@@ -563,117 +564,195 @@ void DEM3DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
         access_mode::read);
     ArrayHandle<unsigned int> h_numTypeFaces(m_numTypeFaces, access_location::host,
         access_mode::read);
-    ArrayHandle<unsigned int> h_vertexConnectivity(m_vertexConnectivity, access_location::host,
-        access_mode::read);
     ArrayHandle<unsigned int> h_edges(m_edges, access_location::host,
         access_mode::read);
 
-
     // get a local copy of the simulation box too
     const BoxDim& box = m_pdata->getBox();
 
-    // create a temporary copy of r_cut sqaured
-    Scalar r_cut_sq = m_r_cut * m_r_cut;
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_all = N + m_pdata->getNGhosts();
+    const unsigned int ntypes = m_pdata->getNTypes();
 
-    // tally up the number of forces calculated
-    int64_t n_calc = 0;
+    // lay out the world-frame vertices of every particle consecutively
+    m_worldVertOffset.resize(n_all);
+    unsigned int n_world_verts = 0;
+    for (unsigned int i = 0; i < n_all; i++)
+        {
+        m_worldVertOffset[i] = n_world_verts;
+        n_world_verts += h_numTypeVerts.data[__scalar_as_int(h_pos.data[i].w)];
+        }
+    m_worldVerts.resize(n_world_verts);
+
+    // rotate the vertices of each particle once, rather than once per pair they take part in
+    #ifdef ENABLE_TBB
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_all),
+        [&](const tbb::blocked_range<unsigned int>& r) {
+    for (unsigned int i = r.begin(); i != r.end(); ++i)
+    #else
+    for (unsigned int i = 0; i < n_all; i++)
+    #endif
+        {
+        const quat<Scalar> quati(h_orientation.data[i]);
+        const unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        const Real4 *verts = h_verts.data + h_firstTypeVert.data[typei];
+        vec3<Real> *world_verts = m_worldVerts.data() + m_worldVertOffset[i];
 
-    // for each particle
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        for (unsigned int v = 0; v < h_numTypeVerts.data[typei]; v++)
+            world_verts[v] = rotate(quati, vec3<Real>(verts[v]));
+        }
+    #ifdef ENABLE_TBB
+        });
+    #endif
+
+    // bounding radius of each type: the largest distance of a vertex from the center of mass
+    std::vector<Real> type_radius(ntypes, Real(0));
+    Real max_radius(0);
+    for (unsigned int t = 0; t < ntypes; t++)
         {
-        // access the particle's position and type (MEM TRANSFER: 4 scalars)
-        vec3<Scalar> pi(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        quat<Scalar> quati(h_orientation.data[i]);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
-
-        // initialize current particle force, potential energy, and virial to 0
-        vec3<Real> fi;
-        vec3<Real> ti;
-        Real pei(0);
-        Real viriali[6];
-        for (int k = 0; k < 6; k++)
-            viriali[k] = 0.0;
-
-        // If the evaluator needs the diameters of the particles to evaluate, grab particle_i's here
-        // MEM TRANSFER (1 scalar)
-        Scalar di;
-        if (Potential::needsDiameter())
+        for (unsigned int v = 0; v < h_numTypeVerts.data[t]; v++)
             {
-            di = h_diameter.data[i];
+            const vec3<Real> vertex(h_verts.data[h_firstTypeVert.data[t] + v]);
+            type_radius[t] = std::max(type_radius[t], Real(sqrt(dot(vertex, vertex))));
             }
+        max_radius = std::max(max_radius, type_radius[t]);
+        }
 
-        vec3<Scalar> vi;
-        if(Potential::needsVelocity())
-            vi = vec3<Scalar>(h_velocity.data[i]);
-
-        // loop over all of the neighbors of this particle
-        const unsigned int myHead = h_head_list.data[i];
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int j = 0; j < size; j++)
-            {
-            // increment our calculation counter
-            n_calc++;
+    // r_cut covers the two largest shapes plus the range of the contact potential
+    const Real contact_range(std::max(m_r_cut - 2*max_radius, Real(0)));
 
-            // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-            unsigned int k = h_nlist.data[myHead + j];
-            // sanity check
-            assert(k < m_pdata->getN() + m_pdata->getNGhosts());
+    // with a half neighbor list forces act on j as well as on i, so all but one chunk of particles
+    // accumulate into private arrays
+    unsigned int n_chunks = 1;
+    #ifdef ENABLE_TBB
+    // limit the memory used by the private arrays; contacts are expensive enough to split small systems
+    const unsigned int max_chunks = 16;
+    n_chunks = std::max(1u, std::min(std::min(m_exec_conf->getNumThreads(), N/64), max_chunks));
+    #endif
+    const bool private_arrays = third_law && n_chunks > 1;
 
-            // calculate dr (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            vec3<Scalar> pj(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
-            quat<Scalar> quatj(h_orientation.data[k]);
-            vec3<Scalar> dxScalar(pj - pi);
+    if (private_arrays)
+        {
+        m_force_scratch.resize((n_chunks-1)*N);
+        m_torque_scratch.resize((n_chunks-1)*N);
+        m_virial_scratch.resize((n_chunks-1)*6*N);
+        }
 
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar
-            unsigned int typej = __scalar_as_int(h_pos.data[k].w);
-            // sanity check
-            assert(typej < m_pdata->getNTypes());
+    //! Compute the forces on particles first to last-1 (and their half-list neighbors) into force, torque and virial
+    auto compute_range = [&](unsigned int first, unsigned int last, Scalar4 *force, Scalar4 *torque,
+                             Scalar *virial, unsigned int pitch)
+        {
+        // the evaluator carries per-pair diameter and velocity state, so every chunk needs its own
+        DEMEvaluator<Real, Real4, Potential> evaluator(m_evaluator);
 
-            // apply periodic boundary conditions (FLOPS: 9 (worst case: first branch is missed, the 2nd is taken and the add is done)
-            dxScalar = vec3<Scalar>(box.minImage(vec_to_scalar3(dxScalar)));
-            const vec3<Real> dx(dxScalar);
+        const vec3<Real> *world_verts = m_worldVerts.data();
 
-            // If the evaluator needs the diameters of the particles to evaluate, grab particle_j's and
-            // pass in the diameters of the particles here
+        for (unsigned int i = first; i < last; i++)
+            {
+            // access the particle's position and type (MEM TRANSFER: 4 scalars)
+            vec3<Scalar> pi(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            // sanity check
+            assert(typei < m_pdata->getNTypes());
+
+            // geometry of particle i
+            const vec3<Real> *verts_i = world_verts + m_worldVertOffset[i];
+            const unsigned int firstVert_i = h_firstTypeVert.data[typei];
+            const unsigned int numVerts_i = h_numTypeVerts.data[typei];
+            const unsigned int numEdges_i = h_numTypeEdges.data[typei];
+            const unsigned int numFaces_i = h_numTypeFaces.data[typei];
+            const unsigned int *edges_i = h_edges.data + 2*h_firstTypeEdge.data[typei];
+
+            // initialize current particle force, potential energy, and virial to 0
+            vec3<Real> fi;
+            vec3<Real> ti;
+            Real pei(0);
+            Real viriali[6];
+            for (int l = 0; l < 6; l++)
+                viriali[l] = 0.0;
+
+            // If the evaluator needs the diameters of the particles to evaluate, grab particle_i's here
             // MEM TRANSFER (1 scalar)
-            Scalar dj;
+            Scalar di;
             if (Potential::needsDiameter())
                 {
-                dj = h_diameter.data[k];
-                m_evaluator.setDiameter(di,dj);
+                di = h_diameter.data[i];
                 }
 
+            vec3<Scalar> vi;
             if(Potential::needsVelocity())
-                m_evaluator.setVelocity(vi - vec3<Scalar>(h_velocity.data[k]));
-
-            // start computing the force
-            // calculate r squared (FLOPS: 5)
-            Real rsq = dot(dx, dx);
+                vi = vec3<Scalar>(h_velocity.data[i]);
 
-            // only compute the force if the particles are closer than the cuttoff (FLOPS: 1)
-            if (m_evaluator.withinCutoff(rsq,r_cut_sq))
+            // loop over all of the neighbors of this particle
+            const unsigned int myHead = h_head_list.data[i];
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            for (unsigned int j = 0; j < size; j++)
                 {
+                // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                unsigned int k = h_nlist.data[myHead + j];
+                // sanity check
+                assert(k < m_pdata->getN() + m_pdata->getNGhosts());
+
+                // calculate dr (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                vec3<Scalar> pj(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
+                vec3<Scalar> dxScalar(pj - pi);
+
+                // access the type of the neighbor particle (MEM TRANSFER: 1 scalar
+                unsigned int typej = __scalar_as_int(h_pos.data[k].w);
+                // sanity check
+                assert(typej < m_pdata->getNTypes());
+
+                // apply periodic boundary conditions (FLOPS: 9 (worst case: first branch is missed, the 2nd is taken and the add is done)
+                dxScalar = vec3<Scalar>(box.minImage(vec_to_scalar3(dxScalar)));
+                const vec3<Real> dx(dxScalar);
+
+                // If the evaluator needs the diameters of the particles to evaluate, grab particle_j's and
+                // pass in the diameters of the particles here
+                // MEM TRANSFER (1 scalar)
+                Scalar dj;
+                if (Potential::needsDiameter())
+                    {
+                    dj = h_diameter.data[k];
+                    evaluator.setDiameter(di,dj);
+                    }
+
+                // start computing the force
+                // calculate r squared (FLOPS: 5)
+                Real rsq = dot(dx, dx);
+
+                // skip the pair unless the bounding spheres of the two shapes are within contact range (FLOPS: 3)
+                const Real r_bound(std::min(type_radius[typei] + type_radius[typej] + contact_range, m_r_cut));
+                if (!evaluator.withinCutoff(rsq, r_bound*r_bound))
+                    continue;
+
+                if(Potential::needsVelocity())
+                    evaluator.setVelocity(vi - vec3<Scalar>(h_velocity.data[k]));
+
+                // geometry of particle j
+                const vec3<Real> *verts_j = world_verts + m_worldVertOffset[k];
+                const unsigned int firstVert_j = h_firstTypeVert.data[typej];
+                const unsigned int numVerts_j = h_numTypeVerts.data[typej];
+                const unsigned int numEdges_j = h_numTypeEdges.data[typej];
+                const unsigned int numFaces_j = h_numTypeFaces.data[typej];
+                const unsigned int *edges_j = h_edges.data + 2*h_firstTypeEdge.data[typej];
+
                 // local forces and torques for particles i and j
                 vec3<Real> forceij, forceji;
                 vec3<Real> torqueij, torqueji;
                 Real potentialij(0);
 
                 // iterate over each vertex in particle i
-                for(size_t vertIndex(0); vertIndex < h_numTypeVerts.data[typei]; ++vertIndex)
+                for(unsigned int vertIndex(0); vertIndex < numVerts_i; ++vertIndex)
                     {
-                    const vec3<Real> vertex0(
-                        rotate(quati, vec3<Real>(h_verts.data[h_firstTypeVert.data[typei] + vertIndex])));
+                    const vec3<Real> &vertex0(verts_i[vertIndex]);
 
                     // iterate over each face in particle j
-                    size_t faceIndex(typej);
-                    if(h_numTypeFaces.data[typej] > 0)
+                    unsigned int faceIndex(typej);
+                    if(numFaces_j > 0)
                         {
                         do
                             {
-                            m_evaluator.vertexFace(dx, vertex0, quatj,
-                                h_verts.data,
+                            evaluator.vertexFace(dx, vertex0, verts_j, firstVert_j,
                                 h_realVertIndex.data,
                                 h_nextFaceVert.data,
                                 h_firstFaceVert.data[faceIndex],
@@ -685,17 +764,14 @@ void DEM3DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
                         while(faceIndex != typej);
                         }
                     // no faces; is it a spherocylinder?
-                    else if(h_numTypeEdges.data[typej] > 0)
+                    else if(numEdges_j > 0)
                         {
                         // iterate over all edges of j
-                        for(size_t edgej(0); edgej < h_numTypeEdges.data[typej]; ++edgej)
+                        for(unsigned int edgej(0); edgej < numEdges_j; ++edgej)
                             {
-                            vec3<Real> p10(h_verts.data[h_edges.data[2*(edgej + h_firstTypeEdge.data[typej])]]);
-                            vec3<Real> p11(h_verts.data[h_edges.data[2*(edgej + h_firstTypeEdge.data[typej]) + 1]]);
-                            p10 = rotate(quatj, p10);
-                            p11 = rotate(quatj, p11);
-
-                            m_evaluator.vertexEdge(dx, vertex0, p10, p11,
+                            evaluator.vertexEdge(dx, vertex0,
+                                verts_j[edges_j[2*edgej] - firstVert_j],
+                                verts_j[edges_j[2*edgej + 1] - firstVert_j],
                                 potentialij, forceij, torqueij,
                                 forceji, torqueji);
                             }
@@ -704,12 +780,9 @@ void DEM3DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
                     else
                         {
                         // all pairs of vertices
-                        for(size_t vertj(0); vertj < h_numTypeVerts.data[typej]; ++vertj)
+                        for(unsigned int vertj(0); vertj < numVerts_j; ++vertj)
                             {
-                            vec3<Real> vertex1(h_verts.data[h_firstTypeVert.data[typej] + vertj]);
-                            vertex1 = rotate(quatj, vertex1);
-
-                            m_evaluator.vertexVertex(dx, vertex0, dx + vertex1,
+                            evaluator.vertexVertex(dx, vertex0, dx + verts_j[vertj],
                                 potentialij, forceij, torqueij,
                                 forceji, torqueji);
                             }
@@ -717,19 +790,17 @@ void DEM3DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
                     }
 
                 // iterate over each vertex in particle j
-                for(size_t vertIndex(0); vertIndex < h_numTypeVerts.data[typej]; ++vertIndex)
+                for(unsigned int vertIndex(0); vertIndex < numVerts_j; ++vertIndex)
                     {
-                    const vec3<Real> vertex0(
-                        rotate(quatj, vec3<Real>(h_verts.data[h_firstTypeVert.data[typej] + vertIndex])));
+                    const vec3<Real> &vertex0(verts_j[vertIndex]);
 
                     // iterate over each face in particle i
-                    size_t faceIndex(typei);
-                    if(h_numTypeFaces.data[typei] > 0)
+                    unsigned int faceIndex(typei);
+                    if(numFaces_i > 0)
                         {
                         do
                             {
-                            m_evaluator.vertexFace(-dx, vertex0, quati,
-                                h_verts.data,
+                            evaluator.vertexFace(-dx, vertex0, verts_i, firstVert_i,
                                 h_realVertIndex.data,
                                 h_nextFaceVert.data,
                                 h_firstFaceVert.data[faceIndex],
@@ -741,17 +812,14 @@ void DEM3DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
                         while(faceIndex != typei);
                         }
                     // no faces; is it a spherocylinder?
-                    else if(h_numTypeEdges.data[typei] > 0)
+                    else if(numEdges_i > 0)
                         {
                         // iterate over all edges of i
-                        for(size_t edgei(0); edgei < h_numTypeEdges.data[typei]; ++edgei)
+                        for(unsigned int edgei(0); edgei < numEdges_i; ++edgei)
                             {
-                            vec3<Real> p10(h_verts.data[h_edges.data[2*(edgei + h_firstTypeEdge.data[typei])]]);
-                            vec3<Real> p11(h_verts.data[h_edges.data[2*(edgei + h_firstTypeEdge.data[typei]) + 1]]);
-                            p10 = rotate(quati, p10);
-                            p11 = rotate(quati, p11);
-
-                            m_evaluator.vertexEdge(-dx, vertex0, p10, p11,
+                            evaluator.vertexEdge(-dx, vertex0,
+                                verts_i[edges_i[2*edgei] - firstVert_i],
+                                verts_i[edges_i[2*edgei + 1] - firstVert_i],
                                 potentialij, forceji, torqueji,
                                 forceij, torqueij);
                             }
@@ -762,22 +830,18 @@ void DEM3DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
                     }
 
                 // iterate over all pairs of edges
-                for(size_t edgei(0); edgei < h_numTypeEdges.data[typei]; ++edgei)
+                for(unsigned int edgei(0); edgei < numEdges_i; ++edgei)
                     {
-                    vec3<Real> p00(h_verts.data[h_edges.data[2*(edgei + h_firstTypeEdge.data[typei])]]);
-                    vec3<Real> p01(h_verts.data[h_edges.data[2*(edgei + h_firstTypeEdge.data[typei]) + 1]]);
-                    p00 = rotate(quati, p00);
-                    p01 = rotate(quati, p01);
+                    const vec3<Real> &p00(verts_i[edges_i[2*edgei] - firstVert_i]);
+                    const vec3<Real> &p01(verts_i[edges_i[2*edgei + 1] - firstVert_i]);
 
                     // iterate over all edges of j
-                    for(size_t edgej(0); edgej < h_numTypeEdges.data[typej]; ++edgej)
+                    for(unsigned int edgej(0); edgej < numEdges_j; ++edgej)
                         {
-                        vec3<Real> p10(h_verts.data[h_edges.data[2*(edgej + h_firstTypeEdge.data[typej])]]);
-                        vec3<Real> p11(h_verts.data[h_edges.data[2*(edgej + h_firstTypeEdge.data[typej]) + 1]]);
-                        p10 = rotate(quatj, p10);
-                        p11 = rotate(quatj, p11);
+                        const vec3<Real> p10(dx + verts_j[edges_j[2*edgej] - firstVert_j]);
+                        const vec3<Real> p11(dx + verts_j[edges_j[2*edgej + 1] - firstVert_j]);
 
-                        m_evaluator.edgeEdge(dx, p00, p01, dx + p10, dx + p11, potentialij, forceij, torqueij, forceji, torqueji);
+                        evaluator.edgeEdge(dx, p00, p01, p10, p11, potentialij, forceij, torqueij, forceji, torqueji);
                         }
                     }
 
@@ -798,56 +862,113 @@ void DEM3DForceCompute<Real, Real4, Potential>::computeForces(unsigned int times
                 fi += forceij;
                 ti += torqueij;
                 pei += potentialij;
-                viriali[0] += pair_virial[0];
-                viriali[1] += pair_virial[1];
-                viriali[2] += pair_virial[2];
-                viriali[3] += pair_virial[3];
-                viriali[4] += pair_virial[4];
-                viriali[5] += pair_virial[5];
+                for (int l = 0; l < 6; l++)
+                    viriali[l] += pair_virial[l];
 
                 // add the force to particle j if we are using the third law (MEM TRANSFER: 10 scalars / FLOPS: 8)
-                if (third_law && k < m_pdata->getN())
+                if (third_law && k < N)
                     {
-                    h_force.data[k].x  += forceji.x;
-                    h_force.data[k].y  += forceji.y;
-                    h_force.data[k].z  += forceji.z;
-                    h_force.data[k].w  += potentialij;
-                    h_torque.data[k].x += torqueji.x;
-                    h_torque.data[k].y += torqueji.y;
-                    h_torque.data[k].z += torqueji.z;
-                    h_virial.data[0*virial_pitch + k] += pair_virial[0];
-                    h_virial.data[1*virial_pitch + k] += pair_virial[1];
-                    h_virial.data[2*virial_pitch + k] += pair_virial[2];
-                    h_virial.data[3*virial_pitch + k] += pair_virial[3];
-                    h_virial.data[4*virial_pitch + k] += pair_virial[4];
-                    h_virial.data[5*virial_pitch + k] += pair_virial[5];
+                    force[k].x  += forceji.x;
+                    force[k].y  += forceji.y;
+                    force[k].z  += forceji.z;
+                    force[k].w  += potentialij;
+                    torque[k].x += torqueji.x;
+                    torque[k].y += torqueji.y;
+                    torque[k].z += torqueji.z;
+                    for (int l = 0; l < 6; l++)
+                        virial[l*pitch + k] += pair_virial[l];
                     }
                 }
 
+            // finally, increment the force, potential energy and virial for particle i
+            // (MEM TRANSFER: 10 scalars / FLOPS: 5)
+            force[i].x  += fi.x;
+            force[i].y  += fi.y;
+            force[i].z  += fi.z;
+            force[i].w  += pei;
+            torque[i].x += ti.x;
+            torque[i].y += ti.y;
+            torque[i].z += ti.z;
+            for (int l = 0; l < 6; l++)
+                virial[l*pitch + i] += viriali[l];
             }
+        };
 
-        // finally, increment the force, potential energy and virial for particle i
-        // (MEM TRANSFER: 10 scalars / FLOPS: 5)
-        h_force.data[i].x  += fi.x;
-        h_force.data[i].y  += fi.y;
-        h_force.data[i].z  += fi.z;
-        h_force.data[i].w  += pei;
-        h_torque.data[i].x += ti.x;
-        h_torque.data[i].y += ti.y;
-        h_torque.data[i].z += ti.z;
-        h_virial.data[0*virial_pitch + i] += viriali[0];
-        h_virial.data[1*virial_pitch + i] += viriali[1];
-        h_virial.data[2*virial_pitch + i] += viriali[2];
-        h_virial.data[3*virial_pitch + i] += viriali[3];
-        h_virial.data[4*virial_pitch + i] += viriali[4];
-        h_virial.data[5*virial_pitch + i] += viriali[5];
+    #ifdef ENABLE_TBB
+    tbb::parallel_for((unsigned int)0, n_chunks, [&](unsigned int chunk)
+    #else
+    for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+    #endif
+        {
+        Scalar4 *force = h_force.data;
+        Scalar4 *torque = h_torque.data;
+        Scalar *virial = h_virial.data;
+        unsigned int pitch = virial_pitch;
+        if (private_arrays && chunk > 0)
+            {
+            force = &m_force_scratch[(chunk-1)*N];
+            torque = &m_torque_scratch[(chunk-1)*N];
+            virial = &m_virial_scratch[(chunk-1)*6*N];
+            pitch = N;
+            memset(force, 0, sizeof(Scalar4)*N);
+            memset(torque, 0, sizeof(Scalar4)*N);
+            memset(virial, 0, sizeof(Scalar)*6*N);
+            }
+
+        unsigned int first = (unsigned int)((unsigned long)N*chunk/n_chunks);
+        unsigned int last = (unsigned int)((unsigned long)N*(chunk+1)/n_chunks);
+        compute_range(first, last, force, torque, virial, pitch);
         }
+    #ifdef ENABLE_TBB
+    );
+    #endif
 
-    int64_t flops = m_pdata->getN() * 5 + n_calc * (3+5+9+1+14+6+8);
-    if (third_law) flops += n_calc * 8;
-    int64_t mem_transfer = m_pdata->getN() * (5+4+10)*sizeof(Real) + n_calc * (1+3+1)*sizeof(Real);
-    if (third_law) mem_transfer += n_calc*10*sizeof(Real);
-    if (m_prof) m_prof->pop(flops, mem_transfer);
+    // sum up the private arrays in a fixed order
+    if (private_arrays)
+        {
+        #ifdef ENABLE_TBB
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+            [&](const tbb::blocked_range<unsigned int>& r) {
+        for (unsigned int i = r.begin(); i != r.end(); ++i)
+        #else
+        for (unsigned int i = 0; i < N; ++i)
+        #endif
+            {
+            for (unsigned int chunk = 1; chunk < n_chunks; ++chunk)
+                {
+                const Scalar4& f = m_force_scratch[(chunk-1)*N + i];
+                h_force.data[i].x += f.x;
+                h_force.data[i].y += f.y;
+                h_force.data[i].z += f.z;
+                h_force.data[i].w += f.w;
+
+                const Scalar4& t = m_torque_scratch[(chunk-1)*N + i];
+                h_torque.data[i].x += t.x;
+                h_torque.data[i].y += t.y;
+                h_torque.data[i].z += t.z;
+
+                for (unsigned int l = 0; l < 6; ++l)
+                    h_virial.data[l*virial_pitch + i] += m_virial_scratch[((chunk-1)*6 + l)*N + i];
+                }
+            }
+        #ifdef ENABLE_TBB
+            });
+        #endif
+        }
+
+    if (m_prof)
+        {
+        // tally up the number of pairs considered
+        int64_t n_calc = 0;
+        for (unsigned int i = 0; i < N; i++)
+            n_calc += h_n_neigh.data[i];
+
+        int64_t flops = N * 5 + n_calc * (3+5+9+3+14+6+8);
+        if (third_law) flops += n_calc * 8;
+        int64_t mem_transfer = N * (5+4+10)*sizeof(Real) + n_calc * (1+3+1)*sizeof(Real);
+        if (third_law) mem_transfer += n_calc*10*sizeof(Real);
+        m_prof->pop(flops, mem_transfer);
+        }
     }
 
 #ifdef WIN32
@@ -56,6 +56,13 @@
   - Vertices (3D points) are stored consecutively for a shape
   - Edges (pairs of vertex indices) are stored consecutively for a shape
 
+  On the CPU, the vertices of every local and ghost particle are rotated into the world frame once per step and
+  stored consecutively for each particle, so the contact loops read them directly instead of rotating the
+  vertices of both shapes for every pair. Pairs whose bounding spheres (the largest vertex distance of each
+  type plus the contact range) do not overlap are skipped before any contact is evaluated. With TBB, particles
+  are split into chunks that are evaluated in parallel; with a half neighbor list, all but the first chunk
+  accumulate into private arrays that are summed in a fixed order afterwards.
+
   \ingroup computes
 */
 template<typename Real, typename Real4, typename Potential>
@@ -138,6 +145,11 @@ class DEM3DForceCompute : public ForceCompute
         GPUArray<Real4> m_verts; //! Vertices for each real index
         std::vector<std::vector<vec3<Real> > > m_vertsVec; //!< Vertices for each type
         std::vector<std::vector<std::vector<unsigned int> > > m_facesVec; //!< Faces for each type
+        std::vector<vec3<Real> > m_worldVerts; //!< World-frame vertices of each local and ghost particle
+        std::vector<unsigned int> m_worldVertOffset; //!< particle->first vertex in m_worldVerts
+        std::vector<Scalar4> m_force_scratch; //!< Private force arrays of all but the first chunk
+        std::vector<Scalar4> m_torque_scratch; //!< Private torque arrays of all but the first chunk
+        std::vector<Scalar> m_virial_scratch; //!< Private virial arrays of all but the first chunk
 
         //! Re-send the list of vertices and links to the GPU
         void createGeometry();
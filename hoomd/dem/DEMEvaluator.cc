@@ -74,6 +74,26 @@ DEVICE inline void DEMEvaluator<Real, Real4, Potential>::vertexFace(
     const unsigned int *realIndicesj, const unsigned int *facesj, const unsigned int vertex0Index, Real &potential,
     vec3<Real> &force_i, vec3<Real> &torque_i, vec3<Real> &force_j, vec3<Real> &torque_j) const
     {
+    vertexFaceImpl(rij, r0, DEMRotatedVertices<Real, Real4>(quatj, verticesj, realIndicesj), facesj, vertex0Index,
+        potential, force_i, torque_i, force_j, torque_j);
+    }
+
+template<typename Real, typename Real4, typename Potential>
+DEVICE inline void DEMEvaluator<Real, Real4, Potential>::vertexFace(
+    const vec3<Real> &rij, const vec3<Real> &r0, const vec3<Real> *worldVerticesj, const unsigned int firstVertj,
+    const unsigned int *realIndicesj, const unsigned int *facesj, const unsigned int vertex0Index, Real &potential,
+    vec3<Real> &force_i, vec3<Real> &torque_i, vec3<Real> &force_j, vec3<Real> &torque_j) const
+    {
+    vertexFaceImpl(rij, r0, DEMWorldVertices<Real>(worldVerticesj, firstVertj, realIndicesj), facesj, vertex0Index,
+        potential, force_i, torque_i, force_j, torque_j);
+    }
+
+template<typename Real, typename Real4, typename Potential> template<typename VertexSource>
+DEVICE inline void DEMEvaluator<Real, Real4, Potential>::vertexFaceImpl(
+    const vec3<Real> &rij, const vec3<Real> &r0, const VertexSource &vertex,
+    const unsigned int *facesj, const unsigned int vertex0Index, Real &potential,
+    vec3<Real> &force_i, vec3<Real> &torque_i, vec3<Real> &force_j, vec3<Real> &torque_j) const
+    {
     // distsq will be used to hold the square distance from r0 to the
     // face of interest; work relative to particle j's center of mass
     Real distsq(0);
@@ -83,13 +103,13 @@ DEVICE inline void DEMEvaluator<Real, Real4, Potential>::vertexFace(
     vec3<Real> rPrime;
 
     // vertex0 is the reference point in particle j to "fan out" from
-    const vec3<Real> vertex0(rotate(quatj, vec3<Real>(verticesj[realIndicesj[vertex0Index]])));
+    const vec3<Real> vertex0(vertex(vertex0Index));
 
     // r0r0: vector from vertex0 to r0 relative to particle j
     const vec3<Real> r0r0(r0j - vertex0);
 
     // check distance for first edge of polygon
-    const vec3<Real> secondVertex(rotate(quatj, vec3<Real>(verticesj[realIndicesj[facesj[vertex0Index]]])));
+    const vec3<Real> secondVertex(vertex(facesj[vertex0Index]));
     const vec3<Real> rsec(secondVertex - vertex0);
     Real lambda(dot(r0r0, rsec)/dot(rsec, rsec));
     lambda = clip(lambda);
@@ -110,7 +130,7 @@ DEVICE inline void DEMEvaluator<Real, Real4, Potential>::vertexFace(
         Real alpha(0), beta(0);
 
         p1 = p2;
-        p2 = rotate(quatj, vec3<Real>(verticesj[realIndicesj[facesj[i]]]));
+        p2 = vertex(facesj[i]);
         p01 = p02;
         p02 = p2 - vertex0;
 
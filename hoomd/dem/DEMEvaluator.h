@@ -21,6 +21,36 @@
 #define DEVICE
 #endif
 
+/*! Looks up the vertices of a face by rotating the body-frame vertices of the particle */
+template<typename Real, typename Real4>
+struct DEMRotatedVertices
+    {
+    DEVICE DEMRotatedVertices(const quat<Real> &q, const Real4 *verts, const unsigned int *realIndices):
+        m_q(q), m_verts(verts), m_realIndices(realIndices) {}
+
+    DEVICE inline vec3<Real> operator()(const unsigned int i) const
+        {return rotate(m_q, vec3<Real>(m_verts[m_realIndices[i]]));}
+
+    const quat<Real> m_q;
+    const Real4 *m_verts;
+    const unsigned int *m_realIndices;
+    };
+
+/*! Looks up the vertices of a face from the world-frame vertices of the particle */
+template<typename Real>
+struct DEMWorldVertices
+    {
+    DEVICE DEMWorldVertices(const vec3<Real> *verts, const unsigned int firstVert, const unsigned int *realIndices):
+        m_verts(verts), m_firstVert(firstVert), m_realIndices(realIndices) {}
+
+    DEVICE inline vec3<Real> operator()(const unsigned int i) const
+        {return m_verts[m_realIndices[i] - m_firstVert];}
+
+    const vec3<Real> *m_verts;
+    const unsigned int m_firstVert;
+    const unsigned int *m_realIndices;
+    };
+
 /*! Wrapper class to evaluate potentials between features of shapes */
 template<typename Real, typename Real4, typename Potential>
 class DEMEvaluator
@@ -89,6 +119,18 @@ class DEMEvaluator
             const unsigned int *realIndicesj, const unsigned int *facesj, const unsigned int vertex0, Real &potential,
             vec3<Real> &force_i, vec3<Real> &torque_i, vec3<Real> &force_j, vec3<Real> &torque_j) const;
 
+        /*! Evaluate the force and torque contributions for particles i
+          and j as in the vertexFace() above, but with the vertices of
+          particle j already rotated into the world frame. worldVerticesj
+          holds the rotated vertices of particle j only, so the real
+          vertex index of each face vertex is offset by firstVertj, the
+          first real vertex index of the type of particle j.
+        */
+        DEVICE inline void vertexFace(
+            const vec3<Real> &rij, const vec3<Real> &r0, const vec3<Real> *worldVerticesj, const unsigned int firstVertj,
+            const unsigned int *realIndicesj, const unsigned int *facesj, const unsigned int vertex0, Real &potential,
+            vec3<Real> &force_i, vec3<Real> &torque_i, vec3<Real> &force_j, vec3<Real> &torque_j) const;
+
         /*! Evaluate the force and torque contributions for particles i
           and j between two edges, specified by points r00 (first vertex
           of the edge in particle i), r01 (second vertex in the edge in
@@ -120,6 +162,13 @@ class DEMEvaluator
             }
 
     private:
+        //! Shared implementation of both vertexFace() variants; vertex(i) gives degenerate vertex i of particle j
+        template<typename VertexSource>
+        DEVICE inline void vertexFaceImpl(
+            const vec3<Real> &rij, const vec3<Real> &r0, const VertexSource &vertex,
+            const unsigned int *facesj, const unsigned int vertex0, Real &potential,
+            vec3<Real> &force_i, vec3<Real> &torque_i, vec3<Real> &force_j, vec3<Real> &torque_j) const;
+
         //! Vertex/face potential parameters
         Potential m_potential;
     };
@@ -6,6 +6,7 @@ import hoomd.dem;
 hoomd.context.initialize();
 
 import itertools
+import numpy
 import unittest
 
 def not_on_mpi(f):
@@ -243,5 +244,155 @@ class shape_shape(unittest.TestCase):
     def tearDown(self):
         hoomd.comm.barrier();
 
+class threads(unittest.TestCase):
+
+    def test_threads_2d(self):
+        self._test_threads(twoD=True);
+
+    def test_threads_3d(self):
+        self._test_threads(twoD=False);
+
+    def _test_threads(self, twoD):
+        if hoomd.context.exec_conf.isCUDAEnabled() or not hoomd._hoomd.is_TBB_available():
+            return;
+
+        # randomly rotated squares or cubes, close enough for most of them to touch
+        n = [16, 16] if twoD else [8, 8, 8];
+        system = hoomd.init.create_lattice(hoomd.lattice.sq(a=1.9) if twoD else hoomd.lattice.sc(a=1.9), n=n);
+        snap = system.take_snapshot();
+        if hoomd.comm.get_rank() == 0:
+            numpy.random.seed(7);
+            if twoD:
+                theta = numpy.random.uniform(0, 2*numpy.pi, size=snap.particles.N);
+                snap.particles.orientation[:] = numpy.array([numpy.cos(theta/2), 0*theta, 0*theta, numpy.sin(theta/2)]).T;
+            else:
+                q = numpy.random.normal(size=(snap.particles.N, 4));
+                snap.particles.orientation[:] = q/numpy.linalg.norm(q, axis=1)[:, numpy.newaxis];
+        system.restore_snapshot(snap);
+
+        nl = hoomd.md.nlist.cell();
+        potential = hoomd.dem.pair.WCA(nlist=nl, radius=.5);
+        nve = hoomd.md.integrate.nve(group=hoomd.group.all());
+        mode = hoomd.md.integrate.mode_standard(dt=0);
+
+        if twoD:
+            potential.setParams('A', [[.5, .5], [-.5, .5], [-.5, -.5], [.5, -.5]], center=False);
+        else:
+            vertices = list(itertools.product(*(3*[[-.5, .5]])));
+            faces = [[4, 0, 2, 6],
+                     [1, 0, 4, 5],
+                     [5, 4, 6, 7],
+                     [2, 0, 1, 3],
+                     [6, 2, 3, 7],
+                     [3, 1, 5, 7]];
+            potential.setParams('A', vertices, faces, center=False);
+
+        hoomd.option.set_num_threads(1);
+        hoomd.run(1);
+        F1 = numpy.array([p.net_force for p in system.particles]);
+        T1 = numpy.array([p.net_torque for p in system.particles]);
+        U1 = numpy.array([p.net_energy for p in system.particles]);
+
+        hoomd.option.set_num_threads(4);
+        hoomd.run(1);
+        F4 = numpy.array([p.net_force for p in system.particles]);
+        T4 = numpy.array([p.net_torque for p in system.particles]);
+        U4 = numpy.array([p.net_energy for p in system.particles]);
+
+        self.assertGreater(numpy.max(numpy.abs(F1)), 1e-3);
+        numpy.testing.assert_allclose(F4, F1, rtol=1e-6, atol=1e-8);
+        numpy.testing.assert_allclose(T4, T1, rtol=1e-6, atol=1e-8);
+        numpy.testing.assert_allclose(U4, U1, rtol=1e-6, atol=1e-8);
+
+        potential.disable();
+        del potential;
+        del system;
+
+    def setUp(self):
+        hoomd.context.initialize();
+
+    def tearDown(self):
+        hoomd.comm.barrier();
+
+class early_rejection(unittest.TestCase):
+
+    def test_early_rejection_2d(self):
+        self._test_early_rejection(twoD=True);
+
+    def test_early_rejection_3d(self):
+        self._test_early_rejection(twoD=False);
+
+    def _run(self, twoD, large):
+        # randomly rotated squares or cubes on a jittered lattice with a spacing just inside the contact range of
+        # their bounding spheres (2.54 or 2.85), so that some neighbors touch and others fall outside the bound
+        n = 8 if twoD else 6;
+        a = 2.45 if twoD else 2.75;
+        box = hoomd.data.boxdim(L=60, dimensions=(2 if twoD else 3));
+        snap = hoomd.data.make_snapshot(N=n**(2 if twoD else 3), box=box, particle_types=['A', 'B']);
+        if hoomd.comm.get_rank() == 0:
+            numpy.random.seed(11);
+            for (i, idx) in enumerate(itertools.product(*((2 if twoD else 3)*[range(n)]))):
+                snap.particles.position[i, :len(idx)] = [a*(k - (n - 1)/2.) + numpy.random.uniform(-.15, .15)
+                                                         for k in idx];
+            snap.particles.typeid[:] = 1;
+            if twoD:
+                theta = numpy.random.uniform(0, 2*numpy.pi, size=snap.particles.N);
+                snap.particles.orientation[:] = numpy.array([numpy.cos(theta/2), 0*theta, 0*theta, numpy.sin(theta/2)]).T;
+            else:
+                q = numpy.random.normal(size=(snap.particles.N, 4));
+                snap.particles.orientation[:] = q/numpy.linalg.norm(q, axis=1)[:, numpy.newaxis];
+
+        system = hoomd.init.read_snapshot(snap);
+        nl = hoomd.md.nlist.cell();
+        potential = hoomd.dem.pair.WCA(nlist=nl, radius=.5);
+        nve = hoomd.md.integrate.nve(group=hoomd.group.all());
+        mode = hoomd.md.integrate.mode_standard(dt=0);
+
+        # type A has no particles. When it is much larger than B, r_cut grows with it and the bounding spheres of two
+        # B shapes reject pairs that the r_cut test alone would evaluate. When A is a copy of B, the bound equals r_cut.
+        scale = 5 if large else 1;
+        if twoD:
+            square = [[.5, .5], [-.5, .5], [-.5, -.5], [.5, -.5]];
+            potential.setParams('B', square, center=False);
+            potential.setParams('A', [[scale*x for x in v] for v in square], center=False);
+        else:
+            cube = list(itertools.product(*(3*[[-.5, .5]])));
+            faces = [[4, 0, 2, 6],
+                     [1, 0, 4, 5],
+                     [5, 4, 6, 7],
+                     [2, 0, 1, 3],
+                     [6, 2, 3, 7],
+                     [3, 1, 5, 7]];
+            potential.setParams('B', cube, faces, center=False);
+            potential.setParams('A', [[scale*x for x in v] for v in cube], faces, center=False);
+
+        hoomd.run(1);
+        F = numpy.array([p.net_force for p in system.particles]);
+        T = numpy.array([p.net_torque for p in system.particles]);
+        U = numpy.array([p.net_energy for p in system.particles]);
+
+        potential.disable();
+        del potential;
+        del system;
+        hoomd.context.initialize();
+
+        return (F, T, U);
+
+    def _test_early_rejection(self, twoD):
+        (F1, T1, U1) = self._run(twoD, large=False);
+        (F5, T5, U5) = self._run(twoD, large=True);
+
+        self.assertGreater(numpy.max(numpy.abs(F1)), 1e-3);
+        self.assertGreater(numpy.sum(U1 == 0), 0);
+        numpy.testing.assert_allclose(F5, F1, rtol=1e-6, atol=1e-8);
+        numpy.testing.assert_allclose(T5, T1, rtol=1e-6, atol=1e-8);
+        numpy.testing.assert_allclose(U5, U1, rtol=1e-6, atol=1e-8);
+
+    def setUp(self):
+        hoomd.context.initialize();
+
+    def tearDown(self):
+        hoomd.comm.barrier();
+
 if __name__ == '__main__':
     unittest.main(argv = ['test_potentials.py', '-v']);
@@ -71,6 +71,15 @@ class ComputeFreeVolume : public Compute
         //! Get the value of a logged quantity
         virtual Scalar getLogValue(const std::string& quantity, unsigned int timestep);
 
+        //! Resolves a log quantity name to a handle
+        virtual int getLogHandle(const std::string& quantity)
+            {
+            return (quantity == "hpmc_free_volume"+m_suffix) ? 0 : -1;
+            }
+
+        //! Calculates the log value for a handle returned by getLogHandle()
+        virtual Scalar getLogValueByHandle(int handle, unsigned int timestep);
+
         //! Return an estimate of the overlap volume
         virtual void computeFreeVolume(unsigned int timestep);
 
@@ -276,29 +285,42 @@ Scalar ComputeFreeVolume<Shape>::getLogValue(const std::string& quantity, unsign
     {
     if (quantity == "hpmc_free_volume"+m_suffix)
         {
-        // perform MC integration
-        compute(timestep);
+        return getLogValueByHandle(0, timestep);
+        }
+    throw std::runtime_error("Undefined log quantity");
+    }
+
+/*! \param handle Handle returned by getLogHandle()
+    \param timestep Current time step of the simulation
+    \return the requested log quantity.
+*/
+template<class Shape>
+Scalar ComputeFreeVolume<Shape>::getLogValueByHandle(int handle, unsigned int timestep)
+    {
+    if (handle != 0)
+        throw std::runtime_error("Undefined log quantity");
 
-        // access counters
-        ArrayHandle<unsigned int> h_n_overlap_all(m_n_overlap_all, access_location::host, access_mode::read);
+    // perform MC integration
+    compute(timestep);
 
-        // generate n_sample random test depletants in the global box
-        unsigned int n_sample = m_n_sample;
+    // access counters
+    ArrayHandle<unsigned int> h_n_overlap_all(m_n_overlap_all, access_location::host, access_mode::read);
 
-        #ifdef ENABLE_MPI
-        // in MPI, for small n_sample we can encounter round-off issues
-        unsigned int n_ranks = this->m_exec_conf->getNRanks();
-        n_sample = (n_sample/n_ranks)*n_ranks;
-        #endif
+    // generate n_sample random test depletants in the global box
+    unsigned int n_sample = m_n_sample;
 
+    #ifdef ENABLE_MPI
+    // in MPI, for small n_sample we can encounter round-off issues
+    unsigned int n_ranks = this->m_exec_conf->getNRanks();
+    n_sample = (n_sample/n_ranks)*n_ranks;
+    #endif
 
-        // total free volume
-        const BoxDim& global_box = this->m_pdata->getGlobalBox();
-        Scalar V_free = (Scalar)(n_sample-*h_n_overlap_all.data)/(Scalar)n_sample*global_box.getVolume();
 
-        return V_free;
-        }
-    throw std::runtime_error("Undefined log quantity");
+    // total free volume
+    const BoxDim& global_box = this->m_pdata->getGlobalBox();
+    Scalar V_free = (Scalar)(n_sample-*h_n_overlap_all.data)/(Scalar)n_sample*global_box.getVolume();
+
+    return V_free;
     }
 
 //! Export this hpmc analyzer to python
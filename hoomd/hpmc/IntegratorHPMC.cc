@@ -138,63 +138,90 @@ std::vector< std::string > IntegratorHPMC::getProvidedLogQuantities()
 */
 Scalar IntegratorHPMC::getLogValue(const std::string& quantity, unsigned int timestep)
     {
-    hpmc_counters_t counters = getCounters(2);
+    int handle = IntegratorHPMC::getLogHandle(quantity);
+    if (handle >= 0)
+        return IntegratorHPMC::getLogValueByHandle(handle, timestep);
 
+    //nothing found -> pass on to integrator
+    return Integrator::getLogValue(quantity, timestep);
+    }
+
+/*! \param quantity Name of the log quantity
+    \returns The handle of the quantity, or -1 if it is not provided by IntegratorHPMC
+
+    The quantities listed in getProvidedLogQuantities() are numbered in order, the per type move sizes follow
+    as hpmc_d_<typename> = 7 + 2*type and hpmc_a_<typename> = 8 + 2*type.
+*/
+int IntegratorHPMC::getLogHandle(const std::string& quantity)
+    {
     if (quantity == "hpmc_sweep")
-        {
-        hpmc_counters_t counters_total = getCounters(0);
-        return double(counters_total.getNMoves()) / double(m_pdata->getNGlobal());
-        }
+        return 0;
     else if (quantity == "hpmc_translate_acceptance")
-        {
-        return counters.getTranslateAcceptance();
-        }
+        return 1;
     else if (quantity == "hpmc_rotate_acceptance")
-        {
-        return counters.getRotateAcceptance();
-        }
+        return 2;
     else if (quantity == "hpmc_d")
-        {
-        ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
-        return h_d.data[0];
-        }
+        return 3;
     else if (quantity == "hpmc_a")
-        {
-        ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
-        return h_a.data[0];
-        }
+        return 4;
     else if (quantity == "hpmc_move_ratio")
-        {
-        return getMoveRatio();
-        }
+        return 5;
     else if (quantity == "hpmc_overlap_count")
+        return 6;
+
+    //loop over per particle move size quantities
+    for (unsigned int typ=0; typ<m_pdata->getNTypes();typ++)
         {
-        return countOverlaps(timestep, false);
+        if (quantity == "hpmc_d_" + m_pdata->getNameByType(typ))
+            return 7 + 2*typ;
+        if (quantity == "hpmc_a_" + m_pdata->getNameByType(typ))
+            return 8 + 2*typ;
         }
-    else
+
+    return -1;
+    }
+
+/*! \param handle Handle returned by getLogHandle()
+    \param timestep Current time step of the simulation
+    \return the requested log quantity.
+*/
+Scalar IntegratorHPMC::getLogValueByHandle(int handle, unsigned int timestep)
+    {
+    switch (handle)
         {
-        //loop over per particle move size quantities
-        for (unsigned int typ=0; typ<m_pdata->getNTypes();typ++)
-          {
-          ostringstream tmp_str0;
-          tmp_str0<<"hpmc_d_"<<m_pdata->getNameByType(typ);
-          if (quantity==tmp_str0.str())
+        case 0:
             {
-            ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
-            return h_d.data[typ];
+            hpmc_counters_t counters_total = getCounters(0);
+            return double(counters_total.getNMoves()) / double(m_pdata->getNGlobal());
             }
+        case 1:
+            return getCounters(2).getTranslateAcceptance();
+        case 2:
+            return getCounters(2).getRotateAcceptance();
+        case 5:
+            return getMoveRatio();
+        case 6:
+            return countOverlaps(timestep, false);
+        }
 
-          ostringstream tmp_str1;
-          tmp_str1<<"hpmc_a_"<<m_pdata->getNameByType(typ);
-          if (quantity==tmp_str1.str())
-            {
-            ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
-            return h_a.data[typ];
-            }
-          }
+    // per type move sizes, hpmc_d and hpmc_a refer to the first type
+    unsigned int typ = (handle >= 7) ? (handle - 7)/2 : 0;
+    bool translate = (handle >= 7) ? ((handle - 7) % 2 == 0) : (handle == 3);
+    if (handle < 3 || typ >= m_pdata->getNTypes())
+        {
+        m_exec_conf->msg->error() << "hpmc: " << handle << " is not a valid log handle" << endl;
+        throw runtime_error("Error getting log value");
+        }
 
-        //nothing found -> pass on to integrator
-        return Integrator::getLogValue(quantity, timestep);
+    if (translate)
+        {
+        ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
+        return h_d.data[typ];
+        }
+    else
+        {
+        ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
+        return h_a.data[typ];
         }
     }
 
@@ -260,6 +260,12 @@ class IntegratorHPMC : public Integrator
         //! Get the value of a logged quantity
         virtual Scalar getLogValue(const std::string& quantity, unsigned int timestep);
 
+        //! Resolves a log quantity name to a handle
+        virtual int getLogHandle(const std::string& quantity);
+
+        //! Calculates the log value for a handle returned by getLogHandle()
+        virtual Scalar getLogValueByHandle(int handle, unsigned int timestep);
+
         //! Check the particle data for non-normalized orientations
         virtual bool checkParticleOrientations();
 
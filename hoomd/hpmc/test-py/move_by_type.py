@@ -180,5 +180,33 @@ class pair_rot_some(unittest.TestCase):
         del self.system
         context.initialize()
 
+# Check that the move sizes by type are logged with the values that were set
+class log_move_size(unittest.TestCase):
+    def setUp(self) :
+        self.system  = create_empty(N=1, box=data.boxdim(L=10, dimensions=3), particle_types=['A','B'])
+
+        self.mc = hpmc.integrate.sphere(seed=10, d={'A':0.1,'B':0.2}, a={'A':0.3,'B':0.4});
+        self.mc.shape_param.set('A', diameter=1.0)
+        self.mc.shape_param.set('B', diameter=1.0)
+
+    def test_log(self):
+        log = analyze.log(filename=None, quantities=['hpmc_d', 'hpmc_a', 'hpmc_d_A', 'hpmc_d_B', 'hpmc_a_A',
+                                                     'hpmc_a_B', 'hpmc_overlap_count'], period=1)
+        run(1)
+
+        # hpmc_d and hpmc_a report the first type
+        self.assertAlmostEqual(log.query('hpmc_d'), 0.1, places=5)
+        self.assertAlmostEqual(log.query('hpmc_a'), 0.3, places=5)
+        self.assertAlmostEqual(log.query('hpmc_d_A'), 0.1, places=5)
+        self.assertAlmostEqual(log.query('hpmc_d_B'), 0.2, places=5)
+        self.assertAlmostEqual(log.query('hpmc_a_A'), 0.3, places=5)
+        self.assertAlmostEqual(log.query('hpmc_a_B'), 0.4, places=5)
+        self.assertEqual(log.query('hpmc_overlap_count'), 0)
+
+    def tearDown(self):
+        del self.mc
+        del self.system
+        context.initialize()
+
 if __name__ == '__main__':
     unittest.main(argv = ['test.py', '-v'])
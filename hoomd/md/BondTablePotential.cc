@@ -47,6 +47,7 @@ BondTablePotential::BondTablePotential(std::shared_ptr<SystemDefinition> sysdef,
     m_tables.swap(tables);
     GPUArray<Scalar4> params(m_bond_data->getNTypes(), m_exec_conf);
     m_params.swap(params);
+    m_spline_tables.resize(m_bond_data->getNTypes());
     assert(!m_tables.isNull());
 
     // helper to compute indices
@@ -117,6 +118,42 @@ void BondTablePotential::setTable(unsigned int type,
         h_tables.data[m_table_value(i, type)].x = V[i];
         h_tables.data[m_table_value(i, type)].y = F[i];
         }
+
+    // the linear table replaces any spline table for this type
+    m_spline_tables[type] = HermiteTable();
+    }
+
+/*! \param type Type of the bond to set parameters for
+    \param r Knot positions, strictly increasing
+    \param V Potential at the knots
+    \param F Force at the knots (must be - dV / dr)
+    \post Bonds of this type are evaluated with a cubic Hermite spline between r[0] and the last knot
+*/
+void BondTablePotential::setSplineTable(unsigned int type,
+                                        const std::vector<Scalar> &r,
+                                        const std::vector<Scalar> &V,
+                                        const std::vector<Scalar> &F)
+    {
+    // make sure the type is valid
+    if (type >= m_bond_data->getNTypes())
+        {
+        m_exec_conf->msg->error() << "Invalid bond type specified" << endl;
+        throw runtime_error("Error setting parameters in PotentialBond");
+        }
+
+    if (!HermiteTable::validate(r, V, F) || r.front() < 0)
+        {
+        m_exec_conf->msg->error() << "bond.table: spline knots must be non-negative and strictly increasing, with "
+                                  << "one value of V and F per knot" << endl;
+        throw runtime_error("Error initializing BondTablePotential");
+        }
+
+    m_spline_tables[type].set(r, V, F);
+
+    // keep the range in the parameters consistent with the spline
+    ArrayHandle<Scalar4> h_params(m_params, access_location::host, access_mode::readwrite);
+    h_params.data[type].x = r.front();
+    h_params.data[type].y = r.back();
     }
 
 /*! BondTablePotential provides
@@ -225,27 +262,35 @@ void BondTablePotential::computeForces(unsigned int timestep)
 
         if (r < rmax && r >= rmin)
             {
-            // precomputed term
-            Scalar value_f = (r - rmin) / delta_r;
-
-            // compute index into the table and read in values
-
-            /// Here we use the table!!
-            unsigned int value_i = (unsigned int)floor(value_f);
-            Scalar2 VF0 = h_tables.data[m_table_value(value_i, type)];
-            Scalar2 VF1 = h_tables.data[m_table_value(value_i+1, type)];
-            // unpack the data
-            Scalar V0 = VF0.x;
-            Scalar V1 = VF1.x;
-            Scalar F0 = VF0.y;
-            Scalar F1 = VF1.y;
-
-            // compute the linear interpolation coefficient
-            Scalar f = value_f - Scalar(value_i);
-
-            // interpolate to get V and F;
-            Scalar V = V0 + f * (V1 - V0);
-            Scalar F = F0 + f * (F1 - F0);
+            Scalar V, F;
+            if (m_spline_tables[type].isSet())
+                {
+                m_spline_tables[type].evaluate(r, V, F);
+                }
+            else
+                {
+                // precomputed term
+                Scalar value_f = (r - rmin) / delta_r;
+
+                // compute index into the table and read in values
+
+                /// Here we use the table!!
+                unsigned int value_i = (unsigned int)floor(value_f);
+                Scalar2 VF0 = h_tables.data[m_table_value(value_i, type)];
+                Scalar2 VF1 = h_tables.data[m_table_value(value_i+1, type)];
+                // unpack the data
+                Scalar V0 = VF0.x;
+                Scalar V1 = VF1.x;
+                Scalar F0 = VF0.y;
+                Scalar F1 = VF1.y;
+
+                // compute the linear interpolation coefficient
+                Scalar f = value_f - Scalar(value_i);
+
+                // interpolate to get V and F;
+                V = V0 + f * (V1 - V0);
+                F = F0 + f * (F1 - F0);
+                }
 
             // convert to standard variables used by the other pair computes in HOOMD-blue
             Scalar force_divr = Scalar(0.0);
@@ -296,5 +341,6 @@ void export_BondTablePotential(py::module& m)
     py::class_<BondTablePotential, std::shared_ptr<BondTablePotential> >(m, "BondTablePotential", py::base<ForceCompute>())
     .def(py::init< std::shared_ptr<SystemDefinition>, unsigned int, const std::string& >())
     .def("setTable", &BondTablePotential::setTable)
+    .def("setSplineTable", &BondTablePotential::setSplineTable)
     ;
     }
@@ -7,6 +7,7 @@
 #include "hoomd/ForceCompute.h"
 #include "hoomd/Index1D.h"
 #include "hoomd/GPUArray.h"
+#include "HermiteTable.h"
 
 #include <memory>
 
@@ -48,6 +49,9 @@
     Values are interpolated linearly between two points straddling the given r. For a given r, the first point needed, i
     can be calculated via i = floorf((r - rmin) / dr). The fraction between ri and ri+1 can be calculated via
     f = (r - rmin) / dr - float(i). And the linear interpolation can then be performed via V(r) ~= Vi + f * (Vi+1 - Vi)
+
+    Bond types given a HermiteTable with setSplineTable() are interpolated with cubic Hermite splines on their own,
+    possibly uneven, knots instead (CPU only).
     \ingroup computes
 */
 class PYBIND11_EXPORT BondTablePotential : public ForceCompute
@@ -68,6 +72,12 @@ class PYBIND11_EXPORT BondTablePotential : public ForceCompute
                               Scalar rmin,
                               Scalar rmax);
 
+        //! Set a cubic Hermite spline table for a given type
+        virtual void setSplineTable(unsigned int type,
+                                    const std::vector<Scalar> &r,
+                                    const std::vector<Scalar> &V,
+                                    const std::vector<Scalar> &F);
+
         //! Returns a list of log quantities this compute calculates
         virtual std::vector< std::string > getProvidedLogQuantities();
 
@@ -92,6 +102,7 @@ class PYBIND11_EXPORT BondTablePotential : public ForceCompute
         unsigned int m_table_width;                 //!< Width of the tables in memory
         GPUArray<Scalar2> m_tables;                  //!< Stored V and F tables
         GPUArray<Scalar4> m_params;                 //!< Parameters stored for each table
+        std::vector<HermiteTable> m_spline_tables;  //!< Spline tables, used instead of m_tables when set
         Index2D m_table_value;                      //!< Index table helper
         std::string m_log_name;                     //!< Cached log name
 
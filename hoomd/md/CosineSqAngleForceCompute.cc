@@ -118,7 +118,6 @@ void CosineSqAngleForceCompute::computeForces(unsigned int timestep)
     assert(m_pdata);
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar4> h_force(m_force,access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar> h_virial(m_virial,access_location::host, access_mode::overwrite);
@@ -128,7 +127,6 @@ void CosineSqAngleForceCompute::computeForces(unsigned int timestep)
     assert(h_force.data);
     assert(h_virial.data);
     assert(h_pos.data);
-    assert(h_rtag.data);
 
     // Zero data for force calculation.
     memset((void*)h_force.data,0,sizeof(Scalar4)*m_force.getNumElements());
@@ -137,29 +135,19 @@ void CosineSqAngleForceCompute::computeForces(unsigned int timestep)
     // get a local copy of the simulation box too
     const BoxDim& box = m_pdata->getGlobalBox();
 
+    // the index table holds the angles with their members translated to particle indices, ordered for locality
+    ArrayHandle<AngleData::members_t> h_angles(m_angle_data->getIndexTable(), access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_angle_data->getIndexTableTypeVal(), access_location::host, access_mode::read);
+
     // for each of the angles
     const unsigned int size = (unsigned int)m_angle_data->getN();
     for (unsigned int i = 0; i < size; i++)
         {
-        // lookup the tag of each of the particles participating in the angle
-        const AngleData::members_t& angle = m_angle_data->getMembersByIndex(i);
-        assert(angle.tag[0] <= m_pdata->getMaximumTag());
-        assert(angle.tag[1] <= m_pdata->getMaximumTag());
-        assert(angle.tag[2] <= m_pdata->getMaximumTag());
-
-        // transform a, b, and c into indices into the particle data arrays
-        // MEM TRANSFER: 6 ints
-        unsigned int idx_a = h_rtag.data[angle.tag[0]];
-        unsigned int idx_b = h_rtag.data[angle.tag[1]];
-        unsigned int idx_c = h_rtag.data[angle.tag[2]];
-
-        // throw an error if this angle is incomplete
-        if (idx_a == NOT_LOCAL|| idx_b == NOT_LOCAL || idx_c == NOT_LOCAL)
-            {
-            this->m_exec_conf->msg->error() << "angle.cosinesq: angle " <<
-                angle.tag[0] << " " << angle.tag[1] << " " << angle.tag[2] << " incomplete." << endl << endl;
-            throw std::runtime_error("Error in angle calculation");
-            }
+        // lookup the index of each of the particles participating in the angle
+        const AngleData::members_t& angle = h_angles.data[i];
+        unsigned int idx_a = angle.idx[0];
+        unsigned int idx_b = angle.idx[1];
+        unsigned int idx_c = angle.idx[2];
 
         assert(idx_a < m_pdata->getN()+m_pdata->getNGhosts());
         assert(idx_b < m_pdata->getN()+m_pdata->getNGhosts());
@@ -202,7 +190,7 @@ void CosineSqAngleForceCompute::computeForces(unsigned int timestep)
         if (c_abbc < -1.0) c_abbc = -1.0;
 
         // actually calculate the force
-        unsigned int angle_type = m_angle_data->getTypeByIndex(i);
+        unsigned int angle_type = h_typeval.data[i].type;
         Scalar dcosth = c_abbc - cos(m_t_0[angle_type]);  // = cos(t) - cos(t0)
         Scalar tk = m_K[angle_type]*dcosth;  // = k(cos(t) - cos(t0))
 
@@ -12,7 +12,7 @@
 #endif
 
 #include "hoomd/HOOMDMath.h"
-#include "hoomd/Saru.h"
+#include "hoomd/Philox.h"
 
 
 /*! \file EvaluatorPairDPDLJThermo.h
@@ -201,11 +201,11 @@ class EvaluatorPairDPDLJThermo
                    m_oj = m_j;
                    }
 
-                hoomd::detail::Saru rng(m_oi, m_oj, m_seed + m_timestep);
+                hoomd::detail::PhiloxRNG rng(hoomd::detail::PhiloxStream::PairDPDLJThermo, m_seed, m_oi, m_oj, m_timestep);
 
 
                 // Generate a single random number
-                Scalar alpha = rng.s<Scalar>(-1,1);
+                Scalar alpha = hoomd::detail::philox_uniform<Scalar>(rng.block().x, -1, 1);
 
                 // conservative lj
                 force_divr = r2inv * r6inv * (Scalar(12.0)*lj1*r6inv - Scalar(6.0)*lj2);
@@ -13,7 +13,7 @@
 
 #include "hoomd/HOOMDMath.h"
 
-#include "hoomd/Saru.h"
+#include "hoomd/Philox.h"
 
 
 /*! \file EvaluatorPairDPDThermo.h
@@ -195,10 +195,10 @@ class EvaluatorPairDPDThermo
                    m_oj = m_j;
                    }
 
-                hoomd::detail::Saru rng(m_oi, m_oj, m_seed + m_timestep);
+                hoomd::detail::PhiloxRNG rng(hoomd::detail::PhiloxStream::PairDPDThermo, m_seed, m_oi, m_oj, m_timestep);
 
                 // Generate a single random number
-                Scalar alpha = rng.s<Scalar>(-1,1);
+                Scalar alpha = hoomd::detail::philox_uniform<Scalar>(rng.block().x, -1, 1);
 
                 // conservative dpd
                 //force_divr = FDIV(a,r)*(Scalar(1.0) - r*rcutinv);
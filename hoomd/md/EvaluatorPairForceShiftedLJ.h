@@ -12,6 +12,7 @@
 #endif
 
 #include "hoomd/HOOMDMath.h"
+#include "PairPrecisionSetup.h"
 
 /*! \file EvaluatorPairForceShiftedLJ.h
     \brief Defines the pair evaluator class for LJ potentials
@@ -89,23 +90,23 @@ class EvaluatorPairForceShiftedLJ
             // compute the force divided by r in force_divr
             if (rsq < rcutsq && lj1 != 0)
                 {
-                Scalar r2inv = Scalar(1.0)/rsq;
-                Scalar r6inv = r2inv * r2inv * r2inv;
-                force_divr= r2inv * r6inv * (Scalar(12.0)*lj1*r6inv - Scalar(6.0)*lj2);
+                PairReal r2inv = PairReal(1.0)/rsq;
+                PairReal r6inv = r2inv * r2inv * r2inv;
+                force_divr= r2inv * r6inv * (PairReal(12.0)*lj1*r6inv - PairReal(6.0)*lj2);
 
                 pair_eng = r6inv * (lj1*r6inv - lj2);
 
-                Scalar rcut2inv = Scalar(1.0)/rcutsq;
-                Scalar rcut6inv = rcut2inv * rcut2inv * rcut2inv;
+                PairReal rcut2inv = PairReal(1.0)/rcutsq;
+                PairReal rcut6inv = rcut2inv * rcut2inv * rcut2inv;
 
                 if (energy_shift)
                     pair_eng -= rcut6inv * (lj1*rcut6inv - lj2);
 
                 // shift force and add linear term to potential
-                Scalar rcut_r_inv = fast::rsqrt(rsq*rcutsq);
-                Scalar force_rcut_at_rcut = rcut6inv * (Scalar(12.0)*lj1*rcut6inv - Scalar(6.0)*lj2);
+                PairReal rcut_r_inv = fast::rsqrt(rsq*rcutsq);
+                PairReal force_rcut_at_rcut = rcut6inv * (PairReal(12.0)*lj1*rcut6inv - PairReal(6.0)*lj2);
                 force_divr -= rcut_r_inv * force_rcut_at_rcut;
-                pair_eng += (rsq*rcut_r_inv-Scalar(1.0))*force_rcut_at_rcut;
+                pair_eng += (rsq*rcut_r_inv-PairReal(1.0))*force_rcut_at_rcut;
 
                 return true;
                 }
@@ -125,10 +126,10 @@ class EvaluatorPairForceShiftedLJ
         #endif
 
     protected:
-        Scalar rsq;     //!< Stored rsq from the constructor
-        Scalar rcutsq;  //!< Stored rcutsq from the constructor
-        Scalar lj1;     //!< lj1 parameter extracted from the params passed to the constructor
-        Scalar lj2;     //!< lj2 parameter extracted from the params passed to the constructor
+        PairReal rsq;     //!< Stored rsq from the constructor
+        PairReal rcutsq;  //!< Stored rcutsq from the constructor
+        PairReal lj1;     //!< lj1 parameter extracted from the params passed to the constructor
+        PairReal lj2;     //!< lj2 parameter extracted from the params passed to the constructor
     };
 
 
@@ -12,6 +12,7 @@
 #endif
 
 #include "hoomd/HOOMDMath.h"
+#include "PairPrecisionSetup.h"
 
 /*! \file EvaluatorPairGauss.h
     \brief Defines the pair evaluator class for Gaussian potentials
@@ -89,16 +90,16 @@ class EvaluatorPairGauss
             // compute the force divided by r in force_divr
             if (rsq < rcutsq)
                 {
-                Scalar sigma_sq = sigma*sigma;
-                Scalar r_over_sigma_sq = rsq / sigma_sq;
-                Scalar exp_val = fast::exp(-Scalar(1.0)/Scalar(2.0) * r_over_sigma_sq);
+                PairReal sigma_sq = sigma*sigma;
+                PairReal r_over_sigma_sq = rsq / sigma_sq;
+                PairReal exp_val = fast::exp(-PairReal(1.0)/PairReal(2.0) * r_over_sigma_sq);
 
                 force_divr = epsilon / sigma_sq * exp_val;
                 pair_eng = epsilon * exp_val;
 
                 if (energy_shift)
                     {
-                    pair_eng -= epsilon * fast::exp(-Scalar(1.0)/Scalar(2.0) * rcutsq / sigma_sq);
+                    pair_eng -= epsilon * fast::exp(-PairReal(1.0)/PairReal(2.0) * rcutsq / sigma_sq);
                     }
                 return true;
                 }
@@ -118,10 +119,10 @@ class EvaluatorPairGauss
         #endif
 
     protected:
-        Scalar rsq;     //!< Stored rsq from the constructor
-        Scalar rcutsq;  //!< Stored rcutsq from the constructor
-        Scalar epsilon; //!< epsilon parameter extracted from the params passed to the constructor
-        Scalar sigma;   //!< sigma parameter extracted from the params passed to the constructor
+        PairReal rsq;     //!< Stored rsq from the constructor
+        PairReal rcutsq;  //!< Stored rcutsq from the constructor
+        PairReal epsilon; //!< epsilon parameter extracted from the params passed to the constructor
+        PairReal sigma;   //!< sigma parameter extracted from the params passed to the constructor
     };
 
 
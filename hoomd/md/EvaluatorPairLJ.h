@@ -12,6 +12,7 @@
 #endif
 
 #include "hoomd/HOOMDMath.h"
+#include "PairPrecisionSetup.h"
 
 /*! \file EvaluatorPairLJ.h
     \brief Defines the pair evaluator class for LJ potentials
@@ -73,6 +74,10 @@
     needs to diverge between the host and device (i.e., to use a special math function like __powf on the device), it
     can similarly be put inside an ifdef NVCC block.
 
+    Evaluators may perform their internal math in PairReal (see PairPrecisionSetup.h), which is float in
+    ENABLE_MD_MIXED_PRECISION builds. The constructor and evalForceAndEnergy() arguments remain Scalar so that
+    PotentialPair computes distances and accumulates forces, energies and virials in full precision.
+
     <b>LJ specifics</b>
 
     EvaluatorPairLJ evaluates the function:
@@ -139,16 +144,16 @@ class EvaluatorPairLJ
             // compute the force divided by r in force_divr
             if (rsq < rcutsq && lj1 != 0)
                 {
-                Scalar r2inv = Scalar(1.0)/rsq;
-                Scalar r6inv = r2inv * r2inv * r2inv;
-                force_divr= r2inv * r6inv * (Scalar(12.0)*lj1*r6inv - Scalar(6.0)*lj2);
+                PairReal r2inv = PairReal(1.0)/rsq;
+                PairReal r6inv = r2inv * r2inv * r2inv;
+                force_divr= r2inv * r6inv * (PairReal(12.0)*lj1*r6inv - PairReal(6.0)*lj2);
 
                 pair_eng = r6inv * (lj1*r6inv - lj2);
 
                 if (energy_shift)
                     {
-                    Scalar rcut2inv = Scalar(1.0)/rcutsq;
-                    Scalar rcut6inv = rcut2inv * rcut2inv * rcut2inv;
+                    PairReal rcut2inv = PairReal(1.0)/rcutsq;
+                    PairReal rcut6inv = rcut2inv * rcut2inv * rcut2inv;
                     pair_eng -= rcut6inv * (lj1*rcut6inv - lj2);
                     }
                 return true;
@@ -169,10 +174,10 @@ class EvaluatorPairLJ
         #endif
 
     protected:
-        Scalar rsq;     //!< Stored rsq from the constructor
-        Scalar rcutsq;  //!< Stored rcutsq from the constructor
-        Scalar lj1;     //!< lj1 parameter extracted from the params passed to the constructor
-        Scalar lj2;     //!< lj2 parameter extracted from the params passed to the constructor
+        PairReal rsq;     //!< Stored rsq from the constructor
+        PairReal rcutsq;  //!< Stored rcutsq from the constructor
+        PairReal lj1;     //!< lj1 parameter extracted from the params passed to the constructor
+        PairReal lj2;     //!< lj2 parameter extracted from the params passed to the constructor
     };
 
 
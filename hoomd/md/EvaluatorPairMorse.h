@@ -12,6 +12,7 @@
 #endif
 
 #include "hoomd/HOOMDMath.h"
+#include "PairPrecisionSetup.h"
 
 /*! \file EvaluatorPairMorse.h
     \brief Defines the pair evaluator class for Morse potential
@@ -87,17 +88,17 @@ class EvaluatorPairMorse
             // compute the force divided by r in force_divr
             if (rsq < rcutsq)
                 {
-                Scalar r = fast::sqrt(rsq);
-                Scalar Exp_factor = fast::exp(-alpha*(r-r0));
+                PairReal r = fast::sqrt(rsq);
+                PairReal Exp_factor = fast::exp(-alpha*(r-r0));
 
-                pair_eng = D0 * Exp_factor * (Exp_factor - Scalar(2.0));
-                force_divr = Scalar(2.0) * D0 * alpha * Exp_factor * (Exp_factor - Scalar(1.0)) / r;
+                pair_eng = D0 * Exp_factor * (Exp_factor - PairReal(2.0));
+                force_divr = PairReal(2.0) * D0 * alpha * Exp_factor * (Exp_factor - PairReal(1.0)) / r;
 
                 if (energy_shift)
                     {
-                    Scalar rcut = fast::sqrt(rcutsq);
-                    Scalar Exp_factor_cut = fast::exp(-alpha*(rcut-r0));
-                    pair_eng -= D0 * Exp_factor_cut * (Exp_factor_cut - Scalar(2.0));
+                    PairReal rcut = fast::sqrt(rcutsq);
+                    PairReal Exp_factor_cut = fast::exp(-alpha*(rcut-r0));
+                    pair_eng -= D0 * Exp_factor_cut * (Exp_factor_cut - PairReal(2.0));
                     }
                 return true;
                 }
@@ -117,11 +118,11 @@ class EvaluatorPairMorse
         #endif
 
     protected:
-        Scalar rsq;     //!< Stored rsq from the constructor
-        Scalar rcutsq;  //!< Stored rcutsq from the constructor
-        Scalar D0;      //!< Depth of the Morse potential at its minimum
-        Scalar alpha;   //!< Controls width of the potential well
-        Scalar r0;      //!< Offset, i.e., position of the potential minimum
+        PairReal rsq;     //!< Stored rsq from the constructor
+        PairReal rcutsq;  //!< Stored rcutsq from the constructor
+        PairReal D0;      //!< Depth of the Morse potential at its minimum
+        PairReal alpha;   //!< Controls width of the potential well
+        PairReal r0;      //!< Offset, i.e., position of the potential minimum
     };
 
 
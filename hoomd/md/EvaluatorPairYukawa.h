@@ -12,6 +12,7 @@
 #endif
 
 #include "hoomd/HOOMDMath.h"
+#include "PairPrecisionSetup.h"
 
 /*! \file EvaluatorPairYukawa.h
     \brief Defines the pair evaluator class for Yukawa potentials
@@ -89,19 +90,19 @@ class EvaluatorPairYukawa
             // compute the force divided by r in force_divr
             if (rsq < rcutsq && epsilon != 0)
                 {
-                Scalar rinv = fast::rsqrt(rsq);
-                Scalar r = Scalar(1.0) / rinv;
-                Scalar r2inv = Scalar(1.0) / rsq;
+                PairReal rinv = fast::rsqrt(rsq);
+                PairReal r = PairReal(1.0) / rinv;
+                PairReal r2inv = PairReal(1.0) / rsq;
 
-                Scalar exp_val = fast::exp(-kappa * r);
+                PairReal exp_val = fast::exp(-kappa * r);
 
                 force_divr = epsilon * exp_val * r2inv * (rinv + kappa);
                 pair_eng = epsilon * exp_val * rinv;
 
                 if (energy_shift)
                     {
-                    Scalar rcutinv = fast::rsqrt(rcutsq);
-                    Scalar rcut = Scalar(1.0) / rcutinv;
+                    PairReal rcutinv = fast::rsqrt(rcutsq);
+                    PairReal rcut = PairReal(1.0) / rcutinv;
                     pair_eng -= epsilon * fast::exp(-kappa * rcut) * rcutinv;
                     }
                 return true;
@@ -122,10 +123,10 @@ class EvaluatorPairYukawa
         #endif
 
     protected:
-        Scalar rsq;     //!< Stored rsq from the constructor
-        Scalar rcutsq;  //!< Stored rcutsq from the constructor
-        Scalar epsilon; //!< epsilon parameter extracted from the params passed to the constructor
-        Scalar kappa;   //!< kappa parameter extracted from the params passed to the constructor
+        PairReal rsq;     //!< Stored rsq from the constructor
+        PairReal rcutsq;  //!< Stored rcutsq from the constructor
+        PairReal epsilon; //!< epsilon parameter extracted from the params passed to the constructor
+        PairReal kappa;   //!< kappa parameter extracted from the params passed to the constructor
     };
 
 
@@ -9,6 +9,11 @@
 
 #include <map>
 #include <string.h>
+
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
+
 namespace py = pybind11;
 
 /*! \file ForceComposite.cc
@@ -19,7 +24,7 @@ namespace py = pybind11;
 */
 ForceComposite::ForceComposite(std::shared_ptr<SystemDefinition> sysdef)
         : MolecularForceCompute(sysdef), m_bodies_changed(false), m_ptls_added_removed(false),
-         m_global_max_d(0.0),
+         m_global_max_d(0.0), m_body_table_dirty(true),
          #ifdef ENABLE_MPI
          m_comm_ghost_layer_connected(false),
          #endif
@@ -180,6 +185,7 @@ void ForceComposite::setParam(unsigned int body_typeid,
                 }
             }
         m_bodies_changed = true;
+        m_body_table_dirty = true;
         assert(m_d_max_changed.size() > body_typeid);
 
         // make sure central particle will be communicated
@@ -266,6 +272,8 @@ void ForceComposite::slotNumTypesChange()
     m_d_max_changed.resize(new_ntypes, false);
 
     m_body_max_diameter.resize(new_ntypes,0.0);
+
+    m_body_table_dirty = true;
     }
 
 Scalar ForceComposite::requestExtraGhostLayerWidth(unsigned int type)
@@ -764,8 +772,21 @@ void ForceComposite::computeForces(unsigned int timestep)
         compute_virial = true;
         }
 
-    // loop over all molecules, also incomplete ones
+    // constituent positions in the body frame
+    updateBodyTable();
+    const unsigned int *body_offset = &m_body_table_offset.front();
+    const Scalar *body_x = m_body_table_x.data();
+    const Scalar *body_y = m_body_table_y.data();
+    const Scalar *body_z = m_body_table_z.data();
+
+    // loop over all molecules, also incomplete ones, every molecule writes only to its own particles
+    #ifdef ENABLE_TBB
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, nmol),
+        [&](const tbb::blocked_range<unsigned int>& range) {
+    for (unsigned int ibody = range.begin(); ibody != range.end(); ++ibody)
+    #else
     for (unsigned int ibody = 0; ibody < nmol; ibody++)
+    #endif
         {
         unsigned int len = h_molecule_length.data[ibody];
 
@@ -791,6 +812,25 @@ void ForceComposite::computeForces(unsigned int timestep)
         // body type
         unsigned int type = __scalar_as_int(postype.w);
 
+        // only add forces for local central particles
+        bool central_local = central_idx < m_pdata->getN();
+
+        // if the central particle is local, the molecule should be complete
+        if (central_local && len > 1 && len != h_body_len.data[type] + 1)
+            {
+            m_exec_conf->msg->error() << "constrain.rigid(): Composite particle with body tag " << central_tag << " incomplete"
+                << std::endl << std::endl;
+            throw std::runtime_error("Error computing composite particle forces.\n");
+            }
+
+        // rotate all constituents with the same matrix
+        rotmat3<Scalar> rot(orientation);
+        const unsigned int offset = body_offset[type];
+
+        Scalar4 force_sum = make_scalar4(0.0,0.0,0.0,0.0);
+        vec3<Scalar> torque_sum(0.0,0.0,0.0);
+        Scalar virial_sum[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
         // sum up forces and torques from constituent particles
         for (unsigned int jptl = 0; jptl < len; ++jptl)
             {
@@ -810,61 +850,39 @@ void ForceComposite::computeForces(unsigned int timestep)
             h_net_force.data[idxj] = make_scalar4(0.0,0.0,0.0,0.0);
             h_net_torque.data[idxj] = make_scalar4(0.0,0.0,0.0,0.0);
 
-            // only add forces for local central particles
-            if (central_idx < m_pdata->getN())
+            if (central_local)
                 {
-                // if the central particle is local, the molecule should be complete
-                if (len != h_body_len.data[type] + 1)
-                    {
-                    m_exec_conf->msg->error() << "constrain.rigid(): Composite particle with body tag " << central_tag << " incomplete"
-                        << std::endl << std::endl;
-                    throw std::runtime_error("Error computing composite particle forces.\n");
-                    }
-
                 // sum up center of mass force
-                h_force.data[central_idx].x += f.x;
-                h_force.data[central_idx].y += f.y;
-                h_force.data[central_idx].z += f.z;
+                force_sum.x += f.x;
+                force_sum.y += f.y;
+                force_sum.z += f.z;
 
                 // sum up energy
-                h_force.data[central_idx].w += net_force.w;
+                force_sum.w += net_force.w;
 
-                // fetch relative position from rigid body definition
-                vec3<Scalar> dr(h_body_pos.data[m_body_idx(type, jptl - 1)]);
-
-                // rotate into space frame
-                vec3<Scalar> dr_space = rotate(orientation, dr);
+                // fetch relative position from rigid body definition and rotate into space frame
+                unsigned int k = offset + jptl - 1;
+                vec3<Scalar> dr_space = rot*vec3<Scalar>(body_x[k], body_y[k], body_z[k]);
 
                 // torque = r x f
-                vec3<Scalar> delta_torque(cross(dr_space,f));
-                h_torque.data[central_idx].x += delta_torque.x;
-                h_torque.data[central_idx].y += delta_torque.y;
-                h_torque.data[central_idx].z += delta_torque.z;
+                torque_sum += cross(dr_space,f);
 
                 /* from previous rigid body implementation: Access Torque elements from a single particle. Right now I will am assuming that the particle
                     and rigid body reference frames are the same. Probably have to rotate first.
                  */
-                h_torque.data[central_idx].x += net_torque.x;
-                h_torque.data[central_idx].y += net_torque.y;
-                h_torque.data[central_idx].z += net_torque.z;
+                torque_sum.x += net_torque.x;
+                torque_sum.y += net_torque.y;
+                torque_sum.z += net_torque.z;
 
                 if (compute_virial)
                     {
-                    // sum up virial
-                    Scalar virialxx = h_net_virial.data[0*net_virial_pitch+idxj];
-                    Scalar virialxy = h_net_virial.data[1*net_virial_pitch+idxj];
-                    Scalar virialxz = h_net_virial.data[2*net_virial_pitch+idxj];
-                    Scalar virialyy = h_net_virial.data[3*net_virial_pitch+idxj];
-                    Scalar virialyz = h_net_virial.data[4*net_virial_pitch+idxj];
-                    Scalar virialzz = h_net_virial.data[5*net_virial_pitch+idxj];
-
-                    // subtract intra-body virial prt
-                    h_virial.data[0*m_virial_pitch+central_idx] += virialxx - f.x*dr_space.x;
-                    h_virial.data[1*m_virial_pitch+central_idx] += virialxy - f.x*dr_space.y;
-                    h_virial.data[2*m_virial_pitch+central_idx] += virialxz - f.x*dr_space.z;
-                    h_virial.data[3*m_virial_pitch+central_idx] += virialyy - f.y*dr_space.y;
-                    h_virial.data[4*m_virial_pitch+central_idx] += virialyz - f.y*dr_space.z;
-                    h_virial.data[5*m_virial_pitch+central_idx] += virialzz - f.z*dr_space.z;
+                    // sum up virial, subtract intra-body virial prt
+                    virial_sum[0] += h_net_virial.data[0*net_virial_pitch+idxj] - f.x*dr_space.x;
+                    virial_sum[1] += h_net_virial.data[1*net_virial_pitch+idxj] - f.x*dr_space.y;
+                    virial_sum[2] += h_net_virial.data[2*net_virial_pitch+idxj] - f.x*dr_space.z;
+                    virial_sum[3] += h_net_virial.data[3*net_virial_pitch+idxj] - f.y*dr_space.y;
+                    virial_sum[4] += h_net_virial.data[4*net_virial_pitch+idxj] - f.y*dr_space.z;
+                    virial_sum[5] += h_net_virial.data[5*net_virial_pitch+idxj] - f.z*dr_space.z;
                     }
                 }
 
@@ -876,7 +894,18 @@ void ForceComposite::computeForces(unsigned int timestep)
             h_net_virial.data[4*net_virial_pitch+idxj] = 0.0;
             h_net_virial.data[5*net_virial_pitch+idxj] = 0.0;
             }
+
+        if (central_local)
+            {
+            h_force.data[central_idx] = force_sum;
+            h_torque.data[central_idx] = make_scalar4(torque_sum.x, torque_sum.y, torque_sum.z, 0.0);
+            for (unsigned int i = 0; i < 6; ++i)
+                h_virial.data[i*m_virial_pitch+central_idx] = virial_sum[i];
+            }
         }
+    #ifdef ENABLE_TBB
+        });
+    #endif
     }
 
 /* Set position and velocity of constituent particles in rigid bodies in the 1st or second half of integration on the CPU
@@ -885,10 +914,12 @@ void ForceComposite::computeForces(unsigned int timestep)
 
 void ForceComposite::updateCompositeParticles(unsigned int timestep)
     {
-    // access molecule order (this needs to be on top because of ArrayHandle scope)
-    ArrayHandle<unsigned int> h_molecule_order(getMoleculeOrder(), access_location::host, access_mode::read);
+    // access molecule list (this needs to be on top because of ArrayHandle scope)
+    Index2D molecule_indexer = getMoleculeIndexer();
+    unsigned int nmol = molecule_indexer.getW();
+
+    ArrayHandle<unsigned int> h_molecule_list(getMoleculeList(), access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_molecule_len(getMoleculeLengths(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_molecule_idx(getMoleculeIndex(), access_location::host, access_mode::read);
 
     // access the particle data arrays
     ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
@@ -902,35 +933,54 @@ void ForceComposite::updateCompositeParticles(unsigned int timestep)
 
     ArrayHandle<unsigned int> h_body(m_pdata->getBodies(), access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
 
-    // access body positions and orientations
-    ArrayHandle<Scalar3> h_body_pos(m_body_pos, access_location::host, access_mode::read);
+    // access body orientations and lengths
     ArrayHandle<Scalar4> h_body_orientation(m_body_orientation, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_body_len(m_body_len, access_location::host, access_mode::read);
 
+    // constituent positions in the body frame
+    updateBodyTable();
+    const unsigned int *body_offset = &m_body_table_offset.front();
+    const Scalar *body_x = m_body_table_x.data();
+    const Scalar *body_y = m_body_table_y.data();
+    const Scalar *body_z = m_body_table_z.data();
+
     const BoxDim& box = m_pdata->getBox();
     const BoxDim& global_box = m_pdata->getGlobalBox();
 
     // we need to update both local and ghost particles
-    unsigned int nptl = m_pdata->getN() + m_pdata->getNGhosts();
-
-    for (unsigned int iptl = 0; iptl < nptl; iptl++)
+    unsigned int nptl_local = m_pdata->getN();
+
+    // every molecule writes only to its own constituents
+    #ifdef ENABLE_TBB
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, nmol),
+        [&](const tbb::blocked_range<unsigned int>& range) {
+    for (unsigned int ibody = range.begin(); ibody != range.end(); ++ibody)
+    #else
+    for (unsigned int ibody = 0; ibody < nmol; ibody++)
+    #endif
         {
-        unsigned int central_tag = h_body.data[iptl];
+        unsigned int len = h_molecule_len.data[ibody];
 
-        if (central_tag == NO_BODY)
-            continue;
+        // does the molecule have local constituents?
+        bool has_local = false;
+        for (unsigned int jptl = 0; jptl < len; ++jptl)
+            {
+            if (h_molecule_list.data[molecule_indexer(ibody, jptl)] < nptl_local)
+                has_local = true;
+            }
 
         // body tag equals tag for central ptl
+        unsigned int first_idx = h_molecule_list.data[molecule_indexer(ibody, 0)];
+        unsigned int central_tag = h_body.data[first_idx];
         assert(central_tag <= m_pdata->getMaximumTag());
         unsigned int central_idx = h_rtag.data[central_tag];
 
-        if (central_idx == NOT_LOCAL && iptl >= m_pdata->getN())
-            continue;
-
         if (central_idx == NOT_LOCAL)
             {
+            if (!has_local)
+                continue;
+
             m_exec_conf->msg->error() << "constrain.rigid(): Missing central particle tag " << central_tag << "!"
                 << std::endl << std::endl;
             throw std::runtime_error("Error updating composite particles.\n");
@@ -939,9 +989,6 @@ void ForceComposite::updateCompositeParticles(unsigned int timestep)
         // central ptl position and orientation
         assert(central_idx <= m_pdata->getN() + m_pdata->getNGhosts());
 
-        // do not overwrite the central ptl
-        if (iptl == central_idx) continue;
-
         Scalar4 postype = h_postype.data[central_idx];
         vec3<Scalar> pos(postype);
         quat<Scalar> orientation(h_orientation.data[central_idx]);
@@ -950,10 +997,9 @@ void ForceComposite::updateCompositeParticles(unsigned int timestep)
         unsigned int type = __scalar_as_int(postype.w);
 
         unsigned int body_len = h_body_len.data[type];
-        unsigned int mol_idx = h_molecule_idx.data[iptl];
-        if (body_len != h_molecule_len.data[mol_idx] - 1)
+        if (len > 1 && body_len != len - 1)
             {
-            if (iptl < m_pdata->getN())
+            if (has_local)
                 {
                 // if the molecule is incomplete and has local members, this is an error
                 m_exec_conf->msg->error() << "constrain.rigid(): Composite particle with body tag " << central_tag << " incomplete"
@@ -967,30 +1013,76 @@ void ForceComposite::updateCompositeParticles(unsigned int timestep)
 
         int3 img = h_image.data[central_idx];
 
-        // fetch relative index in body from molecule list
-        assert(h_molecule_order.data[iptl] > 0);
-        unsigned int idx_in_body = h_molecule_order.data[iptl] - 1;
+        // rotate all constituents with the same matrix
+        rotmat3<Scalar> rot(orientation);
+        const unsigned int offset = body_offset[type];
+
+        // the central particle is the first member, the constituents follow in the order of the body definition
+        for (unsigned int jptl = 1; jptl < len; ++jptl)
+            {
+            unsigned int iptl = h_molecule_list.data[molecule_indexer(ibody, jptl)];
+            unsigned int idx_in_body = jptl - 1;
 
-        vec3<Scalar> local_pos(h_body_pos.data[m_body_idx(type,idx_in_body)]);
-        vec3<Scalar> dr_space = rotate(orientation, local_pos);
+            unsigned int k = offset + idx_in_body;
+            vec3<Scalar> dr_space = rot*vec3<Scalar>(body_x[k], body_y[k], body_z[k]);
 
-        // update position and orientation
-        vec3<Scalar> updated_pos(pos);
-        quat<Scalar> local_orientation(h_body_orientation.data[m_body_idx(type, idx_in_body)]);
+            // update position and orientation
+            vec3<Scalar> updated_pos(pos);
+            quat<Scalar> local_orientation(h_body_orientation.data[m_body_idx(type, idx_in_body)]);
 
-        updated_pos += dr_space;
-        quat<Scalar> updated_orientation = orientation*local_orientation;
+            updated_pos += dr_space;
+            quat<Scalar> updated_orientation = orientation*local_orientation;
 
-        // this runs before the ForceComputes,
-        // wrap into box, allowing rigid bodies to span multiple images
-        int3 imgi = box.getImage(vec_to_scalar3(updated_pos));
-        int3 negimgi = make_int3(-imgi.x,-imgi.y,-imgi.z);
-        updated_pos = global_box.shift(updated_pos, negimgi);
+            // this runs before the ForceComputes,
+            // wrap into box, allowing rigid bodies to span multiple images
+            int3 imgi = box.getImage(vec_to_scalar3(updated_pos));
+            int3 negimgi = make_int3(-imgi.x,-imgi.y,-imgi.z);
+            updated_pos = global_box.shift(updated_pos, negimgi);
 
-        h_postype.data[iptl] = make_scalar4(updated_pos.x, updated_pos.y, updated_pos.z, h_postype.data[iptl].w);
-        h_orientation.data[iptl] = quat_to_scalar4(updated_orientation);
-        h_image.data[iptl] = img+imgi;
+            h_postype.data[iptl] = make_scalar4(updated_pos.x, updated_pos.y, updated_pos.z, h_postype.data[iptl].w);
+            h_orientation.data[iptl] = quat_to_scalar4(updated_orientation);
+            h_image.data[iptl] = img+imgi;
+            }
         }
+    #ifdef ENABLE_TBB
+        });
+    #endif
+    }
+
+/*! Copies the constituent positions of all body types into one flat table with separate x, y and z arrays, so
+    that the constituents of a body are rotated with unit-stride loads.
+*/
+void ForceComposite::updateBodyTable()
+    {
+    if (!m_body_table_dirty)
+        return;
+
+    ArrayHandle<Scalar3> h_body_pos(m_body_pos, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body_len(m_body_len, access_location::host, access_mode::read);
+
+    unsigned int ntypes = m_body_len.getNumElements();
+    m_body_table_offset.resize(ntypes+1);
+    m_body_table_offset[0] = 0;
+    for (unsigned int type = 0; type < ntypes; ++type)
+        m_body_table_offset[type+1] = m_body_table_offset[type] + h_body_len.data[type];
+
+    unsigned int n = m_body_table_offset[ntypes];
+    m_body_table_x.resize(n);
+    m_body_table_y.resize(n);
+    m_body_table_z.resize(n);
+
+    for (unsigned int type = 0; type < ntypes; ++type)
+        {
+        for (unsigned int i = 0; i < h_body_len.data[type]; ++i)
+            {
+            Scalar3 dr = h_body_pos.data[m_body_idx(type, i)];
+            m_body_table_x[m_body_table_offset[type] + i] = dr.x;
+            m_body_table_y[m_body_table_offset[type] + i] = dr.y;
+            m_body_table_z[m_body_table_offset[type] + i] = dr.z;
+            }
+        }
+
+    m_body_table_dirty = false;
     }
 
 void export_ForceComposite(py::module& m)
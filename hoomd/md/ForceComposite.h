@@ -89,6 +89,15 @@ class PYBIND11_EXPORT ForceComposite : public MolecularForceCompute
         std::vector<Scalar> m_body_max_diameter;                  //!< List of diameters for all body types
         Scalar m_global_max_d;                                    //!< Maximum over all body diameters
 
+        std::vector<Scalar> m_body_table_x;               //!< Body frame x coordinate of every constituent
+        std::vector<Scalar> m_body_table_y;               //!< Body frame y coordinate of every constituent
+        std::vector<Scalar> m_body_table_z;               //!< Body frame z coordinate of every constituent
+        std::vector<unsigned int> m_body_table_offset;    //!< First constituent of each body type in the table
+        bool m_body_table_dirty;                          //!< True if the body table needs to be rebuilt
+
+        //! Rebuild the structure-of-arrays table of constituent positions
+        void updateBodyTable();
+
         //! Helper function to be called when the number of types changes
         void slotNumTypesChange();
 
@@ -7,6 +7,11 @@
 #include "ForceDistanceConstraint.h"
 
 #include <string.h>
+
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
+
 using namespace Eigen;
 namespace py = pybind11;
 
@@ -21,7 +26,8 @@ ForceDistanceConstraint::ForceDistanceConstraint(std::shared_ptr<SystemDefinitio
           m_cmatrix(m_exec_conf), m_cvec(m_exec_conf), m_lagrange(m_exec_conf),
           m_rel_tol(1e-3), m_constraint_violated(m_exec_conf), m_condition(m_exec_conf),
           m_sparse_idxlookup(m_exec_conf), m_constraint_reorder(true), m_constraints_added_removed(true),
-          m_d_max(0.0)
+          m_d_max(0.0), m_iterative(false), m_tol(1e-6), m_max_iter(100), m_num_iterations(0),
+          m_constraint_groups_dirty(true), m_num_solves(0), m_total_iterations(0), m_num_unconverged(0)
     {
     m_constraint_violated.resetFlags(0);
 
@@ -61,19 +67,30 @@ void ForceDistanceConstraint::computeForces(unsigned int timestep)
         throw std::runtime_error("Error computing constraints.\n");
         }
 
-    // reallocate through amortized resizin
-    unsigned int n_constraint = m_cdata->getN()+m_cdata->getNGhosts();
-    m_cmatrix.resize(n_constraint*n_constraint);
-    m_cvec.resize(n_constraint);
+    if (m_iterative)
+        {
+        // the iterative solver does not need the matrix
+        solveConstraintsIterative(timestep);
 
-    // populate the terms in the matrix vector equation
-    fillMatrixVector(timestep);
+        // check violations
+        checkConstraints(timestep);
+        }
+    else
+        {
+        // reallocate through amortized resizin
+        unsigned int n_constraint = m_cdata->getN()+m_cdata->getNGhosts();
+        m_cmatrix.resize(n_constraint*n_constraint);
+        m_cvec.resize(n_constraint);
 
-    // check violations
-    checkConstraints(timestep);
+        // populate the terms in the matrix vector equation
+        fillMatrixVector(timestep);
 
-    // solve the matrix vector equation
-    solveConstraints(timestep);
+        // check violations
+        checkConstraints(timestep);
+
+        // solve the matrix vector equation
+        solveConstraints(timestep);
+        }
 
     // compute forces
     computeConstraintForces(timestep);
@@ -372,6 +389,281 @@ void ForceDistanceConstraint::solveConstraints(unsigned int timestep)
         m_prof->pop();
     }
 
+/*! Solves the same linear system as solveConstraints() with Gauss-Seidel sweeps. With the sum over the constraints
+    m that act on particle p,
+
+        g_p = sum_m (+/-) lambda_m r_m,
+
+    the product of row n of the matrix with the Lagrange multipliers is 4 q_n.(g_a/m_a - g_b/m_b). Each sweep updates
+    the multipliers one at a time and adds the change to g of the two particles. Groups of constraints that share no
+    particles are independent and are solved in parallel.
+*/
+void ForceDistanceConstraint::solveConstraintsIterative(unsigned int timestep)
+    {
+    unsigned int n_constraint = m_cdata->getN()+m_cdata->getNGhosts();
+
+    // reallocate array of constraint forces
+    m_lagrange.resize(n_constraint);
+
+    // skip if zero constraints
+    if (n_constraint == 0) return;
+
+    if (m_prof)
+        m_prof->push("iterative solve");
+
+    // access particle data
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_netforce(m_pdata->getNetForce(), access_location::host, access_mode::read);
+
+    // access constraint data
+    ArrayHandle<ConstraintData::members_t> h_groups(m_cdata->getMembersArray(), access_location::host,
+        access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_cdata->getTypeValArray(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_group_tag(m_cdata->getTags(), access_location::host, access_mode::read);
+
+    ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::overwrite);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
+    m_iter_constraints.resize(n_constraint);
+    m_iter_g.assign(max_local, vec3<double>());
+
+    // the multipliers of the last step are stored by constraint tag
+    if (m_lagrange_tag.size() < m_cdata->getRTags().size())
+        m_lagrange_tag.resize(m_cdata->getRTags().size(), 0.0);
+
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        // transform a and b into indicies into the particle data arrays
+        const ConstraintData::members_t& constraint = h_groups.data[n];
+        unsigned int idx_a = h_rtag.data[constraint.tag[0]];
+        unsigned int idx_b = h_rtag.data[constraint.tag[1]];
+
+        if (idx_a >= max_local || idx_b >= max_local)
+            {
+            this->m_exec_conf->msg->error() << "constrain.distance(): constraint " <<
+                constraint.tag[0] << " " << constraint.tag[1] << " incomplete." << std::endl << std::endl;
+            throw std::runtime_error("Error in constraint calculation");
+            }
+
+        vec3<Scalar> rn(box.minImage(vec3<Scalar>(h_pos.data[idx_a]) - vec3<Scalar>(h_pos.data[idx_b])));
+        vec3<Scalar> rndot(vec3<Scalar>(h_vel.data[idx_a]) - vec3<Scalar>(h_vel.data[idx_b]));
+        vec3<Scalar> qn(rn+rndot*m_deltaT);
+
+        IterativeConstraint& c = m_iter_constraints[n];
+        c.idx_a = idx_a;
+        c.idx_b = idx_b;
+        c.r = rn;
+        c.q = qn;
+        c.inv_ma = double(1.0)/h_vel.data[idx_a].w;
+        c.inv_mb = double(1.0)/h_vel.data[idx_b].w;
+
+        // get constraint distance
+        Scalar d = h_typeval.data[n].val;
+
+        // check distance violation
+        if (fast::sqrt(dot(rn,rn))-d >= m_rel_tol*d || std::isnan(dot(rn,rn)))
+            {
+            m_constraint_violated.resetFlags(n+1);
+            }
+
+        c.rhs = (dot(qn,qn)-d*d)/m_deltaT/m_deltaT;
+        c.rhs += double(2.0)*dot(c.q, vec3<double>(h_netforce.data[idx_a])*c.inv_ma
+            - vec3<double>(h_netforce.data[idx_b])*c.inv_mb);
+        c.diag = double(4.0)*dot(c.q, c.r)*(c.inv_ma + c.inv_mb);
+
+        // warm start
+        double lambda = m_lagrange_tag[h_group_tag.data[n]];
+        h_lagrange.data[n] = lambda;
+        m_iter_g[idx_a] += lambda*c.r;
+        m_iter_g[idx_b] -= lambda*c.r;
+        }
+
+    if (m_constraint_groups_dirty)
+        {
+        buildConstraintGroups();
+        m_constraint_groups_dirty = false;
+        }
+
+    unsigned int n_groups = m_group_offsets.size() - 1;
+    m_group_iterations.resize(n_groups);
+
+    #ifdef ENABLE_TBB
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_groups),
+        [&](const tbb::blocked_range<unsigned int>& range) {
+    for (unsigned int group = range.begin(); group != range.end(); ++group)
+    #else
+    for (unsigned int group = 0; group < n_groups; ++group)
+    #endif
+        {
+        // absolute floor of the convergence test, so that unloaded constraints (lambda -> 0) do not have to be
+        // resolved to the relative tolerance of their own vanishing multiplier: the largest multiplier any
+        // constraint of the group would carry on its own
+        double lambda_scale = 0.0;
+        for (unsigned int k = m_group_offsets[group]; k < m_group_offsets[group+1]; ++k)
+            {
+            const IterativeConstraint& c = m_iter_constraints[m_group_order[k]];
+            lambda_scale = std::max(lambda_scale, fabs(c.rhs/c.diag));
+            }
+
+        unsigned int iter = 0;
+        bool converged = false;
+        while (!converged && iter < m_max_iter)
+            {
+            converged = true;
+            for (unsigned int k = m_group_offsets[group]; k < m_group_offsets[group+1]; ++k)
+                {
+                unsigned int n = m_group_order[k];
+                const IterativeConstraint& c = m_iter_constraints[n];
+
+                // residual of this constraint equation
+                double ax = double(4.0)*dot(c.q, m_iter_g[c.idx_a]*c.inv_ma - m_iter_g[c.idx_b]*c.inv_mb);
+                double delta = (c.rhs - ax)/c.diag;
+
+                double lambda = h_lagrange.data[n] + delta;
+                h_lagrange.data[n] = lambda;
+                m_iter_g[c.idx_a] += delta*c.r;
+                m_iter_g[c.idx_b] -= delta*c.r;
+
+                if (fabs(delta) > m_tol*(fabs(lambda) + lambda_scale))
+                    converged = false;
+                }
+            iter++;
+            }
+
+        // groups that did not converge are flagged with m_max_iter+1
+        m_group_iterations[group] = converged ? iter : m_max_iter+1;
+        }
+    #ifdef ENABLE_TBB
+        });
+    #endif
+
+    // statistics
+    m_num_iterations = 0;
+    for (unsigned int group = 0; group < n_groups; ++group)
+        {
+        if (m_group_iterations[group] > m_max_iter)
+            m_num_unconverged++;
+        m_num_iterations = std::max(m_num_iterations, std::min(m_group_iterations[group], m_max_iter));
+        }
+    m_num_solves++;
+    m_total_iterations += m_num_iterations;
+
+    // store the multipliers for the next step
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        m_lagrange_tag[h_group_tag.data[n]] = h_lagrange.data[n];
+
+    if (m_prof)
+        m_prof->pop();
+    }
+
+/*! Constraints that share a particle, directly or through other constraints, are in the same group. Requires
+    m_iter_constraints to be filled in for the current step.
+*/
+void ForceDistanceConstraint::buildConstraintGroups()
+    {
+    unsigned int n_constraint = m_cdata->getN()+m_cdata->getNGhosts();
+    unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
+
+    // union-find over particle indices
+    std::vector<unsigned int> parent(max_local);
+    for (unsigned int i = 0; i < max_local; ++i)
+        parent[i] = i;
+
+    auto find = [&parent](unsigned int i)
+        {
+        while (parent[i] != i)
+            {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+            }
+        return i;
+        };
+
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        unsigned int root_a = find(m_iter_constraints[n].idx_a);
+        unsigned int root_b = find(m_iter_constraints[n].idx_b);
+        if (root_a != root_b)
+            parent[std::max(root_a, root_b)] = std::min(root_a, root_b);
+        }
+
+    // number the groups in the order of their first constraint and count their sizes
+    std::vector<unsigned int> group_of_root(max_local, NOT_LOCAL);
+    std::vector<unsigned int> constraint_group(n_constraint);
+    m_group_offsets.assign(1, 0);
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        unsigned int root = find(m_iter_constraints[n].idx_a);
+        if (group_of_root[root] == NOT_LOCAL)
+            {
+            group_of_root[root] = m_group_offsets.size() - 1;
+            m_group_offsets.push_back(0);
+            }
+        constraint_group[n] = group_of_root[root];
+        m_group_offsets[constraint_group[n]+1]++;
+        }
+
+    unsigned int n_groups = m_group_offsets.size() - 1;
+    for (unsigned int group = 0; group < n_groups; ++group)
+        m_group_offsets[group+1] += m_group_offsets[group];
+
+    // list the constraints of each group
+    std::vector<unsigned int> cursor(m_group_offsets.begin(), m_group_offsets.end() - 1);
+    m_group_order.resize(n_constraint);
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        m_group_order[cursor[constraint_group[n]]++] = n;
+
+    m_exec_conf->msg->notice(6) << "constrain.distance(): " << n_groups << " independent groups of constraints"
+                                << std::endl;
+    }
+
+std::vector< std::string > ForceDistanceConstraint::getProvidedLogQuantities()
+    {
+    std::vector< std::string > list;
+    list.push_back("constrain_distance_iterations");
+    return list;
+    }
+
+/*! \param quantity Name of the quantity to get the log value of
+    \param timestep Current time step of the simulation
+*/
+Scalar ForceDistanceConstraint::getLogValue(const std::string& quantity, unsigned int timestep)
+    {
+    if (quantity == std::string("constrain_distance_iterations"))
+        {
+        compute(timestep);
+        return Scalar(m_num_iterations);
+        }
+    else
+        {
+        m_exec_conf->msg->error() << "constrain.distance(): " << quantity << " is not a valid log quantity"
+                                  << std::endl;
+        throw std::runtime_error("Error getting log value");
+        }
+    }
+
+void ForceDistanceConstraint::printStats()
+    {
+    if (!m_iterative || m_num_solves == 0)
+        return;
+
+    m_exec_conf->msg->notice(1) << "-- constrain.distance() stats:" << std::endl;
+    m_exec_conf->msg->notice(1) << "Average number of iterations: " << double(m_total_iterations)/double(m_num_solves)
+                                << std::endl;
+    m_exec_conf->msg->notice(1) << "Unconverged groups: " << m_num_unconverged << std::endl;
+    }
+
+void ForceDistanceConstraint::resetStats()
+    {
+    m_num_solves = 0;
+    m_total_iterations = 0;
+    m_num_unconverged = 0;
+    }
+
 void ForceDistanceConstraint::computeConstraintForces(unsigned int timestep)
     {
     ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::read);
@@ -596,5 +888,7 @@ void export_ForceDistanceConstraint(py::module& m)
     py::class_< ForceDistanceConstraint, std::shared_ptr<ForceDistanceConstraint> >(m, "ForceDistanceConstraint", py::base<MolecularForceCompute>())
         .def(py::init< std::shared_ptr<SystemDefinition> >())
         .def("setRelativeTolerance", &ForceDistanceConstraint::setRelativeTolerance)
+        .def("setIterative", &ForceDistanceConstraint::setIterative)
+        .def("getNumIterations", &ForceDistanceConstraint::getNumIterations)
     ;
     }
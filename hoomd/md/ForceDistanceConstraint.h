@@ -21,6 +21,7 @@
 
 #include "hoomd/GPUVector.h"
 #include "hoomd/GPUFlags.h"
+#include "hoomd/VectorMath.h"
 
 #include "hoomd/extern/Eigen/Eigen/Dense"
 #include "hoomd/extern/Eigen/Eigen/SparseLU"
@@ -30,6 +31,11 @@
     [1] M. Yoneya, H. J. C. Berendsen, and K. Hirasawa, “A Non-Iterative Matrix Method for Constraint Molecular Dynamics Simulations,” Mol. Simul., vol. 13, no. 6, pp. 395–405, 1994.
     [2] M. Yoneya, “A Generalized Non-iterative Matrix Method for Constraint Molecular Dynamics Simulations,” J. Comput. Phys., vol. 172, no. 1, pp. 188–197, Sep. 2001.
 
+    Alternatively, the linear system can be solved iteratively without assembling the matrix (setIterative()).
+    The constraints are split into connected groups (molecules), which are solved in parallel by Gauss-Seidel sweeps
+    in the spirit of SHAKE. The Lagrange multipliers of the previous step, stored by constraint tag, are the
+    starting point. The sweeps stop when no multiplier changes by more than the relative tolerance.
+
     See Integrator for detailed documentation on constraint force implementation.
     \ingroup computes
 */
@@ -54,6 +60,36 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
             m_rel_tol = rel_tol;
             }
 
+        //! Select the iterative solver
+        /*! \param iterative True to solve the constraint equations iteratively, false for the sparse LU solver
+            \param tol Tolerance of the Lagrange multipliers, relative to their magnitude in the molecule
+            \param max_iter Maximum number of Gauss-Seidel sweeps per step
+        */
+        void setIterative(bool iterative, Scalar tol, unsigned int max_iter)
+            {
+            m_iterative = iterative;
+            m_tol = tol;
+            m_max_iter = max_iter;
+            }
+
+        //! Get the maximum number of sweeps over all molecules in the last iterative solve
+        unsigned int getNumIterations()
+            {
+            return m_num_iterations;
+            }
+
+        //! Returns a list of log quantities this compute calculates
+        virtual std::vector< std::string > getProvidedLogQuantities();
+
+        //! Calculates the requested log value and returns it
+        virtual Scalar getLogValue(const std::string& quantity, unsigned int timestep);
+
+        //! Print statistics of the iterative solver
+        virtual void printStats();
+
+        //! Reset statistics counters
+        virtual void resetStats();
+
         #ifdef ENABLE_MPI
         //! Get ghost particle fields requested by this pair potential
         virtual CommFlags getRequestedCommFlags(unsigned int timestep);
@@ -83,6 +119,35 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
 
         Scalar m_d_max;                    //!< Maximum constraint extension
 
+        bool m_iterative;                  //!< True if the iterative solver is used
+        Scalar m_tol;                      //!< Tolerance of the iterative solver, relative to the multiplier scale of a group
+        unsigned int m_max_iter;           //!< Maximum number of sweeps of the iterative solver
+        unsigned int m_num_iterations;     //!< Maximum number of sweeps over all groups in the last solve
+        bool m_constraint_groups_dirty;    //!< True if the connected groups of constraints need to be rebuilt
+
+        //! Per-constraint quantities for the iterative solver
+        struct IterativeConstraint
+            {
+            unsigned int idx_a;     //!< Index of the first particle
+            unsigned int idx_b;     //!< Index of the second particle
+            vec3<double> r;         //!< Current separation vector
+            vec3<double> q;         //!< Predicted separation vector
+            double inv_ma;          //!< Inverse mass of the first particle
+            double inv_mb;          //!< Inverse mass of the second particle
+            double rhs;             //!< Right hand side of the constraint equation
+            double diag;            //!< Diagonal matrix element
+            };
+        std::vector<IterativeConstraint> m_iter_constraints;    //!< Constraint quantities by constraint index
+        std::vector< vec3<double> > m_iter_g;       //!< Sum of multiplier times separation vector, by particle index
+        std::vector<unsigned int> m_group_order;    //!< Constraint indices ordered by connected group
+        std::vector<unsigned int> m_group_offsets;  //!< Start of each group in m_group_order
+        std::vector<unsigned int> m_group_iterations;   //!< Number of sweeps used by each group
+        std::vector<double> m_lagrange_tag;         //!< Lagrange multipliers of the last step, by constraint tag
+
+        uint64_t m_num_solves;             //!< Number of iterative solves since the last resetStats()
+        uint64_t m_total_iterations;       //!< Sum of the maximum number of sweeps per solve
+        uint64_t m_num_unconverged;        //!< Number of groups that did not converge within m_max_iter
+
         //! Compute the forces
         virtual void computeForces(unsigned int timestep);
 
@@ -98,10 +163,17 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
         //! Solve the linear matrix-vector equation
         virtual void computeConstraintForces(unsigned int timestep);
 
+        //! Solve the constraint equations iteratively without assembling the matrix
+        virtual void solveConstraintsIterative(unsigned int timestep);
+
+        //! Split the constraints into connected groups
+        void buildConstraintGroups();
+
         //! Method called when constraint order changes
         virtual void slotConstraintReorder()
             {
             m_constraint_reorder = true;
+            m_constraint_groups_dirty = true;
             }
 
         //! Method called when constraint order changes
@@ -0,0 +1,295 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+
+// Maintainer: jglaser
+
+#include "ForceSettleConstraint.h"
+
+#include <atomic>
+#include <set>
+
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
+
+namespace py = pybind11;
+
+/*! \file ForceSettleConstraint.cc
+    \brief Contains code for the ForceSettleConstraint class
+*/
+
+/*! \param sysdef SystemDefinition containing the ParticleData to compute forces on
+*/
+ForceSettleConstraint::ForceSettleConstraint(std::shared_ptr<SystemDefinition> sysdef)
+        : ForceDistanceConstraint(sysdef), m_molecules_dirty(true)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ForceSettleConstraint" << std::endl;
+    }
+
+//! Destructor
+ForceSettleConstraint::~ForceSettleConstraint()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ForceSettleConstraint" << std::endl;
+    }
+
+/*! \param timestep Current timestep
+*/
+void ForceSettleConstraint::computeForces(unsigned int timestep)
+    {
+    if (m_prof)
+        m_prof->push("Settle constraint");
+
+    if (m_cdata->getNGlobal() == 0)
+        {
+        m_exec_conf->msg->error() << "constrain.settle() called with no constraints defined!\n" << std::endl;
+        throw std::runtime_error("Error computing constraints.\n");
+        }
+
+    if (m_molecules_dirty)
+        {
+        buildMolecules();
+        m_molecules_dirty = false;
+        }
+
+    // solve the 3x3 system of every molecule
+    solveMolecules(timestep);
+
+    // check violations
+    checkConstraints(timestep);
+
+    // compute forces
+    computeConstraintForces(timestep);
+
+    if (m_prof)
+        m_prof->pop();
+    }
+
+/*! Groups the local constraints by connected component. Every component must consist of three constraints
+    between three particles.
+*/
+void ForceSettleConstraint::buildMolecules()
+    {
+    unsigned int n_constraint = m_cdata->getN()+m_cdata->getNGhosts();
+    unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
+
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<ConstraintData::members_t> h_groups(m_cdata->getMembersArray(), access_location::host,
+        access_mode::read);
+
+    // union-find over particle indices
+    std::vector<unsigned int> parent(max_local);
+    for (unsigned int i = 0; i < max_local; ++i)
+        parent[i] = i;
+
+    auto find = [&parent](unsigned int i)
+        {
+        while (parent[i] != i)
+            {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+            }
+        return i;
+        };
+
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        const ConstraintData::members_t& constraint = h_groups.data[n];
+        unsigned int idx_a = h_rtag.data[constraint.tag[0]];
+        unsigned int idx_b = h_rtag.data[constraint.tag[1]];
+
+        if (idx_a >= max_local || idx_b >= max_local)
+            {
+            this->m_exec_conf->msg->error() << "constrain.settle(): constraint " <<
+                constraint.tag[0] << " " << constraint.tag[1] << " incomplete." << std::endl << std::endl;
+            throw std::runtime_error("Error in constraint calculation");
+            }
+
+        unsigned int root_a = find(idx_a);
+        unsigned int root_b = find(idx_b);
+        if (root_a != root_b)
+            parent[std::max(root_a, root_b)] = std::min(root_a, root_b);
+        }
+
+    // collect the constraints of each molecule
+    std::vector<unsigned int> molecule_of_root(max_local, NOT_LOCAL);
+    std::vector<unsigned int> n_molecule_constraints;
+    m_molecules.clear();
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        unsigned int root = find(h_rtag.data[h_groups.data[n].tag[0]]);
+        if (molecule_of_root[root] == NOT_LOCAL)
+            {
+            molecule_of_root[root] = m_molecules.size();
+            m_molecules.push_back(SettleMolecule());
+            n_molecule_constraints.push_back(0);
+            }
+
+        unsigned int mol = molecule_of_root[root];
+        if (n_molecule_constraints[mol] == 3)
+            {
+            m_exec_conf->msg->error() << "constrain.settle(): particle " << h_groups.data[n].tag[0]
+                                      << " belongs to a molecule with more than three constraints." << std::endl;
+            throw std::runtime_error("Error in constraint calculation");
+            }
+        m_molecules[mol].constraint[n_molecule_constraints[mol]++] = n;
+        }
+
+    for (unsigned int mol = 0; mol < m_molecules.size(); ++mol)
+        {
+        SettleMolecule& molecule = m_molecules[mol];
+        const ConstraintData::members_t *c[3];
+        for (unsigned int k = 0; k < n_molecule_constraints[mol]; ++k)
+            c[k] = &h_groups.data[molecule.constraint[k]];
+
+        // three different constraints between three particles form a triangle
+        bool triangle = n_molecule_constraints[mol] == 3;
+        if (triangle)
+            {
+            std::set<unsigned int> tags;
+            for (unsigned int k = 0; k < 3; ++k)
+                {
+                tags.insert(c[k]->tag[0]);
+                tags.insert(c[k]->tag[1]);
+                for (unsigned int l = k+1; l < 3; ++l)
+                    {
+                    if ((c[k]->tag[0] == c[l]->tag[0] && c[k]->tag[1] == c[l]->tag[1])
+                        || (c[k]->tag[0] == c[l]->tag[1] && c[k]->tag[1] == c[l]->tag[0]))
+                        triangle = false;
+                    }
+                }
+            if (tags.size() != 3)
+                triangle = false;
+            }
+
+        if (!triangle)
+            {
+            m_exec_conf->msg->error() << "constrain.settle(): particle " << c[0]->tag[0]
+                                      << " does not belong to a rigid triangle of three constraints." << std::endl;
+            throw std::runtime_error("Error in constraint calculation");
+            }
+
+        for (unsigned int k = 0; k < 3; ++k)
+            for (unsigned int l = 0; l < 3; ++l)
+                {
+                molecule.sign_a[k][l] = (c[k]->tag[0] == c[l]->tag[0]) - (c[k]->tag[0] == c[l]->tag[1]);
+                molecule.sign_b[k][l] = (c[k]->tag[1] == c[l]->tag[0]) - (c[k]->tag[1] == c[l]->tag[1]);
+                }
+        }
+
+    m_exec_conf->msg->notice(6) << "constrain.settle(): " << m_molecules.size() << " molecules" << std::endl;
+    }
+
+/*! Sets up the same linear system as ForceDistanceConstraint::fillMatrixVector() for each molecule and solves it
+    by Cramer's rule.
+*/
+void ForceSettleConstraint::solveMolecules(unsigned int timestep)
+    {
+    unsigned int n_constraint = m_cdata->getN()+m_cdata->getNGhosts();
+
+    // reallocate array of constraint forces
+    m_lagrange.resize(n_constraint);
+
+    // access particle data
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_netforce(m_pdata->getNetForce(), access_location::host, access_mode::read);
+
+    // access constraint data
+    ArrayHandle<ConstraintData::members_t> h_groups(m_cdata->getMembersArray(), access_location::host,
+        access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_cdata->getTypeValArray(), access_location::host, access_mode::read);
+
+    ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::overwrite);
+
+    const BoxDim& box = m_pdata->getBox();
+    const Scalar deltaT = m_deltaT;
+    const Scalar rel_tol = m_rel_tol;
+
+    // index of a violated constraint + 1
+    std::atomic<unsigned int> violated(0);
+
+    unsigned int n_molecules = m_molecules.size();
+
+    #ifdef ENABLE_TBB
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_molecules),
+        [&](const tbb::blocked_range<unsigned int>& range) {
+    for (unsigned int mol = range.begin(); mol != range.end(); ++mol)
+    #else
+    for (unsigned int mol = 0; mol < n_molecules; ++mol)
+    #endif
+        {
+        const SettleMolecule& molecule = m_molecules[mol];
+
+        vec3<double> r[3];
+        vec3<double> q[3];
+        double inv_ma[3];
+        double inv_mb[3];
+        double c[3];
+
+        for (unsigned int k = 0; k < 3; ++k)
+            {
+            unsigned int n = molecule.constraint[k];
+            unsigned int idx_a = h_rtag.data[h_groups.data[n].tag[0]];
+            unsigned int idx_b = h_rtag.data[h_groups.data[n].tag[1]];
+
+            vec3<Scalar> rn(box.minImage(vec3<Scalar>(h_pos.data[idx_a]) - vec3<Scalar>(h_pos.data[idx_b])));
+            vec3<Scalar> rndot(vec3<Scalar>(h_vel.data[idx_a]) - vec3<Scalar>(h_vel.data[idx_b]));
+            r[k] = rn;
+            q[k] = rn + rndot*deltaT;
+            inv_ma[k] = double(1.0)/h_vel.data[idx_a].w;
+            inv_mb[k] = double(1.0)/h_vel.data[idx_b].w;
+
+            // get constraint distance
+            Scalar d = h_typeval.data[n].val;
+
+            // check distance violation
+            if (fast::sqrt(dot(rn,rn))-d >= rel_tol*d || std::isnan(dot(rn,rn)))
+                violated = n+1;
+
+            c[k] = (dot(q[k],q[k])-d*d)/deltaT/deltaT;
+            c[k] += double(2.0)*dot(q[k], vec3<double>(h_netforce.data[idx_a])*inv_ma[k]
+                - vec3<double>(h_netforce.data[idx_b])*inv_mb[k]);
+            }
+
+        // matrix elements
+        double A[3][3];
+        for (unsigned int k = 0; k < 3; ++k)
+            for (unsigned int l = 0; l < 3; ++l)
+                A[k][l] = double(4.0)*dot(q[k],r[l])*(molecule.sign_a[k][l]*inv_ma[k]
+                    - molecule.sign_b[k][l]*inv_mb[k]);
+
+        // cofactors
+        double C00 = A[1][1]*A[2][2] - A[1][2]*A[2][1];
+        double C01 = A[1][2]*A[2][0] - A[1][0]*A[2][2];
+        double C02 = A[1][0]*A[2][1] - A[1][1]*A[2][0];
+        double det = A[0][0]*C00 + A[0][1]*C01 + A[0][2]*C02;
+        double inv_det = double(1.0)/det;
+
+        double C10 = A[0][2]*A[2][1] - A[0][1]*A[2][2];
+        double C11 = A[0][0]*A[2][2] - A[0][2]*A[2][0];
+        double C12 = A[0][1]*A[2][0] - A[0][0]*A[2][1];
+        double C20 = A[0][1]*A[1][2] - A[0][2]*A[1][1];
+        double C21 = A[0][2]*A[1][0] - A[0][0]*A[1][2];
+        double C22 = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+
+        // lambda = adj(A) c / det(A)
+        h_lagrange.data[molecule.constraint[0]] = (C00*c[0] + C10*c[1] + C20*c[2])*inv_det;
+        h_lagrange.data[molecule.constraint[1]] = (C01*c[0] + C11*c[1] + C21*c[2])*inv_det;
+        h_lagrange.data[molecule.constraint[2]] = (C02*c[0] + C12*c[1] + C22*c[2])*inv_det;
+        }
+    #ifdef ENABLE_TBB
+        });
+    #endif
+
+    if (violated)
+        m_constraint_violated.resetFlags(violated);
+    }
+
+void export_ForceSettleConstraint(py::module& m)
+    {
+    py::class_< ForceSettleConstraint, std::shared_ptr<ForceSettleConstraint> >(m, "ForceSettleConstraint", py::base<ForceDistanceConstraint>())
+        .def(py::init< std::shared_ptr<SystemDefinition> >())
+    ;
+    }
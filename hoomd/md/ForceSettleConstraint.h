@@ -0,0 +1,81 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+
+// Maintainer: jglaser
+
+#include "ForceDistanceConstraint.h"
+
+/*! \file ForceSettleConstraint.h
+    \brief Declares a class to constrain rigid three-site molecules analytically
+*/
+
+#ifdef NVCC
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <hoomd/extern/pybind/include/pybind11/pybind11.h>
+
+#ifndef __ForceSettleConstraint_H__
+#define __ForceSettleConstraint_H__
+
+//! Constrains rigid triangles, such as three-site water, analytically
+/*! ForceSettleConstraint applies the constraint forces of ForceDistanceConstraint to molecules that consist of
+    exactly three particles joined by three distance constraints. Like SETTLE, it makes use of the fact that every
+    such molecule is independent and small: instead of a global sparse LU decomposition, the 3x3 system of each
+    molecule is solved in closed form. The molecules are kept in a flat table of constraint indices and solved in
+    parallel.
+
+    The table is rebuilt when the constraints are reordered, i.e. after ghost exchange in MPI simulations.
+    Molecule tags, ghost layer width, degrees of freedom and violation checks are inherited from
+    ForceDistanceConstraint, which handles the MPI communication of complete molecules.
+
+    It is an error if any connected set of constraints is not a triangle.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ForceSettleConstraint : public ForceDistanceConstraint
+    {
+    public:
+        //! Constructs the compute
+        ForceSettleConstraint(std::shared_ptr<SystemDefinition> sysdef);
+
+        //! Destructor
+        virtual ~ForceSettleConstraint();
+
+    protected:
+        //! A rigid triangle
+        /*! The signs encode the role of each particle: sign_a[k][l] is +1 if the first member of constraint k is
+            the first member of constraint l, -1 if it is the second member, and 0 otherwise. sign_b refers to the
+            second member of constraint k.
+        */
+        struct SettleMolecule
+            {
+            unsigned int constraint[3];     //!< Constraint indices
+            int sign_a[3][3];               //!< Role of the first member of each constraint in all constraints
+            int sign_b[3][3];               //!< Role of the second member of each constraint in all constraints
+            };
+        std::vector<SettleMolecule> m_molecules;    //!< Table of local molecules
+        bool m_molecules_dirty;                     //!< True if the molecule table needs to be rebuilt
+
+        //! Compute the forces
+        virtual void computeForces(unsigned int timestep);
+
+        //! Solve the constraint equations of every molecule
+        void solveMolecules(unsigned int timestep);
+
+        //! Build the table of molecules from the local constraints
+        void buildMolecules();
+
+        //! Method called when constraint order changes
+        virtual void slotConstraintReorder()
+            {
+            ForceDistanceConstraint::slotConstraintReorder();
+            m_molecules_dirty = true;
+            }
+    };
+
+//! Exports the ForceSettleConstraint to python
+void export_ForceSettleConstraint(pybind11::module& m);
+
+#endif
@@ -125,7 +125,6 @@ void HarmonicDihedralForceCompute::computeForces(unsigned int timestep)
     assert(m_pdata);
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar4> h_force(m_force,access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar> h_virial(m_virial,access_location::host, access_mode::overwrite);
@@ -138,39 +137,26 @@ void HarmonicDihedralForceCompute::computeForces(unsigned int timestep)
     assert(h_force.data);
     assert(h_virial.data);
     assert(h_pos.data);
-    assert(h_rtag.data);
 
     unsigned int virial_pitch = m_virial.getPitch();
 
     // get a local copy of the simulation box too
     const BoxDim& box = m_pdata->getBox();
 
+    // the index table holds the dihedrals with their members translated to particle indices, ordered for locality
+    ArrayHandle<ImproperData::members_t> h_dihedrals(m_dihedral_data->getIndexTable(), access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_dihedral_data->getIndexTableTypeVal(), access_location::host, access_mode::read);
+
     // for each of the dihedrals
     const unsigned int size = (unsigned int)m_dihedral_data->getN();
     for (unsigned int i = 0; i < size; i++)
         {
-        // lookup the tag of each of the particles participating in the dihedral
-        const ImproperData::members_t& dihedral = m_dihedral_data->getMembersByIndex(i);
-        assert(dihedral.tag[0] <= m_pdata->getMaximumTag());
-        assert(dihedral.tag[1] <= m_pdata->getMaximumTag());
-        assert(dihedral.tag[2] <= m_pdata->getMaximumTag());
-        assert(dihedral.tag[3] <= m_pdata->getMaximumTag());
-
-        // transform a, b, and c into indicies into the particle data arrays
-        // MEM TRANSFER: 6 ints
-        unsigned int idx_a = h_rtag.data[dihedral.tag[0]];
-        unsigned int idx_b = h_rtag.data[dihedral.tag[1]];
-        unsigned int idx_c = h_rtag.data[dihedral.tag[2]];
-        unsigned int idx_d = h_rtag.data[dihedral.tag[3]];
-
-        // throw an error if this angle is incomplete
-        if (idx_a == NOT_LOCAL|| idx_b == NOT_LOCAL || idx_c == NOT_LOCAL || idx_d == NOT_LOCAL)
-            {
-            this->m_exec_conf->msg->error() << "dihedral.harmonic: dihedral " <<
-                dihedral.tag[0] << " " << dihedral.tag[1] << " " << dihedral.tag[2] << " " << dihedral.tag[3]
-                << " incomplete." << endl << endl;
-            throw std::runtime_error("Error in dihedral calculation");
-            }
+        // lookup the index of each of the particles participating in the dihedral
+        const ImproperData::members_t& dihedral = h_dihedrals.data[i];
+        unsigned int idx_a = dihedral.idx[0];
+        unsigned int idx_b = dihedral.idx[1];
+        unsigned int idx_c = dihedral.idx[2];
+        unsigned int idx_d = dihedral.idx[3];
 
         assert(idx_a < m_pdata->getN() + m_pdata->getNGhosts());
         assert(idx_b < m_pdata->getN() + m_pdata->getNGhosts());
@@ -231,7 +217,7 @@ void HarmonicDihedralForceCompute::computeForces(unsigned int timestep)
         if (c_abcd > 1.0) c_abcd = 1.0;
         if (c_abcd < -1.0) c_abcd = -1.0;
 
-        unsigned int dihedral_type = m_dihedral_data->getTypeByIndex(i);
+        unsigned int dihedral_type = h_typeval.data[i].type;
         int multi = (int)m_multi[dihedral_type];
         Scalar p = Scalar(1.0);
         Scalar dfab = Scalar(0.0);
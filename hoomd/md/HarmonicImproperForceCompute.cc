@@ -118,7 +118,6 @@ void HarmonicImproperForceCompute::computeForces(unsigned int timestep)
     assert(m_pdata);
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar4> h_force(m_force,access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar> h_virial(m_virial,access_location::host, access_mode::overwrite);
@@ -128,7 +127,6 @@ void HarmonicImproperForceCompute::computeForces(unsigned int timestep)
     assert(h_force.data);
     assert(h_virial.data);
     assert(h_pos.data);
-    assert(h_rtag.data);
 
     // Zero data for force calculation.
     memset((void*)h_force.data,0,sizeof(Scalar4)*m_force.getNumElements());
@@ -137,32 +135,20 @@ void HarmonicImproperForceCompute::computeForces(unsigned int timestep)
     // get a local copy of the simulation box too
     const BoxDim& box = m_pdata->getBox();
 
+    // the index table holds the impropers with their members translated to particle indices, ordered for locality
+    ArrayHandle<ImproperData::members_t> h_impropers(m_improper_data->getIndexTable(), access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_improper_data->getIndexTableTypeVal(), access_location::host, access_mode::read);
+
     // for each of the impropers
     const unsigned int size = (unsigned int)m_improper_data->getN();
     for (unsigned int i = 0; i < size; i++)
         {
-        // lookup the tag of each of the particles participating in the improper
-        const ImproperData::members_t& improper = m_improper_data->getMembersByIndex(i);
-        assert(improper.tag[0] <= m_pdata->getMaximumTag());
-        assert(improper.tag[1] <= m_pdata->getMaximumTag());
-        assert(improper.tag[2] <= m_pdata->getMaximumTag());
-        assert(improper.tag[3] <= m_pdata->getMaximumTag());
-
-        // transform a, b, and c into indicies into the particle data arrays
-        // MEM TRANSFER: 6 ints
-        unsigned int idx_a = h_rtag.data[improper.tag[0]];
-        unsigned int idx_b = h_rtag.data[improper.tag[1]];
-        unsigned int idx_c = h_rtag.data[improper.tag[2]];
-        unsigned int idx_d = h_rtag.data[improper.tag[3]];
-
-        // throw an error if this angle is incomplete
-        if (idx_a == NOT_LOCAL|| idx_b == NOT_LOCAL || idx_c == NOT_LOCAL || idx_d == NOT_LOCAL)
-            {
-            this->m_exec_conf->msg->error() << "improper.harmonic: improper " <<
-                improper.tag[0] << " " << improper.tag[1] << " " << improper.tag[2] << " " << improper.tag[3]
-                << " incomplete." << endl << endl;
-            throw std::runtime_error("Error in improper calculation");
-            }
+        // lookup the index of each of the particles participating in the improper
+        const ImproperData::members_t& improper = h_impropers.data[i];
+        unsigned int idx_a = improper.idx[0];
+        unsigned int idx_b = improper.idx[1];
+        unsigned int idx_c = improper.idx[2];
+        unsigned int idx_d = improper.idx[3];
 
         assert(idx_a < m_pdata->getN() + m_pdata->getNGhosts());
         assert(idx_b < m_pdata->getN() + m_pdata->getNGhosts());
@@ -220,7 +206,7 @@ void HarmonicImproperForceCompute::computeForces(unsigned int timestep)
         Scalar s = sqrt(1.0 - c*c);
         if (s < SMALL) s = SMALL;
 
-        unsigned int improper_type = m_improper_data->getTypeByIndex(i);
+        unsigned int improper_type = h_typeval.data[i].type;
         Scalar domega = acos(c) - m_chi[improper_type];
         Scalar a = m_K[improper_type] * domega;
 
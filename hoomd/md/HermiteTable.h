@@ -0,0 +1,227 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+
+// Maintainer: joaander
+
+#include "hoomd/HOOMDMath.h"
+
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+
+/*! \file HermiteTable.h
+    \brief Declares the HermiteTable class
+*/
+
+#ifdef NVCC
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifndef __HERMITE_TABLE_H__
+#define __HERMITE_TABLE_H__
+
+//! Allocator for std::vector that aligns its storage to 64 byte cache lines
+template<class T>
+struct cacheline_allocator
+    {
+    typedef T value_type;
+
+    cacheline_allocator() { }
+
+    template<class U>
+    cacheline_allocator(const cacheline_allocator<U>&) { }
+
+    T *allocate(std::size_t n)
+        {
+        void *result = NULL;
+        int retval = posix_memalign(&result, 64, n*sizeof(T));
+        if (retval != 0)
+            {
+            throw std::runtime_error("Error allocating aligned memory");
+            }
+        return (T *)result;
+        }
+
+    void deallocate(T *ptr, std::size_t n)
+        {
+        free(ptr);
+        }
+    };
+
+template<class T, class U>
+bool operator==(const cacheline_allocator<T>&, const cacheline_allocator<U>&)
+    {
+    return true;
+    }
+
+template<class T, class U>
+bool operator!=(const cacheline_allocator<T>&, const cacheline_allocator<U>&)
+    {
+    return false;
+    }
+
+//! Coefficients and knots of one interval of a HermiteTable
+/*! The alignment pads the structure to one cache line in both single and double precision.
+*/
+struct hermite_interval
+    {
+    Scalar4 coeff;  //!< Polynomial coefficients (a0, a1, a2, a3)
+    Scalar4 knots;  //!< (r_i, r_{i+1}, 0, 0)
+    } __attribute__((aligned(64)));
+
+//! Tabulated function of one variable interpolated with cubic Hermite splines
+/*! HermiteTable stores a potential V(r) and its force F(r) = -dV/dr at knots r_0 < r_1 < ... < r_{n-1}, which need
+    not be equally spaced. On each interval, V is represented by the cubic that matches V and dV/dr at both knots.
+    The force is the exact derivative of the interpolated potential, so energy and force are consistent. The error in
+    V is O(h^4) and the error in F is O(h^3) in the knot spacing h, compared to O(h^2) for linear interpolation of
+    both, so that far fewer knots are needed for the same accuracy. Knots can be placed densely where the potential
+    is steep and sparsely elsewhere.
+
+    \b Memory layout
+
+    Each interval is a hermite_interval that holds the polynomial coefficients (a0, a1, a2, a3) of
+    V(r) = a0 + a1 s + a2 s^2 + a3 s^3 with s = r - r_i, followed by (r_i, r_{i+1}, 0, 0). The intervals are stored
+    with a cacheline_allocator and each fills one 64 byte cache line, padded in single precision, so an evaluation
+    touches exactly one line of coefficients.
+
+    The variable need not be a distance. Angle and dihedral tables use the same class with r standing for the angle.
+
+    \b Lookup
+
+    The range [r_0, r_{n-1}) is divided into equally sized buckets no wider than the narrowest interval (up to a
+    limit of 16 buckets per interval), and each bucket stores the interval that contains its lower edge. An
+    evaluation locates its bucket directly and then advances over at most a few knots. For equally spaced knots,
+    the bucket is the interval.
+*/
+class HermiteTable
+    {
+    public:
+        //! Constructs an empty table
+        HermiteTable()
+            : m_rmin(0.0), m_rmax(0.0), m_inv_bucket_width(0.0)
+            {
+            }
+
+        //! Check the knots passed to set()
+        /*! \param r Knot positions
+            \param V Potential at the knots
+            \param F Force at the knots
+            \returns true if there are at least two knots, the sizes match and the knots are strictly increasing
+        */
+        static bool validate(const std::vector<Scalar>& r, const std::vector<Scalar>& V, const std::vector<Scalar>& F)
+            {
+            if (r.size() < 2 || V.size() != r.size() || F.size() != r.size())
+                return false;
+
+            for (unsigned int i = 0; i+1 < r.size(); ++i)
+                {
+                if (!(r[i+1] > r[i]))
+                    return false;
+                }
+            return true;
+            }
+
+        //! Set the tabulated values
+        /*! \param r Knot positions, strictly increasing
+            \param V Potential at the knots
+            \param F Force (-dV/dr) at the knots
+            \pre validate(r, V, F) is true
+        */
+        void set(const std::vector<Scalar>& r, const std::vector<Scalar>& V, const std::vector<Scalar>& F)
+            {
+            unsigned int n_intervals = r.size() - 1;
+            m_rmin = r.front();
+            m_rmax = r.back();
+
+            m_intervals.resize(n_intervals);
+            Scalar h_min = m_rmax - m_rmin;
+            for (unsigned int i = 0; i < n_intervals; ++i)
+                {
+                Scalar h = r[i+1] - r[i];
+                h_min = std::min(h_min, h);
+
+                // derivatives at the knots
+                Scalar d0 = -F[i];
+                Scalar d1 = -F[i+1];
+                Scalar dV = V[i+1] - V[i];
+
+                Scalar a0 = V[i];
+                Scalar a1 = d0;
+                Scalar a2 = (Scalar(3.0)*dV/h - Scalar(2.0)*d0 - d1)/h;
+                Scalar a3 = (d0 + d1 - Scalar(2.0)*dV/h)/(h*h);
+
+                m_intervals[i].coeff = make_scalar4(a0, a1, a2, a3);
+                m_intervals[i].knots = make_scalar4(r[i], r[i+1], 0.0, 0.0);
+                }
+
+            // bucket lookup table
+            unsigned int n_buckets = (unsigned int)std::ceil((m_rmax - m_rmin)/h_min);
+            n_buckets = std::max(std::min(n_buckets, 16*n_intervals), n_intervals);
+            m_inv_bucket_width = Scalar(n_buckets)/(m_rmax - m_rmin);
+
+            m_bucket.resize(n_buckets);
+            unsigned int i = 0;
+            for (unsigned int b = 0; b < n_buckets; ++b)
+                {
+                Scalar r_bucket = m_rmin + Scalar(b)/m_inv_bucket_width;
+                while (i+1 < n_intervals && r[i+1] <= r_bucket)
+                    i++;
+                m_bucket[b] = i;
+                }
+            }
+
+        //! Test if the table has been set
+        bool isSet() const
+            {
+            return m_intervals.size() > 0;
+            }
+
+        //! Get the first knot
+        Scalar getRMin() const
+            {
+            return m_rmin;
+            }
+
+        //! Get the last knot
+        Scalar getRMax() const
+            {
+            return m_rmax;
+            }
+
+        //! Evaluate the potential and force
+        /*! \param r Position at which to evaluate, rmin <= r < rmax
+            \param V Interpolated potential (output)
+            \param F Interpolated force -dV/dr (output)
+        */
+        inline void evaluate(Scalar r, Scalar& V, Scalar& F) const
+            {
+            unsigned int b = (unsigned int)((r - m_rmin)*m_inv_bucket_width);
+            b = std::min(b, (unsigned int)m_bucket.size() - 1);
+            unsigned int i = m_bucket[b];
+
+            // advance to the interval that contains r
+            const hermite_interval *c = &m_intervals[i];
+            while (r >= c->knots.y && i+1 < m_intervals.size())
+                {
+                i++;
+                c++;
+                }
+
+            const Scalar4 a = c->coeff;
+            Scalar s = r - c->knots.x;
+            V = a.x + s*(a.y + s*(a.z + s*a.w));
+            F = -(a.y + s*(Scalar(2.0)*a.z + s*Scalar(3.0)*a.w));
+            }
+
+    private:
+        std::vector<hermite_interval, cacheline_allocator<hermite_interval> > m_intervals; //!< One cache line per interval
+        std::vector<unsigned int> m_bucket;     //!< First interval that overlaps each bucket
+        Scalar m_rmin;                          //!< First knot
+        Scalar m_rmax;                          //!< Last knot
+        Scalar m_inv_bucket_width;              //!< Inverse width of the lookup buckets
+    };
+
+#endif
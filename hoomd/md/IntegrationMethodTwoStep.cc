@@ -122,7 +122,11 @@ unsigned int IntegrationMethodTwoStep::getRotationalNDOF(std::shared_ptr<Particl
     unsigned int query_group_dof = 0;
     unsigned int dimension = m_sysdef->getNDimensions();
     unsigned int dof_one;
-    ArrayHandle<Scalar3> h_moment_inertia(m_pdata->getMomentsOfInertiaArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_moment_inertia(m_pdata->getMomentsOfInertiaArray(false), access_location::host, access_mode::read);
+
+    // without allocated moments of inertia, no particle has rotational degrees of freedom
+    if (! m_pdata->hasAnisotropicArrays())
+        local_group_size = 0;
 
     for (unsigned int group_idx = 0; group_idx < local_group_size; group_idx++)
         {
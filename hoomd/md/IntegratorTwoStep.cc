@@ -341,6 +341,8 @@ void IntegratorTwoStep::setAnisotropicMode(AnisotropicMode mode)
 */
 void IntegratorTwoStep::prepRun(unsigned int timestep)
     {
+    Integrator::prepRun(timestep);
+
     bool aniso = false;
 
     // set (an-)isotropic integration mode
@@ -390,8 +392,9 @@ void IntegratorTwoStep::prepRun(unsigned int timestep)
 #endif
         computeNetForce(timestep);
 
-    // accelerations only need to be calculated if the accelerations have not yet been set
-    if (!m_pdata->isAccelSet())
+    // accelerations only need to be calculated if the accelerations have not yet been set, or if the slow forces
+    // enter the net force of this step with a different weight than at the end of the previous run
+    if (!m_pdata->isAccelSet() || m_slow_forces.size())
         {
         computeAccelerations(timestep);
         m_pdata->notifyAccelSet();
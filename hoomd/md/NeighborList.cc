@@ -51,6 +51,8 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar _r_c
     m_last_check_result = false;
     m_every = 0;
     m_exclusions_set = false;
+    m_ex_far_pitch = 0;
+    m_exclusions_in_build = false;
 
     m_need_reallocate_exlist = false;
 
@@ -243,7 +245,7 @@ void NeighborList::compute(unsigned int timestep)
                 }
             } while (overflowed);
 
-        if (m_exclusions_set)
+        if (m_exclusions_set && !m_exclusions_in_build)
             filterNlist();
 
         setLastUpdatedPos();
@@ -1230,6 +1232,9 @@ void NeighborList::buildNlist(unsigned int timestep)
     }
 
 /*! Translates the exclusions set in \c m_n_ex_tag and \c m_ex_list_tag to indices in \c m_n_ex_idx and \c m_ex_list_idx
+
+    Exclusions of particles with tags that differ by -32 to 31 are also stored as a bitmask over the tag offset in
+    \c m_ex_mask. All others are stored as sorted indices in \c m_ex_list_far.
 */
 void NeighborList::updateExListIdx()
     {
@@ -1247,8 +1252,14 @@ void NeighborList::updateExListIdx()
     ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::overwrite);
     ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx, access_location::host, access_mode::overwrite);
 
+    const unsigned int N = m_pdata->getN();
+    m_ex_far_pitch = m_ex_list_indexer.getH();
+    m_ex_mask.resize(N);
+    m_n_ex_far.resize(N);
+    m_ex_list_far.resize(N*m_ex_far_pitch);
+
     // translate the number and exclusions from one array to the other
-    for (unsigned int idx = 0; idx < m_pdata->getN(); idx++)
+    for (unsigned int idx = 0; idx < N; idx++)
         {
         // get the tag for this index
         unsigned int tag = h_tag.data[idx];
@@ -1257,6 +1268,10 @@ void NeighborList::updateExListIdx()
         unsigned int n = h_n_ex_tag.data[tag];
         h_n_ex_idx.data[idx] = n;
 
+        uint64_t mask = 0;
+        unsigned int n_far = 0;
+        unsigned int *far = m_ex_list_far.data() + idx*m_ex_far_pitch;
+
         // construct the exclusion list
         for (unsigned int offset = 0; offset < n; offset++)
             {
@@ -1265,7 +1280,18 @@ void NeighborList::updateExListIdx()
 
             // store excluded particle idx
             h_ex_list_idx.data[m_ex_list_indexer(idx, offset)] = ex_idx;
+
+            // topology-local exclusions go into the bitmask
+            int tag_offset = int(ex_tag) - int(tag);
+            if (tag_offset >= -32 && tag_offset < 32)
+                mask |= uint64_t(1) << (tag_offset + 32);
+            else
+                far[n_far++] = ex_idx;
             }
+
+        std::sort(far, far + n_far);
+        m_ex_mask[idx] = mask;
+        m_n_ex_far[idx] = n_far;
         }
 
     if (m_prof)
@@ -1280,9 +1306,8 @@ void NeighborList::filterNlist()
         m_prof->push("filter");
 
     // access data
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_head_list(m_head_list, access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::readwrite);
     ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::readwrite);
 
@@ -1291,7 +1316,6 @@ void NeighborList::filterNlist()
         {
         unsigned int myHead = h_head_list.data[idx];
         unsigned int n_neigh = h_n_neigh.data[idx];
-        unsigned int n_ex = h_n_ex_idx.data[idx];
         unsigned int new_n_neigh = 0;
 
         // loop over the list, regenerating it as we go
@@ -1299,20 +1323,8 @@ void NeighborList::filterNlist()
             {
             unsigned int cur_neigh = h_nlist.data[myHead + cur_neigh_idx];
 
-            // test if excluded
-            bool excluded = false;
-            for (unsigned int cur_ex_idx = 0; cur_ex_idx < n_ex; cur_ex_idx++)
-                {
-                unsigned int cur_ex = h_ex_list_idx.data[m_ex_list_indexer(idx, cur_ex_idx)];
-                if (cur_ex == cur_neigh)
-                    {
-                    excluded = true;
-                    break;
-                    }
-                }
-
             // add it back to the list if it is not excluded
-            if (!excluded)
+            if (!isExcludedIdx(idx, cur_neigh, h_tag.data))
                 {
                 h_nlist.data[myHead + new_n_neigh] = cur_neigh;
                 new_n_neigh++;
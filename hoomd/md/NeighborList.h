@@ -13,6 +13,7 @@
 #include <memory>
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <vector>
+#include <algorithm>
 
 /*! \file NeighborList.h
     \brief Declares the NeighborList class
@@ -99,6 +100,11 @@
     through the neighbor list and removes any particles that are excluded. This allows an arbitrary number of exclusions
     to be processed without slowing the performance of the buildNlist() step itself.
 
+    On the CPU, updateExListIdx() also encodes the exclusions of each particle whose tags differ by less than 32 as a
+    bitmask over tag offsets. Exclusions from bonded topology are almost always within this window, so that the test
+    of a pair costs one shift. The remaining exclusions are kept in a sorted list that is binary searched. The
+    CPU neighbor lists apply this test while building the list (isExcludedIdx()) and skip filterNlist().
+
     <b>Overvlow handling:</b>
     For easy support of derived GPU classes to implement overflow detection the overflow condition is stored in the
     GPUArray \a d_conditions.
@@ -485,6 +491,33 @@ class PYBIND11_EXPORT NeighborList : public Compute
         bool m_exclusions_set;                 //!< True if any exclusions have been set
         bool m_need_reallocate_exlist;         //!< True if global exclusion list needs to be reallocated
 
+        std::vector<uint64_t> m_ex_mask;           //!< Exclusions within the tag offset window, by particle index
+        std::vector<unsigned int> m_n_ex_far;      //!< Number of exclusions outside of the window, by particle index
+        std::vector<unsigned int> m_ex_list_far;   //!< Sorted indices of the exclusions outside of the window
+        unsigned int m_ex_far_pitch;               //!< Row length of m_ex_list_far
+        bool m_exclusions_in_build;                //!< True if buildNlist() applies the exclusions itself
+
+        //! Test if particle j is excluded from the neighbor list of local particle i
+        /*! \param i Index of the local particle
+            \param j Index of the neighbor (local or ghost)
+            \param tag Particle tags, indexed by particle index
+
+            Only valid after updateExListIdx() of the base class has been called.
+        */
+        inline bool isExcludedIdx(unsigned int i, unsigned int j, const unsigned int *tag) const
+            {
+            int offset = int(tag[j]) - int(tag[i]);
+            if (offset >= -32 && offset < 32)
+                return (m_ex_mask[i] >> (offset + 32)) & 1;
+
+            unsigned int n_far = m_n_ex_far[i];
+            if (n_far == 0)
+                return false;
+
+            const unsigned int *far = &m_ex_list_far[i*m_ex_far_pitch];
+            return std::binary_search(far, far + n_far, j);
+            }
+
         //! Return true if we are supposed to do a distance check in this time step
         bool shouldCheckDistance(unsigned int timestep);
 
@@ -35,6 +35,9 @@ NeighborListStencil::NeighborListStencil(std::shared_ptr<SystemDefinition> sysde
     {
     m_exec_conf->msg->notice(5) << "Constructing NeighborListStencil" << endl;
 
+    // exclusions are applied while building the list
+    m_exclusions_in_build = true;
+
     // create a default cell list if one was not specified
     if (!m_cl)
         m_cl = std::shared_ptr<CellList>(new CellList(sysdef));
@@ -142,6 +145,7 @@ void NeighborListStencil::buildNlist(unsigned int timestep)
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_body(m_pdata->getBodies(), access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
 
     const BoxDim& box = m_pdata->getBox();
     Scalar3 nearest_plane_distance = box.getNearestPlaneDistance();
@@ -318,6 +322,10 @@ void NeighborListStencil::buildNlist(unsigned int timestep)
 
                 if (dr_sq <= r_listsq)
                     {
+                    // apply the exclusions here, so that the list does not need to be filtered afterwards
+                    if (m_exclusions_set && isExcludedIdx(i, cur_neigh, h_tag.data))
+                        continue;
+
                     if (m_storage_mode == full || i < (int)cur_neigh)
                         {
                         // local neighbor
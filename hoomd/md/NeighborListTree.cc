@@ -28,6 +28,9 @@ NeighborListTree::NeighborListTree(std::shared_ptr<SystemDefinition> sysdef,
     {
     m_exec_conf->msg->notice(5) << "Constructing NeighborListTree" << endl;
 
+    // exclusions are applied while building the list
+    m_exclusions_in_build = true;
+
     m_pdata->getNumTypesChangeSignal().connect<NeighborListTree, &NeighborListTree::slotNumTypesChanged>(this);
     m_pdata->getBoxChangeSignal().connect<NeighborListTree, &NeighborListTree::slotBoxChanged>(this);
     m_pdata->getMaxParticleNumberChangeSignal().connect<NeighborListTree, &NeighborListTree::slotMaxNumChanged>(this);
@@ -288,6 +291,7 @@ void NeighborListTree::traverseTree()
     ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_body(m_pdata->getBodies(), access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
 
@@ -379,7 +383,9 @@ void NeighborListTree::traverseTree()
                                                    - vec_to_scalar3(pos_i_image);
                                     Scalar dr_sq = dot(drij,drij);
 
-                                    if (dr_sq <= (r_cutsq_i + sqshift))
+                                    // apply the exclusions here, so that the list does not need to be filtered
+                                    if (dr_sq <= (r_cutsq_i + sqshift) &&
+                                        !(m_exclusions_set && isExcludedIdx(i, j, h_tag.data)))
                                         {
                                         if (m_storage_mode == full || i < j)
                                             {
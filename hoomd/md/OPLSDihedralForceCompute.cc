@@ -109,7 +109,6 @@ void OPLSDihedralForceCompute::computeForces(unsigned int timestep)
     assert(m_pdata);
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
 
     // access the force and virial tensor arrays
     ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
@@ -126,7 +125,6 @@ void OPLSDihedralForceCompute::computeForces(unsigned int timestep)
     assert(h_force.data);
     assert(h_virial.data);
     assert(h_pos.data);
-    assert(h_rtag.data);
 
     unsigned int virial_pitch = m_virial.getPitch();
 
@@ -144,31 +142,20 @@ void OPLSDihedralForceCompute::computeForces(unsigned int timestep)
     // get a local copy of the simulation box
     const BoxDim& box = m_pdata->getBox();
 
+    // the index table holds the dihedrals with their members translated to particle indices, ordered for locality
+    ArrayHandle<ImproperData::members_t> h_dihedrals(m_dihedral_data->getIndexTable(), access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_dihedral_data->getIndexTableTypeVal(), access_location::host, access_mode::read);
+
     // iterate through each dihedral
     const unsigned int numDihedrals = (unsigned int)m_dihedral_data->getN();
     for (n = 0; n < numDihedrals; n++)
         {
-        // lookup the tag of each of the particles participating in the dihedral
-        const ImproperData::members_t& dihedral = m_dihedral_data->getMembersByIndex(n);
-        assert(dihedral.tag[0] < m_pdata->getNGlobal());
-        assert(dihedral.tag[1] < m_pdata->getNGlobal());
-        assert(dihedral.tag[2] < m_pdata->getNGlobal());
-        assert(dihedral.tag[3] < m_pdata->getNGlobal());
-
-        // i1 to i4 are the tags
-        i1 = h_rtag.data[dihedral.tag[0]];
-        i2 = h_rtag.data[dihedral.tag[1]];
-        i3 = h_rtag.data[dihedral.tag[2]];
-        i4 = h_rtag.data[dihedral.tag[3]];
-
-        // throw an error if this angle is incomplete
-        if (i1 == NOT_LOCAL|| i2 == NOT_LOCAL || i3 == NOT_LOCAL || i4 == NOT_LOCAL)
-            {
-            this->m_exec_conf->msg->error() << "dihedral.opls: dihedral " <<
-                dihedral.tag[0] << " " << dihedral.tag[1] << " " << dihedral.tag[2] << " " << dihedral.tag[3]
-                << " incomplete." << endl << endl;
-            throw std::runtime_error("Error in dihedral calculation");
-            }
+        // lookup the index of each of the particles participating in the dihedral
+        const ImproperData::members_t& dihedral = h_dihedrals.data[n];
+        i1 = dihedral.idx[0];
+        i2 = dihedral.idx[1];
+        i3 = dihedral.idx[2];
+        i4 = dihedral.idx[3];
 
         assert(i1 < m_pdata->getN() + m_pdata->getNGhosts());
         assert(i2 < m_pdata->getN() + m_pdata->getNGhosts());
@@ -231,7 +218,7 @@ void OPLSDihedralForceCompute::computeForces(unsigned int timestep)
 
         // get values for k1/2 through k4/2
         // ----- The 1/2 factor is already stored in the parameters --------
-        dihedral_type = m_dihedral_data->getTypeByIndex(n);
+        dihedral_type = h_typeval.data[n].type;
         k1 = h_params.data[dihedral_type].x;
         k2 = h_params.data[dihedral_type].y;
         k3 = h_params.data[dihedral_type].z;
@@ -149,6 +149,13 @@ PPPMForceCompute::~PPPMForceCompute()
         {
         free(m_kiss_fft);
         free(m_kiss_ifft);
+        #ifdef ENABLE_TBB
+        for (unsigned int dim = 0; dim < 3; ++dim)
+            {
+            free(m_kiss_fft_1d[dim]);
+            free(m_kiss_ifft_1d[dim]);
+            }
+        #endif
         kiss_fft_cleanup();
         }
     #ifdef ENABLE_MPI
@@ -434,6 +441,13 @@ void PPPMForceCompute::initializeFFT()
 
     if (! local_fft)
         {
+        if (m_dfft_initialized)
+            {
+            // the mesh is being re-initialized
+            dfft_destroy_plan(m_dfft_plan_forward);
+            dfft_destroy_plan(m_dfft_plan_inverse);
+            }
+
         // ghost cell communicator for charge interpolation
         m_grid_comm_forward = std::unique_ptr<CommunicatorGrid<kiss_fft_cpx> >(
             new CommunicatorGrid<kiss_fft_cpx>(m_sysdef,
@@ -486,9 +500,32 @@ void PPPMForceCompute::initializeFFT()
         dims[1] = m_mesh_points.y;
         dims[2] = m_mesh_points.x;
 
+        if (m_kiss_fft_initialized)
+            {
+            // the mesh is being re-initialized
+            free(m_kiss_fft);
+            free(m_kiss_ifft);
+            #ifdef ENABLE_TBB
+            for (unsigned int dim = 0; dim < 3; ++dim)
+                {
+                free(m_kiss_fft_1d[dim]);
+                free(m_kiss_ifft_1d[dim]);
+                }
+            #endif
+            }
+
         m_kiss_fft = kiss_fftnd_alloc(dims, 3, 0, NULL, NULL);
         m_kiss_ifft = kiss_fftnd_alloc(dims, 3, 1, NULL, NULL);
 
+        #ifdef ENABLE_TBB
+        // plans for the threaded transforms, dims are in reverse order
+        for (unsigned int dim = 0; dim < 3; ++dim)
+            {
+            m_kiss_fft_1d[dim] = kiss_fft_alloc(dims[2-dim], 0, NULL, NULL);
+            m_kiss_ifft_1d[dim] = kiss_fft_alloc(dims[2-dim], 1, NULL, NULL);
+            }
+        #endif
+
         m_kiss_fft_initialized = true;
         }
 
@@ -715,26 +752,93 @@ void PPPMForceCompute::assignParticles()
     {
     if (m_prof) m_prof->push("assign");
 
-    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+    const unsigned int n_mesh = m_mesh.getNumElements();
+    unsigned int group_size = m_group->getNumMembers();
+
+    // every chunk of the group spreads its charges onto a private mesh, so that no atomics are needed
+    unsigned int n_chunks = 1;
+    #ifdef ENABLE_TBB
+    // limit the memory used by the private meshes
+    const unsigned int max_chunks = 16;
+    n_chunks = std::max(1u, std::min(std::min(m_exec_conf->getNumThreads(), group_size), max_chunks));
+    #endif
+
+    m_mesh_scratch.resize(n_chunks*n_mesh);
+
+        {
+        ArrayHandle<unsigned int> h_member_idx(m_group->getIndexArray(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff,access_location::host, access_mode::read);
+
+        #ifdef ENABLE_TBB
+        tbb::parallel_for((unsigned int)0, n_chunks, [&](unsigned int chunk)
+        #else
+        for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+        #endif
+            {
+            Scalar *mesh = &m_mesh_scratch[chunk*n_mesh];
+            memset(mesh, 0, sizeof(Scalar)*n_mesh);
+
+            unsigned int group_first = (unsigned int)((unsigned long)group_size*chunk/n_chunks);
+            unsigned int group_last = (unsigned int)((unsigned long)group_size*(chunk+1)/n_chunks);
+            assignParticlesRange(group_first, group_last, h_member_idx.data, h_postype.data, h_charge.data,
+                h_rho_coeff.data, mesh);
+            }
+        #ifdef ENABLE_TBB
+        );
+        #endif
+        }
+
+    // sum up the private meshes in a fixed order
     ArrayHandle<kiss_fft_cpx> h_mesh(m_mesh, access_location::host, access_mode::overwrite);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
 
-    ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff,access_location::host, access_mode::read);
+    #ifdef ENABLE_TBB
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_mesh),
+        [&](const tbb::blocked_range<unsigned int>& r) {
+    for (unsigned int cell = r.begin(); cell != r.end(); ++cell)
+    #else
+    for (unsigned int cell = 0; cell < n_mesh; ++cell)
+    #endif
+        {
+        Scalar rho = Scalar(0.0);
+        for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+            rho += m_mesh_scratch[chunk*n_mesh + cell];
 
-    const BoxDim& box = m_pdata->getBox();
+        h_mesh.data[cell].r = rho;
+        h_mesh.data[cell].i = Scalar(0.0);
+        }
+    #ifdef ENABLE_TBB
+        });
+    #endif
+
+    if (m_prof) m_prof->pop();
+    }
+
+/*! \param group_first First group member to assign
+    \param group_last One past the last group member to assign
+    \param h_member_idx Indices of the group members
+    \param h_postype Particle positions
+    \param h_charge Particle charges
+    \param h_rho_coeff Charge assignment coefficients
+    \param mesh Real-valued charge density mesh to add to, with the same dimensions as m_mesh
 
-    // set mesh to zero
-    memset(h_mesh.data, 0, sizeof(kiss_fft_cpx)*m_mesh.getNumElements());
+    The arrays are passed as pointers so that this method can be called concurrently.
+ */
+void PPPMForceCompute::assignParticlesRange(unsigned int group_first, unsigned int group_last,
+    const unsigned int *h_member_idx, const Scalar4 *h_postype, const Scalar *h_charge, const Scalar *h_rho_coeff,
+    Scalar *mesh)
+    {
+    const BoxDim& box = m_pdata->getBox();
 
     Scalar V_cell = box.getVolume()/(Scalar)(m_mesh_points.x*m_mesh_points.y*m_mesh_points.z);
 
     // loop over group
-    unsigned int group_size = m_group->getNumMembers();
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    for (unsigned int group_idx = group_first; group_idx < group_last; group_idx++)
         {
-        unsigned int idx = m_group->getMemberIndex(group_idx);
+        unsigned int idx = h_member_idx[group_idx];
 
-        Scalar4 postype = h_postype.data[idx];
+        Scalar4 postype = h_postype[idx];
         Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
 
         // ignore if NaN
@@ -743,7 +847,7 @@ void PPPMForceCompute::assignParticles()
             continue;
             }
 
-        Scalar qi = h_charge.data[idx];
+        Scalar qi = h_charge[idx];
 
         // compute coordinates in units of the mesh size
         Scalar3 f = box.makeFraction(pos);
@@ -805,7 +909,7 @@ void PPPMForceCompute::assignParticles()
             Wx = Scalar(0.0);
             for (int iorder = m_order-1; iorder >= 0; iorder--)
                 {
-                Wx = h_rho_coeff.data[i - nlower + iorder*mult_fact] + Wx * dx;
+                Wx = h_rho_coeff[i - nlower + iorder*mult_fact] + Wx * dx;
                 }
 
             int neighi = (int)ix + i;
@@ -824,7 +928,7 @@ void PPPMForceCompute::assignParticles()
                 Wy = Scalar(0.0);
                 for (int iorder = m_order-1; iorder >= 0; iorder--)
                     {
-                    Wy = h_rho_coeff.data[j - nlower + iorder*mult_fact] + Wy * dy;
+                    Wy = h_rho_coeff[j - nlower + iorder*mult_fact] + Wy * dy;
                     }
 
                 int neighj = (int)iy + j;
@@ -842,7 +946,7 @@ void PPPMForceCompute::assignParticles()
                     Wz = Scalar(0.0);
                     for (int iorder = m_order-1; iorder >= 0; iorder--)
                         {
-                        Wz = h_rho_coeff.data[k - nlower + iorder*mult_fact] + Wz * dz;
+                        Wz = h_rho_coeff[k - nlower + iorder*mult_fact] + Wz * dz;
                         }
 
                     int neighk = (int)iz + k;
@@ -859,13 +963,11 @@ void PPPMForceCompute::assignParticles()
                     // store in row major order
                     unsigned int neigh_idx = neighi + m_grid_dim.x * (neighj + m_grid_dim.y*neighk);
 
-                    h_mesh.data[neigh_idx].r += qi*W/V_cell;
+                    mesh[neigh_idx] += qi*W/V_cell;
                     }
                 }
             }
         } // end loop over particles
-
-    if (m_prof) m_prof->pop();
     }
 
 void PPPMForceCompute::updateMeshes()
@@ -877,7 +979,7 @@ void PPPMForceCompute::updateMeshes()
         ArrayHandle<kiss_fft_cpx> h_mesh(m_mesh, access_location::host, access_mode::read);
         ArrayHandle<kiss_fft_cpx> h_fourier_mesh(m_fourier_mesh, access_location::host, access_mode::overwrite);
 
-        kiss_fftnd(m_kiss_fft, h_mesh.data, h_fourier_mesh.data);
+        localFFT(false, h_mesh.data, h_fourier_mesh.data);
         if (m_prof) m_prof->pop();
         }
 
@@ -915,7 +1017,13 @@ void PPPMForceCompute::updateMeshes()
         unsigned int NNN = m_global_dim.x*m_global_dim.y*m_global_dim.z;
 
         // multiply with influence function and I*k
+        #ifdef ENABLE_TBB
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, m_n_inner_cells),
+            [&](const tbb::blocked_range<unsigned int>& r) {
+        for (unsigned int k = r.begin(); k != r.end(); ++k)
+        #else
         for (unsigned int k = 0; k < m_n_inner_cells; ++k)
+        #endif
             {
             kiss_fft_cpx f = h_fourier_mesh.data[k];
 
@@ -932,6 +1040,9 @@ void PPPMForceCompute::updateMeshes()
             h_fourier_mesh_G_z.data[k].r = f.i * kvec.z * scaled_inf_f;
             h_fourier_mesh_G_z.data[k].i = -f.r * kvec.z * scaled_inf_f;
             }
+        #ifdef ENABLE_TBB
+            });
+        #endif
         }
 
     if (m_prof) m_prof->pop();
@@ -946,9 +1057,9 @@ void PPPMForceCompute::updateMeshes()
         ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_x(m_inv_fourier_mesh_x, access_location::host, access_mode::overwrite);
         ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_y(m_inv_fourier_mesh_y, access_location::host, access_mode::overwrite);
         ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_z(m_inv_fourier_mesh_z, access_location::host, access_mode::overwrite);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_x.data, h_inv_fourier_mesh_x.data);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_y.data, h_inv_fourier_mesh_y.data);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_z.data, h_inv_fourier_mesh_z.data);
+        localFFT(true, h_fourier_mesh_G_x.data, h_inv_fourier_mesh_x.data);
+        localFFT(true, h_fourier_mesh_G_y.data, h_inv_fourier_mesh_y.data);
+        localFFT(true, h_fourier_mesh_G_z.data, h_inv_fourier_mesh_z.data);
         if (m_prof) m_prof->pop();
         }
 
@@ -989,35 +1100,128 @@ void PPPMForceCompute::updateMeshes()
     #endif
     }
 
+/*! \param inverse True if the inverse transform is to be performed
+    \param in Input mesh
+    \param out Output mesh
+
+    With TBB, the transform is performed as one-dimensional transforms of all pencils along x, y and z,
+    which are distributed over the threads. Otherwise, the serial multi-dimensional KISS FFT is used.
+ */
+void PPPMForceCompute::localFFT(bool inverse, const kiss_fft_cpx *in, kiss_fft_cpx *out)
+    {
+    #ifdef ENABLE_TBB
+    const kiss_fft_cfg *cfg = inverse ? m_kiss_ifft_1d : m_kiss_fft_1d;
+
+    const unsigned int nx = m_mesh_points.x;
+    const unsigned int ny = m_mesh_points.y;
+    const unsigned int nz = m_mesh_points.z;
+
+    // pencils along x are contiguous in memory
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, ny*nz),
+        [&](const tbb::blocked_range<unsigned int>& r) {
+        for (unsigned int pencil = r.begin(); pencil != r.end(); ++pencil)
+            kiss_fft(cfg[0], in + pencil*nx, out + pencil*nx);
+        });
+
+    // pencils along y and z are strided, transform into a buffer and scatter the result back in place
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, nx*nz),
+        [&](const tbb::blocked_range<unsigned int>& r) {
+        std::vector<kiss_fft_cpx> buf(ny);
+        for (unsigned int pencil = r.begin(); pencil != r.end(); ++pencil)
+            {
+            kiss_fft_cpx *base = out + (pencil % nx) + (pencil / nx)*nx*ny;
+            kiss_fft_stride(cfg[1], base, &buf.front(), nx);
+            for (unsigned int j = 0; j < ny; ++j)
+                base[j*nx] = buf[j];
+            }
+        });
+
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, nx*ny),
+        [&](const tbb::blocked_range<unsigned int>& r) {
+        std::vector<kiss_fft_cpx> buf(nz);
+        for (unsigned int pencil = r.begin(); pencil != r.end(); ++pencil)
+            {
+            kiss_fft_cpx *base = out + pencil;
+            kiss_fft_stride(cfg[2], base, &buf.front(), nx*ny);
+            for (unsigned int k = 0; k < nz; ++k)
+                base[k*nx*ny] = buf[k];
+            }
+        });
+    #else
+    kiss_fftnd(inverse ? m_kiss_ifft : m_kiss_fft, in, out);
+    #endif
+    }
+
 void PPPMForceCompute::interpolateForces()
     {
     if (m_prof) m_prof->push("interpolate");
 
-    // access particle data
-    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
-
-    // access inverse Fourier tranform mesh
-    ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_x(m_inv_fourier_mesh_x, access_location::host, access_mode::read);
-    ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_y(m_inv_fourier_mesh_y, access_location::host, access_mode::read);
-    ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_z(m_inv_fourier_mesh_z, access_location::host, access_mode::read);
+        {
+        // reset force for ALL particles
+        ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+        memset(h_force.data, 0, sizeof(Scalar4)*m_pdata->getN());
+        }
 
-    // access force array
-    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    unsigned int group_size = m_group->getNumMembers();
 
-    // reset force for ALL particles
-    memset(h_force.data, 0, sizeof(Scalar4)*m_pdata->getN());
+        {
+        ArrayHandle<unsigned int> h_member_idx(m_group->getIndexArray(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+
+        // access inverse Fourier tranform mesh
+        ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_x(m_inv_fourier_mesh_x, access_location::host, access_mode::read);
+        ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_y(m_inv_fourier_mesh_y, access_location::host, access_mode::read);
+        ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_z(m_inv_fourier_mesh_z, access_location::host, access_mode::read);
+
+        // access force array
+        ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::readwrite);
+
+        ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff, access_location::host, access_mode::read);
+
+        // every group member writes only its own force
+        #ifdef ENABLE_TBB
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, group_size),
+            [&](const tbb::blocked_range<unsigned int>& r) {
+            interpolateForcesRange(r.begin(), r.end(), h_member_idx.data, h_postype.data, h_charge.data,
+                h_inv_fourier_mesh_x.data, h_inv_fourier_mesh_y.data, h_inv_fourier_mesh_z.data, h_rho_coeff.data,
+                h_force.data);
+            });
+        #else
+        interpolateForcesRange(0, group_size, h_member_idx.data, h_postype.data, h_charge.data,
+            h_inv_fourier_mesh_x.data, h_inv_fourier_mesh_y.data, h_inv_fourier_mesh_z.data, h_rho_coeff.data,
+            h_force.data);
+        #endif
+        }
 
-    ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff, access_location::host, access_mode::read);
+    if (m_prof) m_prof->pop();
+    }
 
+/*! \param group_first First group member to interpolate the force for
+    \param group_last One past the last group member
+    \param h_member_idx Indices of the group members
+    \param h_postype Particle positions
+    \param h_charge Particle charges
+    \param h_inv_fourier_mesh_x Electric field mesh, x-component
+    \param h_inv_fourier_mesh_y Electric field mesh, y-component
+    \param h_inv_fourier_mesh_z Electric field mesh, z-component
+    \param h_rho_coeff Charge assignment coefficients
+    \param h_force Force array to write to
+
+    The arrays are passed as pointers so that this method can be called concurrently.
+ */
+void PPPMForceCompute::interpolateForcesRange(unsigned int group_first, unsigned int group_last,
+    const unsigned int *h_member_idx, const Scalar4 *h_postype, const Scalar *h_charge,
+    const kiss_fft_cpx *h_inv_fourier_mesh_x, const kiss_fft_cpx *h_inv_fourier_mesh_y,
+    const kiss_fft_cpx *h_inv_fourier_mesh_z, const Scalar *h_rho_coeff, Scalar4 *h_force)
+    {
     const BoxDim& box = m_pdata->getBox();
 
     // loop over group
-    unsigned int group_size = m_group->getNumMembers();
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    for (unsigned int group_idx = group_first; group_idx < group_last; group_idx++)
         {
-        unsigned int idx = m_group->getMemberIndex(group_idx);
-        Scalar4 postype = h_postype.data[idx];
+        unsigned int idx = h_member_idx[group_idx];
+        Scalar4 postype = h_postype[idx];
 
         Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
 
@@ -1027,7 +1231,7 @@ void PPPMForceCompute::interpolateForces()
             continue;
             }
 
-        Scalar qi = h_charge.data[idx];
+        Scalar qi = h_charge[idx];
 
         // compute coordinates in units of the mesh size
         Scalar3 f = box.makeFraction(pos);
@@ -1090,7 +1294,7 @@ void PPPMForceCompute::interpolateForces()
             Wx = Scalar(0.0);
             for (int iorder = m_order-1; iorder >= 0; iorder--)
                 {
-                Wx = h_rho_coeff.data[i - nlower + iorder*mult_fact] + Wx * dx;
+                Wx = h_rho_coeff[i - nlower + iorder*mult_fact] + Wx * dx;
                 }
 
             int neighi = (int)ix + i;
@@ -1109,7 +1313,7 @@ void PPPMForceCompute::interpolateForces()
                 Wy = Scalar(0.0);
                 for (int iorder = m_order-1; iorder >= 0; iorder--)
                     {
-                    Wy = h_rho_coeff.data[j - nlower + iorder*mult_fact] + Wy * dy;
+                    Wy = h_rho_coeff[j - nlower + iorder*mult_fact] + Wy * dy;
                     }
 
                 int neighj = (int)iy + j;
@@ -1128,7 +1332,7 @@ void PPPMForceCompute::interpolateForces()
                     Wz = Scalar(0.0);
                     for (int iorder = m_order-1; iorder >= 0; iorder--)
                         {
-                        Wz = h_rho_coeff.data[k - nlower + iorder*mult_fact] + Wz * dz;
+                        Wz = h_rho_coeff[k - nlower + iorder*mult_fact] + Wz * dz;
                         }
 
                     int neighk = (int)iz + k;
@@ -1142,9 +1346,9 @@ void PPPMForceCompute::interpolateForces()
 
                     unsigned int neigh_idx = neighi + m_grid_dim.x * (neighj + m_grid_dim.y*neighk);
 
-                    kiss_fft_cpx E_x = h_inv_fourier_mesh_x.data[neigh_idx];
-                    kiss_fft_cpx E_y = h_inv_fourier_mesh_y.data[neigh_idx];
-                    kiss_fft_cpx E_z = h_inv_fourier_mesh_z.data[neigh_idx];
+                    kiss_fft_cpx E_x = h_inv_fourier_mesh_x[neigh_idx];
+                    kiss_fft_cpx E_y = h_inv_fourier_mesh_y[neigh_idx];
+                    kiss_fft_cpx E_z = h_inv_fourier_mesh_z[neigh_idx];
 
                     Scalar W = Wx * Wy * Wz;
                     force.x += qi*W*E_x.r;
@@ -1154,10 +1358,8 @@ void PPPMForceCompute::interpolateForces()
                 }
             }
 
-        h_force.data[idx] = make_scalar4(force.x,force.y,force.z,0.0);
+        h_force[idx] = make_scalar4(force.x,force.y,force.z,0.0);
         }  // end of loop over particles
-
-    if (m_prof) m_prof->pop();
     }
 
 Scalar PPPMForceCompute::computePE()
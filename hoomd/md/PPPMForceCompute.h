@@ -15,6 +15,10 @@
 
 #include "hoomd/extern/kiss_fftnd.h"
 
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
+
 #include <memory>
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 
@@ -181,6 +185,11 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         kiss_fftnd_cfg m_kiss_fft;         //!< The FFT configuration
         kiss_fftnd_cfg m_kiss_ifft;        //!< Inverse FFT configuration
 
+        #ifdef ENABLE_TBB
+        kiss_fft_cfg m_kiss_fft_1d[3];     //!< One-dimensional FFT configurations along x, y and z
+        kiss_fft_cfg m_kiss_ifft_1d[3];    //!< One-dimensional inverse FFT configurations along x, y and z
+        #endif
+
         #ifdef ENABLE_MPI
         dfft_plan m_dfft_plan_forward;     //!< Distributed FFT for forward transform
         dfft_plan m_dfft_plan_inverse;     //!< Distributed FFT for inverse transform
@@ -199,6 +208,8 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         GPUArray<kiss_fft_cpx> m_inv_fourier_mesh_y;   //!< Fourier transformed mesh times the influence function, y-component
         GPUArray<kiss_fft_cpx> m_inv_fourier_mesh_z;   //!< Fourier transformed mesh times the influence function, z-component
 
+        std::vector<Scalar> m_mesh_scratch;        //!< Per-thread charge meshes for concurrent charge assignment
+
         std::vector<std::string> m_log_names;           //!< Name of the log quantity
 
         bool m_dfft_initialized;                   //! True if host dfft has been initialized
@@ -206,6 +217,20 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         //! Compute virial on mesh
         void computeVirialMesh();
 
+        //! Assign the charges of a range of group members to a mesh
+        void assignParticlesRange(unsigned int group_first, unsigned int group_last,
+            const unsigned int *h_member_idx, const Scalar4 *h_postype, const Scalar *h_charge,
+            const Scalar *h_rho_coeff, Scalar *mesh);
+
+        //! Interpolate the forces on a range of group members
+        void interpolateForcesRange(unsigned int group_first, unsigned int group_last,
+            const unsigned int *h_member_idx, const Scalar4 *h_postype, const Scalar *h_charge,
+            const kiss_fft_cpx *h_inv_fourier_mesh_x, const kiss_fft_cpx *h_inv_fourier_mesh_y,
+            const kiss_fft_cpx *h_inv_fourier_mesh_z, const Scalar *h_rho_coeff, Scalar4 *h_force);
+
+        //! Perform a local three-dimensional FFT
+        void localFFT(bool inverse, const kiss_fft_cpx *in, kiss_fft_cpx *out);
+
         //! Compute number of ghost cellso
         uint3 computeGhostCellNum();
 
@@ -17,6 +17,7 @@ PPPMForceComputeGPU::PPPMForceComputeGPU(std::shared_ptr<SystemDefinition> sysde
     std::shared_ptr<ParticleGroup> group)
     : PPPMForceCompute(sysdef,nlist,group),
       m_local_fft(true),
+      m_fft_initialized(false),
       m_sum(m_exec_conf),
       m_block_size(256),
       m_gpu_q_max(m_exec_conf)
@@ -29,19 +30,36 @@ PPPMForceComputeGPU::PPPMForceComputeGPU(std::shared_ptr<SystemDefinition> sysde
 
 PPPMForceComputeGPU::~PPPMForceComputeGPU()
     {
-    if (m_local_fft)
-        cufftDestroy(m_cufft_plan);
-    #ifdef ENABLE_MPI
-    else
+    if (m_fft_initialized)
         {
-        dfft_destroy_plan(m_dfft_plan_forward);
-        dfft_destroy_plan(m_dfft_plan_inverse);
+        if (m_local_fft)
+            cufftDestroy(m_cufft_plan);
+        #ifdef ENABLE_MPI
+        else
+            {
+            dfft_destroy_plan(m_dfft_plan_forward);
+            dfft_destroy_plan(m_dfft_plan_inverse);
+            }
+        #endif
         }
-    #endif
     }
 
 void PPPMForceComputeGPU::initializeFFT()
     {
+    if (m_fft_initialized)
+        {
+        // the mesh is being re-initialized
+        if (m_local_fft)
+            cufftDestroy(m_cufft_plan);
+        #ifdef ENABLE_MPI
+        else
+            {
+            dfft_destroy_plan(m_dfft_plan_forward);
+            dfft_destroy_plan(m_dfft_plan_inverse);
+            }
+        #endif
+        }
+
     #ifdef ENABLE_MPI
     m_local_fft = !m_pdata->getDomainDecomposition();
 
@@ -104,6 +122,8 @@ void PPPMForceComputeGPU::initializeFFT()
         cufftPlan3d(&m_cufft_plan, m_mesh_points.z, m_mesh_points.y, m_mesh_points.x, CUFFT_C2C);
         }
 
+    m_fft_initialized = true;
+
     // allocate mesh and transformed mesh
 
     // pad with offset
@@ -102,6 +102,7 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
 
         cufftHandle m_cufft_plan;          //!< The FFT plan
         bool m_local_fft;                  //!< True if we are only doing local FFTs (not distributed)
+        bool m_fft_initialized;            //!< True if the FFT plans have been created
 
         #ifdef ENABLE_MPI
         typedef CommunicatorGridGPU<cufftComplex> CommunicatorGridGPUComplex;
@@ -0,0 +1,33 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file PairPrecisionSetup.h
+    \brief Setup for md mixed precision pair potentials
+*/
+
+#ifndef __PAIR_PRECISION_SETUP_H__
+#define __PAIR_PRECISION_SETUP_H__
+
+#ifdef SINGLE_PRECISION
+
+// in single precision, PairReal is always float
+//! Typedef'd real for use in pair evaluator math
+typedef float PairReal;
+
+#else
+
+// in double precision, mixed mode evaluates the pair potential in float. Positions, the pair distance, force
+// accumulation, thermodynamic reductions and integration remain in double precision.
+#ifdef ENABLE_MD_MIXED_PRECISION
+typedef float PairReal;
+
+#else
+typedef double PairReal;
+
+#endif
+
+#endif
+
+#endif //__PAIR_PRECISION_SETUP_H__
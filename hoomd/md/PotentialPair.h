@@ -104,6 +104,10 @@ class PotentialPair : public ForceCompute
         virtual std::vector< std::string > getProvidedLogQuantities();
         //! Calculates the requested log value and returns it
         virtual Scalar getLogValue(const std::string& quantity, unsigned int timestep);
+        //! Resolves a log quantity to an integer handle
+        virtual int getLogHandle(const std::string& quantity);
+        //! Calculates the log value for a handle returned by getLogHandle()
+        virtual Scalar getLogValueByHandle(int handle, unsigned int timestep);
 
         //! Shifting modes that can be applied to the energy
         enum energyShiftMode
@@ -300,6 +304,32 @@ Scalar PotentialPair< evaluator >::getLogValue(const std::string& quantity, unsi
         }
     }
 
+/*! \param quantity Name of the log quantity
+    \returns 0 for the pair energy, -1 for any other quantity
+*/
+template< class evaluator >
+int PotentialPair< evaluator >::getLogHandle(const std::string& quantity)
+    {
+    return (quantity == m_log_name) ? 0 : -1;
+    }
+
+/*! \param handle Handle returned by getLogHandle()
+    \param timestep Current timestep of the simulation
+*/
+template< class evaluator >
+Scalar PotentialPair< evaluator >::getLogValueByHandle(int handle, unsigned int timestep)
+    {
+    if (handle != 0)
+        {
+        this->m_exec_conf->msg->error() << "pair." << evaluator::getName() << ": " << handle << " is not a valid log handle"
+                  << std::endl;
+        throw std::runtime_error("Error getting log value");
+        }
+
+    compute(timestep);
+    return calcEnergySum();
+    }
+
 /*! \post The pair forces are computed for the given timestep. The neighborlist's compute method is called to ensure
     that it is up to date before proceeding.
 
@@ -16,6 +16,10 @@
 #include "hoomd/ForceCompute.h"
 #include "NeighborList.h"
 
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
+
 
 /*! \file PotentialTersoff.h
     \brief Defines the template class for standard three-body potentials
@@ -38,6 +42,11 @@
     EvaluatorTersoff) which is passed in as a template parameter so the computations are performed
     as efficiently as possible.
 
+    The separation, distance and type pair of every neighbor of particle i are computed once and stored in a
+    per-particle table, from which all triplets ijk around i are evaluated. Since forces act on j and k as well, the
+    particles are split into chunks that are processed in parallel when built with TBB, each accumulating into
+    private force and virial arrays that are summed in a fixed order.
+
     PotentialTersoff handles most of the internal details common to all standard three-body potentials.
      - A cutoff radius to be specified per particle type-pair
      - Per type-pair parameters are stored and a set method is provided
@@ -108,6 +117,21 @@ class PotentialTersoff : public ForceCompute
         std::string m_prof_name;                    //!< Cached profiler name
         std::string m_log_name;                     //!< Cached log name
 
+        //! Geometry of a neighbor of the particle whose triplets are evaluated
+        struct TripletNeighbor
+            {
+            Scalar3 dx;                 //!< Minimum image separation from the central particle
+            Scalar rsq;                 //!< Squared distance
+            Scalar inv_r;               //!< Inverse distance
+            unsigned int idx;           //!< Particle index
+            unsigned int type;          //!< Particle type
+            unsigned int typpair_idx;   //!< Index of the type pair with the central particle
+            bool interactive;           //!< True if the type pair with the central particle interacts
+            };
+
+        std::vector<Scalar4> m_force_scratch;       //!< Private force arrays of all but the first chunk
+        std::vector<Scalar> m_virial_scratch;       //!< Private virial arrays of all but the first chunk
+
         //! Actually compute the forces
         virtual void computeForces(unsigned int timestep);
 
@@ -306,45 +330,66 @@ void PotentialTersoff< evaluator >::computeForces(unsigned int timestep)
     ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
     ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::read);
 
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_all = m_pdata->getN()+m_pdata->getNGhosts();
+
     // need to start from a zero force, energy
-    memset(h_force.data, 0, sizeof(Scalar4)*(m_pdata->getN()+m_pdata->getNGhosts()));
+    memset(h_force.data, 0, sizeof(Scalar4)*n_all);
     memset(h_virial.data, 0, sizeof(Scalar)*6*m_virial_pitch);
 
     unsigned int ntypes = m_pdata->getNTypes();
 
-    // for each particle
-    for (int i = 0; i < (int)m_pdata->getN(); i++)
+    // forces act on j and k as well as on i, so every chunk of particles accumulates into private arrays
+    unsigned int n_chunks = 1;
+    #ifdef ENABLE_TBB
+    // limit the memory used by the private arrays
+    const unsigned int max_chunks = 16;
+    n_chunks = std::max(1u, std::min(std::min(m_exec_conf->getNumThreads(), N/256), max_chunks));
+    #endif
+
+    // chunk 0 writes to the force and virial arrays directly
+    m_force_scratch.resize((n_chunks-1)*n_all);
+    if (compute_virial)
+        m_virial_scratch.resize((n_chunks-1)*6*n_all);
+
+    //! Compute the forces of particles first to last-1 into force and virial
+    auto compute_range = [&](unsigned int first, unsigned int last, Scalar4 *force, Scalar *virial,
+                             unsigned int virial_pitch)
         {
-        // access the particle's position and type (MEM TRANSFER: 4 scalars)
-        Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int head_i = h_head_list.data[i];
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
-
-        // initialize current force and potential energy of particle i to 0
-        Scalar3 fi = make_scalar3(0.0, 0.0, 0.0);
-        Scalar pei = 0.0;
-
-        Scalar viriali_xx(0.0);
-        Scalar viriali_xy(0.0);
-        Scalar viriali_xz(0.0);
-        Scalar viriali_yy(0.0);
-        Scalar viriali_yz(0.0);
-        Scalar viriali_zz(0.0);
+        // geometry of the neighbors of the current particle
+        std::vector<TripletNeighbor> nbr;
 
         Scalar phi_ab[ntypes];
 
-        // reset phi
-        for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
+        for (unsigned int i = first; i < last; i++)
             {
-            phi_ab[typ_b] = Scalar(0.0);
-            }
+            // access the particle's position and type (MEM TRANSFER: 4 scalars)
+            Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            const unsigned int head_i = h_head_list.data[i];
+            // sanity check
+            assert(typei < m_pdata->getNTypes());
+
+            // initialize current force and potential energy of particle i to 0
+            Scalar3 fi = make_scalar3(0.0, 0.0, 0.0);
+            Scalar pei = 0.0;
+
+            Scalar viriali_xx(0.0);
+            Scalar viriali_xy(0.0);
+            Scalar viriali_xz(0.0);
+            Scalar viriali_yy(0.0);
+            Scalar viriali_yz(0.0);
+            Scalar viriali_zz(0.0);
+
+            // reset phi
+            for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
+                {
+                phi_ab[typ_b] = Scalar(0.0);
+                }
 
-        // all neighbors of this particle
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        if (evaluator::hasPerParticleEnergy())
-            {
+            // compute the separation of all neighbors of this particle once, they are used in every triplet
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            nbr.resize(size);
             for (unsigned int j = 0; j < size; j++)
                 {
                 // access the index of neighbor j (MEM TRANSFER: 1 scalar)
@@ -356,213 +401,148 @@ void PotentialTersoff< evaluator >::computeForces(unsigned int timestep)
                 unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
                 assert(typej < m_pdata->getNTypes());
 
-                // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                Scalar3 dxij = posi - posj;
-
-                // apply periodic boundary conditions
-                dxij = box.minImage(dxij);
+                // calculate dr_ij and apply periodic boundary conditions (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                TripletNeighbor& n = nbr[j];
+                n.dx = box.minImage(posi - posj);
 
                 // compute rij_sq (FLOPS: 5)
-                Scalar rij_sq = dot(dxij, dxij);
-
-                // get parameters for this type pair
-                unsigned int typpair_idx = m_typpair_idx(typei, typej);
-                param_type param = h_params.data[typpair_idx];
-                Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
-                // evaluate the scalar per-neighbor contribution
-                evaluator eval(rij_sq, rcutsq, param);
-                eval.evalPhi(phi_ab[typej]);
-                }
-
-            // self-energy
-            for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
-                {
-                unsigned int typpair_idx = m_typpair_idx(typei,typ_b);
-                param_type param = h_params.data[typpair_idx];
-                Scalar rcutsq = h_rcutsq.data[typpair_idx];
-                evaluator eval(Scalar(0.0), rcutsq, param);
-                Scalar energy(0.0);
-                eval.evalSelfEnergy(energy, phi_ab[typ_b]);
-                pei += energy;
+                n.rsq = dot(n.dx, n.dx);
+                n.inv_r = fast::rsqrt(n.rsq);
+                n.idx = jj;
+                n.type = typej;
+                n.typpair_idx = m_typpair_idx(typei, typej);
+
+                evaluator eval(n.rsq, h_rcutsq.data[n.typpair_idx], h_params.data[n.typpair_idx]);
+                n.interactive = eval.areInteractive();
                 }
-            }
 
-        // loop over all of the neighbors of this particle
-        for (unsigned int j = 0; j < size; j++)
-            {
-            // access the index of neighbor j (MEM TRANSFER: 1 scalar)
-            unsigned int jj = h_nlist.data[head_i + j];
-            assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
-
-            // access the position and type of particle j
-            Scalar3 posj = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
-            unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
-            assert(typej < m_pdata->getNTypes());
-
-            // initialize the current force and potential energy of particle j to 0
-            Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
-            Scalar pej = 0.0;
-
-            // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 dxij = posi - posj;
-
-            // apply periodic boundary conditions
-            dxij = box.minImage(dxij);
-
-            // compute rij_sq (FLOPS: 5)
-            Scalar rij_sq = dot(dxij, dxij);
-
-            // get parameters for this type pair
-            unsigned int typpair_idx = m_typpair_idx(typei, typej);
-            param_type param = h_params.data[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
-            // evaluate the base repulsive and attractive terms
-            Scalar fR = 0.0;
-            Scalar fA = 0.0;
-            evaluator eval(rij_sq, rcutsq, param);
-            bool evaluated = eval.evalRepulsiveAndAttractive(fR, fA);
-
-            Scalar virialj_xx(0.0);
-            Scalar virialj_xy(0.0);
-            Scalar virialj_xz(0.0);
-            Scalar virialj_yy(0.0);
-            Scalar virialj_yz(0.0);
-            Scalar virialj_zz(0.0);
-
-            if (evaluated)
+            if (evaluator::hasPerParticleEnergy())
                 {
-                // evaluate chi
-                Scalar chi = 0.0;
-                if (evaluator::needsChi())
+                for (unsigned int j = 0; j < size; j++)
                     {
-                    for (unsigned int k = 0; k < size; k++)
-                        {
-                        // access the index of neighbor k
-                        unsigned int kk = h_nlist.data[head_i + k];
-                        assert(kk < m_pdata->getN());
+                    // evaluate the scalar per-neighbor contribution
+                    const TripletNeighbor& n = nbr[j];
+                    evaluator eval(n.rsq, h_rcutsq.data[n.typpair_idx], h_params.data[n.typpair_idx]);
+                    eval.evalPhi(phi_ab[n.type]);
+                    }
 
-                        // access the position and type of neighbor k
-                        Scalar3 posk = make_scalar3(h_pos.data[kk].x, h_pos.data[kk].y, h_pos.data[kk].z);
-                        unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
-                        assert(typek < m_pdata->getNTypes());
+                // self-energy
+                for (unsigned int typ_b = 0; typ_b < ntypes; ++typ_b)
+                    {
+                    unsigned int typpair_idx = m_typpair_idx(typei,typ_b);
+                    param_type param = h_params.data[typpair_idx];
+                    Scalar rcutsq = h_rcutsq.data[typpair_idx];
+                    evaluator eval(Scalar(0.0), rcutsq, param);
+                    Scalar energy(0.0);
+                    eval.evalSelfEnergy(energy, phi_ab[typ_b]);
+                    pei += energy;
+                    }
+                }
 
-                        // access the type pair parameters for i and k
-                        typpair_idx = m_typpair_idx(typei, typek);
-                        param_type temp_param = h_params.data[typpair_idx];
+            // loop over all of the neighbors of this particle
+            for (unsigned int j = 0; j < size; j++)
+                {
+                const TripletNeighbor& nj = nbr[j];
+                unsigned int jj = nj.idx;
+                const Scalar3& dxij = nj.dx;
+                Scalar rij_sq = nj.rsq;
 
-                        evaluator temp_eval(rij_sq, rcutsq, temp_param);
-                        bool temp_evaluated = temp_eval.areInteractive();
+                // initialize the current force and potential energy of particle j to 0
+                Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
+                Scalar pej = 0.0;
 
-                        if (kk != jj && temp_evaluated)
-                            {
-                            // compute drik
-                            Scalar3 dxik = posi - posk;
+                // get parameters for this type pair
+                param_type param = h_params.data[nj.typpair_idx];
+                Scalar rcutsq = h_rcutsq.data[nj.typpair_idx];
 
-                            // apply periodic boundary conditions
-                            dxik = box.minImage(dxik);
+                // evaluate the base repulsive and attractive terms
+                Scalar fR = 0.0;
+                Scalar fA = 0.0;
+                evaluator eval(rij_sq, rcutsq, param);
+                bool evaluated = eval.evalRepulsiveAndAttractive(fR, fA);
 
-                            // compute rik_sq
-                            Scalar rik_sq = dot(dxik, dxik);
+                Scalar virialj_xx(0.0);
+                Scalar virialj_xy(0.0);
+                Scalar virialj_xz(0.0);
+                Scalar virialj_yy(0.0);
+                Scalar virialj_yz(0.0);
+                Scalar virialj_zz(0.0);
 
-                            // compute the bond angle (if needed)
-                            Scalar cos_th = Scalar(0.0);
-                            if (evaluator::needsAngle())
-                                cos_th = dot(dxij, dxik) / fast::sqrt(rij_sq * rik_sq);
+                if (evaluated)
+                    {
+                    // evaluate chi
+                    Scalar chi = 0.0;
+                    if (evaluator::needsChi())
+                        {
+                        for (unsigned int k = 0; k < size; k++)
+                            {
+                            const TripletNeighbor& nk = nbr[k];
+                            if (k == j || !nk.interactive)
+                                continue;
 
                             // evaluate the partial chi term
-                            eval.setRik(rik_sq);
+                            eval.setRik(nk.rsq);
                             if (evaluator::needsAngle())
-                                eval.setAngle(cos_th);
+                                eval.setAngle(dot(dxij, nk.dx) * nj.inv_r * nk.inv_r);
 
                             eval.evalChi(chi);
                             }
                         }
-                    }
-
-                // evaluate the force and energy from the ij interaction
-                Scalar force_divr = Scalar(0.0);
-                Scalar potential_eng = Scalar(0.0);
-                Scalar bij = Scalar(0.0);
-                eval.evalForceij(fR, fA, chi, phi_ab[typej], bij, force_divr, potential_eng);
-
-                // add this force to particle i
-                fi += force_divr * dxij;
-                pei += potential_eng * Scalar(0.5);
-
-                if (compute_virial)
-                    {
-                    Scalar force_div2r = Scalar(0.5)*force_divr;
-
-                    viriali_xx += force_div2r*dxij.x*dxij.x;
-                    viriali_xy += force_div2r*dxij.x*dxij.y;
-                    viriali_xz += force_div2r*dxij.x*dxij.z;
-                    viriali_yy += force_div2r*dxij.y*dxij.y;
-                    viriali_yz += force_div2r*dxij.y*dxij.z;
-                    viriali_zz += force_div2r*dxij.z*dxij.z;
-                    }
 
-                // add this force to particle j
-                fj += Scalar(-1.0) * force_divr * dxij;
-                pej += potential_eng * Scalar(0.5);
+                    // evaluate the force and energy from the ij interaction
+                    Scalar force_divr = Scalar(0.0);
+                    Scalar potential_eng = Scalar(0.0);
+                    Scalar bij = Scalar(0.0);
+                    eval.evalForceij(fR, fA, chi, phi_ab[nj.type], bij, force_divr, potential_eng);
 
-                if (compute_virial)
-                    {
-                    Scalar force_div2r = Scalar(0.5)*force_divr;
-
-                    virialj_xx += force_div2r*dxij.x*dxij.x;
-                    virialj_xy += force_div2r*dxij.x*dxij.y;
-                    virialj_xz += force_div2r*dxij.x*dxij.z;
-                    virialj_yy += force_div2r*dxij.y*dxij.y;
-                    virialj_yz += force_div2r*dxij.y*dxij.z;
-                    virialj_zz += force_div2r*dxij.z*dxij.z;
-                    }
+                    // add this force to particle i
+                    fi += force_divr * dxij;
+                    pei += potential_eng * Scalar(0.5);
 
-                if (evaluator::hasIkForce())
-                    {
-                    // evaluate the force from the ik interactions
-                    for (unsigned int k = 0; k < size; k++)
+                    if (compute_virial)
                         {
-                        // access the index of neighbor k
-                        unsigned int kk = h_nlist.data[head_i + k];
-                        assert(kk < m_pdata->getN());
-
-                        // access the position and type of neighbor k
-                        Scalar3 posk = make_scalar3(h_pos.data[kk].x, h_pos.data[kk].y, h_pos.data[kk].z);
-                        unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
-                        assert(typek < m_pdata->getNTypes());
+                        Scalar force_div2r = Scalar(0.5)*force_divr;
+
+                        viriali_xx += force_div2r*dxij.x*dxij.x;
+                        viriali_xy += force_div2r*dxij.x*dxij.y;
+                        viriali_xz += force_div2r*dxij.x*dxij.z;
+                        viriali_yy += force_div2r*dxij.y*dxij.y;
+                        viriali_yz += force_div2r*dxij.y*dxij.z;
+                        viriali_zz += force_div2r*dxij.z*dxij.z;
+                        }
 
-                        // access the type pair parameters for i and k
-                        typpair_idx = m_typpair_idx(typei, typek);
-                        param_type temp_param = h_params.data[typpair_idx];
+                    // add this force to particle j
+                    fj += Scalar(-1.0) * force_divr * dxij;
+                    pej += potential_eng * Scalar(0.5);
 
-                        evaluator temp_eval(rij_sq, rcutsq, temp_param);
-                        bool temp_evaluated = temp_eval.areInteractive();
+                    if (compute_virial)
+                        {
+                        Scalar force_div2r = Scalar(0.5)*force_divr;
+
+                        virialj_xx += force_div2r*dxij.x*dxij.x;
+                        virialj_xy += force_div2r*dxij.x*dxij.y;
+                        virialj_xz += force_div2r*dxij.x*dxij.z;
+                        virialj_yy += force_div2r*dxij.y*dxij.y;
+                        virialj_yz += force_div2r*dxij.y*dxij.z;
+                        virialj_zz += force_div2r*dxij.z*dxij.z;
+                        }
 
-                        if (kk != jj && temp_evaluated)
+                    if (evaluator::hasIkForce())
+                        {
+                        // evaluate the force from the ik interactions
+                        for (unsigned int k = 0; k < size; k++)
                             {
-                            // create variable for the force on k
-                            Scalar3 fk = make_scalar3(0.0, 0.0, 0.0);
-
-                            // compute dr_ik
-                            Scalar3 dxik = posi - posk;
-
-                            // apply periodic boundary conditions
-                            dxik = box.minImage(dxik);
-
-                            // compute rik_sq
-                            Scalar rik_sq = dot(dxik, dxik);
+                            const TripletNeighbor& nk = nbr[k];
+                            if (k == j || !nk.interactive)
+                                continue;
 
-                            // compute the bond angle (if needed)
-                            Scalar cos_th = Scalar(0.0);
-                            if (evaluator::needsAngle())
-                                cos_th = dot(dxij, dxik) / sqrt(rij_sq * rik_sq);
+                            unsigned int kk = nk.idx;
+                            const Scalar3& dxik = nk.dx;
 
                             // set up the evaluator
-                            eval.setRik(rik_sq);
+                            eval.setRik(nk.rsq);
                             if (evaluator::needsAngle())
-                                eval.setAngle(cos_th);
+                                eval.setAngle(dot(dxij, dxik) * nj.inv_r * nk.inv_r);
 
                             // compute the total force and energy
                             Scalar3 force_divr_ij = make_scalar3(0.0, 0.0, 0.0);
@@ -607,64 +587,116 @@ void PotentialTersoff< evaluator >::computeForces(unsigned int timestep)
                                 }
 
                             // add the force to particle k
-                            fk.x += force_divr_ij.z * dxij.x + force_divr_ik.z * dxik.x;
-                            fk.y += force_divr_ij.z * dxij.y + force_divr_ik.z * dxik.y;
-                            fk.z += force_divr_ij.z * dxij.z + force_divr_ik.z * dxik.z;
-
-                            // increment the force for particle k
-                            unsigned int mem_idx = kk;
-                            h_force.data[mem_idx].x += fk.x;
-                            h_force.data[mem_idx].y += fk.y;
-                            h_force.data[mem_idx].z += fk.z;
+                            force[kk].x += force_divr_ij.z * dxij.x + force_divr_ik.z * dxik.x;
+                            force[kk].y += force_divr_ij.z * dxij.y + force_divr_ik.z * dxik.y;
+                            force[kk].z += force_divr_ij.z * dxij.z + force_divr_ik.z * dxik.z;
 
                             if (compute_virial)
                                 {
                                 Scalar force_div2r_ij = Scalar(0.5)*force_divr_ij.z;
                                 Scalar force_div2r_ik = Scalar(0.5)*force_divr_ik.z;
-                                h_virial.data[0*m_virial_pitch+mem_idx] += force_div2r_ij*dxij.x*dxij.x + force_div2r_ik*dxik.x*dxik.x;
-                                h_virial.data[1*m_virial_pitch+mem_idx] += force_div2r_ij*dxij.x*dxij.y + force_div2r_ik*dxik.x*dxik.y;
-                                h_virial.data[2*m_virial_pitch+mem_idx] += force_div2r_ij*dxij.x*dxij.z + force_div2r_ik*dxik.x*dxik.z;
-                                h_virial.data[3*m_virial_pitch+mem_idx] += force_div2r_ij*dxij.y*dxij.y + force_div2r_ik*dxik.y*dxik.y;
-                                h_virial.data[4*m_virial_pitch+mem_idx] += force_div2r_ij*dxij.y*dxij.z + force_div2r_ik*dxik.y*dxik.z;
-                                h_virial.data[5*m_virial_pitch+mem_idx] += force_div2r_ij*dxij.z*dxij.z + force_div2r_ik*dxik.z*dxik.z;
+                                virial[0*virial_pitch+kk] += force_div2r_ij*dxij.x*dxij.x + force_div2r_ik*dxik.x*dxik.x;
+                                virial[1*virial_pitch+kk] += force_div2r_ij*dxij.x*dxij.y + force_div2r_ik*dxik.x*dxik.y;
+                                virial[2*virial_pitch+kk] += force_div2r_ij*dxij.x*dxij.z + force_div2r_ik*dxik.x*dxik.z;
+                                virial[3*virial_pitch+kk] += force_div2r_ij*dxij.y*dxij.y + force_div2r_ik*dxik.y*dxik.y;
+                                virial[4*virial_pitch+kk] += force_div2r_ij*dxij.y*dxij.z + force_div2r_ik*dxik.y*dxik.z;
+                                virial[5*virial_pitch+kk] += force_div2r_ij*dxij.z*dxij.z + force_div2r_ik*dxik.z*dxik.z;
                                 }
                             }
                         }
                     }
+                // increment the force and potential energy for particle j
+                force[jj].x += fj.x;
+                force[jj].y += fj.y;
+                force[jj].z += fj.z;
+                force[jj].w += pej;
+
+                if (compute_virial)
+                    {
+                    virial[0*virial_pitch+jj] += virialj_xx;
+                    virial[1*virial_pitch+jj] += virialj_xy;
+                    virial[2*virial_pitch+jj] += virialj_xz;
+                    virial[3*virial_pitch+jj] += virialj_yy;
+                    virial[4*virial_pitch+jj] += virialj_yz;
+                    virial[5*virial_pitch+jj] += virialj_zz;
+                    }
+                }
+            // finally, increment the force and potential energy for particle i
+            force[i].x += fi.x;
+            force[i].y += fi.y;
+            force[i].z += fi.z;
+            force[i].w += pei;
+
+            if (compute_virial)
+                {
+                virial[0*virial_pitch+i] += viriali_xx;
+                virial[1*virial_pitch+i] += viriali_xy;
+                virial[2*virial_pitch+i] += viriali_xz;
+                virial[3*virial_pitch+i] += viriali_yy;
+                virial[4*virial_pitch+i] += viriali_yz;
+                virial[5*virial_pitch+i] += viriali_zz;
                 }
-            // increment the force and potential energy for particle j
-            unsigned int mem_idx = jj;
-            h_force.data[mem_idx].x += fj.x;
-            h_force.data[mem_idx].y += fj.y;
-            h_force.data[mem_idx].z += fj.z;
-            h_force.data[mem_idx].w += pej;
+            }
+        };
 
+    #ifdef ENABLE_TBB
+    tbb::parallel_for((unsigned int)0, n_chunks, [&](unsigned int chunk)
+    #else
+    for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+    #endif
+        {
+        Scalar4 *force = h_force.data;
+        Scalar *virial = h_virial.data;
+        unsigned int virial_pitch = m_virial_pitch;
+        if (chunk > 0)
+            {
+            force = &m_force_scratch[(chunk-1)*n_all];
+            memset(force, 0, sizeof(Scalar4)*n_all);
+            virial_pitch = n_all;
             if (compute_virial)
                 {
-                h_virial.data[0*m_virial_pitch+mem_idx] += virialj_xx;
-                h_virial.data[1*m_virial_pitch+mem_idx] += virialj_xy;
-                h_virial.data[2*m_virial_pitch+mem_idx] += virialj_xz;
-                h_virial.data[3*m_virial_pitch+mem_idx] += virialj_yy;
-                h_virial.data[4*m_virial_pitch+mem_idx] += virialj_yz;
-                h_virial.data[5*m_virial_pitch+mem_idx] += virialj_zz;
+                virial = &m_virial_scratch[(chunk-1)*6*n_all];
+                memset(virial, 0, sizeof(Scalar)*6*n_all);
                 }
             }
-        // finally, increment the force and potential energy for particle i
-        unsigned int mem_idx = i;
-        h_force.data[mem_idx].x += fi.x;
-        h_force.data[mem_idx].y += fi.y;
-        h_force.data[mem_idx].z += fi.z;
-        h_force.data[mem_idx].w += pei;
-
-        if (compute_virial)
+
+        unsigned int first = (unsigned int)((unsigned long)N*chunk/n_chunks);
+        unsigned int last = (unsigned int)((unsigned long)N*(chunk+1)/n_chunks);
+        compute_range(first, last, force, virial, virial_pitch);
+        }
+    #ifdef ENABLE_TBB
+    );
+    #endif
+
+    // sum up the private arrays in a fixed order
+    if (n_chunks > 1)
+        {
+        #ifdef ENABLE_TBB
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_all),
+            [&](const tbb::blocked_range<unsigned int>& r) {
+        for (unsigned int i = r.begin(); i != r.end(); ++i)
+        #else
+        for (unsigned int i = 0; i < n_all; ++i)
+        #endif
             {
-            h_virial.data[0*m_virial_pitch+mem_idx] += viriali_xx;
-            h_virial.data[1*m_virial_pitch+mem_idx] += viriali_xy;
-            h_virial.data[2*m_virial_pitch+mem_idx] += viriali_xz;
-            h_virial.data[3*m_virial_pitch+mem_idx] += viriali_yy;
-            h_virial.data[4*m_virial_pitch+mem_idx] += viriali_yz;
-            h_virial.data[5*m_virial_pitch+mem_idx] += viriali_zz;
+            for (unsigned int chunk = 1; chunk < n_chunks; ++chunk)
+                {
+                const Scalar4& f = m_force_scratch[(chunk-1)*n_all + i];
+                h_force.data[i].x += f.x;
+                h_force.data[i].y += f.y;
+                h_force.data[i].z += f.z;
+                h_force.data[i].w += f.w;
+
+                if (compute_virial)
+                    {
+                    for (unsigned int l = 0; l < 6; ++l)
+                        h_virial.data[l*m_virial_pitch+i] += m_virial_scratch[((chunk-1)*6+l)*n_all + i];
+                    }
+                }
             }
+        #ifdef ENABLE_TBB
+            });
+        #endif
         }
 
     if (m_prof) m_prof->pop();
@@ -58,6 +58,7 @@ TableAngleForceCompute::TableAngleForceCompute(std::shared_ptr<SystemDefinition>
     // allocate storage for the tables and parameters
     GPUArray<Scalar2> tables(m_table_width, m_angle_data->getNTypes(), m_exec_conf);
     m_tables.swap(tables);
+    m_spline_tables.resize(m_angle_data->getNTypes());
     assert(!m_tables.isNull());
 
     // helper to compute indices
@@ -107,6 +108,38 @@ void TableAngleForceCompute::setTable(unsigned int type,
         h_tables.data[m_table_value(i, type)].x = V[i];
         h_tables.data[m_table_value(i, type)].y = T[i];
         }
+
+    // the linear table replaces any spline table for this type
+    m_spline_tables[type] = HermiteTable();
+    }
+
+/*! \param type Type of the angle to set parameters for
+    \param theta Knot positions, strictly increasing from 0 to pi
+    \param V Potential at the knots
+    \param T Torque at the knots (must be - dV / dtheta)
+    \post Angles of this type are evaluated with a cubic Hermite spline on the given knots
+*/
+void TableAngleForceCompute::setSplineTable(unsigned int type,
+                                    const std::vector<Scalar> &theta,
+                                    const std::vector<Scalar> &V,
+                                    const std::vector<Scalar> &T)
+    {
+    // make sure the type is valid
+    if (type >= m_angle_data->getNTypes())
+        {
+        m_exec_conf->msg->error() << "angle.table: Invalid angle type specified" << endl;
+        throw runtime_error("Error setting parameters in TableAngleForceCompute");
+        }
+
+    if (!HermiteTable::validate(theta, V, T) || fabs(theta.front()) > Scalar(1e-6)
+        || fabs(theta.back() - Scalar(M_PI)) > Scalar(1e-6))
+        {
+        m_exec_conf->msg->error() << "angle.table: spline knots must be strictly increasing from 0 to pi, with "
+                                  << "one value of V and T per knot" << endl;
+        throw runtime_error("Error initializing TableAngleForceCompute");
+        }
+
+    m_spline_tables[type].set(theta, V, T);
     }
 
 /*! TableAngleForceCompute provides
@@ -147,13 +180,11 @@ void TableAngleForceCompute::computeForces(unsigned int timestep)
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_force(m_force,access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar> h_virial(m_virial,access_location::host, access_mode::overwrite);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
 
     // there are enough other checks on the input data: but it doesn't hurt to be safe
     assert(h_force.data);
     assert(h_virial.data);
     assert(h_pos.data);
-    assert(h_rtag.data);
 
     unsigned int virial_pitch = m_virial.getPitch();
 
@@ -167,29 +198,19 @@ void TableAngleForceCompute::computeForces(unsigned int timestep)
     // access the table data
     ArrayHandle<Scalar2> h_tables(m_tables, access_location::host, access_mode::read);
 
+    // the index table holds the angles with their members translated to particle indices, ordered for locality
+    ArrayHandle<AngleData::members_t> h_angles(m_angle_data->getIndexTable(), access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_angle_data->getIndexTableTypeVal(), access_location::host, access_mode::read);
+
     // for each of the angles
     const unsigned int size = (unsigned int)m_angle_data->getN();
     for (unsigned int i = 0; i < size; i++)
         {
-        // lookup the tag of each of the particles participating in the angle
-        const AngleData::members_t& angle = m_angle_data->getMembersByIndex(i);
-        assert(angle.tag[0] <= m_pdata->getMaximumTag());
-        assert(angle.tag[1] <= m_pdata->getMaximumTag());
-        assert(angle.tag[2] <= m_pdata->getMaximumTag());
-
-        // transform a, b, and c into indicies into the particle data arrays
-        // MEM TRANSFER: 6 ints
-        unsigned int idx_a = h_rtag.data[angle.tag[0]];
-        unsigned int idx_b = h_rtag.data[angle.tag[1]];
-        unsigned int idx_c = h_rtag.data[angle.tag[2]];
-
-        // throw an error if this angle is incomplete
-        if (idx_a == NOT_LOCAL|| idx_b == NOT_LOCAL || idx_c == NOT_LOCAL)
-            {
-            this->m_exec_conf->msg->error() << "angle.table: angle " <<
-                angle.tag[0] << " " << angle.tag[1] << " " << angle.tag[2] << " incomplete." << endl << endl;
-            throw std::runtime_error("Error in angle calculation");
-            }
+        // lookup the index of each of the particles participating in the angle
+        const AngleData::members_t& angle = h_angles.data[i];
+        unsigned int idx_a = angle.idx[0];
+        unsigned int idx_b = angle.idx[1];
+        unsigned int idx_c = angle.idx[2];
 
         assert(idx_a < m_pdata->getN()+m_pdata->getNGhosts());
         assert(idx_b < m_pdata->getN()+m_pdata->getNGhosts());
@@ -240,28 +261,36 @@ void TableAngleForceCompute::computeForces(unsigned int timestep)
         //theta
         Scalar theta = acos(c_abbc);
 
-        // precomputed term
-        Scalar value_f = theta / delta_th;
-
-        // compute index into the table and read in values
-
-        /// Here we use the table!!
-        unsigned int angle_type = m_angle_data->getTypeByIndex(i);
-        unsigned int value_i = floor(value_f);
-        Scalar2 VT0 = h_tables.data[m_table_value(value_i, angle_type)];
-        Scalar2 VT1 = h_tables.data[m_table_value(value_i+1, angle_type)];
-        // unpack the data
-        Scalar V0 = VT0.x;
-        Scalar V1 = VT1.x;
-        Scalar T0 = VT0.y;
-        Scalar T1 = VT1.y;
-
-        // compute the linear interpolation coefficient
-        Scalar f = value_f - Scalar(value_i);
-
-        // interpolate to get V and T;
-        Scalar V = V0 + f * (V1 - V0);
-        Scalar T = T0 + f * (T1 - T0);
+        unsigned int angle_type = h_typeval.data[i].type;
+        Scalar V, T;
+        if (m_spline_tables[angle_type].isSet())
+            {
+            m_spline_tables[angle_type].evaluate(theta, V, T);
+            }
+        else
+            {
+            // precomputed term
+            Scalar value_f = theta / delta_th;
+
+            // compute index into the table and read in values
+
+            /// Here we use the table!!
+            unsigned int value_i = floor(value_f);
+            Scalar2 VT0 = h_tables.data[m_table_value(value_i, angle_type)];
+            Scalar2 VT1 = h_tables.data[m_table_value(value_i+1, angle_type)];
+            // unpack the data
+            Scalar V0 = VT0.x;
+            Scalar V1 = VT1.x;
+            Scalar T0 = VT0.y;
+            Scalar T1 = VT1.y;
+
+            // compute the linear interpolation coefficient
+            Scalar f = value_f - Scalar(value_i);
+
+            // interpolate to get V and T;
+            V = V0 + f * (V1 - V0);
+            T = T0 + f * (T1 - T0);
+            }
 
         Scalar a =  T*s_abbc;
         Scalar a11 = a*c_abbc/rsqab;
@@ -333,5 +362,6 @@ void export_TableAngleForceCompute(py::module& m)
     py::class_<TableAngleForceCompute, std::shared_ptr<TableAngleForceCompute> >(m, "TableAngleForceCompute", py::base<ForceCompute>())
     .def(py::init< std::shared_ptr<SystemDefinition>, unsigned int, const std::string& >())
     .def("setTable", &TableAngleForceCompute::setTable)
+    .def("setSplineTable", &TableAngleForceCompute::setSplineTable)
     ;
     }
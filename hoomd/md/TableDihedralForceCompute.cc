@@ -49,6 +49,7 @@ TableDihedralForceCompute::TableDihedralForceCompute(std::shared_ptr<SystemDefin
     // allocate storage for the tables and parameters
     GPUArray<Scalar2> tables(m_table_width, m_dihedral_data->getNTypes(), m_exec_conf);
     m_tables.swap(tables);
+    m_spline_tables.resize(m_dihedral_data->getNTypes());
     assert(!m_tables.isNull());
 
     // helper to compute indices
@@ -96,6 +97,38 @@ void TableDihedralForceCompute::setTable(unsigned int type,
         h_tables.data[m_table_value(i, type)].x = V[i];
         h_tables.data[m_table_value(i, type)].y = T[i];
         }
+
+    // the linear table replaces any spline table for this type
+    m_spline_tables[type] = HermiteTable();
+    }
+
+/*! \param type Type of the dihedral to set parameters for
+    \param phi Knot positions, strictly increasing from -pi to pi
+    \param V Potential at the knots
+    \param T Torque at the knots (must be - dV / dphi)
+    \post Dihedrals of this type are evaluated with a cubic Hermite spline on the given knots
+*/
+void TableDihedralForceCompute::setSplineTable(unsigned int type,
+                                    const std::vector<Scalar> &phi,
+                                    const std::vector<Scalar> &V,
+                                    const std::vector<Scalar> &T)
+    {
+    // make sure the type is valid
+    if (type >= m_dihedral_data->getNTypes())
+        {
+        m_exec_conf->msg->error() << "dihedral.table: Invalid dihedral type specified" << endl;
+        throw runtime_error("Error setting parameters in TableDihedralForceCompute");
+        }
+
+    if (!HermiteTable::validate(phi, V, T) || fabs(phi.front() + Scalar(M_PI)) > Scalar(1e-6)
+        || fabs(phi.back() - Scalar(M_PI)) > Scalar(1e-6))
+        {
+        m_exec_conf->msg->error() << "dihedral.table: spline knots must be strictly increasing from -pi to pi, with "
+                                  << "one value of V and T per knot" << endl;
+        throw runtime_error("Error initializing TableDihedralForceCompute");
+        }
+
+    m_spline_tables[type].set(phi, V, T);
     }
 
 /*! TableDihedralForceCompute provides
@@ -136,7 +169,6 @@ void TableDihedralForceCompute::computeForces(unsigned int timestep)
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_force(m_force,access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar> h_virial(m_virial,access_location::host, access_mode::overwrite);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
 
 
     // there are enough other checks on the input data: but it doesn't hurt to be safe
@@ -156,32 +188,20 @@ void TableDihedralForceCompute::computeForces(unsigned int timestep)
     // access the table data
     ArrayHandle<Scalar2> h_tables(m_tables, access_location::host, access_mode::read);
 
+    // the index table holds the dihedrals with their members translated to particle indices, ordered for locality
+    ArrayHandle<DihedralData::members_t> h_dihedrals(m_dihedral_data->getIndexTable(), access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_dihedral_data->getIndexTableTypeVal(), access_location::host, access_mode::read);
+
     // for each of the dihedrals
     const unsigned int size = (unsigned int)m_dihedral_data->getN();
     for (unsigned int i = 0; i < size; i++)
         {
-        // lookup the tag of each of the particles participating in the dihedral
-        const DihedralData::members_t& dihedral = m_dihedral_data->getMembersByIndex(i);
-        assert(dihedral.tag[0] <= m_pdata->getMaximumTag());
-        assert(dihedral.tag[1] <= m_pdata->getMaximumTag());
-        assert(dihedral.tag[2] <= m_pdata->getMaximumTag());
-        assert(dihedral.tag[3] <= m_pdata->getMaximumTag());
-
-        // transform a and b into indicies into the particle data arrays
-        // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[dihedral.tag[0]];
-        unsigned int idx_b = h_rtag.data[dihedral.tag[1]];
-        unsigned int idx_c = h_rtag.data[dihedral.tag[2]];
-        unsigned int idx_d = h_rtag.data[dihedral.tag[3]];
-
-        // throw an error if this angle is incomplete
-        if (idx_a == NOT_LOCAL|| idx_b == NOT_LOCAL || idx_c == NOT_LOCAL || idx_d == NOT_LOCAL)
-            {
-            this->m_exec_conf->msg->error() << "dihedral.harmonic: dihedral " <<
-                dihedral.tag[0] << " " << dihedral.tag[1] << " " << dihedral.tag[2] << " " << dihedral.tag[3]
-                << " incomplete." << endl << endl;
-            throw std::runtime_error("Error in dihedral calculation");
-            }
+        // lookup the index of each of the particles participating in the dihedral
+        const DihedralData::members_t& dihedral = h_dihedrals.data[i];
+        unsigned int idx_a = dihedral.idx[0];
+        unsigned int idx_b = dihedral.idx[1];
+        unsigned int idx_c = dihedral.idx[2];
+        unsigned int idx_d = dihedral.idx[3];
 
         assert(idx_a < m_pdata->getN()+m_pdata->getNGhosts());
         assert(idx_b < m_pdata->getN()+m_pdata->getNGhosts());
@@ -269,29 +289,37 @@ void TableDihedralForceCompute::computeForces(unsigned int timestep)
         Scalar phi = acos(c);
         if (det < 0) phi = -phi;
 
-        // precomputed term
-        Scalar delta_phi = Scalar(2.0*M_PI)/Scalar(m_table_width - 1);
-        Scalar value_f = (Scalar(M_PI)+phi) / delta_phi;
-
-        // compute index into the table and read in values
-
-        /// Here we use the table!!
-        unsigned int dihedral_type = m_dihedral_data->getTypeByIndex(i);
-        unsigned int value_i = value_f;
-        Scalar2 VT0 = h_tables.data[m_table_value(value_i, dihedral_type)];
-        Scalar2 VT1 = h_tables.data[m_table_value(value_i+1, dihedral_type)];
-        // unpack the data
-        Scalar V0 = VT0.x;
-        Scalar V1 = VT1.x;
-        Scalar T0 = VT0.y;
-        Scalar T1 = VT1.y;
-
-        // compute the linear interpolation coefficient
-        Scalar f = value_f - Scalar(value_i);
-
-        // interpolate to get V and T;
-        Scalar V = V0 + f * (V1 - V0);
-        Scalar T = T0 + f * (T1 - T0);
+        unsigned int dihedral_type = h_typeval.data[i].type;
+        Scalar V, T;
+        if (m_spline_tables[dihedral_type].isSet())
+            {
+            m_spline_tables[dihedral_type].evaluate(phi, V, T);
+            }
+        else
+            {
+            // precomputed term
+            Scalar delta_phi = Scalar(2.0*M_PI)/Scalar(m_table_width - 1);
+            Scalar value_f = (Scalar(M_PI)+phi) / delta_phi;
+
+            // compute index into the table and read in values
+
+            /// Here we use the table!!
+            unsigned int value_i = value_f;
+            Scalar2 VT0 = h_tables.data[m_table_value(value_i, dihedral_type)];
+            Scalar2 VT1 = h_tables.data[m_table_value(value_i+1, dihedral_type)];
+            // unpack the data
+            Scalar V0 = VT0.x;
+            Scalar V1 = VT1.x;
+            Scalar T0 = VT0.y;
+            Scalar T1 = VT1.y;
+
+            // compute the linear interpolation coefficient
+            Scalar f = value_f - Scalar(value_i);
+
+            // interpolate to get V and T;
+            V = V0 + f * (V1 - V0);
+            T = T0 + f * (T1 - T0);
+            }
 
         // from Blondel and Karplus 1995
         vec3<Scalar> A = cross(vec3<Scalar>(dab),vec3<Scalar>(dcbm));
@@ -358,6 +386,7 @@ void export_TableDihedralForceCompute(py::module& m)
     py::class_<TableDihedralForceCompute, std::shared_ptr<TableDihedralForceCompute> >(m, "TableDihedralForceCompute", py::base<ForceCompute>())
     .def(py::init< std::shared_ptr<SystemDefinition>, unsigned int, const std::string& >())
     .def("setTable", &TableDihedralForceCompute::setTable)
+    .def("setSplineTable", &TableDihedralForceCompute::setSplineTable)
     .def("getEntry", &TableDihedralForceCompute::getEntry)
     ;
     }
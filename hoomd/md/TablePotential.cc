@@ -48,6 +48,7 @@ TablePotential::TablePotential(std::shared_ptr<SystemDefinition> sysdef,
     m_tables.swap(tables);
     GPUArray<Scalar4> params(table_index.getNumElements(), m_exec_conf);
     m_params.swap(params);
+    m_spline_tables.resize(table_index.getNumElements());
 
     assert(!m_tables.isNull());
     assert(!m_params.isNull());
@@ -83,6 +84,7 @@ void TablePotential::slotNumTypesChange()
     m_tables.swap(tables);
     GPUArray<Scalar4> params(table_index.getNumElements(), m_exec_conf);
     m_params.swap(params);
+    m_spline_tables.assign(table_index.getNumElements(), HermiteTable());
 
     assert(!m_tables.isNull());
     assert(!m_params.isNull());
@@ -138,6 +140,38 @@ void TablePotential::setTable(unsigned int typ1,
         h_tables.data[table_value(i, cur_table_index)].x = V[i];
         h_tables.data[table_value(i, cur_table_index)].y = F[i];
         }
+
+    // the linear table replaces any spline table for this pair
+    m_spline_tables[cur_table_index] = HermiteTable();
+    }
+
+/*! \param typ1 First particle type index in the pair to set
+    \param typ2 Second particle type index in the pair to set
+    \param r Knot positions, strictly increasing
+    \param V Potential at the knots
+    \param F Force at the knots (must be - dV / dr)
+    \post The pair (typ1, typ2) is evaluated with a cubic Hermite spline between r[0] and the last knot
+*/
+void TablePotential::setSplineTable(unsigned int typ1,
+                                    unsigned int typ2,
+                                    const std::vector<Scalar> &r,
+                                    const std::vector<Scalar> &V,
+                                    const std::vector<Scalar> &F)
+    {
+    if (!HermiteTable::validate(r, V, F) || r.front() < 0)
+        {
+        m_exec_conf->msg->error() << "pair.table: spline knots must be non-negative and strictly increasing, with "
+                                  << "one value of V and F per knot" << endl;
+        throw runtime_error("Error initializing TablePotential");
+        }
+
+    unsigned int cur_table_index = Index2DUpperTriangular(m_ntypes)(typ1, typ2);
+    m_spline_tables[cur_table_index].set(r, V, F);
+
+    // keep the range in the parameters consistent with the spline
+    ArrayHandle<Scalar4> h_params(m_params, access_location::host, access_mode::readwrite);
+    h_params.data[cur_table_index].x = r.front();
+    h_params.data[cur_table_index].y = r.back();
     }
 
 /*! TablePotential provides
@@ -259,6 +293,7 @@ void TablePotential::computeForces(unsigned int timestep)
             Scalar rmin = params.x;
             Scalar rmax = params.y;
             Scalar delta_r = params.z;
+            const HermiteTable& spline = m_spline_tables[cur_table_index];
 
             // start computing the force
             Scalar rsq = dot(dx, dx);
@@ -267,25 +302,33 @@ void TablePotential::computeForces(unsigned int timestep)
             // only compute the force if the particles are within the region defined by V
             if (r < rmax && r >= rmin)
                 {
-                // precomputed term
-                Scalar value_f = (r - rmin) / delta_r;
-
-                // compute index into the table and read in values
-                unsigned int value_i = (unsigned int)floor(value_f);
-                Scalar2 VF0 = h_tables.data[table_value(value_i, cur_table_index)];
-                Scalar2 VF1 = h_tables.data[table_value(value_i+1, cur_table_index)];
-                // unpack the data
-                Scalar V0 = VF0.x;
-                Scalar V1 = VF1.x;
-                Scalar F0 = VF0.y;
-                Scalar F1 = VF1.y;
-
-                // compute the linear interpolation coefficient
-                Scalar f = value_f - Scalar(value_i);
-
-                // interpolate to get V and F;
-                Scalar V = V0 + f * (V1 - V0);
-                Scalar F = F0 + f * (F1 - F0);
+                Scalar V, F;
+                if (spline.isSet())
+                    {
+                    spline.evaluate(r, V, F);
+                    }
+                else
+                    {
+                    // precomputed term
+                    Scalar value_f = (r - rmin) / delta_r;
+
+                    // compute index into the table and read in values
+                    unsigned int value_i = (unsigned int)floor(value_f);
+                    Scalar2 VF0 = h_tables.data[table_value(value_i, cur_table_index)];
+                    Scalar2 VF1 = h_tables.data[table_value(value_i+1, cur_table_index)];
+                    // unpack the data
+                    Scalar V0 = VF0.x;
+                    Scalar V1 = VF1.x;
+                    Scalar F0 = VF0.y;
+                    Scalar F1 = VF1.y;
+
+                    // compute the linear interpolation coefficient
+                    Scalar f = value_f - Scalar(value_i);
+
+                    // interpolate to get V and F;
+                    V = V0 + f * (V1 - V0);
+                    F = F0 + f * (F1 - F0);
+                    }
 
                 // convert to standard variables used by the other pair computes in HOOMD-blue
                 Scalar forcemag_divr = Scalar(0.0);
@@ -348,5 +391,6 @@ void export_TablePotential(py::module& m)
     py::class_<TablePotential, std::shared_ptr<TablePotential> >(m, "TablePotential", py::base<ForceCompute>())
     .def(py::init< std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>, unsigned int, const std::string& >())
     .def("setTable", &TablePotential::setTable)
+    .def("setSplineTable", &TablePotential::setSplineTable)
     ;
     }
@@ -8,6 +8,7 @@
 #include "NeighborList.h"
 #include "hoomd/Index1D.h"
 #include "hoomd/GPUArray.h"
+#include "HermiteTable.h"
 
 #include <memory>
 
@@ -56,6 +57,10 @@
     Values are interpolated linearly between two points straddling the given r. For a given r, the first point needed, i
     can be calculated via i = floorf((r - rmin) / dr). The fraction between ri and ri+1 can be calculated via
     f = (r - rmin) / dr - Scalar(i). And the linear interpolation can then be performed via V(r) ~= Vi + f * (Vi+1 - Vi)
+
+    Alternatively, a type pair can be given a HermiteTable with setSplineTable(). It interpolates V with cubic
+    Hermite splines on knots that may be spaced unevenly and that can differ in number between type pairs. The
+    range of the spline table replaces rmin and rmax for that pair. Spline tables are only evaluated on the CPU.
     \ingroup computes
 */
 class PYBIND11_EXPORT TablePotential : public ForceCompute
@@ -78,6 +83,13 @@ class PYBIND11_EXPORT TablePotential : public ForceCompute
                               Scalar rmin,
                               Scalar rmax);
 
+        //! Set a cubic Hermite spline table for a given type pair
+        virtual void setSplineTable(unsigned int typ1,
+                                    unsigned int typ2,
+                                    const std::vector<Scalar> &r,
+                                    const std::vector<Scalar> &V,
+                                    const std::vector<Scalar> &F);
+
         //! Returns a list of log quantities this compute calculates
         virtual std::vector< std::string > getProvidedLogQuantities();
 
@@ -90,6 +102,7 @@ class PYBIND11_EXPORT TablePotential : public ForceCompute
         unsigned int m_ntypes;                      //!< Store the number of particle types
         GPUArray<Scalar2> m_tables;                  //!< Stored V and F tables
         GPUArray<Scalar4> m_params;                 //!< Parameters stored for each table
+        std::vector<HermiteTable> m_spline_tables;  //!< Spline tables, used instead of m_tables when set
         std::string m_log_name;                     //!< Cached log name
 
         //! Actually compute the forces
@@ -9,7 +9,7 @@
 #include "QuaternionMath.h"
 #include "hoomd/HOOMDMath.h"
 
-#include "hoomd/Saru.h"
+#include "hoomd/Philox.h"
 using namespace hoomd;
 
 
@@ -71,22 +71,24 @@ void TwoStepBD::integrateStepOne(unsigned int timestep)
     const Scalar currentTemp = m_T->getValue(timestep);
     const unsigned int D = Scalar(m_sysdef->getNDimensions());
 
+    // block 0: random force, block 1: velocity, block 2: random torque, block 3: angular momentum
+    drawRandomBlocks(hoomd::detail::PhiloxStream::TwoStepBD, timestep, m_aniso ? 4 : 2);
+
     const GPUArray< Scalar4 >& net_force = m_pdata->getNetForce();
     ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
     ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
-    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar4> h_net_force(net_force, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_gamma(m_gamma, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar> h_gamma_r(m_gamma_r, access_location::host, access_mode::read);
-    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(m_aniso), access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar4> h_torque(m_pdata->getNetTorqueArray(), access_location::host, access_mode::readwrite);
 
-    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(), access_location::host, access_mode::readwrite);
-    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(m_aniso), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(m_aniso), access_location::host, access_mode::read);
 
     const BoxDim& box = m_pdata->getBox();
 
@@ -96,15 +98,12 @@ void TwoStepBD::integrateStepOne(unsigned int timestep)
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
         {
         unsigned int j = m_group->getMemberIndex(group_idx);
-        unsigned int ptag = h_tag.data[j];
-
-        // Initialize the RNG
-        detail::Saru saru(ptag, timestep, m_seed);
 
         // compute the random force
-        Scalar rx = saru.s<Scalar>(-1,1);
-        Scalar ry = saru.s<Scalar>(-1,1);
-        Scalar rz = saru.s<Scalar>(-1,1);
+        const uint4& noise = m_rng_blocks[group_idx];
+        Scalar rx = hoomd::detail::philox_uniform<Scalar>(noise.x, -1, 1);
+        Scalar ry = hoomd::detail::philox_uniform<Scalar>(noise.y, -1, 1);
+        Scalar rz = hoomd::detail::philox_uniform<Scalar>(noise.z, -1, 1);
 
         Scalar gamma;
         if (m_use_lambda)
@@ -138,10 +137,12 @@ void TwoStepBD::integrateStepOne(unsigned int timestep)
         // draw a new random velocity for particle j
         Scalar mass =  h_vel.data[j].w;
         Scalar sigma = fast::sqrt(currentTemp/mass);
-        h_vel.data[j].x = gaussian_rng(saru, sigma);
-        h_vel.data[j].y = gaussian_rng(saru, sigma);
+        Scalar normal[4];
+        hoomd::detail::philox_normal4(m_rng_blocks[group_size + group_idx], normal);
+        h_vel.data[j].x = normal[0]*sigma;
+        h_vel.data[j].y = normal[1]*sigma;
         if (D > 2)
-            h_vel.data[j].z = gaussian_rng(saru, sigma);
+            h_vel.data[j].z = normal[2]*sigma;
         else
             h_vel.data[j].z = 0;
 
@@ -167,9 +168,10 @@ void TwoStepBD::integrateStepOne(unsigned int timestep)
                 // original Gaussian random torque
                 // Gaussian random distribution is preferred in terms of preserving the exact math
                 vec3<Scalar> bf_torque;
-                bf_torque.x = gaussian_rng(saru, sigma_r);
-                bf_torque.y = gaussian_rng(saru, sigma_r);
-                bf_torque.z = gaussian_rng(saru, sigma_r);
+                hoomd::detail::philox_normal4(m_rng_blocks[2*group_size + group_idx], normal);
+                bf_torque.x = normal[0]*sigma_r;
+                bf_torque.y = normal[1]*sigma_r;
+                bf_torque.z = normal[2]*sigma_r;
 
                 if (x_zero) bf_torque.x = 0;
                 if (y_zero) bf_torque.y = 0;
@@ -194,9 +196,10 @@ void TwoStepBD::integrateStepOne(unsigned int timestep)
                 h_orientation.data[j] = quat_to_scalar4(q);
 
                 // draw a new random ang_mom for particle j in body frame
-                p_vec.x = gaussian_rng(saru, fast::sqrt(currentTemp * I.x));
-                p_vec.y = gaussian_rng(saru, fast::sqrt(currentTemp * I.y));
-                p_vec.z = gaussian_rng(saru, fast::sqrt(currentTemp * I.z));
+                hoomd::detail::philox_normal4(m_rng_blocks[3*group_size + group_idx], normal);
+                p_vec.x = normal[0]*fast::sqrt(currentTemp * I.x);
+                p_vec.y = normal[1]*fast::sqrt(currentTemp * I.y);
+                p_vec.z = normal[2]*fast::sqrt(currentTemp * I.z);
                 if (x_zero) p_vec.x = 0;
                 if (y_zero) p_vec.y = 0;
                 if (z_zero) p_vec.z = 0;
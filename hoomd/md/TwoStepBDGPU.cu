@@ -8,7 +8,7 @@
 #include "hoomd/VectorMath.h"
 #include "hoomd/HOOMDMath.h"
 
-#include "hoomd/Saru.h"
+#include "hoomd/Philox.h"
 using namespace hoomd;
 
 #include <assert.h>
@@ -50,8 +50,9 @@ extern __shared__ Scalar s_gammas[];
 
     This kernel is implemented in a very similar manner to gpu_nve_step_one_kernel(), see it for design details.
 
-    Random number generation is done per thread with Saru's 3-seed constructor. The seeds are, the time step,
-    the particle tag, and the user-defined seed.
+    Random number generation is done per thread with the counter-based Philox generator, keyed by the user-defined
+    seed, the particle tag and the time step. The kernel draws the same integer blocks as TwoStepBD, but the device log, sin and cos may
+    round the normal numbers differently in the last bits.
 
     This kernel must be launched with enough dynamic shared memory per block to read in d_gamma
 */
@@ -120,10 +121,13 @@ void gpu_brownian_step_one_kernel(Scalar4 *d_pos,
         unsigned int ptag = d_tag[idx];
 
         // compute the random force
-        detail::Saru saru(ptag, timestep, seed);
-        Scalar rx = saru.s<Scalar>(-1,1);
-        Scalar ry = saru.s<Scalar>(-1,1);
-        Scalar rz =  saru.s<Scalar>(-1,1);
+        // block 0: random force, block 1: velocity, block 2: random torque, block 3: angular momentum
+        detail::PhiloxRNG rng(detail::PhiloxStream::TwoStepBD, seed, ptag, 0, timestep);
+        Scalar random[4];
+        rng.uniform4(random, Scalar(-1), Scalar(1));
+        Scalar rx = random[0];
+        Scalar ry = random[1];
+        Scalar rz = random[2];
 
         // calculate the magnitude of the random force
         Scalar gamma;
@@ -162,10 +166,12 @@ void gpu_brownian_step_one_kernel(Scalar4 *d_pos,
         // draw a new random velocity for particle j
         Scalar mass = vel.w;
         Scalar sigma = fast::sqrt(T/mass);
-        vel.x = gaussian_rng(saru, sigma);
-        vel.y = gaussian_rng(saru, sigma);
+        Scalar normal[4];
+        rng.normal4(normal);
+        vel.x = normal[0]*sigma;
+        vel.y = normal[1]*sigma;
         if (D > 2)
-            vel.z = gaussian_rng(saru, sigma);
+            vel.z = normal[2]*sigma;
         else
             vel.z = 0;
 
@@ -199,9 +205,10 @@ void gpu_brownian_step_one_kernel(Scalar4 *d_pos,
                 // original Gaussian random torque
                 // Gaussian random distribution is preferred in terms of preserving the exact math
                 vec3<Scalar> bf_torque;
-                bf_torque.x = gaussian_rng(saru, sigma_r);
-                bf_torque.y = gaussian_rng(saru, sigma_r);
-                bf_torque.z = gaussian_rng(saru, sigma_r);
+                rng.normal4(normal);
+                bf_torque.x = normal[0]*sigma_r;
+                bf_torque.y = normal[1]*sigma_r;
+                bf_torque.z = normal[2]*sigma_r;
 
                 if (x_zero) bf_torque.x = 0;
                 if (y_zero) bf_torque.y = 0;
@@ -224,9 +231,10 @@ void gpu_brownian_step_one_kernel(Scalar4 *d_pos,
                 d_orientation[idx] = quat_to_scalar4(q);
 
                 // draw a new random ang_mom for particle j in body frame
-                p_vec.x = gaussian_rng(saru, fast::sqrt(T * I.x));
-                p_vec.y = gaussian_rng(saru, fast::sqrt(T * I.y));
-                p_vec.z = gaussian_rng(saru, fast::sqrt(T * I.z));
+                rng.normal4(normal);
+                p_vec.x = normal[0]*fast::sqrt(T * I.x);
+                p_vec.y = normal[1]*fast::sqrt(T * I.y);
+                p_vec.z = normal[2]*fast::sqrt(T * I.z);
                 if (x_zero) p_vec.x = 0;
                 if (y_zero) p_vec.y = 0;
                 if (z_zero) p_vec.z = 0;
@@ -5,7 +5,7 @@
 // Maintainer: joaander
 
 #include "TwoStepLangevin.h"
-#include "hoomd/Saru.h"
+#include "hoomd/Philox.h"
 #include "hoomd/VectorMath.h"
 
 #ifdef ENABLE_MPI
@@ -246,19 +246,21 @@ void TwoStepLangevin::integrateStepTwo(unsigned int timestep)
     if (m_prof)
         m_prof->push("Langevin step 2");
 
+    // block 0: random force, block 1: random torque
+    drawRandomBlocks(hoomd::detail::PhiloxStream::TwoStepLangevin, timestep, m_aniso ? 2 : 1);
+
     ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar3> h_accel(m_pdata->getAccelerations(), access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_net_force(net_force, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_gamma(m_gamma, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_gamma_r(m_gamma_r, access_location::host, access_mode::read);
 
-    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
-    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(m_aniso), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(m_aniso), access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar4> h_net_torque(m_pdata->getNetTorqueArray(), access_location::host, access_mode::readwrite);
-    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(m_aniso), access_location::host, access_mode::read);
 
     // grab some initial variables
     const Scalar currentTemp = m_T->getValue(timestep);
@@ -272,16 +274,13 @@ void TwoStepLangevin::integrateStepTwo(unsigned int timestep)
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
         {
         unsigned int j = m_group->getMemberIndex(group_idx);
-        unsigned int ptag = h_tag.data[j];
-
-        // Initialize the RNG
-        detail::Saru saru(ptag, timestep, m_seed);
 
         // first, calculate the BD forces
         // Generate three random numbers
-        Scalar rx = saru.s<Scalar>(-1,1);
-        Scalar ry = saru.s<Scalar>(-1,1);
-        Scalar rz = saru.s<Scalar>(-1,1);
+        const uint4& noise = m_rng_blocks[group_idx];
+        Scalar rx = hoomd::detail::philox_uniform<Scalar>(noise.x, -1, 1);
+        Scalar ry = hoomd::detail::philox_uniform<Scalar>(noise.y, -1, 1);
+        Scalar rz = hoomd::detail::philox_uniform<Scalar>(noise.z, -1, 1);
 
         Scalar gamma;
         if (m_use_lambda)
@@ -342,9 +341,11 @@ void TwoStepLangevin::integrateStepTwo(unsigned int timestep)
                 Scalar sigma_r = fast::sqrt(Scalar(2.0)*gamma_r*currentTemp/m_deltaT);
                 if (m_noiseless_r) sigma_r = Scalar(0.0);
 
-                Scalar rand_x = gaussian_rng(saru, sigma_r);
-                Scalar rand_y = gaussian_rng(saru, sigma_r);
-                Scalar rand_z = gaussian_rng(saru, sigma_r);
+                Scalar normal[4];
+                hoomd::detail::philox_normal4(m_rng_blocks[group_size + group_idx], normal);
+                Scalar rand_x = normal[0]*sigma_r;
+                Scalar rand_y = normal[1]*sigma_r;
+                Scalar rand_z = normal[2]*sigma_r;
 
                 // check for degenerate moment of inertia
                 bool x_zero, y_zero, z_zero;
@@ -7,6 +7,7 @@
 
 
 #include "TwoStepLangevinBase.h"
+#include "hoomd/Philox.h"
 
 #ifdef ENABLE_MPI
 #include "hoomd/HOOMDMPI.h"
@@ -100,6 +101,31 @@ void TwoStepLangevinBase::slotNumTypesChange()
         }
     }
 
+/*! \param stream Identifier of the integration method drawing the numbers
+    \param timestep Current time step
+    \param n_blocks Number of blocks to draw for each group member
+
+    Block b of the group member with index group_idx is stored at m_rng_blocks[b*group_size + group_idx]. It is the
+    same block that hoomd::detail::PhiloxRNG(stream, m_seed, tag, 0, timestep) draws after b calls to block(), so it
+    does not depend on the number of ranks or on the order of the particles. Drawing all blocks in one pass keeps the
+    generator out of the integration loop, where it could not be vectorized.
+*/
+void TwoStepLangevinBase::drawRandomBlocks(unsigned int stream, unsigned int timestep, unsigned int n_blocks)
+    {
+    const unsigned int group_size = m_group->getNumMembers();
+
+    m_rng_tags.resize(group_size);
+    m_rng_blocks.resize(n_blocks*group_size);
+
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+        m_rng_tags[group_idx] = h_tag.data[m_group->getMemberIndex(group_idx)];
+
+    for (unsigned int b = 0; b < n_blocks; b++)
+        hoomd::detail::philox_generate(m_rng_blocks.data() + b*group_size, stream, m_seed, m_rng_tags.data(),
+                                       group_size, 0, timestep, b);
+    }
+
 /*! \param typ Particle type to set gamma for
     \param gamma The gamma value to set
 */
@@ -19,6 +19,7 @@
 #endif
 
 #include <hoomd/extern/pybind/include/pybind11/pybind11.h>
+#include <vector>
 
 //! Base class for Langevin equation based integration method
 /*! HOOMD implements Langevin dynamics and Brownian dynamics. Both are based on the same equation of motion, but the
@@ -60,6 +61,12 @@ class PYBIND11_EXPORT TwoStepLangevinBase : public IntegrationMethodTwoStep
         GPUVector<Scalar> m_gamma;        //!< List of per type gammas to use
         GPUVector<Scalar> m_gamma_r;      //!< List of per type gamma_r (for 2D-only rotational noise) to use
 
+        std::vector<unsigned int> m_rng_tags; //!< Tags of the group members, which identify their random streams
+        std::vector<uint4> m_rng_blocks;  //!< Random blocks of the group members, block-major
+
+        //! Draw the first n_blocks random blocks of every group member in bulk
+        void drawRandomBlocks(unsigned int stream, unsigned int timestep, unsigned int n_blocks);
+
         //! Method to be called when number of types changes
         virtual void slotNumTypesChange();
     };
@@ -6,7 +6,7 @@
 
 #include "TwoStepLangevinGPU.cuh"
 
-#include "hoomd/Saru.h"
+#include "hoomd/Philox.h"
 using namespace hoomd;
 
 #include <assert.h>
@@ -49,8 +49,9 @@ extern __shared__ Scalar bdtally_sdata[];
 
     This kernel will tally the energy transfer from the bd thermal reservoir and the particle system
 
-    Random number generation is done per thread with Saru's 3-seed constructor. The seeds are, the time step,
-    the particle tag, and the user-defined seed.
+    Random number generation is done per thread with the counter-based Philox generator, keyed by the user-defined
+    seed, the particle tag and the time step. The kernel draws the same integer blocks as TwoStepLangevin, but the device log, sin and cos may
+    round the normal numbers differently in the last bits.
 
     This kernel must be launched with enough dynamic shared memory per block to read in d_gamma
 */
@@ -124,12 +125,14 @@ void gpu_langevin_step_two_kernel(const Scalar4 *d_pos,
         if (noiseless_t)
             coeff = Scalar(0.0);
 
-        //Initialize the Random Number Generator and generate the 3 random numbers
-        detail::Saru s(ptag, timestep, seed); // 3 dimensional seeding
+        //Initialize the Random Number Generator and generate the 3 random numbers from block 0
+        detail::PhiloxRNG rng(detail::PhiloxStream::TwoStepLangevin, seed, ptag, 0, timestep);
+        Scalar random[4];
+        rng.uniform4(random, Scalar(-1.0), Scalar(1.0));
 
-        Scalar randomx=s.s<Scalar>(-1.0, 1.0);
-        Scalar randomy=s.s<Scalar>(-1.0, 1.0);
-        Scalar randomz=s.s<Scalar>(-1.0, 1.0);
+        Scalar randomx=random[0];
+        Scalar randomy=random[1];
+        Scalar randomz=random[2];
 
         bd_force.x = randomx*coeff - gamma*vel.x;
         bd_force.y = randomy*coeff - gamma*vel.y;
@@ -307,10 +310,14 @@ __global__ void gpu_langevin_angular_step_two_kernel(
             Scalar sigma_r = fast::sqrt(Scalar(2.0)*gamma_r*T/deltaT);
             if (noiseless_r) sigma_r = Scalar(0.0);
 
-            detail::Saru saru(ptag, timestep, seed); // 3 dimensional seeding
-            Scalar rand_x = gaussian_rng(saru, sigma_r);
-            Scalar rand_y = gaussian_rng(saru, sigma_r);
-            Scalar rand_z = gaussian_rng(saru, sigma_r);
+            // the random torque comes from block 1, after the random force
+            detail::PhiloxRNG rng(detail::PhiloxStream::TwoStepLangevin, seed, ptag, 0, timestep);
+            rng.skip(1);
+            Scalar normal[4];
+            rng.normal4(normal);
+            Scalar rand_x = normal[0]*sigma_r;
+            Scalar rand_y = normal[1]*sigma_r;
+            Scalar rand_z = normal[2]*sigma_r;
 
             // check for zero moment of inertia
             bool x_zero, y_zero, z_zero;
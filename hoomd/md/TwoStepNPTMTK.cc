@@ -494,6 +494,9 @@ void TwoStepNPTMTK::integrateStepTwo(unsigned int timestep)
     Scalar mtk = (nuxx+nuyy+nuzz)/(Scalar)m_ndof;
     Scalar exp_thermo_fac = exp(-Scalar(1.0/2.0)*(xi_trans+mtk)*m_deltaT);
 
+    // kinetic tensor of the updated velocities, handed to the thermo compute to save it a pass over the velocities
+    double kinetic[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
     // perform second half step of NPT integration
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
         {
@@ -524,8 +527,15 @@ void TwoStepNPTMTK::integrateStepTwo(unsigned int timestep)
 
         // store velocity
         h_vel.data[j].x = v.x; h_vel.data[j].y = v.y; h_vel.data[j].z = v.z;
+
+        kinetic[0] += m*v.x*v.x; kinetic[1] += m*v.x*v.y; kinetic[2] += m*v.x*v.z;
+        kinetic[3] += m*v.y*v.y; kinetic[4] += m*v.y*v.z; kinetic[5] += m*v.z*v.z;
         }
 
+    // advanceBarostat() computes the thermodynamic properties at these velocities
+    if (m_thermo_group_t->getGroup() == m_group)
+        m_thermo_group_t->setKineticTensor(timestep+1, kinetic);
+
     if (m_aniso)
         {
         // angular degrees of freedom
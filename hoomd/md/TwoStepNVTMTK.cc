@@ -125,6 +125,9 @@ void TwoStepNVTMTK::integrateStepOne(unsigned int timestep)
     ArrayHandle<Scalar3> h_accel(m_pdata->getAccelerations(), access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
 
+    // kinetic tensor of the updated velocities, handed to the thermo compute to save it a pass over the velocities
+    double kinetic[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
         {
         unsigned int j = m_group->getMemberIndex(group_idx);
@@ -140,6 +143,10 @@ void TwoStepNVTMTK::integrateStepOne(unsigned int timestep)
         // rescale velocity
         v *= m_exp_thermo_fac;
 
+        double mass = h_vel.data[j].w;
+        kinetic[0] += mass*v.x*v.x; kinetic[1] += mass*v.x*v.y; kinetic[2] += mass*v.x*v.z;
+        kinetic[3] += mass*v.y*v.y; kinetic[4] += mass*v.y*v.z; kinetic[5] += mass*v.z*v.z;
+
         pos += m_deltaT * v;
 
         // store updated variables
@@ -163,6 +170,10 @@ void TwoStepNVTMTK::integrateStepOne(unsigned int timestep)
         // wrap the particles around the box
         box.wrap(h_pos.data[j], h_image.data[j]);
         }
+
+    // advanceThermostat() computes the thermodynamic properties at these velocities
+    if (m_thermo->getGroup() == m_group)
+        m_thermo->setKineticTensor(timestep+1, kinetic);
     }
 
     // Integration of angular degrees of freedom using sympletic and
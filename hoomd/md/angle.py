@@ -371,6 +371,11 @@ def _table_eval(theta, V, T, width):
       i = int(round((theta)/dth))
       return (V[i], T[i])
 
+# the table is only evaluated at its own knots, index maps each knot to its row
+def _table_eval_knots(theta, V, T, index):
+      i = index[theta];
+      return (V[i], T[i])
+
 class table(force._force):
     R""" Tabulated angle potential.
 
@@ -378,6 +383,7 @@ class table(force._force):
 
         width (int): Number of points to use to interpolate V and F (see documentation above)
         name (str): Name of the force instance
+        interpolation (str): ``'linear'`` or ``'hermite'``
 
     :py:class:`table` specifies that a tabulated  angle potential should be added to every bonded triple of particles
     in the simulation.
@@ -399,6 +405,12 @@ class table(force._force):
 
     - :math:`T_{\mathrm{user}}(\theta)` and :math:`V_{\mathrm{user}}(\theta)` - evaluated by `func` (see example)
     - coefficients passed to `func` - `coeff` (see example)
+    - grid points - ``knots`` (in radians) - *optional*: defaults to *width* evenly spaced points,
+      only used with ``interpolation='hermite'``
+
+    With ``interpolation='hermite'``, V and T are interpolated with cubic Hermite splines on the grid points, which
+    need not be evenly spaced but must start at :math:`0` and end at :math:`\pi`. See :py:class:`hoomd.md.pair.table`
+    for details. Hermite interpolation is not available on the GPU.
 
     The table *width* is set once when :py:class:`table` is specified. There are two ways to specify the other
     parameters.
@@ -428,9 +440,17 @@ class table(force._force):
         btable.set_from_file('polymer', 'angle.dat')
 
     """
-    def __init__(self, width, name=None):
+    def __init__(self, width, name=None, interpolation='linear'):
         hoomd.util.print_status_line();
 
+        if interpolation not in ['linear', 'hermite']:
+            hoomd.context.msg.error("angle.table: interpolation must be 'linear' or 'hermite'\n");
+            raise ValueError("Error initializing angle.table");
+
+        if interpolation == 'hermite' and hoomd.context.exec_conf.isCUDAEnabled():
+            hoomd.context.msg.error("angle.table: hermite interpolation is not supported on the GPU\n");
+            raise RuntimeError("Error initializing angle.table");
+
         # initialize the base class
         force._force.__init__(self, name);
 
@@ -445,15 +465,36 @@ class table(force._force):
 
         # setup the coefficent matrix
         self.angle_coeff = coeff();
+        self.angle_coeff.set_default_coeff('knots', None);
 
-        # stash the width for later use
+        # stash the width and interpolation for later use
         self.width = width;
+        self.interpolation = interpolation;
 
-    def update_angle_table(self, atype, func, coeff):
+    def update_angle_table(self, atype, func, coeff, knots=None):
         # allocate arrays to store V and F
         Vtable = _hoomd.std_vector_scalar();
         Ttable = _hoomd.std_vector_scalar();
 
+        if self.interpolation == 'hermite':
+            if knots is None:
+                dth = math.pi / float(self.width-1);
+                knots = [dth * i for i in range(0, self.width)];
+
+            if len(knots) < 2 or math.fabs(knots[0]) > 1e-6 or math.fabs(knots[-1] - math.pi) > 1e-6:
+                hoomd.context.msg.error("angle.table: knots must start at 0 and end at pi\n");
+                raise RuntimeError("Error updating angle coefficients");
+
+            thtable = _hoomd.std_vector_scalar();
+            for theta in knots:
+                (V,T) = func(theta, **coeff);
+                thtable.append(theta);
+                Vtable.append(V);
+                Ttable.append(T);
+
+            self.cpp_force.setSplineTable(atype, thtable, Vtable, Ttable);
+            return;
+
         # calculate dth
         dth = math.pi / float(self.width-1);
 
@@ -472,7 +513,7 @@ class table(force._force):
 
     def update_coeffs(self):
         # check that the angle coefficents are valid
-        if not self.angle_coeff.verify(["func", "coeff"]):
+        if not self.angle_coeff.verify(["func", "coeff", "knots"]):
             hoomd.context.msg.error("Not all angle coefficients are set for angle.table\n");
             raise RuntimeError("Error updating angle coefficients");
 
@@ -487,8 +528,9 @@ class table(force._force):
         for i in range(0,ntypes):
             func = self.angle_coeff.get(type_list[i], "func");
             coeff = self.angle_coeff.get(type_list[i], "coeff");
+            knots = self.angle_coeff.get(type_list[i], "knots");
 
-            self.update_angle_table(i, func, coeff);
+            self.update_angle_table(i, func, coeff, knots);
 
     def set_from_file(self, anglename, filename):
         R""" Set a angle pair interaction from a file.
@@ -509,6 +551,8 @@ class table(force._force):
             and that :math:`\delta \theta = \pi/(N-1)`. The table is read
             directly into the grid points used to evaluate :math:`T_{\mathrm{user}}(\theta)` and :math:`V_{\mathrm{user}}(\theta)`.
 
+        With ``interpolation='hermite'``, the theta values are used as the ``knots`` of the angle type. They must increase
+        from 0 to :math:`\pi` (to within 1e-6) but need not be equally spaced, and the file may have any number of rows.
         """
         hoomd.util.print_status_line();
 
@@ -541,6 +585,19 @@ class table(force._force):
             V_table.append(values[1]);
             T_table.append(values[2]);
 
+        if self.interpolation == 'hermite':
+            for i in range(1,len(theta_table)):
+                if theta_table[i] <= theta_table[i-1]:
+                    hoomd.context.msg.error("angle.table: theta must be monotonically increasing\n");
+                    raise RuntimeError("Error reading table file");
+
+            index = {k: i for i, k in enumerate(theta_table)};
+            hoomd.util.quiet_status();
+            self.angle_coeff.set(anglename, func=_table_eval_knots, coeff=dict(V=V_table, T=T_table, index=index),
+                                 knots=theta_table)
+            hoomd.util.unquiet_status();
+            return;
+
         # validate input
         if self.width != len(theta_table):
             hoomd.context.msg.error("angle.table: file must have exactly " + str(self.width) + " rows\n");
@@ -379,12 +379,18 @@ def _table_eval(r, rmin, rmax, V, F, width):
       i = int(round((r - rmin)/dr))
       return (V[i], F[i])
 
+# the table is only evaluated at its own knots, index maps each knot to its row
+def _table_eval_knots(r, rmin, rmax, V, F, index):
+      i = index[r];
+      return (V[i], F[i])
+
 class table(force._force):
     R""" Tabulated bond potential.
 
     Args:
         width (int): Number of points to use to interpolate V and F
         name (str): Name of the potential instance
+        interpolation (str): ``'linear'`` or ``'hermite'``
 
     :py:class:`table` specifies that a tabulated bond potential should be applied between the two particles in each
     defined bond.
@@ -418,6 +424,12 @@ class table(force._force):
     - coefficients passed to `func` - ``coeff`` (see example)
     - :math:`r_{\mathrm{min}}` - ``rmin`` (in distance units)
     - :math:`r_{\mathrm{max}}` - ``rmax`` (in distance units)
+    - grid points - ``knots`` (in distance units) - *optional*: defaults to *width* evenly spaced points,
+      only used with ``interpolation='hermite'``
+
+    With ``interpolation='hermite'``, V and F are interpolated with cubic Hermite splines on the grid points, which
+    need not be evenly spaced. See :py:class:`hoomd.md.pair.table` for details. Hermite interpolation is not
+    available on the GPU.
 
     The table *width* is set once when bond.table is specified.
     There are two ways to specify the other parameters.
@@ -454,9 +466,17 @@ class table(force._force):
         Ensure that ``rmin`` and ``rmax`` cover the range of possible bond lengths. When gpu eror checking is on, a error will
         be thrown if a bond distance is outside than this range.
     """
-    def __init__(self, width, name=None):
+    def __init__(self, width, name=None, interpolation='linear'):
         hoomd.util.print_status_line();
 
+        if interpolation not in ['linear', 'hermite']:
+            hoomd.context.msg.error("bond.table: interpolation must be 'linear' or 'hermite'\n");
+            raise ValueError("Error initializing bond.table");
+
+        if interpolation == 'hermite' and hoomd.context.exec_conf.isCUDAEnabled():
+            hoomd.context.msg.error("bond.table: hermite interpolation is not supported on the GPU\n");
+            raise RuntimeError("Error initializing bond.table");
+
         # initialize the base class
         force._force.__init__(self, name);
 
@@ -471,15 +491,36 @@ class table(force._force):
 
         # setup the coefficent matrix
         self.bond_coeff = coeff();
+        self.bond_coeff.set_default_coeff('knots', None);
 
-        # stash the width for later use
+        # stash the width and interpolation for later use
         self.width = width;
+        self.interpolation = interpolation;
 
-    def update_bond_table(self, btype, func, rmin, rmax, coeff):
+    def update_bond_table(self, btype, func, rmin, rmax, coeff, knots=None):
         # allocate arrays to store V and F
         Vtable = _hoomd.std_vector_scalar();
         Ftable = _hoomd.std_vector_scalar();
 
+        if self.interpolation == 'hermite':
+            if knots is None:
+                dr = (rmax - rmin) / float(self.width-1);
+                knots = [rmin + dr * i for i in range(0, self.width)];
+
+            if len(knots) < 2 or math.fabs(knots[0] - rmin) > 1e-6 or math.fabs(knots[-1] - rmax) > 1e-6:
+                hoomd.context.msg.error("bond.table: knots must start at rmin and end at rmax\n");
+                raise RuntimeError("Error updating bond coefficients");
+
+            rtable = _hoomd.std_vector_scalar();
+            for r in knots:
+                (V,F) = func(r, rmin, rmax, **coeff);
+                rtable.append(r);
+                Vtable.append(V);
+                Ftable.append(F);
+
+            self.cpp_force.setSplineTable(btype, rtable, Vtable, Ftable);
+            return;
+
         # calculate dr
         dr = (rmax - rmin) / float(self.width-1);
 
@@ -498,7 +539,7 @@ class table(force._force):
 
     def update_coeffs(self):
         # check that the bond coefficents are valid
-        if not self.bond_coeff.verify(["func", "rmin", "rmax", "coeff"]):
+        if not self.bond_coeff.verify(["func", "rmin", "rmax", "coeff", "knots"]):
             hoomd.context.msg.error("Not all bond coefficients are set for bond.table\n");
             raise RuntimeError("Error updating bond coefficients");
 
@@ -515,8 +556,9 @@ class table(force._force):
             rmin = self.bond_coeff.get(type_list[i], "rmin");
             rmax = self.bond_coeff.get(type_list[i], "rmax");
             coeff = self.bond_coeff.get(type_list[i], "coeff");
+            knots = self.bond_coeff.get(type_list[i], "knots");
 
-            self.update_bond_table(i, func, rmin, rmax, coeff);
+            self.update_bond_table(i, func, rmin, rmax, coeff, knots);
 
     def set_from_file(self, bondname, filename):
         R""" Set a bond pair interaction from a file.
@@ -539,6 +581,9 @@ class table(force._force):
         The first r value sets ``rmin``, the last sets ``rmax``. Any line with # as the first non-whitespace character is
         is treated as a comment. The ``r`` values must monotonically increase and be equally spaced. The table is read
         directly into the grid points used to evaluate :math:`F_{\mathrm{user}}(r)` and :math:`V_{\mathrm{user}}(r)`.
+
+        With ``interpolation='hermite'``, the ``r`` values must increase but need not be equally spaced, and the file
+        may have any number of rows. They are used as the ``knots`` of the bond type.
         """
         hoomd.util.print_status_line();
 
@@ -571,15 +616,28 @@ class table(force._force):
             V_table.append(values[1]);
             F_table.append(values[2]);
 
+        # extract rmin and rmax
+        rmin_table = r_table[0];
+        rmax_table = r_table[-1];
+
+        if self.interpolation == 'hermite':
+            for i in range(1,len(r_table)):
+                if r_table[i] <= r_table[i-1]:
+                    hoomd.context.msg.error("bond.table: r must be monotonically increasing\n");
+                    raise RuntimeError("Error reading table file");
+
+            index = {k: i for i, k in enumerate(r_table)};
+            hoomd.util.quiet_status();
+            self.bond_coeff.set(bondname, func=_table_eval_knots, rmin=rmin_table, rmax=rmax_table,
+                                coeff=dict(V=V_table, F=F_table, index=index), knots=r_table)
+            hoomd.util.unquiet_status();
+            return;
+
         # validate input
         if self.width != len(r_table):
             hoomd.context.msg.error("bond.table: file must have exactly " + str(self.width) + " rows\n");
             raise RuntimeError("Error reading table file");
 
-        # extract rmin and rmax
-        rmin_table = r_table[0];
-        rmax_table = r_table[-1];
-
         # check for even spacing
         dr = (rmax_table - rmin_table) / float(self.width-1);
         for i in range(0,self.width):
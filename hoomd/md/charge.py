@@ -112,6 +112,7 @@ class pppm(force._force):
 
         # error check flag - must be set to true by set_params in order for the run() to commence
         self.params_set = False;
+        self.alpha = 0.0;
 
         # initialize the short range part of electrostatics
         hoomd.util.quiet_status();
@@ -170,42 +171,12 @@ class pppm(force._force):
         Ly = box.getL().y
         Lz = box.getL().z
 
-        hx = Lx/Nx
-        hy = Ly/Ny
-        hz = Lz/Nz
-
-        gew1 = 0.0
-        kappa = gew1
-        f = diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
-        hmin = min(hx, hy, hz)
-        gew2 = 10.0/hmin
-        kappa = gew2
-        fmid = diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
-
-        if f*fmid >= 0.0:
-            hoomd.context.msg.error("f*fmid >= 0.0\n");
+        try:
+            kappa = find_kappa(Nx, Ny, Nz, Lx, Ly, Lz, N, order, q2, rcut)
+        except RuntimeError as e:
+            hoomd.context.msg.error(str(e) + "\n");
             raise RuntimeError("Cannot compute PPPM");
 
-        if f < 0.0:
-            dgew=gew2-gew1
-            rtb = gew1
-        else:
-            dgew=gew1-gew2
-            rtb = gew2
-
-        ncount = 0
-
-        while math.fabs(dgew) > 0.00001 and fmid != 0.0:
-            dgew *= 0.5
-            kappa = rtb + dgew
-            fmid = diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
-            if fmid <= 0.0:
-                rtb = kappa
-            ncount += 1
-            if ncount > 10000.0:
-                hoomd.context.msg.error("kappa not converging\n");
-                raise RuntimeError("Cannot compute PPPM");
-
         ntypes = hoomd.context.current.system_definition.getParticleData().getNTypes();
         type_list = [];
         for i in range(0,ntypes):
@@ -220,6 +191,125 @@ class pppm(force._force):
         # set the parameters for the appropriate type
         self.cpp_force.setParams(Nx, Ny, Nz, order, kappa, rcut, alpha);
 
+        # store the parameters for tune()
+        self.alpha = alpha;
+
+    def tune(self, rcut, accuracy=1e-4, order=(3,4,5,6,7), max_mesh=512, warmup=0, steps=1000, quiet=False):
+        R""" Choose the PPPM parameters with the shortest run time for a given accuracy.
+
+        Args:
+            rcut (list): Cutoffs for the short-ranged part of the electrostatics calculation to test
+            accuracy (float): Target root mean square error of the electrostatic force (in force units)
+            order (list): Interpolation orders to test
+            max_mesh (int): Maximum number of grid points in any direction
+            warmup (int): Number of time steps to run() before the first candidate
+            steps (int): Number of time steps to run() for each candidate
+            quiet (bool): Quiet the individual run() calls.
+
+        .. versionadded:: 2.4
+
+        For every combination of *rcut* and *order*, :py:meth:`tune()` determines the smallest mesh for which the
+        estimated RMS force error is below *accuracy*, using the same error estimates as :py:meth:`set_params()`. Mesh
+        sizes are restricted to products of the factors 2, 3 and 5, which are fast for FFTs (powers of two in MPI
+        simulations). Each candidate is then benchmarked with three runs of *steps* time steps, and the median TPS is
+        recorded. A report of all candidates is printed, and the fastest parameters are left set for further
+        :py:func:`hoomd.run()` calls.
+
+        The error estimate assumes a homogeneous distribution of charges. An integrator must be set before calling
+        :py:meth:`tune()`. In total, ``warmup + 3*steps*(number of candidates)`` time steps are run.
+
+        Examples::
+
+            pppm.tune(rcut=[2.0, 2.5, 3.0], accuracy=1e-5)
+
+        Returns:
+            (Nx, Ny, Nz, order, rcut) of the fastest candidate
+        """
+        hoomd.util.print_status_line();
+
+        if hoomd.context.current.system_definition.getNDimensions() != 3:
+            hoomd.context.msg.error("System must be 3 dimensional\n");
+            raise RuntimeError("Cannot tune PPPM");
+
+        if accuracy <= 0.0:
+            hoomd.context.msg.error("charge.pppm: accuracy must be positive\n");
+            raise ValueError("Cannot tune PPPM");
+
+        # find the smallest mesh that fulfills the accuracy goal for every combination of rcut and order
+        q2 = self.cpp_force.getQ2Sum();
+        N = hoomd.context.current.system_definition.getParticleData().getNGlobal()
+        box = hoomd.context.current.system_definition.getParticleData().getGlobalBox()
+        L = [box.getL().x, box.getL().y, box.getL().z]
+
+        sizes = fft_mesh_sizes(max_mesh, hoomd.comm.get_num_ranks() > 1)
+
+        candidates = [];
+        for cur_order in order:
+            if cur_order < 1 or cur_order > 7:
+                hoomd.context.msg.error("charge.pppm: Interpolation order has to be between 1 and 7\n");
+                raise ValueError("Cannot tune PPPM");
+
+            for cur_rcut in rcut:
+                for n in sizes:
+                    # use the same grid spacing along all directions
+                    h = max(L)/n
+                    mesh = [min([m for m in sizes if m >= l/h] + [sizes[-1]]) for l in L]
+
+                    try:
+                        kappa = find_kappa(mesh[0], mesh[1], mesh[2], L[0], L[1], L[2], N, cur_order, q2, cur_rcut)
+                    except RuntimeError:
+                        continue
+
+                    error = estimate_error(mesh[0], mesh[1], mesh[2], L[0], L[1], L[2], N, cur_order, kappa, q2,
+                                           cur_rcut)
+                    if error <= accuracy:
+                        candidates.append((mesh[0], mesh[1], mesh[2], cur_order, cur_rcut, error));
+                        break;
+
+        if len(candidates) == 0:
+            hoomd.context.msg.error("charge.pppm: No mesh with at most " + str(max_mesh) +
+                                    " points reaches the requested accuracy\n");
+            raise RuntimeError("Cannot tune PPPM");
+
+        # quiet the tuner starting here so that the user doesn't see all of the parameter set and run calls
+        hoomd.util.quiet_status();
+
+        if warmup > 0:
+            hoomd.run(warmup, quiet=quiet);
+
+        tps_list = [];
+        for (Nx, Ny, Nz, cur_order, cur_rcut, error) in candidates:
+            self.set_params(Nx=Nx, Ny=Ny, Nz=Nz, order=cur_order, rcut=cur_rcut, alpha=self.alpha);
+
+            # run the benchmark 3 times
+            tps = [];
+            for i in range(3):
+                hoomd.run(steps, quiet=quiet);
+                tps.append(hoomd.context.current.system.getLastTPS())
+
+            # record the median tps of the 3
+            tps.sort();
+            tps_list.append(tps[1]);
+
+        # set the fastest candidate
+        fastest = tps_list.index(max(tps_list));
+        (Nx, Ny, Nz, cur_order, cur_rcut, error) = candidates[fastest];
+        self.set_params(Nx=Nx, Ny=Ny, Nz=Nz, order=cur_order, rcut=cur_rcut, alpha=self.alpha);
+
+        hoomd.util.unquiet_status();
+
+        # notify the user of the benchmark results
+        hoomd.context.msg.notice(2, "charge.pppm: tuning report\n");
+        hoomd.context.msg.notice(2, "{:>6} {:>6} {:>6} {:>6} {:>10} {:>12} {:>12}\n".format(
+            'Nx', 'Ny', 'Nz', 'order', 'rcut', 'error', 'tps'));
+        for (c, tps) in zip(candidates, tps_list):
+            hoomd.context.msg.notice(2, "{:>6} {:>6} {:>6} {:>6} {:>10.4g} {:>12.4g} {:>12.4g}\n".format(
+                c[0], c[1], c[2], c[3], c[4], c[5], tps));
+        hoomd.context.msg.notice(2, "Optimal parameters: Nx = {}, Ny = {}, Nz = {}, order = {}, rcut = {}\n".format(
+            Nx, Ny, Nz, cur_order, cur_rcut));
+
+        return (Nx, Ny, Nz, cur_order, cur_rcut);
+
     def update_coeffs(self):
         if not self.params_set:
             hoomd.context.msg.error("Coefficients for PPPM are not set. Call set_coeff prior to run()\n");
@@ -228,6 +318,68 @@ class pppm(force._force):
         if self.nlist.cpp_nlist.getDiameterShift():
             hoomd.context.msg.warning("Neighbor diameter shifting is enabled, PPPM may not correct for all excluded interactions\n");
 
+## \internal
+# \brief Find the splitting parameter that balances the real and reciprocal space errors
+def find_kappa(Nx, Ny, Nz, Lx, Ly, Lz, N, order, q2, rcut):
+    hx = Lx/Nx
+    hy = Ly/Ny
+    hz = Lz/Nz
+
+    gew1 = 0.0
+    kappa = gew1
+    f = diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+    hmin = min(hx, hy, hz)
+    gew2 = 10.0/hmin
+    kappa = gew2
+    fmid = diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+
+    if f*fmid >= 0.0:
+        raise RuntimeError("f*fmid >= 0.0");
+
+    if f < 0.0:
+        dgew=gew2-gew1
+        rtb = gew1
+    else:
+        dgew=gew1-gew2
+        rtb = gew2
+
+    ncount = 0
+
+    while math.fabs(dgew) > 0.00001 and fmid != 0.0:
+        dgew *= 0.5
+        kappa = rtb + dgew
+        fmid = diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+        if fmid <= 0.0:
+            rtb = kappa
+        ncount += 1
+        if ncount > 10000.0:
+            raise RuntimeError("kappa not converging");
+
+    return kappa
+
+## \internal
+# \brief Estimate the total RMS force error
+def estimate_error(Nx, Ny, Nz, Lx, Ly, Lz, N, order, kappa, q2, rcut):
+    lprx = rms(Lx/Nx, Lx, N, order, kappa, q2)
+    lpry = rms(Ly/Ny, Ly, N, order, kappa, q2)
+    lprz = rms(Lz/Nz, Lz, N, order, kappa, q2)
+    kspace_prec = math.sqrt(lprx*lprx + lpry*lpry + lprz*lprz) / sqrt(3.0)
+    real_prec = 2.0*q2 * math.exp(-kappa*kappa*rcut*rcut)/sqrt(N*rcut*Lx*Ly*Lz)
+    return math.sqrt(kspace_prec*kspace_prec + real_prec*real_prec)
+
+## \internal
+# \brief List the mesh sizes up to max_mesh that are fast for FFTs
+def fft_mesh_sizes(max_mesh, pow2):
+    sizes = [];
+    for n in range(2, max_mesh+1):
+        m = n
+        for f in ([2] if pow2 else [2,3,5]):
+            while m % f == 0:
+                m //= f
+        if m == 1:
+            sizes.append(n)
+    return sizes
+
 def diffpr(hx, hy, hz, xprd, yprd, zprd, N, order, kappa, q2, rcut):
     lprx = rms(hx, xprd, N, order, kappa, q2)
     lpry = rms(hy, yprd, N, order, kappa, q2)
@@ -219,6 +219,19 @@ class distance(_constraint_force):
     .. caution::
         constrain.distance() does not currently interoperate with integrate.brownian() or integrate.langevin()
 
+    By default, the linear system is solved directly with a sparse LU decomposition. With
+    ``set_params(solver='iterative')``, it is instead solved with Gauss-Seidel sweeps over the constraints, in the
+    spirit of SHAKE. The iteration starts from the Lagrange multipliers of the previous step and stops when the
+    change of every multiplier is below *tol* relative to its own value plus the largest multiplier any constraint
+    of the molecule would carry on its own, so that constraints that carry no load do not stall the iteration.
+    Molecules that share no constraints are solved in parallel.
+    The iterative solver runs on the CPU and does not store the constraint matrix, which pays off for large
+    numbers of small molecules.
+
+    The following quantities are provided to :py:class:`hoomd.analyze.log`:
+
+    - **constrain_distance_iterations** - largest number of sweeps needed by any molecule in the last iterative solve
+
     Example::
 
         constrain.distance()
@@ -238,16 +251,87 @@ class distance(_constraint_force):
 
         hoomd.context.current.system.addCompute(self.cpp_force, self.force_name);
 
-    def set_params(self,rel_tol=None):
+        self.solver = 'direct'
+        self.tol = 1e-6
+        self.max_iter = 100
+
+    def set_params(self,rel_tol=None,solver=None,tol=None,max_iter=None):
         R""" Set parameters for constraint computation.
 
         Args:
             rel_tol (float): The relative tolerance with which constraint violations are detected (**optional**).
+            solver (str): Either 'direct' or 'iterative' (**optional**).
+            tol (float): Convergence tolerance of the iterative solver, relative to the multipliers of a molecule (**optional**).
+            max_iter (int): Maximum number of sweeps of the iterative solver (**optional**).
 
         Example::
 
             dist = constrain.distance()
             dist.set_params(rel_tol=0.0001)
+            dist.set_params(solver='iterative', tol=1e-8, max_iter=200)
+        """
+        if rel_tol is not None:
+            self.cpp_force.setRelativeTolerance(float(rel_tol))
+
+        if solver is not None:
+            if solver not in ['direct', 'iterative']:
+                hoomd.context.msg.error("constrain.distance: solver must be 'direct' or 'iterative'\n");
+                raise ValueError("Invalid solver");
+            self.solver = solver
+
+        if tol is not None:
+            self.tol = float(tol)
+
+        if max_iter is not None:
+            self.max_iter = int(max_iter)
+
+        self.cpp_force.setIterative(self.solver == 'iterative', self.tol, self.max_iter)
+
+class settle(_constraint_force):
+    R""" Constrain rigid three-site molecules analytically.
+
+    :py:class:`settle` applies the same constraint forces as :py:class:`distance`, for systems in which every
+    molecule defined by constraints is a rigid triangle of three particles and three constraints, such as three-site
+    water models. Like SETTLE, it exploits that these molecules are small and independent: the constraint equations
+    of each molecule are solved in closed form, and all molecules are solved in parallel. This is much cheaper than
+    the sparse matrix solve of :py:class:`distance` for large numbers of molecules.
+
+    It is an error when any molecule defined by constraints is not a triangle. Use :py:class:`distance` for
+    general constraint topologies, and do not use both at the same time.
+
+    Warning:
+        In MPI simulations, all particles connected through constraints will be communicated between processors as ghost particles.
+
+    Example::
+
+        for i in range(num_water):
+            system.constraints.add(3*i, 3*i+1, 1.0)
+            system.constraints.add(3*i, 3*i+2, 1.0)
+            system.constraints.add(3*i+1, 3*i+2, 1.633)
+        constrain.settle()
+
+    """
+    def __init__(self):
+        hoomd.util.print_status_line();
+
+        # initialize the base class
+        _constraint_force.__init__(self);
+
+        # create the c++ mirror class
+        self.cpp_force = _md.ForceSettleConstraint(hoomd.context.current.system_definition);
+
+        hoomd.context.current.system.addCompute(self.cpp_force, self.force_name);
+
+    def set_params(self,rel_tol=None):
+        R""" Set parameters for constraint computation.
+
+        Args:
+            rel_tol (float): The relative tolerance with which constraint violations are detected (**optional**).
+
+        Example::
+
+            water = constrain.settle()
+            water.set_params(rel_tol=0.0001)
         """
         if rel_tol is not None:
             self.cpp_force.setRelativeTolerance(float(rel_tol))
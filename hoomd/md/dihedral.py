@@ -290,12 +290,18 @@ def _table_eval(theta, V, T, width):
       i = int(round((theta+math.pi)/dth))
       return (V[i], T[i])
 
+# the table is only evaluated at its own knots, index maps each knot to its row
+def _table_eval_knots(theta, V, T, index):
+      i = index[theta];
+      return (V[i], T[i])
+
 class table(force._force):
     R""" Tabulated dihedral potential.
 
     Args:
         width (int): Number of points to use to interpolate V and T (see documentation above)
         name (str): Name of the force instance
+        interpolation (str): ``'linear'`` or ``'hermite'``
 
     :py:class:`table` specifies that a tabulated dihedral force should be applied to every define dihedral.
 
@@ -308,6 +314,12 @@ class table(force._force):
 
     - :math:`T_{\mathrm{user}}(\theta)` and :math:`V_{\mathrm{user}} (\theta)` - evaluated by ``func`` (see example)
     - coefficients passed to `func` - `coeff` (see example)
+    - grid points - ``knots`` (in radians) - *optional*: defaults to *width* evenly spaced points,
+      only used with ``interpolation='hermite'``
+
+    With ``interpolation='hermite'``, V and T are interpolated with cubic Hermite splines on the grid points, which
+    need not be evenly spaced but must start at :math:`-\pi` and end at :math:`\pi`. See :py:class:`hoomd.md.pair.table`
+    for details. Hermite interpolation is not available on the GPU.
 
     .. rubric:: Set table from a given function
 
@@ -334,9 +346,17 @@ class table(force._force):
         dtable.set_from_file('polymer', 'dihedral.dat')
 
     """
-    def __init__(self, width, name=None):
+    def __init__(self, width, name=None, interpolation='linear'):
         hoomd.util.print_status_line();
 
+        if interpolation not in ['linear', 'hermite']:
+            hoomd.context.msg.error("dihedral.table: interpolation must be 'linear' or 'hermite'\n");
+            raise ValueError("Error initializing dihedral.table");
+
+        if interpolation == 'hermite' and hoomd.context.exec_conf.isCUDAEnabled():
+            hoomd.context.msg.error("dihedral.table: hermite interpolation is not supported on the GPU\n");
+            raise RuntimeError("Error initializing dihedral.table");
+
         # initialize the base class
         force._force.__init__(self, name);
 
@@ -351,15 +371,36 @@ class table(force._force):
 
         # setup the coefficent matrix
         self.dihedral_coeff = coeff();
+        self.dihedral_coeff.set_default_coeff('knots', None);
 
-        # stash the width for later use
+        # stash the width and interpolation for later use
         self.width = width;
+        self.interpolation = interpolation;
 
-    def update_dihedral_table(self, atype, func, coeff):
+    def update_dihedral_table(self, atype, func, coeff, knots=None):
         # allocate arrays to store V and F
         Vtable = _hoomd.std_vector_scalar();
         Ttable = _hoomd.std_vector_scalar();
 
+        if self.interpolation == 'hermite':
+            if knots is None:
+                dth = 2.0*math.pi / float(self.width-1);
+                knots = [-math.pi + dth * i for i in range(0, self.width)];
+
+            if len(knots) < 2 or math.fabs(knots[0] + math.pi) > 1e-6 or math.fabs(knots[-1] - math.pi) > 1e-6:
+                hoomd.context.msg.error("dihedral.table: knots must start at -pi and end at pi\n");
+                raise RuntimeError("Error updating dihedral coefficients");
+
+            thtable = _hoomd.std_vector_scalar();
+            for theta in knots:
+                (V,T) = func(theta, **coeff);
+                thtable.append(theta);
+                Vtable.append(V);
+                Ttable.append(T);
+
+            self.cpp_force.setSplineTable(atype, thtable, Vtable, Ttable);
+            return;
+
         # calculate dth
         dth = 2.0*math.pi / float(self.width-1);
 
@@ -378,7 +419,7 @@ class table(force._force):
 
     def update_coeffs(self):
         # check that the dihedral coefficents are valid
-        if not self.dihedral_coeff.verify(["func", "coeff"]):
+        if not self.dihedral_coeff.verify(["func", "coeff", "knots"]):
             hoomd.context.msg.error("Not all dihedral coefficients are set for dihedral.table\n");
             raise RuntimeError("Error updating dihedral coefficients");
 
@@ -393,8 +434,9 @@ class table(force._force):
         for i in range(0,ntypes):
             func = self.dihedral_coeff.get(type_list[i], "func");
             coeff = self.dihedral_coeff.get(type_list[i], "coeff");
+            knots = self.dihedral_coeff.get(type_list[i], "knots");
 
-            self.update_dihedral_table(i, func, coeff);
+            self.update_dihedral_table(i, func, coeff, knots);
 
     def set_from_file(self, dihedralname, filename):
         R"""  Set a dihedral pair interaction from a file.
@@ -419,6 +461,9 @@ class table(force._force):
             and that :math:`\delta \theta = 2\pi/(N-1)`. The table is read
             directly into the grid points used to evaluate :math:`T_{\mathrm{user}}(\theta)` and :math:`V_{\mathrm{user}}(\theta)`.
 
+        With ``interpolation='hermite'``, the theta values are used as the ``knots`` of the dihedral type. They must
+        increase from :math:`-\pi` to :math:`\pi` (to within 1e-6) but need not be equally spaced, and the file may
+        have any number of rows.
         """
         hoomd.util.print_status_line();
 
@@ -451,6 +496,19 @@ class table(force._force):
             V_table.append(values[1]);
             T_table.append(values[2]);
 
+        if self.interpolation == 'hermite':
+            for i in range(1,len(theta_table)):
+                if theta_table[i] <= theta_table[i-1]:
+                    hoomd.context.msg.error("dihedral.table: theta must be monotonically increasing\n");
+                    raise RuntimeError("Error reading table file");
+
+            index = {k: i for i, k in enumerate(theta_table)};
+            hoomd.util.quiet_status();
+            self.dihedral_coeff.set(dihedralname, func=_table_eval_knots,
+                                    coeff=dict(V=V_table, T=T_table, index=index), knots=theta_table)
+            hoomd.util.unquiet_status();
+            return;
+
         # validate input
         if self.width != len(T_table):
             hoomd.context.msg.error("dihedral.table: file must have exactly " + str(self.width) + " rows\n");
@@ -94,6 +94,10 @@ class mode_standard(_integrator):
         self.aniso = aniso
         self.metadata_fields = ['dt', 'aniso']
 
+        # forces evaluated only on the outer steps of the multiple time step scheme
+        self.slow_forces = [];
+        self.slow_period = 1;
+
         # initialize the reflected c++ class
         self.cpp_integrator = _md.IntegratorTwoStep(hoomd.context.current.system_definition, dt);
         self.supports_methods = True;
@@ -142,6 +146,64 @@ class mode_standard(_integrator):
             self.aniso = aniso
             self.cpp_integrator.setAnisotropicMode(anisoMode)
 
+    def set_multiple_timestep(self, forces, period):
+        R""" Evaluate slow forces less often than the other forces.
+
+        Args:
+            forces (list): Forces to evaluate only every *period* steps.
+            period (int): Number of time steps between evaluations of *forces*. Set to 1 to evaluate all forces on
+                          every step.
+
+        .. versionadded:: 2.4
+
+        :py:meth:`set_multiple_timestep` enables impulse multiple time step integration (r-RESPA). The slow forces are
+        applied on the first step of every :py:func:`hoomd.run()` and then every *period* steps, with a weight of
+        *period*. When a run ends between two slow steps, the first step of the next run makes up for the missing part
+        of the impulse. All other forces are evaluated on every step with the time step *dt*. Typical slow forces are the long
+        range electrostatics of :py:class:`hoomd.md.charge.pppm`, whose reciprocal space part varies slowly in time.
+        The outer time step *period* * *dt* must remain small compared to the fastest motion driven by the slow
+        forces; a *period* of 2 to 4 is common.
+
+        The slow forces are also computed on steps where the potential energy or the pressure is needed, such as steps
+        where these quantities are logged, so the thermodynamic quantities always include them. On such steps, the
+        slow forces do not change the motion of the particles.
+
+        Multiple time step integration is not available on the GPU.
+
+        Examples::
+
+            pppm = md.charge.pppm(group=charged, nlist=nl)
+            integrator_mode.set_multiple_timestep(forces=[pppm], period=2)
+
+            # disable multiple time steps
+            integrator_mode.set_multiple_timestep(forces=[], period=1)
+
+        """
+        hoomd.util.print_status_line();
+        self.check_initialization();
+
+        if int(period) != period or period < 1:
+            hoomd.context.msg.error("integrate.mode_standard: period must be a positive integer.\n");
+            raise ValueError("Error setting multiple time step parameters.");
+
+        for f in forces:
+            if not isinstance(f, hoomd.md.force._force):
+                hoomd.context.msg.error("integrate.mode_standard: slow forces must be md forces.\n");
+                raise TypeError("Error setting multiple time step parameters.");
+
+        self.slow_forces = list(forces);
+        self.slow_period = int(period);
+
+    ## \internal
+    # \brief Updates the C++ side forces, including the multiple time step slow forces
+    def update_forces(self):
+        _integrator.update_forces(self);
+
+        self.cpp_integrator.setSlowForcePeriod(self.slow_period);
+        for f in self.slow_forces:
+            if f.enabled:
+                self.cpp_integrator.addSlowForceCompute(f.cpp_force);
+
     def reset_methods(self):
         R""" (Re-)initialize the integrator variables in all integration methods
 
@@ -23,6 +23,7 @@
 #include "FIREEnergyMinimizer.h"
 #include "ForceComposite.h"
 #include "ForceDistanceConstraint.h"
+#include "ForceSettleConstraint.h"
 #include "HarmonicAngleForceCompute.h"
 #include "CosineSqAngleForceCompute.h"
 #include "HarmonicDihedralForceCompute.h"
@@ -241,6 +242,7 @@ PYBIND11_MODULE(_md, m)
     export_OneDConstraint(m);
     export_MolecularForceCompute(m);
     export_ForceDistanceConstraint(m);
+    export_ForceSettleConstraint(m);
     export_ForceComposite(m);
     export_PPPMForceCompute(m);
     py::class_< wall_type, std::shared_ptr<wall_type> >(m, "wall_type")
@@ -952,6 +952,11 @@ def _table_eval(r, rmin, rmax, V, F, width):
     i = int(round((r - rmin)/dr))
     return (V[i], F[i])
 
+# the table is only evaluated at its own knots, index maps each knot to its row
+def _table_eval_knots(r, rmin, rmax, V, F, index):
+    i = index[r];
+    return (V[i], F[i])
+
 class table(force._force):
     R""" Tabulated pair potential.
 
@@ -959,6 +964,7 @@ class table(force._force):
         width (int): Number of points to use to interpolate V and F.
         nlist (:py:mod:`hoomd.md.nlist`): Neighbor list (default of None automatically creates a global cell-list based neighbor list)
         name (str): Name of the force instance
+        interpolation (str): ``'linear'`` or ``'hermite'``
 
     :py:class:`table` specifies that a tabulated pair potential should be applied between every
     non-excluded particle pair in the simulation.
@@ -997,6 +1003,23 @@ class table(force._force):
     - coefficients passed to ``func`` - *coeff* (see example)
     - :math:`_{\mathrm{min}}` - *rmin* (in distance units)
     - :math:`_{\mathrm{max}}` - *rmax* (in distance units)
+    - grid points - *knots* (in distance units) - *optional*: defaults to *width* evenly spaced points,
+      only used with ``interpolation='hermite'``
+
+    .. rubric:: Spline interpolation
+
+    With ``interpolation='hermite'``, V and F are interpolated between grid points with cubic Hermite splines that
+    match both V and F at every grid point. F is the exact derivative of the interpolated V. The error decreases
+    much faster with the grid spacing than for linear interpolation, so that an order of magnitude fewer points
+    typically give the same accuracy. The grid points of each pair can be given explicitly in *knots* and do not need
+    to be evenly spaced: place them densely where the potential is steep and sparsely where it is smooth. *knots*
+    must increase and start at *rmin* and end at *rmax*::
+
+        table = pair.table(width=100, nlist=nl, interpolation='hermite')
+        knots = [0.8 + 2.2*(i/99.0)**2 for i in range(100)]
+        table.pair_coeff.set('A', 'A', func=lj, rmin=0.8, rmax=3.0, coeff=dict(epsilon=1.5, sigma=1.0), knots=knots)
+
+    Hermite interpolation is not available on the GPU.
 
     .. rubric:: Set table from a given function
 
@@ -1018,7 +1041,8 @@ class table(force._force):
 
     When you have no function for for *V* or *F*, or you otherwise have the data listed in a file,
     :py:class:`table` can use the given values directly. You must first specify the number of rows
-    in your tables when initializing pair.table. Then use :py:meth:`set_from_file()` to read the file::
+    in your tables when initializing pair.table (except with ``interpolation='hermite'``, see
+    :py:meth:`set_from_file()`). Then use :py:meth:`set_from_file()` to read the file::
 
         nl = nlist.cell()
         table = pair.table(width=1000, nlist=nl)
@@ -1031,14 +1055,23 @@ class table(force._force):
         not diverge near r=0, then a setting of *rmin=0* is valid.
 
     """
-    def __init__(self, width, nlist, name=None):
+    def __init__(self, width, nlist, name=None, interpolation='linear'):
         hoomd.util.print_status_line();
 
+        if interpolation not in ['linear', 'hermite']:
+            hoomd.context.msg.error("pair.table: interpolation must be 'linear' or 'hermite'\n");
+            raise ValueError("Error initializing pair.table");
+
+        if interpolation == 'hermite' and hoomd.context.exec_conf.isCUDAEnabled():
+            hoomd.context.msg.error("pair.table: hermite interpolation is not supported on the GPU\n");
+            raise RuntimeError("Error initializing pair.table");
+
         # initialize the base class
         force._force.__init__(self, name);
 
         # setup the coefficent matrix
         self.pair_coeff = coeff();
+        self.pair_coeff.set_default_coeff('knots', None);
 
         self.nlist = nlist
         self.nlist.subscribe(lambda:self.get_rcut())
@@ -1053,14 +1086,34 @@ class table(force._force):
 
         hoomd.context.current.system.addCompute(self.cpp_force, self.force_name);
 
-        # stash the width for later use
+        # stash the width and interpolation for later use
         self.width = width;
+        self.interpolation = interpolation;
 
-    def update_pair_table(self, typei, typej, func, rmin, rmax, coeff):
+    def update_pair_table(self, typei, typej, func, rmin, rmax, coeff, knots=None):
         # allocate arrays to store V and F
         Vtable = _hoomd.std_vector_scalar();
         Ftable = _hoomd.std_vector_scalar();
 
+        if self.interpolation == 'hermite':
+            if knots is None:
+                dr = (rmax - rmin) / float(self.width-1);
+                knots = [rmin + dr * i for i in range(0, self.width)];
+
+            if len(knots) < 2 or math.fabs(knots[0] - rmin) > 1e-6 or math.fabs(knots[-1] - rmax) > 1e-6:
+                hoomd.context.msg.error("pair.table: knots must start at rmin and end at rmax\n");
+                raise RuntimeError("Error updating pair coefficients");
+
+            rtable = _hoomd.std_vector_scalar();
+            for r in knots:
+                (V,F) = func(r, rmin, rmax, **coeff);
+                rtable.append(r);
+                Vtable.append(V);
+                Ftable.append(F);
+
+            self.cpp_force.setSplineTable(typei, typej, rtable, Vtable, Ftable);
+            return;
+
         # calculate dr
         dr = (rmax - rmin) / float(self.width-1);
 
@@ -1119,7 +1172,7 @@ class table(force._force):
 
     def update_coeffs(self):
         # check that the pair coefficents are valid
-        if not self.pair_coeff.verify(["func", "rmin", "rmax", "coeff"]):
+        if not self.pair_coeff.verify(["func", "rmin", "rmax", "coeff", "knots"]):
             hoomd.context.msg.error("Not all pair coefficients are set for pair.table\n");
             raise RuntimeError("Error updating pair coefficients");
 
@@ -1136,8 +1189,9 @@ class table(force._force):
                 rmin = self.pair_coeff.get(type_list[i], type_list[j], "rmin");
                 rmax = self.pair_coeff.get(type_list[i], type_list[j], "rmax");
                 coeff = self.pair_coeff.get(type_list[i], type_list[j], "coeff");
+                knots = self.pair_coeff.get(type_list[i], type_list[j], "knots");
 
-                self.update_pair_table(i, j, func, rmin, rmax, coeff);
+                self.update_pair_table(i, j, func, rmin, rmax, coeff, knots);
 
     def set_from_file(self, a, b, filename):
         R""" Set a pair interaction from a file.
@@ -1162,6 +1216,9 @@ class table(force._force):
         The first r value sets *rmin*, the last sets *rmax*. Any line with # as the first non-whitespace character is
         is treated as a comment. The *r* values must monotonically increase and be equally spaced. The table is read
         directly into the grid points used to evaluate :math:`F_{\mathrm{user}}(r)` and :math:`_{\mathrm{user}}(r)`.
+
+        With ``interpolation='hermite'``, the *r* values must increase but need not be equally spaced, and the file
+        may have any number of rows. They are used as the *knots* of the pair.
         """
         hoomd.util.print_status_line();
 
@@ -1194,15 +1251,28 @@ class table(force._force):
             V_table.append(values[1]);
             F_table.append(values[2]);
 
+        # extract rmin and rmax
+        rmin_table = r_table[0];
+        rmax_table = r_table[-1];
+
+        if self.interpolation == 'hermite':
+            for i in range(1,len(r_table)):
+                if r_table[i] <= r_table[i-1]:
+                    hoomd.context.msg.error("pair.table: r must be monotonically increasing\n");
+                    raise RuntimeError("Error reading table file");
+
+            index = {k: i for i, k in enumerate(r_table)};
+            hoomd.util.quiet_status();
+            self.pair_coeff.set(a, b, func=_table_eval_knots, rmin=rmin_table, rmax=rmax_table,
+                                coeff=dict(V=V_table, F=F_table, index=index), knots=r_table)
+            hoomd.util.unquiet_status();
+            return;
+
         # validate input
         if self.width != len(r_table):
             hoomd.context.msg.error("pair.table: file must have exactly " + str(self.width) + " rows\n");
             raise RuntimeError("Error reading table file");
 
-        # extract rmin and rmax
-        rmin_table = r_table[0];
-        rmax_table = r_table[-1];
-
         # check for even spacing
         dr = (rmax_table - rmin_table) / float(self.width-1);
         for i in range(0,self.width):
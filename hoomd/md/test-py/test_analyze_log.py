@@ -96,6 +96,21 @@ class analyze_log_query_tests (unittest.TestCase):
         self.assertNotEqual(U0, U1);
         self.assertNotEqual(K0, K1);
 
+    # tests that quantities from several sources are consistent when evaluated together
+    def test_consistent_sources(self):
+        log = hoomd.analyze.log(quantities = ['pair_lj_energy', 'potential_energy', 'kinetic_energy', 'pressure_xx'],
+                                period = 10, filename=None);
+        hoomd.run(11);
+        U_pair = log.query('pair_lj_energy');
+        U = log.query('potential_energy');
+        self.assertNotEqual(U, 0);
+        self.assertAlmostEqual(U_pair / U, 1.0, places=5);
+
+        # changing the logged quantities resolves the sources again
+        log.set_params(quantities = ['kinetic_energy', 'potential_energy', 'pair_lj_energy']);
+        hoomd.run(10);
+        self.assertAlmostEqual(log.query('pair_lj_energy') / log.query('potential_energy'), 1.0, places=5);
+
     # tests basic creation of the analyzer
     def test_with_file(self):
         if hoomd.comm.get_rank() == 0:
@@ -263,5 +278,161 @@ class analyze_log_hdf5_tests (unittest.TestCase):
         if (hoomd.comm.get_rank()==0):
             os.remove(self.tmp_file);
 
+# test analyze.log_binary
+class analyze_log_binary_tests (unittest.TestCase):
+    def setUp(self):
+        self.s = init.create_lattice(lattice.sc(a=1.5),n=[8,8,8]);
+        nl = hoomd.md.nlist.cell()
+        self.pair = hoomd.md.pair.lj(r_cut=2.5, nlist = nl)
+        self.pair.pair_coeff.set('A', 'A', epsilon=1.0, sigma=1.0)
+        hoomd.md.integrate.mode_standard(dt=0.005);
+        self.langevin = hoomd.md.integrate.langevin(hoomd.group.all(), seed=1, kT=1.0);
+
+        if hoomd.comm.get_rank() == 0:
+            tmp = tempfile.mkstemp(suffix='.test.log');
+            self.tmp_file = tmp[1];
+        else:
+            self.tmp_file = "invalid";
+
+    # tests that the file holds the logged values
+    def test(self):
+        log = hoomd.analyze.log_binary(quantities = ['potential_energy', 'kinetic_energy'], period = 10,
+                                       filename=self.tmp_file, buffer_size=3, overwrite=True);
+        hoomd.run(101);
+        U = log.query('potential_energy');
+
+        if hoomd.comm.get_rank() == 0:
+            data = hoomd.analyze.read_log_binary(self.tmp_file);
+            self.assertEqual(data.dtype.names, ('timestep', 'potential_energy', 'kinetic_energy'));
+            self.assertEqual(len(data), 11);
+            numpy.testing.assert_array_equal(data['timestep'], numpy.arange(0, 101, 10));
+            self.assertAlmostEqual(data['potential_energy'][-1], U, places=5);
+
+    # tests appending to an existing file
+    def test_append(self):
+        log = hoomd.analyze.log_binary(quantities = ['potential_energy'], period = 10, filename=self.tmp_file,
+                                       overwrite=True);
+        hoomd.run(50);
+        log.disable();
+        del log
+
+        log = hoomd.analyze.log_binary(quantities = ['potential_energy'], period = 10, filename=self.tmp_file);
+        hoomd.run(50);
+
+        if hoomd.comm.get_rank() == 0:
+            data = hoomd.analyze.read_log_binary(self.tmp_file);
+            self.assertEqual(len(data), 10);
+            self.assertEqual(data['timestep'][-1], 90);
+
+        # the columns of an existing file cannot change
+        self.assertRaises(RuntimeError, log.set_params, quantities=['kinetic_energy']);
+
+    def tearDown(self):
+        hoomd.context.initialize();
+        if (hoomd.comm.get_rank()==0):
+            os.remove(self.tmp_file);
+
+# test analyze.correlator
+class analyze_correlator_tests (unittest.TestCase):
+    def setUp(self):
+        self.s = init.create_lattice(lattice.sc(a=1.5),n=[8,8,8]);
+        nl = hoomd.md.nlist.cell()
+        self.pair = hoomd.md.pair.lj(r_cut=2.5, nlist = nl)
+        self.pair.pair_coeff.set('A', 'A', epsilon=1.0, sigma=1.0)
+        hoomd.md.integrate.mode_standard(dt=0.005);
+        self.langevin = hoomd.md.integrate.langevin(hoomd.group.all(), seed=1, kT=1.0);
+
+    # tests the scalar correlations and block averages
+    def test(self):
+        corr = hoomd.analyze.correlator(quantities=['potential_energy', 'pressure_xy'], period=2,
+                                        num_points=8, averaging=2, num_levels=4);
+        hoomd.run(200);
+
+        tau, c = corr.get('pressure_xy');
+        self.assertEqual(len(tau), len(c));
+        self.assertEqual(tau[0], 0);
+        self.assertEqual(tau[1], 2);
+        self.assertGreater(c[0], 0);
+
+        mean, errors = corr.get_block_average('potential_energy');
+        self.assertLess(mean, 0);
+        self.assertGreater(len(errors), 0);
+
+        corr.reset();
+        tau, c = corr.get('pressure_xy');
+        self.assertEqual(len(tau), 0);
+
+        self.assertRaises(RuntimeError, corr.get, 'kinetic_energy');
+
+    # tests the per-particle correlations
+    def test_particles(self):
+        if hoomd.comm.get_num_ranks() > 1:
+            return;
+
+        corr = hoomd.analyze.correlator(quantities=[], period=1, particle_quantities=['velocity', 'msd'],
+                                        group=hoomd.group.all(), num_points=8, num_levels=3);
+        hoomd.run(50);
+
+        tau, msd = corr.get('msd');
+        self.assertEqual(msd[0], 0);
+        self.assertGreater(msd[-1], msd[1]);
+
+        tau, vacf = corr.get('velocity');
+        # <v.v> = 3 kT/m in equilibrium, allow for the initial heating
+        self.assertGreater(vacf[0], 0);
+
+    # tests the zero lag velocity correlation against the velocities of a snapshot
+    def test_vacf_zero_lag(self):
+        if hoomd.comm.get_num_ranks() > 1:
+            return;
+
+        hoomd.run(100);
+        snap = self.s.take_snapshot();
+        v = numpy.array(snap.particles.velocity, dtype=numpy.float64);
+
+        # the only sample is taken before the first step, the correlation is averaged over the 3N components
+        corr = hoomd.analyze.correlator(quantities=[], period=1, particle_quantities=['velocity'],
+                                        group=hoomd.group.all());
+        hoomd.run(1);
+
+        tau, vacf = corr.get('velocity');
+        self.assertEqual(len(vacf), 1);
+        self.assertAlmostEqual(vacf[0], numpy.mean(v*v), places=5);
+
+    # tests the correlations of free particles, which move with constant velocities
+    def test_free_particles(self):
+        if hoomd.comm.get_num_ranks() > 1:
+            return;
+
+        hoomd.run(100);
+        self.langevin.disable();
+        self.pair.disable();
+        hoomd.md.integrate.nve(hoomd.group.all());
+
+        # the first step still applies the accelerations left by the pair force
+        hoomd.run(1);
+        snap = self.s.take_snapshot();
+        v = numpy.array(snap.particles.velocity, dtype=numpy.float64);
+        v2 = numpy.mean(v*v);
+
+        corr = hoomd.analyze.correlator(quantities=[], period=1, particle_quantities=['velocity', 'msd'],
+                                        group=hoomd.group.all(), num_points=8, averaging=2, num_levels=4);
+        hoomd.run(100);
+
+        # the velocity autocorrelation is the same at all lags, on all levels
+        tau, vacf = corr.get('velocity');
+        self.assertGreater(len(vacf), 8);
+        for c in vacf:
+            self.assertAlmostEqual(c, v2, places=5);
+
+        # the motion is ballistic, block averages of linear trajectories are exact
+        tau, msd = corr.get('msd');
+        self.assertEqual(msd[0], 0);
+        for t, m in zip(tau[1:], msd[1:]):
+            self.assertAlmostEqual(m / (v2*(t*0.005)**2), 1.0, places=2);
+
+    def tearDown(self):
+        hoomd.context.initialize();
+
 if __name__ == '__main__':
     unittest.main(argv = ['test.py', '-v'])
@@ -88,6 +88,31 @@ class angle_table_tests (unittest.TestCase):
             numpy.testing.assert_allclose(f_1.force[1], f_2.force[1],rtol=0.01)
             numpy.testing.assert_allclose(f_1.force[2], f_2.force[2],rtol=0.01)
 
+    # compare a spline table on a few uneven knots against harmonic angle
+    def test_hermite_compare(self):
+        if context.exec_conf.isCUDAEnabled():
+            return;
+
+        harmonic_1 = md.angle.table(width=10, interpolation='hermite')
+        harmonic_1.angle_coeff.set('angleA', func=lambda theta: (0.5*1*theta*theta, -theta), coeff=dict(),
+                                   knots=[0.0, 0.2, 0.9, 1.1, 2.0, math.pi])
+        harmonic_2 = md.angle.harmonic()
+        harmonic_2.angle_coeff.set('angleA', k=1.0, t0=0)
+        md.integrate.mode_standard(dt=0.005);
+        all = group.all()
+        md.integrate.nve(all)
+        run(1)
+        for i in range(len(self.sys.particles)):
+            f_1 = harmonic_1.forces[i]
+            f_2 = harmonic_2.forces[i]
+            # the spline represents the quadratic potential exactly
+            numpy.testing.assert_allclose(f_1.energy, f_2.energy,rtol=1e-3,atol=1e-5)
+            numpy.testing.assert_allclose(f_1.force, f_2.force,rtol=1e-3,atol=1e-5)
+
+    # test invalid interpolation
+    def test_invalid_interpolation(self):
+        self.assertRaises(ValueError, md.angle.table, width=10, interpolation='quintic');
+
     def tearDown(self):
         del self.sys
         context.initialize();
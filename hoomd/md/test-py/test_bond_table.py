@@ -31,6 +31,19 @@ class bond_table_tests (unittest.TestCase):
         btable = md.bond.table(width=1000);
         self.assertRaises(RuntimeError, btable.update_coeffs);
 
+    # test hermite interpolation
+    def test_hermite(self):
+        if context.exec_conf.isCUDAEnabled():
+            return;
+
+        btable = md.bond.table(width=10, interpolation='hermite');
+        btable.bond_coeff.set('polymer', rmin=0.0, rmax=2.0, func=lambda r, rmin, rmax: (r*r, -2*r), coeff=dict(),
+                              knots=[0.0, 0.5, 1.0, 2.0]);
+        btable.update_coeffs();
+
+    # test invalid interpolation
+    def test_invalid_interpolation(self):
+        self.assertRaises(ValueError, md.bond.table, width=10, interpolation='quintic');
 
     # Add tests to check for runtime errors
 
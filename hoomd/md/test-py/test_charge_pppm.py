@@ -54,6 +54,40 @@ class charge_pppm_tests (unittest.TestCase):
         del self.s
         context.initialize()
 
+# charge.pppm.tune
+class charge_pppm_tune_tests (unittest.TestCase):
+    def setUp(self):
+        self.s = init.create_lattice(lattice.sc(a=2.1878096788957757),n=[5,5,4]); #target a packing fraction of 0.05
+
+        for i in range(0,50):
+            self.s.particles[i].charge = -1;
+
+        for i in range(50,100):
+            self.s.particles[i].charge = 1;
+
+    # tune the parameters and check that the choice is one of the candidates
+    def test(self):
+        all = group.all()
+        nl = md.nlist.cell()
+        c = md.charge.pppm(all, nlist = nl);
+        md.integrate.mode_standard(dt=0.005);
+        md.integrate.nve(all);
+        (Nx, Ny, Nz, order, rcut) = c.tune(rcut=[2.0, 2.5], accuracy=1e-3, order=[4,5], max_mesh=64, steps=10);
+        self.assertTrue(rcut in [2.0, 2.5]);
+        self.assertTrue(order in [4,5]);
+        self.assertTrue(Nx <= 64 and Ny <= 64 and Nz <= 64);
+        run(10);
+
+        # an unreachable accuracy is an error
+        self.assertRaises(RuntimeError, c.tune, rcut=[2.0], accuracy=1e-30, max_mesh=16, steps=10);
+
+        del all
+        del c
+
+    def tearDown(self):
+        del self.s
+        context.initialize()
+
 # charge.pppm
 class charge_pppm_twoparticle_tests (unittest.TestCase):
     def setUp(self):
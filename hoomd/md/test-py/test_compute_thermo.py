@@ -74,6 +74,28 @@ class compute_thermo_tests (unittest.TestCase):
         numpy.testing.assert_allclose(log.query('rotational_kinetic_energy_A'), 0, atol=1e-7)
         numpy.testing.assert_allclose(log.query('temperature_A'), 2.0 / (3*self.N-3) * K_ref)
 
+    # Unit test: the deterministic reduction gives the same values
+    def test_deterministic(self):
+        all = group.all()
+        thermo = compute.thermo(group=all);
+
+        quantities=['kinetic_energy', 'pressure_xx', 'pressure_xy', 'pressure_zz'];
+        log = analyze.log(filename=None, quantities=quantities, period=None);
+
+        md.integrate.mode_standard(dt=0.0);
+        md.integrate.nve(group=all);
+
+        run(1);
+        ref = [log.query(q) for q in quantities]
+
+        thermo.set_params(deterministic=True)
+        run(1);
+        numpy.testing.assert_allclose([log.query(q) for q in quantities], ref)
+
+        m = self.m;
+        v = self.v;
+        K_ref = 1/2 * numpy.sum(m * (v[:,0]**2 + v[:,1]**2 + v[:,2]**2))
+        numpy.testing.assert_allclose(log.query('kinetic_energy'), K_ref)
 
     def tearDown(self):
         context.initialize();
@@ -37,52 +37,101 @@ class constrain_distance_tests (unittest.TestCase):
     def test_create(self):
         md.constrain.distance();
 
-    # test setting coefficients
+    # test that both solvers maintain the distances and conserve energy
     def test_constraint(self):
-        constraint = md.constrain.distance()
+        for solver in ['direct', 'iterative']:
+            if solver != 'direct':
+                # start over from the initial configuration
+                self.tearDown()
+                self.setUp()
 
-        md.integrate.mode_standard(dt=0.005)
+            constraint = md.constrain.distance()
+            constraint.set_params(solver=solver, tol=1e-10, max_iter=500)
 
-        md.integrate.nve(group=group.all())
+            md.integrate.mode_standard(dt=0.005)
 
-        lj = md.pair.lj(r_cut=2.5, nlist = self.nl)
-        lj.pair_coeff.set('A','A',epsilon=1.0,sigma=1.0)
-        lj.set_params(mode="shift")
+            md.integrate.nve(group=group.all())
 
-        log = analyze.log(quantities = ['potential_energy', 'kinetic_energy'], period = 10, filename=None);
+            lj = md.pair.lj(r_cut=2.5, nlist = self.nl)
+            lj.pair_coeff.set('A','A',epsilon=1.0,sigma=1.0)
+            lj.set_params(mode="shift")
 
-        run(100)
+            log = analyze.log(quantities = ['potential_energy', 'kinetic_energy', 'constrain_distance_iterations'],
+                              period = 10, filename=None);
+
+            run(100)
+
+            E0 = log.query('kinetic_energy') + log.query('potential_energy')
+
+            if solver == 'iterative':
+                # warm started, the solver converges well before the limit
+                self.assertGreater(log.query('constrain_distance_iterations'), 0)
+                self.assertLess(log.query('constrain_distance_iterations'), 500)
 
-        K0 = log.query('kinetic_energy');
-        U0 = log.query('potential_energy');
-        E0 = K0 + U0
+            # check that distances are maintained
+            box = self.system.box
+            pos0 = self.system.particles[0].position
+            pos1 = self.system.particles[1].position
+            pos2 = self.system.particles[2].position
 
-        # check that distances are maintained
-        box = self.system.box
-        pos0 = self.system.particles[0].position
-        pos1 = self.system.particles[1].position
-        pos2 = self.system.particles[2].position
+            pos01 = box.min_image((pos0[0]-pos1[0], pos0[1]-pos1[1], pos0[2]-pos1[2]))
+            pos02 = box.min_image((pos0[0]-pos2[0], pos0[1]-pos2[1], pos0[2]-pos2[2]))
+            pos12 = box.min_image((pos2[0]-pos1[0], pos2[1]-pos1[1], pos2[2]-pos1[2]))
+
+            self.assertAlmostEqual(pos01[0]*pos01[0]+pos01[1]*pos01[1]+pos01[2]*pos01[2],1.5*1.5,4)
+            self.assertAlmostEqual(pos02[0]*pos02[0]+pos02[1]*pos02[1]+pos02[2]*pos02[2],1.5*1.5,4)
+            self.assertAlmostEqual(pos12[0]*pos12[0]+pos12[1]*pos12[1]+pos12[2]*pos12[2],2.0*1.5*1.5,4)
+
+            # test energy conservation
+            run(1000)
+            E1 = log.query('kinetic_energy') + log.query('potential_energy')
+
+            self.assertAlmostEqual(E0,E1,3)
+
+    # test that a constraint without load does not stall the iterative solver
+    def test_constraint_iterative_unloaded(self):
+        # two constraints at 60 degrees, the molecule is pulled along the first one only
+        self.tearDown()
+        snap = data.make_snapshot(N=3,box=data.boxdim(L=25),particle_types=['A'])
+        self.system = init.read_snapshot(snap)
+        self.nl = md.nlist.cell()
+
+        self.system.particles[0].position = (0,0,0)
+        self.system.particles[1].position = (1.5,0,0)
+        self.system.particles[2].position = (0.75,1.5*math.sqrt(3.0)/2.0,0)
+
+        self.system.constraints.add(0,1,1.5)
+        self.system.constraints.add(0,2,1.5)
+
+        # particle 2 is pushed with the acceleration that the loaded constraint gives particle 0, so that the
+        # Lagrange multiplier of the 0-2 constraint vanishes up to round-off
+        md.force.constant(fx=1.0, fy=0, fz=0, group=group.tags(1,1))
+        md.force.constant(fx=0.5, fy=0, fz=0, group=group.tags(2,2))
+
+        constraint = md.constrain.distance()
+        constraint.set_params(solver='iterative', tol=1e-10, max_iter=500)
+
+        md.integrate.mode_standard(dt=0.005)
+        md.integrate.nve(group=group.all())
 
-        pos01 = box.min_image((pos0[0]-pos1[0], pos0[1]-pos1[1], pos0[2]-pos1[2]))
-        pos02 = box.min_image((pos0[0]-pos2[0], pos0[1]-pos2[1], pos0[2]-pos2[2]))
-        pos12 = box.min_image((pos2[0]-pos1[0], pos2[1]-pos1[1], pos2[2]-pos1[2]))
+        log = analyze.log(quantities = ['constrain_distance_iterations'], period = 1, filename=None);
 
-        self.assertAlmostEqual(pos01[0]*pos01[0]+pos01[1]*pos01[1]+pos01[2]*pos01[2],1.5*1.5,4)
-        self.assertAlmostEqual(pos02[0]*pos02[0]+pos02[1]*pos02[1]+pos02[2]*pos02[2],1.5*1.5,4)
-        self.assertAlmostEqual(pos12[0]*pos12[0]+pos12[1]*pos12[1]+pos12[2]*pos12[2],2.0*1.5*1.5,4)
+        iterations = []
+        def sample(timestep):
+            iterations.append(log.query('constrain_distance_iterations'))
 
-        # test energy conservation
-        run(1000)
-        K1 = log.query('kinetic_energy');
-        U1 = log.query('potential_energy');
-        E1 = K1 + U1
+        run(200, callback=sample, callback_period=1)
 
-        self.assertAlmostEqual(E0,E1,3)
+        self.assertGreater(max(iterations), 0)
+        self.assertLess(max(iterations), 50)
 
     # test coefficient not set checking
     def test_set_params(self):
         constraint = md.constrain.distance()
         constraint.set_params(rel_tol=0.01)
+        constraint.set_params(solver='iterative', tol=1e-8, max_iter=50)
+        constraint.set_params(solver='direct')
+        self.assertRaises(ValueError, constraint.set_params, solver='cg')
 
     # test remove particle fails
     def test_constraint_fail(self):
@@ -0,0 +1,113 @@
+# -*- coding: iso-8859-1 -*-
+# Maintainer: jglaser
+
+from hoomd import *
+from hoomd import md
+context.initialize()
+import unittest
+import os
+
+import math
+
+#---
+# tests md.constrain.settle
+class constrain_settle_tests (unittest.TestCase):
+    def setUp(self):
+        print
+        snap = data.make_snapshot(N=6,box=data.boxdim(L=25),particle_types=['O','H'])
+
+        # two rigid triangles
+        if comm.get_rank() == 0:
+            snap.particles.position[:] = [(0,0,0), (1.0,0,0), (0,-1.0,0),
+                                          (5,0,0), (5,1.0,0), (5,0,1.0)]
+            snap.particles.typeid[:] = [0,1,1,0,1,1]
+            snap.particles.mass[:] = [16.0,1.0,1.0,16.0,1.0,1.0]
+            snap.particles.velocity[:] = [(0.1,0,0.2), (-0.3,0.5,0), (0,0.2,-0.4),
+                                          (0,-0.1,0), (0.5,0,0.3), (0,0.4,0)]
+        self.system = init.read_snapshot(snap)
+
+        self.d_HH = math.sqrt(2.0)
+        for i in range(2):
+            self.system.constraints.add(3*i,3*i+1,1.0)
+            self.system.constraints.add(3*i,3*i+2,1.0)
+            self.system.constraints.add(3*i+1,3*i+2,self.d_HH)
+
+        self.nl = md.nlist.cell()
+
+    def dist2(self, i, j):
+        box = self.system.box
+        pi = self.system.particles[i].position
+        pj = self.system.particles[j].position
+        r = box.min_image((pi[0]-pj[0], pi[1]-pj[1], pi[2]-pj[2]))
+        return r[0]*r[0]+r[1]*r[1]+r[2]*r[2]
+
+    # test that we can create the constraint
+    def test_create(self):
+        md.constrain.settle();
+
+    # test that the molecules stay rigid and energy is conserved
+    def test_constraint(self):
+        constraint = md.constrain.settle()
+
+        md.integrate.mode_standard(dt=0.005)
+        md.integrate.nve(group=group.all())
+
+        lj = md.pair.lj(r_cut=2.5, nlist = self.nl)
+        lj.pair_coeff.set(['O','H'],['O','H'],epsilon=1.0,sigma=1.0)
+        lj.set_params(mode="shift")
+
+        log = analyze.log(quantities = ['potential_energy', 'kinetic_energy'], period = 10, filename=None);
+
+        run(100)
+        E0 = log.query('kinetic_energy') + log.query('potential_energy')
+
+        for i in range(2):
+            self.assertAlmostEqual(self.dist2(3*i,3*i+1),1.0,4)
+            self.assertAlmostEqual(self.dist2(3*i,3*i+2),1.0,4)
+            self.assertAlmostEqual(self.dist2(3*i+1,3*i+2),self.d_HH**2,4)
+
+        run(1000)
+        E1 = log.query('kinetic_energy') + log.query('potential_energy')
+
+        self.assertAlmostEqual(E0,E1,3)
+
+    # test that settle and distance give the same trajectory
+    def test_distance(self):
+        constraint = md.constrain.distance()
+        md.integrate.mode_standard(dt=0.005)
+        md.integrate.nve(group=group.all())
+        run(100)
+        pos_distance = [self.system.particles[i].position for i in range(6)]
+
+        self.tearDown()
+        self.setUp()
+
+        constraint = md.constrain.settle()
+        md.integrate.mode_standard(dt=0.005)
+        md.integrate.nve(group=group.all())
+        run(100)
+        for i in range(6):
+            for k in range(3):
+                self.assertAlmostEqual(self.system.particles[i].position[k], pos_distance[i][k], 5)
+
+    # test that molecules other than triangles are rejected
+    def test_not_triangle(self):
+        self.system.constraints.add(2,3,5.0)
+        constraint = md.constrain.settle()
+        md.integrate.mode_standard(dt=0.005)
+        md.integrate.nve(group=group.all())
+        if comm.get_num_ranks() == 1:
+            self.assertRaises(RuntimeError, run, 1);
+
+    # test setting parameters
+    def test_set_params(self):
+        constraint = md.constrain.settle()
+        constraint.set_params(rel_tol=0.01)
+
+    def tearDown(self):
+        del self.system
+        del self.nl
+        context.initialize();
+
+if __name__ == '__main__':
+    unittest.main(argv = ['test.py', '-v'])
@@ -107,6 +107,34 @@ class dihedral_table_tests (unittest.TestCase):
         v = harmonic.cpp_force.getEntry(0,4)
         numpy.testing.assert_allclose([6.0, -5.0], [v.x, v.y])
 
+    # compare a spline table on uneven knots against harmonic dihedral
+    def test_hermite_compare(self):
+        if context.exec_conf.isCUDAEnabled():
+            return;
+
+        knots = [math.pi*(-1.0 + 2.0*(i/79.0)**1.5) for i in range(80)]
+        harmonic_1 = md.dihedral.table(width=10, interpolation='hermite')
+        harmonic_1.dihedral_coeff.set('dihedralA', func=lambda theta: (0.5*1*( 1 + math.cos(theta)), 0.5*1*math.sin(theta)),
+                                      coeff=dict(), knots=knots)
+        harmonic_2 = md.dihedral.harmonic()
+        harmonic_2.dihedral_coeff.set('dihedralA', k=1.0, d=1,n=1)
+        md.integrate.mode_standard(dt=0.005);
+        all = group.all()
+        md.integrate.nve(all)
+        run(1)
+        for i in range(len(self.sys.particles)):
+            f_1 = harmonic_1.forces[i]
+            f_2 = harmonic_2.forces[i]
+            # 80 knots are more accurate than the 1000 point linear table
+            self.assertAlmostEqual(f_1.energy, f_2.energy,3)
+            self.assertAlmostEqual(f_1.force[0], f_2.force[0],2)
+            self.assertAlmostEqual(f_1.force[1], f_2.force[1],2)
+            self.assertAlmostEqual(f_1.force[2], f_2.force[2],2)
+
+    # test invalid interpolation
+    def test_invalid_interpolation(self):
+        self.assertRaises(ValueError, md.dihedral.table, width=10, interpolation='quintic');
+
     def tearDown(self):
         del self.sys
         context.initialize();
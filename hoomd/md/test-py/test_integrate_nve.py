@@ -6,13 +6,14 @@ from hoomd import md;
 context.initialize()
 import unittest
 import os
+import numpy
 
 # unit tests for md.integrate.nve
 class integrate_nve_tests (unittest.TestCase):
     def setUp(self):
         print
-        init.create_lattice(lattice.sc(a=2.1878096788957757),n=[5,5,4]); #target a packing fraction of 0.05
-        md.force.constant(fx=0.1, fy=0.1, fz=0.1)
+        self.s = init.create_lattice(lattice.sc(a=2.1878096788957757),n=[5,5,4]); #target a packing fraction of 0.05
+        self.const = md.force.constant(fx=0.1, fy=0.1, fz=0.1)
 
         context.current.sorter.set_params(grid=8)
 
@@ -40,6 +41,111 @@ class integrate_nve_tests (unittest.TestCase):
         nve.set_params(limit=0.1);
         nve.set_params(zero_force=False);
 
+    # assign reproducible random velocities with zero net momentum
+    def randomize_velocities(self):
+        snap = self.s.take_snapshot();
+        if comm.get_rank() == 0:
+            numpy.random.seed(12);
+            v = numpy.random.normal(0.0, 1.0, size=(snap.particles.N, 3));
+            snap.particles.velocity[:] = v - numpy.mean(v, axis=0);
+        self.s.restore_snapshot(snap);
+        return snap;
+
+    # test that multiple time step integration with period 1 is the same as standard integration
+    def test_multiple_timestep_period_one(self):
+        nl = md.nlist.cell();
+        lj = md.pair.lj(r_cut=2.5, nlist=nl);
+        lj.pair_coeff.set('A', 'A', epsilon=1.0, sigma=1.0);
+        slow = md.pair.gauss(r_cut=3.0, nlist=nl);
+        slow.pair_coeff.set('A', 'A', epsilon=0.5, sigma=1.0);
+        snap0 = self.randomize_velocities();
+
+        mode = md.integrate.mode_standard(dt=0.005);
+        md.integrate.nve(group.all());
+        run(25);
+        ref = self.s.take_snapshot();
+
+        self.s.restore_snapshot(snap0);
+        mode.set_multiple_timestep(forces=[slow], period=1);
+        run(10);
+        run(15);
+        snap = self.s.take_snapshot();
+
+        if comm.get_rank() == 0:
+            numpy.testing.assert_allclose(snap.particles.position, ref.particles.position, rtol=1e-5, atol=1e-5);
+            numpy.testing.assert_allclose(snap.particles.velocity, ref.particles.velocity, rtol=1e-5, atol=1e-5);
+
+    # test that the slow impulse is exact when runs start and end between slow steps
+    def test_multiple_timestep_impulse(self):
+        slow = md.force.constant(fx=-0.05, fy=0.02, fz=0.0);
+        mode = md.integrate.mode_standard(dt=0.005);
+        md.integrate.nve(group.all());
+        mode.set_multiple_timestep(forces=[slow], period=3);
+
+        # start on a step that is not a multiple of the period and end with a run of whole periods
+        run(7);
+        run(5);
+        run(9);
+
+        snap = self.s.take_snapshot();
+        if comm.get_rank() == 0:
+            v = numpy.mean(snap.particles.velocity, axis=0);
+            numpy.testing.assert_allclose(v, 21*0.005*numpy.array([0.1-0.05, 0.1+0.02, 0.1]), rtol=1e-5);
+
+    # test that the slow impulse is exact for uneven restarts, empty runs and period changes between runs
+    def test_multiple_timestep_impulse_uneven(self):
+        slow = md.force.constant(fx=-0.05, fy=0.02, fz=0.0);
+        mode = md.integrate.mode_standard(dt=0.005);
+        md.integrate.nve(group.all());
+
+        mode.set_multiple_timestep(forces=[slow], period=4);
+        run(5);
+        run(0);
+        mode.set_multiple_timestep(forces=[slow], period=2);
+        run(3);
+        run(1);
+
+        # the last run covers whole periods, so no part of the impulse is left over
+        mode.set_multiple_timestep(forces=[slow], period=4);
+        run(8);
+
+        snap = self.s.take_snapshot();
+        if comm.get_rank() == 0:
+            v = numpy.mean(snap.particles.velocity, axis=0);
+            numpy.testing.assert_allclose(v, 17*0.005*numpy.array([0.1-0.05, 0.1+0.02, 0.1]), rtol=1e-5);
+
+    # test energy conservation with a slow force
+    def test_multiple_timestep_energy(self):
+        self.const.disable();
+        nl = md.nlist.cell();
+        lj = md.pair.lj(r_cut=2.5, nlist=nl);
+        lj.pair_coeff.set('A', 'A', epsilon=1.0, sigma=1.0);
+        lj.set_params(mode='shift');
+        slow = md.pair.gauss(r_cut=3.0, nlist=nl);
+        slow.pair_coeff.set('A', 'A', epsilon=0.5, sigma=1.0);
+        slow.set_params(mode='shift');
+        self.randomize_velocities();
+
+        mode = md.integrate.mode_standard(dt=0.002);
+        md.integrate.nve(group.all());
+        mode.set_multiple_timestep(forces=[slow], period=3);
+
+        # log on steps that are not slow steps, the slow energy must still be included
+        log = analyze.log(filename=None, quantities=['potential_energy', 'kinetic_energy'], period=5);
+        energy = [];
+        def record(timestep):
+            energy.append(log.query('potential_energy') + log.query('kinetic_energy'));
+
+        run(2000, callback=record, callback_period=5);
+        energy = numpy.array(energy)/len(self.s.particles);
+        self.assertLess(numpy.max(numpy.abs(energy - energy[0])), 2e-3);
+    # test multiple time step error checking
+    def test_multiple_timestep_error(self):
+        mode = md.integrate.mode_standard(dt=0.005);
+        self.assertRaises(ValueError, mode.set_multiple_timestep, forces=[], period=0);
+        self.assertRaises(ValueError, mode.set_multiple_timestep, forces=[], period=1.5);
+        self.assertRaises(TypeError, mode.set_multiple_timestep, forces=[mode], period=2);
+
     # test w/ empty group
     def test_empty(self):
         empty = group.cuboid(name="empty", xmin=-100, xmax=-100, ymin=-100, ymax=-100, zmin=-100, zmax=-100)
@@ -55,6 +55,44 @@ class pair_table_tests (unittest.TestCase):
         table.pair_coeff.set('B', 'B', rmin=0.0, rmax=1.0, func=lambda r, rmin, rmax: (r, 2*r), coeff=dict());
         table.update_coeffs();
 
+    # test hermite interpolation against the analytic potential
+    def test_hermite(self):
+        if context.exec_conf.isCUDAEnabled():
+            return;
+
+        def lj(r, rmin, rmax, epsilon, sigma):
+            V = 4 * epsilon * ( (sigma / r)**12 - (sigma / r)**6);
+            F = 4 * epsilon / r * ( 12 * (sigma / r)**12 - 6 * (sigma / r)**6);
+            return (V, F)
+
+        table = md.pair.table(width=100, nlist = self.nl, interpolation='hermite');
+        knots = [0.8 + 2.2*(i/99.0)**2 for i in range(100)];
+        table.pair_coeff.set('A', 'A', rmin=0.8, rmax=3.0, func=lj, coeff=dict(epsilon=1.0, sigma=1.0), knots=knots);
+        lj_ref = md.pair.lj(r_cut=3.0, nlist = self.nl);
+        lj_ref.pair_coeff.set('A', 'A', epsilon=1.0, sigma=1.0);
+        md.integrate.mode_standard(dt=0.005);
+        md.integrate.nve(group.all());
+        run(1);
+
+        for i in range(0, len(self.s.particles), 17):
+            self.assertAlmostEqual(table.forces[i].energy, lj_ref.forces[i].energy, places=4);
+            for k in range(3):
+                self.assertAlmostEqual(table.forces[i].force[k], lj_ref.forces[i].force[k], places=3);
+
+    # test that knots must cover rmin to rmax
+    def test_hermite_knots(self):
+        if context.exec_conf.isCUDAEnabled():
+            return;
+
+        table = md.pair.table(width=100, nlist = self.nl, interpolation='hermite');
+        table.pair_coeff.set('A', 'A', rmin=0.0, rmax=1.0, func=lambda r, rmin, rmax: (r, 2*r), coeff=dict(),
+                             knots=[0.0, 0.5]);
+        self.assertRaises(RuntimeError, table.update_coeffs);
+
+    # test invalid interpolation
+    def test_invalid_interpolation(self):
+        self.assertRaises(ValueError, md.pair.table, width=100, nlist = self.nl, interpolation='quintic');
+
     def tearDown(self):
         del self.s, self.nl
         context.initialize();
@@ -0,0 +1,63 @@
+# -*- coding: iso-8859-1 -*-
+
+from hoomd import *
+from hoomd import md;
+from hoomd import _hoomd
+context.initialize()
+import unittest
+import numpy
+
+# md.pair.tersoff
+class pair_tersoff_tests (unittest.TestCase):
+    def setUp(self):
+        print
+        self.s = init.create_lattice(lattice.sc(a=1.5),n=[8,8,8]);
+
+        # displace the particles, so that the forces do not cancel by symmetry
+        snap = self.s.take_snapshot()
+        if comm.get_rank() == 0:
+            numpy.random.seed(11)
+            snap.particles.position[:] += numpy.random.uniform(-0.1, 0.1, size=(snap.particles.N, 3))
+        self.s.restore_snapshot(snap)
+
+        self.nl = md.nlist.cell()
+        self.tersoff = md.pair.tersoff(r_cut=2.0, nlist=self.nl)
+        self.tersoff.pair_coeff.set('A', 'A', C1=2.0, C2=1.0, lambda1=2.0, lambda2=1.0, dimer_r=1.5, n=1.0,
+                                    gamma=0.5, lambda3=0.5, c=1.0, d=1.0, m=0.0)
+
+        # do not move the particles
+        md.integrate.mode_standard(dt=0.0)
+        md.integrate.nve(group=group.all())
+
+    # forces sum to zero
+    def test_momentum(self):
+        run(1)
+        F = numpy.array([f.force for f in self.tersoff.forces])
+        self.assertGreater(numpy.max(numpy.abs(F)), 1e-3)
+        numpy.testing.assert_allclose(numpy.sum(F, axis=0), [0, 0, 0], atol=1e-6)
+
+    # forces do not depend on the number of threads
+    def test_threads(self):
+        if context.exec_conf.isCUDAEnabled() or not _hoomd.is_TBB_available():
+            return
+
+        option.set_num_threads(1)
+        run(1)
+        F1 = numpy.array([f.force for f in self.tersoff.forces])
+        U1 = numpy.array([f.energy for f in self.tersoff.forces])
+
+        option.set_num_threads(4)
+        run(1)
+        F4 = numpy.array([f.force for f in self.tersoff.forces])
+        U4 = numpy.array([f.energy for f in self.tersoff.forces])
+
+        numpy.testing.assert_allclose(F4, F1, rtol=1e-6, atol=1e-10)
+        numpy.testing.assert_allclose(U4, U1, rtol=1e-6, atol=1e-10)
+
+    def tearDown(self):
+        del self.s, self.nl, self.tersoff
+        context.initialize();
+
+
+if __name__ == '__main__':
+    unittest.main(argv = ['test.py', '-v'])
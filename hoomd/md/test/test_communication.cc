@@ -3157,6 +3157,87 @@ struct two_type_ghost_layer
     Scalar m_r_B;   //<! Second cutoff
     };
 
+//! Test that the communication of an isotropic system does not allocate the anisotropic particle arrays
+void test_communicator_isotropic(communicator_creator comm_creator, std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // this test needs to be run on eight processors
+    int size;
+    MPI_Comm_size(exec_conf->getHOOMDWorldMPICommunicator(), &size);
+    UP_ASSERT_EQUAL(size,8);
+
+    // create a system with eight + 1 one ptls (1 ptl in ghost layer)
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(9,          // number of particles
+                                                             BoxDim(2.0), // box dimensions
+                                                             1,           // number of particle types
+                                                             0,           // number of bond types
+                                                             0,           // number of angle types
+                                                             0,           // number of dihedral types
+                                                             0,           // number of dihedral types
+                                                             exec_conf));
+
+    std::shared_ptr<ParticleData> pdata(sysdef->getParticleData());
+
+    // place one particle in the middle of every box (outside the ghost layer)
+    pdata->setPosition(0, make_scalar3(-0.5,-0.5,-0.5),false);
+    pdata->setPosition(1, make_scalar3( 0.5,-0.5,-0.5),false);
+    pdata->setPosition(2, make_scalar3(-0.5, 0.5,-0.5),false);
+    pdata->setPosition(3, make_scalar3( 0.5, 0.5,-0.5),false);
+    pdata->setPosition(4, make_scalar3(-0.5,-0.5, 0.5),false);
+    pdata->setPosition(5, make_scalar3( 0.5,-0.5, 0.5),false);
+    pdata->setPosition(6, make_scalar3(-0.5, 0.5, 0.5),false);
+    pdata->setPosition(7, make_scalar3( 0.5, 0.5, 0.5),false);
+
+    // particle 8 in the ghost layer of its +x neighbor
+    pdata->setPosition(8, make_scalar3( -0.05, -0.5, -0.5),false);
+
+    // distribute particle data on processors
+    SnapshotParticleData<Scalar> snap(9);
+    pdata->takeSnapshot(snap);
+
+    // initialize a 2x2x2 domain decomposition on processor with rank 0
+    std::shared_ptr<DomainDecomposition> decomposition(new DomainDecomposition(exec_conf,  pdata->getBox().getL()));
+    std::shared_ptr<Communicator> comm = comm_creator(sysdef, decomposition);
+
+    pdata->setDomainDecomposition(decomposition);
+
+    pdata->initializeFromSnapshot(snap);
+    UP_ASSERT(!pdata->hasAnisotropicArrays());
+
+    // communicate all fields an isotropic simulation uses
+    CommFlags flags(0);
+    flags[comm_flag::tag] = 1;
+    flags[comm_flag::position] = 1;
+    flags[comm_flag::velocity] = 1;
+    flags[comm_flag::charge] = 1;
+    flags[comm_flag::diameter] = 1;
+    comm->setFlags(flags);
+
+    comm->getGhostLayerWidthRequestSignal().connect<&ghost_layer_width_request_3>();
+
+    comm->migrateParticles();
+    comm->exchangeGhosts();
+    comm->beginUpdateGhosts(0);
+    comm->finishUpdateGhosts(0);
+
+    // move particle 8 into the neighboring domain and migrate it
+    pdata->setPosition(8, make_scalar3( 0.05, -0.5, -0.5),false);
+    pdata->removeAllGhostParticles();
+    comm->migrateParticles();
+    comm->exchangeGhosts();
+    comm->beginUpdateGhosts(0);
+    comm->finishUpdateGhosts(0);
+
+    UP_ASSERT_EQUAL(pdata->getNGlobal(), (unsigned int)9);
+    UP_ASSERT(!pdata->hasAnisotropicArrays());
+
+    // requesting the orientations allocates the arrays
+    flags[comm_flag::orientation] = 1;
+    comm->setFlags(flags);
+    pdata->removeAllGhostParticles();
+    comm->exchangeGhosts();
+    UP_ASSERT(pdata->hasAnisotropicArrays());
+    }
+
 //! Test setting the ghost layer width
 void test_communicator_ghost_layer_width(communicator_creator comm_creator, std::shared_ptr<ExecutionConfiguration> exec_conf)
     {
@@ -3639,6 +3720,14 @@ UP_TEST( communicator_ghost_fields_test)
     test_communicator_ghost_fields(communicator_creator_base, exec_conf);
     }
 
+UP_TEST( communicator_isotropic_test)
+    {
+    auto exec_conf = std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU));;
+
+    communicator_creator communicator_creator_base = bind(base_class_communicator_creator, _1, _2);
+    test_communicator_isotropic(communicator_creator_base, exec_conf);
+    }
+
 UP_TEST( communicator_ghost_layer_width_test)
     {
     auto exec_conf = std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU));;
@@ -3843,6 +3932,14 @@ UP_TEST( communicator_ghost_fields_test_GPU)
     test_communicator_ghost_fields(communicator_creator_gpu, exec_conf);
     }
 
+UP_TEST( communicator_isotropic_test_GPU)
+    {
+    auto exec_conf = std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::GPU));
+
+    communicator_creator communicator_creator_gpu = bind(gpu_communicator_creator, _1, _2);
+    test_communicator_isotropic(communicator_creator_gpu, exec_conf);
+    }
+
 UP_TEST( communicator_ghost_layer_width_test_GPU)
     {
     auto exec_conf = std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::GPU));
@@ -443,6 +443,61 @@ void const_force_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
     }
     }
 
+//! Check that the bond index table translates the members and follows particle reordering
+void bond_index_table_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // 4 particles in a huge box with two bond types, bonds are added out of memory order
+    std::shared_ptr<SystemDefinition> sysdef_4(new SystemDefinition(4, BoxDim(1000.0), 1, 2, 0, 0, 0, exec_conf));
+    std::shared_ptr<ParticleData> pdata_4 = sysdef_4->getParticleData();
+    std::shared_ptr<BondData> bond_data = sysdef_4->getBondData();
+
+    bond_data->addBondedGroup(Bond(1, 2, 3));
+    bond_data->addBondedGroup(Bond(0, 0, 1));
+    bond_data->addBondedGroup(Bond(1, 1, 2));
+
+    {
+    ArrayHandle<BondData::members_t> h_table(bond_data->getIndexTable(), access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(bond_data->getIndexTableTypeVal(), access_location::host,
+        access_mode::read);
+    UP_ASSERT_EQUAL(h_table.data[0].idx[0], 0);
+    UP_ASSERT_EQUAL(h_table.data[0].idx[1], 1);
+    UP_ASSERT_EQUAL(h_typeval.data[0].type, 0);
+    UP_ASSERT_EQUAL(h_table.data[1].idx[0], 1);
+    UP_ASSERT_EQUAL(h_table.data[1].idx[1], 2);
+    UP_ASSERT_EQUAL(h_typeval.data[1].type, 1);
+    UP_ASSERT_EQUAL(h_table.data[2].idx[0], 2);
+    UP_ASSERT_EQUAL(h_table.data[2].idx[1], 3);
+    UP_ASSERT_EQUAL(h_typeval.data[2].type, 1);
+    }
+
+    // reverse the particle order in memory
+    {
+    ArrayHandle<unsigned int> h_tag(pdata_4->getTags(), access_location::host, access_mode::readwrite);
+    ArrayHandle<unsigned int> h_rtag(pdata_4->getRTags(), access_location::host, access_mode::readwrite);
+    for (unsigned int i = 0; i < 4; i++)
+        {
+        h_tag.data[i] = 3 - i;
+        h_rtag.data[3 - i] = i;
+        }
+    }
+    pdata_4->notifyParticleSort();
+
+    {
+    ArrayHandle<BondData::members_t> h_table(bond_data->getIndexTable(), access_location::host, access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(bond_data->getIndexTableTypeVal(), access_location::host,
+        access_mode::read);
+    UP_ASSERT_EQUAL(h_table.data[0].idx[0], 1);
+    UP_ASSERT_EQUAL(h_table.data[0].idx[1], 0);
+    UP_ASSERT_EQUAL(h_typeval.data[0].type, 1);
+    UP_ASSERT_EQUAL(h_table.data[1].idx[0], 2);
+    UP_ASSERT_EQUAL(h_table.data[1].idx[1], 1);
+    UP_ASSERT_EQUAL(h_typeval.data[1].type, 1);
+    UP_ASSERT_EQUAL(h_table.data[2].idx[0], 3);
+    UP_ASSERT_EQUAL(h_table.data[2].idx[1], 2);
+    UP_ASSERT_EQUAL(h_typeval.data[2].type, 0);
+    }
+    }
+
 //! PotentialBondHarmonic creator for bond_force_basic_tests()
 std::shared_ptr<PotentialBondHarmonic> base_class_bf_creator(std::shared_ptr<SystemDefinition> sysdef)
     {
@@ -487,3 +542,9 @@ UP_TEST( ConstForceCompute_basic )
     {
     const_force_test(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+
+//! test case for the bond index table
+UP_TEST( BondData_index_table )
+    {
+    bond_index_table_test(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include <algorithm>
+#include <set>
 
 #include <memory>
 
@@ -15,6 +16,7 @@
 #include "hoomd/md/NeighborListStencil.h"
 #include "hoomd/md/NeighborListTree.h"
 #include "hoomd/Initializers.h"
+#include "hoomd/md/AllPairPotentials.h"
 
 #ifdef ENABLE_CUDA
 #include "hoomd/md/NeighborListGPU.h"
@@ -869,6 +871,159 @@ void neighborlist_diameter_shift_tests(std::shared_ptr<ExecutionConfiguration> e
     }
 
 
+//! Tests exclusions between particles whose tags are far apart
+/*! Exclusions between tags that differ by 32 or more are not covered by the per-particle bitmask and take the sorted
+    list path in NeighborList::isExcludedIdx(). The list built with the exclusions is compared against the list built
+    without them and filtered afterwards, and the LJ forces computed with it against a direct sum over the pairs that
+    are not excluded. Both full and half lists are checked.
+*/
+template <class NL>
+void neighborlist_far_exclusion_tests(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // construct the particle system
+    RandomInitializer init(1000, Scalar(0.016778), Scalar(0.9), "A");
+    std::shared_ptr< SnapshotSystemData<Scalar> > snap = init.getSnapshot();
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+    const unsigned int N = pdata->getN();
+    const Scalar r_cut(3.0);
+
+    // exclude every other pair of neighbors and all pairs of consecutive tags, so that both the bitmask and the far
+    // list are in use for most particles
+    std::set< std::pair<unsigned int, unsigned int> > excluded;
+    unsigned int n_far = 0;
+        {
+        std::shared_ptr<NeighborList> nlist(new NL(sysdef, r_cut, Scalar(0.4)));
+        nlist->setRCutPair(0,0,r_cut);
+        nlist->setStorageMode(NeighborList::full);
+        nlist->compute(0);
+
+        ArrayHandle<unsigned int> h_n_neigh(nlist->getNNeighArray(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_nlist(nlist->getNListArray(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_head_list(nlist->getHeadList(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+
+        for (unsigned int i = 0; i < N; i++)
+            {
+            unsigned int tag_i = h_tag.data[i];
+            if (tag_i + 1 < N)
+                excluded.insert(std::make_pair(tag_i, tag_i + 1));
+
+            for (unsigned int k = 0; k < h_n_neigh.data[i]; k++)
+                {
+                unsigned int tag_j = h_tag.data[h_nlist.data[h_head_list.data[i] + k]];
+                if ((tag_i + tag_j) % 2 == 0)
+                    excluded.insert(std::make_pair(std::min(tag_i, tag_j), std::max(tag_i, tag_j)));
+                }
+            }
+        }
+
+    for (std::set< std::pair<unsigned int, unsigned int> >::iterator ex = excluded.begin(); ex != excluded.end(); ++ex)
+        {
+        if (ex->second - ex->first >= 32)
+            n_far++;
+        }
+    UP_ASSERT(n_far > 100);
+
+    // reference forces: direct sum over all pairs within the cutoff that are not excluded
+    const Scalar lj1 = Scalar(4.0);
+    const Scalar lj2 = Scalar(4.0);
+    std::vector<Scalar3> ref_force(N, make_scalar3(0,0,0));
+        {
+        ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+        const BoxDim& box = pdata->getBox();
+
+        for (unsigned int i = 0; i < N; i++)
+            {
+            for (unsigned int j = i+1; j < N; j++)
+                {
+                unsigned int tag_i = h_tag.data[i];
+                unsigned int tag_j = h_tag.data[j];
+                if (excluded.count(std::make_pair(std::min(tag_i, tag_j), std::max(tag_i, tag_j))))
+                    continue;
+
+                Scalar3 dx = make_scalar3(h_pos.data[i].x - h_pos.data[j].x,
+                                          h_pos.data[i].y - h_pos.data[j].y,
+                                          h_pos.data[i].z - h_pos.data[j].z);
+                dx = box.minImage(dx);
+                Scalar rsq = dot(dx, dx);
+                if (rsq >= r_cut*r_cut)
+                    continue;
+
+                Scalar r2inv = Scalar(1.0)/rsq;
+                Scalar r6inv = r2inv*r2inv*r2inv;
+                Scalar force_divr = r2inv*r6inv*(Scalar(12.0)*lj1*r6inv - Scalar(6.0)*lj2);
+                ref_force[i] += force_divr*dx;
+                ref_force[j] -= force_divr*dx;
+                }
+            }
+        }
+
+    const NeighborList::storageMode modes[] = {NeighborList::full, NeighborList::half};
+    for (unsigned int m = 0; m < 2; m++)
+        {
+        std::shared_ptr<NeighborList> nlist_all(new NL(sysdef, r_cut, Scalar(0.4)));
+        nlist_all->setRCutPair(0,0,r_cut);
+        nlist_all->setStorageMode(modes[m]);
+        nlist_all->compute(0);
+
+        std::shared_ptr<NeighborList> nlist_ex(new NL(sysdef, r_cut, Scalar(0.4)));
+        nlist_ex->setRCutPair(0,0,r_cut);
+        nlist_ex->setStorageMode(modes[m]);
+        for (std::set< std::pair<unsigned int, unsigned int> >::iterator ex = excluded.begin(); ex != excluded.end(); ++ex)
+            nlist_ex->addExclusion(ex->first, ex->second);
+        nlist_ex->compute(0);
+
+            {
+            ArrayHandle<unsigned int> h_n_neigh_all(nlist_all->getNNeighArray(), access_location::host, access_mode::read);
+            ArrayHandle<unsigned int> h_nlist_all(nlist_all->getNListArray(), access_location::host, access_mode::read);
+            ArrayHandle<unsigned int> h_head_list_all(nlist_all->getHeadList(), access_location::host, access_mode::read);
+            ArrayHandle<unsigned int> h_n_neigh_ex(nlist_ex->getNNeighArray(), access_location::host, access_mode::read);
+            ArrayHandle<unsigned int> h_nlist_ex(nlist_ex->getNListArray(), access_location::host, access_mode::read);
+            ArrayHandle<unsigned int> h_head_list_ex(nlist_ex->getHeadList(), access_location::host, access_mode::read);
+            ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+
+            // the list built with exclusions must equal the list built without them and filtered afterwards
+            std::vector<unsigned int> expected;
+            std::vector<unsigned int> actual;
+            for (unsigned int i = 0; i < N; i++)
+                {
+                unsigned int tag_i = h_tag.data[i];
+
+                expected.clear();
+                for (unsigned int k = 0; k < h_n_neigh_all.data[i]; k++)
+                    {
+                    unsigned int j = h_nlist_all.data[h_head_list_all.data[i] + k];
+                    unsigned int tag_j = h_tag.data[j];
+                    if (!excluded.count(std::make_pair(std::min(tag_i, tag_j), std::max(tag_i, tag_j))))
+                        expected.push_back(j);
+                    }
+
+                actual.assign(h_nlist_ex.data + h_head_list_ex.data[i],
+                              h_nlist_ex.data + h_head_list_ex.data[i] + h_n_neigh_ex.data[i]);
+
+                sort(expected.begin(), expected.end());
+                sort(actual.begin(), actual.end());
+                UP_ASSERT(actual == expected);
+                }
+            }
+
+        std::shared_ptr<PotentialPairLJ> fc(new PotentialPairLJ(sysdef, nlist_ex));
+        fc->setRcut(0, 0, r_cut);
+        fc->setParams(0, 0, make_scalar2(lj1, lj2));
+        fc->compute(0);
+
+        ArrayHandle<Scalar4> h_force(fc->getForceArray(), access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            MY_CHECK_SMALL(h_force.data[i].x - ref_force[i].x, tol_small*(Scalar(1.0) + fabs(ref_force[i].x)));
+            MY_CHECK_SMALL(h_force.data[i].y - ref_force[i].y, tol_small*(Scalar(1.0) + fabs(ref_force[i].y)));
+            MY_CHECK_SMALL(h_force.data[i].z - ref_force[i].z, tol_small*(Scalar(1.0) + fabs(ref_force[i].z)));
+            }
+        }
+    }
+
 //! Test two implementations of NeighborList and verify that the output is identical
 template <class NLA, class NLB>
 void neighborlist_comparison_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
@@ -1214,6 +1369,11 @@ UP_TEST( NeighborListBinned_large_ex )
     {
     neighborlist_large_ex_tests<NeighborListBinned>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+//! far exclusion test case for binned class
+UP_TEST( NeighborListBinned_far_exclusion )
+    {
+    neighborlist_far_exclusion_tests<NeighborListBinned>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
 //! body filter test case for binned class
 UP_TEST( NeighborListBinned_body_filter)
     {
@@ -1264,6 +1424,11 @@ UP_TEST( NeighborListStencil_large_ex )
     {
     neighborlist_large_ex_tests<NeighborListStencil>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+//! far exclusion test case for stencil class
+UP_TEST( NeighborListStencil_far_exclusion )
+    {
+    neighborlist_far_exclusion_tests<NeighborListStencil>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
 //! body filter test case for stencil class
 UP_TEST( NeighborListStencil_body_filter)
     {
@@ -1318,6 +1483,11 @@ UP_TEST( NeighborListTree_large_ex )
     {
     neighborlist_large_ex_tests<NeighborListTree>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
+//! far exclusion test case for tree class
+UP_TEST( NeighborListTree_far_exclusion )
+    {
+    neighborlist_far_exclusion_tests<NeighborListTree>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
 //! body filter test case for tree class
 UP_TEST( NeighborListTree_body_filter)
     {
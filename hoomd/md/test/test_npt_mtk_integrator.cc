@@ -512,6 +512,106 @@ void nph_integration_test(twostep_npt_mtk_creator nph_creator, std::shared_ptr<E
     MY_CHECK_CLOSE(P, avrP, rough_tol);
     }
 
+//! Checks that the kinetic tensor accumulated by the integrator gives the same thermodynamic quantities
+/*! TwoStepNPTMTK hands the kinetic tensor of the updated velocities to its thermo compute for the full time step when
+    both act on the same group. The second system uses thermo computes on an equivalent but distinct group, which sum
+    the velocities themselves. Both runs must report the same kinetic energy, pressure and volume.
+*/
+void npt_mtk_fused_kinetic_test(twostep_npt_mtk_creator npt_mtk_creator, std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    const unsigned int N = 1000;
+    Scalar T0 = 1.0;
+
+    RandomInitializer rand_init(N, Scalar(0.2), Scalar(0.9), "A");
+    rand_init.setSeed(12345);
+    std::shared_ptr< SnapshotSystemData<Scalar> > snap = rand_init.getSnapshot();
+
+    // give the particles velocities according to a Maxwell-Boltzmann distribution
+    detail::Saru saru(54321);
+    for (unsigned int idx = 0; idx < snap->particle_data.size; idx++)
+        {
+        Scalar sigma = T0 / snap->particle_data.mass[idx];
+        Scalar vx = gaussianRand(saru, sigma);
+        Scalar vy = gaussianRand(saru, sigma);
+        Scalar vz = gaussianRand(saru, sigma);
+        snap->particle_data.vel[idx] = vec3<Scalar>(vx, vy, vz);
+        }
+
+    PDataFlags flags;
+    flags[pdata_flag::pressure_tensor] = 1;
+    flags[pdata_flag::isotropic_virial] = 1;
+
+    std::shared_ptr<SystemDefinition> sysdef[2];
+    std::shared_ptr<ComputeThermo> thermo_t[2];
+    std::shared_ptr<IntegratorTwoStep> npt[2];
+    std::shared_ptr<PotentialPairLJ> fc[2];
+
+    for (unsigned int k = 0; k < 2; k++)
+        {
+        sysdef[k] = std::shared_ptr<SystemDefinition>(new SystemDefinition(snap, exec_conf));
+        std::shared_ptr<ParticleData> pdata = sysdef[k]->getParticleData();
+        pdata->setFlags(flags);
+
+        std::shared_ptr<ParticleSelector> selector_all(new ParticleSelectorTag(sysdef[k], 0, pdata->getN()-1));
+        std::shared_ptr<ParticleGroup> group_all(new ParticleGroup(sysdef[k], selector_all));
+
+        // the first system integrates and computes the thermodynamic properties of the same group, the second one
+        // computes them for a copy of the group
+        std::shared_ptr<ParticleGroup> group_thermo = group_all;
+        if (k == 1)
+            group_thermo = std::shared_ptr<ParticleGroup>(new ParticleGroup(sysdef[k], selector_all));
+
+        std::shared_ptr<CellList> cl(new CellList(sysdef[k]));
+        std::shared_ptr<NeighborList> nlist(new NeighborListBinned(sysdef[k], Scalar(2.5), Scalar(0.8), cl));
+        fc[k] = std::shared_ptr<PotentialPairLJ>(new PotentialPairLJ(sysdef[k], nlist));
+        fc[k]->setRcut(0, 0, Scalar(pow(Scalar(2.0),Scalar(1./6.))));
+        fc[k]->setParams(0,0,make_scalar2(Scalar(4.0),Scalar(4.0)));
+        fc[k]->setShiftMode(PotentialPairLJ::shift);
+
+        std::shared_ptr<ComputeThermo> thermo(new ComputeThermo(sysdef[k], group_thermo, "name"));
+        thermo->setNDOF(3*N-3);
+        thermo_t[k] = std::shared_ptr<ComputeThermo>(new ComputeThermo(sysdef[k], group_thermo, "name_t"));
+        thermo_t[k]->setNDOF(3*N-3);
+
+        args_t args;
+        args.sysdef = sysdef[k];
+        args.group = group_all;
+        args.thermo_group = thermo;
+        args.thermo_group_t = thermo_t[k];
+        args.tau = 1.0;
+        args.tauP = 1.0;
+        args.T = T0;
+        args.P = 1.0;
+        args.mode = TwoStepNPTMTK::couple_xyz;
+        args.flags = TwoStepNPTMTK::baro_x | TwoStepNPTMTK::baro_y | TwoStepNPTMTK::baro_z;
+
+        npt[k] = std::shared_ptr<IntegratorTwoStep>(new IntegratorTwoStep(sysdef[k], Scalar(0.001)));
+        npt[k]->addIntegrationMethod(npt_mtk_creator(args));
+        npt[k]->addForceCompute(fc[k]);
+        npt[k]->prepRun(0);
+        }
+
+    // the two sums differ only in round-off, so the runs stay together for a while
+    Scalar tol = Scalar(1e-6);
+    for (int i = 0; i < 100; i++)
+        {
+        npt[0]->update(i);
+        npt[1]->update(i);
+
+        MY_CHECK_CLOSE(thermo_t[0]->getKineticEnergy(), thermo_t[1]->getKineticEnergy(), tol);
+        MY_CHECK_CLOSE(thermo_t[0]->getPressure(), thermo_t[1]->getPressure(), tol);
+
+        PressureTensor P0 = thermo_t[0]->getPressureTensor();
+        PressureTensor P1 = thermo_t[1]->getPressureTensor();
+        MY_CHECK_CLOSE(P0.xx, P1.xx, tol);
+        MY_CHECK_CLOSE(P0.yy, P1.yy, tol);
+        MY_CHECK_CLOSE(P0.zz, P1.zz, tol);
+
+        MY_CHECK_CLOSE(sysdef[0]->getParticleData()->getBox().getVolume(),
+                       sysdef[1]->getParticleData()->getBox().getVolume(), tol);
+        }
+    }
+
 //! Basic functionality test of a generic TwoStepNPTMTK for anisotropic pair potential
 void npt_mtk_updater_aniso(twostep_npt_mtk_creator npt_mtk_creator, std::shared_ptr<ExecutionConfiguration> exec_conf)
     {
@@ -860,6 +960,13 @@ UP_TEST( TwoStepNPTMTK_cubic_NPH )
     nph_integration_test(npt_mtk_creator, std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+//! test case for comparing the fused and the separate kinetic tensor sums
+UP_TEST( TwoStepNPTMTK_fused_kinetic )
+    {
+    twostep_npt_mtk_creator npt_mtk_creator = bind(base_class_npt_mtk_creator, _1);
+    npt_mtk_fused_kinetic_test(npt_mtk_creator, std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_CUDA
 //! test case for GPU integration tests
 UP_TEST( TwoStepNPTMTKGPU_tests )
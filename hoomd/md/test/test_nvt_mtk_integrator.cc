@@ -384,6 +384,99 @@ void nvt_updater_compare_test(twostepnvt_creator nvt_creator1, twostepnvt_creato
         }
     }
 
+//! Checks that the kinetic tensor accumulated by the integrator gives the same thermodynamic quantities
+/*! TwoStepNVTMTK hands the kinetic tensor of the updated velocities to its thermo compute when both act on the same
+    group. The second system uses a thermo compute on an equivalent but distinct group, which sums the velocities
+    itself. Both runs must report the same kinetic energy, temperature and pressure.
+*/
+void nvt_mtk_fused_kinetic_test(twostepnvt_creator nvt_creator, std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    const unsigned int N = 1000;
+
+    // create two identical random particle systems to simulate
+    RandomInitializer rand_init(N, Scalar(0.2), Scalar(0.9), "A");
+    std::shared_ptr< SnapshotSystemData<Scalar> > snap;
+    rand_init.setSeed(12345);
+    snap = rand_init.getSnapshot();
+
+    // the pressure needs the virials
+    PDataFlags flags;
+    flags[pdata_flag::pressure_tensor] = 1;
+    flags[pdata_flag::isotropic_virial] = 1;
+
+    std::shared_ptr<SystemDefinition> sysdef1(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata1 = sysdef1->getParticleData();
+    pdata1->setFlags(flags);
+    std::shared_ptr<ParticleSelector> selector_all1(new ParticleSelectorTag(sysdef1, 0, pdata1->getN()-1));
+    std::shared_ptr<ParticleGroup> group_all1(new ParticleGroup(sysdef1, selector_all1));
+
+    std::shared_ptr<SystemDefinition> sysdef2(new SystemDefinition(snap, exec_conf));
+    std::shared_ptr<ParticleData> pdata2 = sysdef2->getParticleData();
+    pdata2->setFlags(flags);
+    std::shared_ptr<ParticleSelector> selector_all2(new ParticleSelectorTag(sysdef2, 0, pdata2->getN()-1));
+    std::shared_ptr<ParticleGroup> group_all2(new ParticleGroup(sysdef2, selector_all2));
+    std::shared_ptr<ParticleGroup> group_thermo2(new ParticleGroup(sysdef2, selector_all2));
+
+    std::shared_ptr<NeighborListTree> nlist1(new NeighborListTree(sysdef1, Scalar(3.0), Scalar(0.8)));
+    nlist1->setRCutPair(0,0,3.0);
+    std::shared_ptr<NeighborListTree> nlist2(new NeighborListTree(sysdef2, Scalar(3.0), Scalar(0.8)));
+    nlist2->setRCutPair(0,0,3.0);
+
+    std::shared_ptr<PotentialPairLJ> fc1(new PotentialPairLJ(sysdef1, nlist1));
+    fc1->setRcut(0, 0, Scalar(3.0));
+    std::shared_ptr<PotentialPairLJ> fc2(new PotentialPairLJ(sysdef2, nlist2));
+    fc2->setRcut(0, 0, Scalar(3.0));
+
+    // setup some values for alpha and sigma
+    Scalar epsilon = Scalar(1.0);
+    Scalar sigma = Scalar(1.2);
+    Scalar alpha = Scalar(0.45);
+    Scalar lj1 = Scalar(4.0) * epsilon * pow(sigma,Scalar(12.0));
+    Scalar lj2 = alpha * Scalar(4.0) * epsilon * pow(sigma,Scalar(6.0));
+
+    // specify the force parameters
+    fc1->setParams(0,0,make_scalar2(lj1,lj2));
+    fc2->setParams(0,0,make_scalar2(lj1,lj2));
+
+    std::shared_ptr<IntegratorTwoStep> nvt1(new IntegratorTwoStep(sysdef1, Scalar(0.002)));
+    std::shared_ptr<ComputeThermo> thermo1(new ComputeThermo(sysdef1, group_all1));
+    thermo1->setNDOF(3*N-3);
+    std::shared_ptr<TwoStepNVTMTK> two_step_nvt1 = nvt_creator(sysdef1, group_all1, thermo1, Scalar(0.5), Scalar(1.2));
+    nvt1->addIntegrationMethod(two_step_nvt1);
+
+    std::shared_ptr<IntegratorTwoStep> nvt2(new IntegratorTwoStep(sysdef2, Scalar(0.002)));
+    std::shared_ptr<ComputeThermo> thermo2(new ComputeThermo(sysdef2, group_thermo2));
+    thermo2->setNDOF(3*N-3);
+    std::shared_ptr<TwoStepNVTMTK> two_step_nvt2 = nvt_creator(sysdef2, group_all2, thermo2, Scalar(0.5), Scalar(1.2));
+    nvt2->addIntegrationMethod(two_step_nvt2);
+
+    nvt1->addForceCompute(fc1);
+    nvt2->addForceCompute(fc2);
+
+    nvt1->prepRun(0);
+    nvt2->prepRun(0);
+
+    // the two sums differ only in round-off, so the runs stay together for a while
+    Scalar tol = Scalar(1e-6);
+    for (int i = 0; i < 100; i++)
+        {
+        nvt1->update(i);
+        nvt2->update(i);
+
+        MY_CHECK_CLOSE(thermo1->getKineticEnergy(), thermo2->getKineticEnergy(), tol);
+        MY_CHECK_CLOSE(thermo1->getTranslationalTemperature(), thermo2->getTranslationalTemperature(), tol);
+        MY_CHECK_CLOSE(thermo1->getPressure(), thermo2->getPressure(), tol);
+
+        PressureTensor P1 = thermo1->getPressureTensor();
+        PressureTensor P2 = thermo2->getPressureTensor();
+        MY_CHECK_CLOSE(P1.xx, P2.xx, tol);
+        MY_CHECK_CLOSE(P1.yy, P2.yy, tol);
+        MY_CHECK_CLOSE(P1.zz, P2.zz, tol);
+        }
+
+    UP_ASSERT(thermo1->getKineticEnergy() > Scalar(0.0));
+    }
+
 //! Performs a basic equilibration test of TwoStepNVTMTK
 UP_TEST( TwoStepNVTMTK_basic_test )
     {
@@ -396,6 +489,12 @@ UP_TEST( TwoStepNVTMTK_basic_aniso_test )
     test_nvt_mtk_integrator_aniso(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)),bind(base_class_nvt_creator, _1, _2, _3, _4, _5));
     }
 
+//! Compares the fused and the separate kinetic tensor sums of TwoStepNVTMTK
+UP_TEST( TwoStepNVTMTK_fused_kinetic_test )
+    {
+    nvt_mtk_fused_kinetic_test(bind(base_class_nvt_creator, _1, _2, _3, _4, _5), std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_CUDA
 //! Performs a basic equilibration test of TwoStepNVTMTKGPU
 UP_TEST( TwoStepNVTMTKGPU_basic_test )
@@ -179,6 +179,61 @@ void angle_force_basic_tests(angleforce_creator tf_creator, std::shared_ptr<Exec
 
     }
 
+//! Checks that a spline table on uneven knots reproduces a harmonic angle potential
+/*! The potential is quadratic, which the cubic Hermite spline represents exactly, and the torque is linear, which a
+    fine linear table represents exactly. Both tables must give the same forces.
+*/
+void angle_force_spline_tests(angleforce_creator tf_creator, std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(3, BoxDim(4.5), 1, 0, 1, 0, 0, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    pdata->setPosition(0,make_scalar3(-1.23,2.0,0.1));
+    pdata->setPosition(1,make_scalar3(1.0,1.0,1.0));
+    pdata->setPosition(2,make_scalar3(1.0,0.0,0.5));
+
+    sysdef->getAngleData()->addBondedGroup(Angle(0,0,1,2));
+
+    unsigned int width = 1000;
+    std::shared_ptr<TableAngleForceCompute> fc_linear = tf_creator(sysdef, width);
+    std::shared_ptr<TableAngleForceCompute> fc_spline = tf_creator(sysdef, width);
+
+    Scalar kappa = 1.0;
+    Scalar x0 = 0.785398;
+
+    std::vector<Scalar> V, T;
+    for (unsigned int i = 0; i < width; ++i)
+        {
+        Scalar x = Scalar(0.0) + (Scalar)i/(Scalar)(width-1)*Scalar(M_PI);
+        V.push_back(0.5*kappa*(x-x0)*(x-x0));
+        T.push_back(-kappa*(x-x0));
+        }
+    fc_linear->setTable(0, V, T);
+
+    Scalar knots[] = {Scalar(0.0), Scalar(0.3), Scalar(1.0), Scalar(1.2), Scalar(2.5), Scalar(M_PI)};
+    std::vector<Scalar> x_knots, V_knots, T_knots;
+    for (unsigned int i = 0; i < sizeof(knots)/sizeof(Scalar); ++i)
+        {
+        x_knots.push_back(knots[i]);
+        V_knots.push_back(0.5*kappa*(knots[i]-x0)*(knots[i]-x0));
+        T_knots.push_back(-kappa*(knots[i]-x0));
+        }
+    fc_spline->setSplineTable(0, x_knots, V_knots, T_knots);
+
+    fc_linear->compute(0);
+    fc_spline->compute(0);
+
+    ArrayHandle<Scalar4> h_force_linear(fc_linear->getForceArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_force_spline(fc_spline->getForceArray(), access_location::host, access_mode::read);
+    for (unsigned int i = 0; i < 3; i++)
+        {
+        MY_CHECK_CLOSE(h_force_spline.data[i].x, h_force_linear.data[i].x, tol);
+        MY_CHECK_CLOSE(h_force_spline.data[i].y, h_force_linear.data[i].y, tol);
+        MY_CHECK_CLOSE(h_force_spline.data[i].z, h_force_linear.data[i].z, tol);
+        MY_CHECK_CLOSE(h_force_spline.data[i].w, h_force_linear.data[i].w, tol);
+        }
+    }
+
 #if 0
 //! Compares the output of two TableAngleForceComputes
 void angle_force_comparison_tests(angleforce_creator tf_creator1,
@@ -278,6 +333,13 @@ UP_TEST( TableAngleForceCompute_basic )
     angle_force_basic_tests(tf_creator, std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+//! test case for angle spline tables on the CPU
+UP_TEST( TableAngleForceCompute_spline )
+    {
+    angleforce_creator tf_creator = bind(base_class_tf_creator, _1,_2);
+    angle_force_spline_tests(tf_creator, std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_CUDA
 //! test case for angle forces on the GPU
 UP_TEST( TableAngleForceComputeGPU_basic )
@@ -297,6 +297,62 @@ void dihedral_force_basic_tests(dihedralforce_creator tf_creator, std::shared_pt
 
     }
 
+//! Checks that a spline table on uneven knots reproduces a harmonic dihedral potential
+/*! The potential is quadratic, which the cubic Hermite spline represents exactly, and the torque is linear, which a
+    fine linear table represents exactly. Both tables must give the same forces.
+*/
+void dihedral_force_spline_tests(dihedralforce_creator tf_creator, std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(4, BoxDim(2.5), 1, 0, 0, 1, 0, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    pdata->setPosition(0,make_scalar3(1.0,0.0,0.0));
+    pdata->setPosition(1,make_scalar3(1.0,0.5,0));
+    pdata->setPosition(2,make_scalar3(0.7,0.3,-0.2));
+    pdata->setPosition(3,make_scalar3(0,0.4,-0.6));
+
+    sysdef->getDihedralData()->addBondedGroup(Dihedral(0,0,1,2,3));
+
+    unsigned int width = 1000;
+    std::shared_ptr<TableDihedralForceCompute> fc_linear = tf_creator(sysdef, width);
+    std::shared_ptr<TableDihedralForceCompute> fc_spline = tf_creator(sysdef, width);
+
+    Scalar kappa = 30;
+    Scalar x0 = 0.0;
+
+    std::vector<Scalar> V, T;
+    for (unsigned int i = 0; i < width; ++i)
+        {
+        Scalar x = -Scalar(M_PI) + (Scalar)i/(Scalar)(width-1)*Scalar(2*M_PI);
+        V.push_back(0.5*kappa*(x-x0)*(x-x0));
+        T.push_back(-kappa*(x-x0));
+        }
+    fc_linear->setTable(0, V, T);
+
+    Scalar knots[] = {-Scalar(M_PI), Scalar(-2.0), Scalar(-0.4), Scalar(0.1), Scalar(1.7), Scalar(M_PI)};
+    std::vector<Scalar> x_knots, V_knots, T_knots;
+    for (unsigned int i = 0; i < sizeof(knots)/sizeof(Scalar); ++i)
+        {
+        x_knots.push_back(knots[i]);
+        V_knots.push_back(0.5*kappa*(knots[i]-x0)*(knots[i]-x0));
+        T_knots.push_back(-kappa*(knots[i]-x0));
+        }
+    fc_spline->setSplineTable(0, x_knots, V_knots, T_knots);
+
+    fc_linear->compute(0);
+    fc_spline->compute(0);
+
+    ArrayHandle<Scalar4> h_force_linear(fc_linear->getForceArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_force_spline(fc_spline->getForceArray(), access_location::host, access_mode::read);
+    for (unsigned int i = 0; i < 4; i++)
+        {
+        MY_CHECK_CLOSE(h_force_spline.data[i].x, h_force_linear.data[i].x, tol);
+        MY_CHECK_CLOSE(h_force_spline.data[i].y, h_force_linear.data[i].y, tol);
+        MY_CHECK_CLOSE(h_force_spline.data[i].z, h_force_linear.data[i].z, tol);
+        MY_CHECK_CLOSE(h_force_spline.data[i].w, h_force_linear.data[i].w, tol);
+        }
+    }
+
 #if 0
 //! Compares the output of two TableDihedralForceComputes
 void dihedral_force_comparison_tests(dihedralforce_creator tf_creator1,
@@ -396,6 +452,13 @@ UP_TEST( TableDihedralForceCompute_basic )
     dihedral_force_basic_tests(tf_creator, std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+//! test case for dihedral spline tables on the CPU
+UP_TEST( TableDihedralForceCompute_spline )
+    {
+    dihedralforce_creator tf_creator = bind(base_class_tf_creator, _1,_2);
+    dihedral_force_spline_tests(tf_creator, std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_CUDA
 //! test case for dihedral forces on the GPU
 UP_TEST( TableDihedralForceComputeGPU_basic )
@@ -304,6 +304,63 @@ void table_potential_type_test(table_potential_creator table_creator, std::share
     }
     }
 
+//! checks that spline tables reproduce a cubic potential exactly on uneven knots
+void table_potential_spline_test(table_potential_creator table_creator, std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(2, BoxDim(1000.0), 1, 0, 0, 0, 0, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    {
+    ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::readwrite);
+    h_pos.data[0].x = h_pos.data[0].y = h_pos.data[0].z = 0.0;
+    h_pos.data[1].x = Scalar(1.5); h_pos.data[1].y = h_pos.data[1].z = 0.0;
+    }
+
+    std::shared_ptr<NeighborListTree> nlist(new NeighborListTree(sysdef, Scalar(2.0), Scalar(0.8)));
+    std::shared_ptr<TablePotential> fc = table_creator(sysdef, nlist, 3);
+
+    // V(r) = r^3 - 2r on knots that are not evenly spaced
+    vector<Scalar> r, V, F;
+    Scalar knots[] = {1.0, 1.2, 1.7, 2.0};
+    for (unsigned int i = 0; i < 4; i++)
+        {
+        r.push_back(knots[i]);
+        V.push_back(knots[i]*knots[i]*knots[i] - Scalar(2.0)*knots[i]);
+        F.push_back(-(Scalar(3.0)*knots[i]*knots[i] - Scalar(2.0)));
+        }
+    fc->setSplineTable(0, 0, r, V, F);
+
+    fc->compute(0);
+
+    {
+    GPUArray<Scalar4>& force_array =  fc->getForceArray();
+    ArrayHandle<Scalar4> h_force(force_array,access_location::host,access_mode::read);
+    // F(1.5) = -4.75, V(1.5) = 0.375
+    MY_CHECK_CLOSE(h_force.data[0].x, 4.75, tol);
+    MY_CHECK_SMALL(h_force.data[0].y, tol_small);
+    MY_CHECK_SMALL(h_force.data[0].z, tol_small);
+    MY_CHECK_CLOSE(h_force.data[0].w, 0.375/2.0, tol);
+
+    MY_CHECK_CLOSE(h_force.data[1].x, -4.75, tol);
+    MY_CHECK_CLOSE(h_force.data[1].w, 0.375/2.0, tol);
+    }
+
+    // outside of the knots there is no force
+    {
+    ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::readwrite);
+    h_pos.data[1].x = Scalar(0.9);
+    }
+
+    fc->compute(1);
+
+    {
+    GPUArray<Scalar4>& force_array =  fc->getForceArray();
+    ArrayHandle<Scalar4> h_force(force_array,access_location::host,access_mode::read);
+    MY_CHECK_SMALL(h_force.data[0].x, tol_small);
+    MY_CHECK_SMALL(h_force.data[0].w, tol_small);
+    }
+    }
+
 //! TablePotential creator for unit tests
 std::shared_ptr<TablePotential> base_class_table_creator(std::shared_ptr<SystemDefinition> sysdef,
                                                     std::shared_ptr<NeighborList> nlist,
@@ -339,6 +396,13 @@ UP_TEST( TablePotential_type )
     table_potential_type_test(table_creator_base, std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+//! test case for spline tables on CPU
+UP_TEST( TablePotential_spline )
+    {
+    table_potential_creator table_creator_base = bind(base_class_table_creator, _1, _2, _3);
+    table_potential_spline_test(table_creator_base, std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_CUDA
 //! test case for basic test on GPU
 UP_TEST( TablePotentialGPU_basic )
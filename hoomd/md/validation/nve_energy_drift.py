@@ -0,0 +1,66 @@
+from hoomd import *
+from hoomd import md
+from hoomd import _hoomd
+
+import numpy as np
+
+import unittest
+
+# Check the energy conservation of an LJ fluid in NVE. Run in SINGLE, DOUBLE and MD_MIXED builds to compare the
+# energy drift of the different precision modes, and with MPI to compare the ghost position modes.
+
+context.initialize()
+
+# identify the time step and ghost position mode by a user parameter
+p = int(option.get_user()[0])
+
+case_list = [(0.001, 'full'), (0.002, 'full'), (0.005, 'full'), (0.002, 'xyz'), (0.002, 'xyz_offset')]
+dt, mode = case_list[p]
+
+# maximum allowed energy drift per particle and unit time
+max_drift = 1e-4
+
+class nve_energy_drift_validation(unittest.TestCase):
+    def setUp(self):
+        self.system = init.create_lattice(unitcell=lattice.sc(a=1.2), n=16)
+
+        nl = md.nlist.cell()
+        lj = md.pair.lj(r_cut=2.5, nlist=nl)
+        lj.pair_coeff.set('A', 'A', epsilon=1.0, sigma=1.0)
+        lj.set_params(mode='xplor')
+
+        comm.set_ghost_position_mode(mode)
+
+    def test_energy_drift(self):
+        md.integrate.mode_standard(dt=dt)
+
+        # melt the lattice
+        langevin = md.integrate.langevin(group=group.all(), kT=1.0, seed=123)
+        run(5000)
+        langevin.disable()
+
+        nve = md.integrate.nve(group=group.all())
+        log = analyze.log(filename=None, quantities=['potential_energy','kinetic_energy'], period=100, overwrite=True)
+
+        t = []
+        E = []
+        def accumulate_E(timestep):
+            t.append(timestep*dt)
+            E.append(log.query('potential_energy') + log.query('kinetic_energy'))
+
+        run(2e5, callback=accumulate_E, callback_period=100)
+
+        N = len(self.system.particles)
+        slope = np.polyfit(np.array(t), np.array(E)/N, 1)[0]
+
+        context.msg.notice(1,'build={} dt={} mode={} energy drift per particle = {:.3e} per unit time\n'.format(
+            _hoomd.hoomd_compile_flags().strip(), dt, mode, slope))
+
+        self.assertLessEqual(abs(slope), max_drift)
+
+    def tearDown(self):
+        del self.system
+        context.initialize()
+
+if __name__ == '__main__':
+    unittest.main(argv = ['test.py', '-v'])
@@ -0,0 +1,91 @@
+from hoomd import *
+from hoomd import md
+from hoomd import _hoomd
+
+import numpy as np
+
+import unittest
+
+# Benchmark the time step rate of an LJ liquid as a function of the sort period for the different sort keys. The
+# particle order is scrambled before each measurement, so that runs without sorting show the cost of poor locality.
+
+context.initialize()
+
+# identify the sort key by a user parameter
+p = int(option.get_user()[0])
+
+key_list = [('grid', 'none'), ('hilbert', 'none'), ('hilbert', 'type')]
+key, secondary = key_list[p]
+
+# sort periods to measure, None disables the sorter
+period_list = [None, 25, 100, 300, 1000]
+
+kT = 1.2
+
+class sort_period_benchmark(unittest.TestCase):
+    def setUp(self):
+        self.system = init.create_lattice(unitcell=lattice.sc(a=1.2, type_name='A'), n=24)
+
+        # two types, so that the type secondary key has an effect
+        self.system.particles.types.add('B')
+        snap = self.system.take_snapshot()
+        if comm.get_rank() == 0:
+            snap.particles.typeid[1::2] = 1
+        self.system.restore_snapshot(snap)
+
+        nl = md.nlist.cell()
+        lj = md.pair.lj(r_cut=2.5, nlist=nl)
+        lj.pair_coeff.set(['A','B'], ['A','B'], epsilon=1.0, sigma=1.0)
+
+        md.integrate.mode_standard(dt=0.005)
+        md.integrate.langevin(group=group.all(), kT=kT, seed=42)
+
+        self.log = analyze.log(filename=None, quantities=['temperature', 'potential_energy'], period=100)
+
+    def test_sort_period(self):
+        sorter = context.current.sorter
+        sorter.set_params(key=key, secondary=secondary)
+
+        tps = []
+        for period in period_list:
+            # scramble the memory order by diffusing without sorting
+            sorter.disable()
+            run(2000, quiet=True)
+
+            if period is None:
+                tps.append(np.mean(benchmark.series(warmup=0, repeat=3, steps=1000)))
+            else:
+                sorter.enable()
+                sorter.set_period(period)
+                tps.append(np.mean(benchmark.series(warmup=0, repeat=3, steps=1000)))
+
+            context.msg.notice(1,'key={} secondary={} period={} TPS={:.1f}\n'.format(key, secondary, period,
+                tps[-1]))
+            self.check_state()
+
+        # adaptive sorting, checked every 25 steps
+        sorter.disable()
+        run(2000, quiet=True)
+        sorter.enable()
+        sorter.set_period(25)
+        sorter.set_params(adaptive=True)
+        tps.append(np.mean(benchmark.series(warmup=0, repeat=3, steps=1000)))
+        context.msg.notice(1,'key={} secondary={} adaptive TPS={:.1f} sorts in the last 1000 steps={}\n'.format(key,
+            secondary, tps[-1], sorter.get_num_sorts()))
+        self.check_state()
+        self.assertGreater(sorter.get_num_sorts(), 0)
+
+    # reordering the particles must not change the thermodynamic state of the liquid
+    def check_state(self):
+        T = self.log.query('temperature')
+        U = self.log.query('potential_energy')/len(self.system.particles)
+        context.msg.notice(1,'key={} secondary={} T={:.4f} U/N={:.4f}\n'.format(key, secondary, T, U))
+        self.assertAlmostEqual(T/kT, 1.0, delta=0.05)
+        self.assertLess(U, 0.0)
+
+    def tearDown(self):
+        del self.system
+        context.initialize()
+
+if __name__ == '__main__':
+    unittest.main(argv = ['test.py', '-v'])
@@ -0,0 +1,78 @@
+from hoomd import *
+from hoomd import md
+
+import numpy as np
+
+import unittest
+
+# Compare linear and cubic Hermite spline tables of the LJ potential at matched force error. The linear table uses
+# 1000 evenly spaced points, the spline table 100 knots placed densely near rmin. The force error is measured against
+# pair.lj on the same configuration and the time step rate of both tables is reported.
+
+context.initialize()
+
+def lj(r, rmin, rmax, epsilon, sigma):
+    V = 4 * epsilon * ( (sigma / r)**12 - (sigma / r)**6);
+    F = 4 * epsilon / r * ( 12 * (sigma / r)**12 - 6 * (sigma / r)**6);
+    return (V, F)
+
+class table_spline_benchmark(unittest.TestCase):
+    def setUp(self):
+        self.system = init.create_lattice(unitcell=lattice.sc(a=1.1, type_name='A'), n=20)
+        self.nl = md.nlist.cell()
+
+        # equilibrate a liquid with the analytic potential
+        self.lj = md.pair.lj(r_cut=3.0, nlist=self.nl)
+        self.lj.pair_coeff.set('A', 'A', epsilon=1.0, sigma=1.0)
+
+        md.integrate.mode_standard(dt=0.005)
+        md.integrate.langevin(group=group.all(), kT=1.2, seed=7)
+        run(2000, quiet=True)
+
+    def measure(self, table):
+        # force error relative to the analytic potential on the current configuration
+        self.lj.enable()
+        run(1, quiet=True)
+
+        err = 0.0
+        norm = 0.0
+        for i in range(len(self.system.particles)):
+            f_table = np.array(table.forces[i].force)
+            f_lj = np.array(self.lj.forces[i].force)
+            err += np.dot(f_table - f_lj, f_table - f_lj)
+            norm += np.dot(f_lj, f_lj)
+
+        # time step rate with the table alone
+        self.lj.disable()
+        tps = np.mean(benchmark.series(warmup=0, repeat=3, steps=500))
+        return np.sqrt(err/norm), tps
+
+    def test_table_spline(self):
+        if context.exec_conf.isCUDAEnabled():
+            return
+
+        linear = md.pair.table(width=1000, nlist=self.nl)
+        linear.pair_coeff.set('A', 'A', func=lj, rmin=0.8, rmax=3.0, coeff=dict(epsilon=1.0, sigma=1.0))
+        err_linear, tps_linear = self.measure(linear)
+        linear.disable()
+
+        hermite = md.pair.table(width=100, nlist=self.nl, interpolation='hermite')
+        knots = [0.8 + 2.2*(i/99.0)**2 for i in range(100)]
+        hermite.pair_coeff.set('A', 'A', func=lj, rmin=0.8, rmax=3.0, coeff=dict(epsilon=1.0, sigma=1.0),
+                               knots=knots)
+        err_hermite, tps_hermite = self.measure(hermite)
+
+        context.msg.notice(1,'linear:  1000 points, relative force error={:.2e} TPS={:.1f}\n'.format(err_linear,
+            tps_linear))
+        context.msg.notice(1,'hermite:  100 knots,  relative force error={:.2e} TPS={:.1f}\n'.format(err_hermite,
+            tps_hermite))
+
+        # ten times fewer knots give at least the same accuracy
+        self.assertLess(err_hermite, err_linear)
+
+    def tearDown(self):
+        del self.system, self.nl, self.lj
+        context.initialize()
+
+if __name__ == '__main__':
+    unittest.main(argv = ['test.py', '-v'])
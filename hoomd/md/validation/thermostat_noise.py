@@ -0,0 +1,58 @@
+from hoomd import *
+from hoomd import md
+
+import numpy as np
+
+import unittest
+
+# Check that the random forces of the stochastic thermostats reproduce the set temperature, and report the time step
+# rate of a system without conservative forces, where the run time is dominated by drawing random numbers.
+
+context.initialize()
+
+# identify the thermostat by a user parameter
+p = int(option.get_user()[0])
+
+method = ['langevin', 'brownian', 'dpd'][p]
+
+kT = 1.5
+
+class thermostat_noise_test(unittest.TestCase):
+    def setUp(self):
+        self.system = init.create_lattice(unitcell=lattice.sc(a=0.85, type_name='A'), n=32)
+
+        nl = md.nlist.cell()
+        md.integrate.mode_standard(dt=0.005)
+
+        if method == 'langevin':
+            md.integrate.langevin(group=group.all(), kT=kT, seed=42)
+        elif method == 'brownian':
+            md.integrate.brownian(group=group.all(), kT=kT, seed=42)
+        else:
+            dpd = md.pair.dpd(r_cut=1.0, nlist=nl, kT=kT, seed=42)
+            dpd.pair_coeff.set('A', 'A', A=0.0, gamma=4.5)
+            md.integrate.nve(group=group.all())
+
+        self.log = analyze.log(filename=None, quantities=['temperature'], period=100)
+
+    def test_temperature(self):
+        # equilibrate
+        run(2000, quiet=True)
+
+        T = []
+        def sample(timestep):
+            T.append(self.log.query('temperature'))
+
+        run(20000, callback=sample, callback_period=100, quiet=True)
+        context.msg.notice(1,'{}: <T>={:.4f} (kT={})\n'.format(method, np.mean(T), kT))
+        self.assertAlmostEqual(np.mean(T)/kT, 1.0, delta=0.02)
+
+        tps = np.mean(benchmark.series(warmup=0, repeat=3, steps=2000))
+        context.msg.notice(1,'{}: TPS={:.1f}\n'.format(method, tps))
+
+    def tearDown(self):
+        del self.system
+        context.initialize()
+
+if __name__ == '__main__':
+    unittest.main(argv = ['test.py', '-v'])
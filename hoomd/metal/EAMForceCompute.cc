@@ -8,6 +8,10 @@
 
 #include <vector>
 
+#ifdef ENABLE_TBB
+#include <tbb/tbb.h>
+#endif
+
 using namespace std;
 
 #include <stdexcept>
@@ -23,7 +27,7 @@ namespace py = pybind11;
  \param type_of_file EAM/Alloy=0, EAM/FS=1
  */
 EAMForceCompute::EAMForceCompute(std::shared_ptr<SystemDefinition> sysdef, char *filename, int type_of_file) :
-        ForceCompute(sysdef)
+        ForceCompute(sysdef), m_pair_cache_enabled(true)
     {
 
     m_exec_conf->msg->notice(5) << "Constructing EAMForceCompute" << endl;
@@ -306,6 +310,18 @@ Scalar EAMForceCompute::getLogValue(const std::string &quantity, unsigned int ti
         }
     }
 
+//! Evaluate a tabulated function from its interpolation coefficients
+static inline Scalar eam_value(const Scalar4& v, Scalar remainder)
+    {
+    return v.w + v.z * remainder + v.y * remainder * remainder + v.x * remainder * remainder * remainder;
+    }
+
+//! Evaluate the derivative of a tabulated function from its interpolation coefficients
+static inline Scalar eam_derivative(const Scalar4& dv, Scalar remainder)
+    {
+    return dv.z + dv.y * remainder + dv.x * remainder * remainder;
+    }
+
 /*! \post The EAM forces are computed for the given timestep. The neighborlist's
  compute method is called to ensure that it is up to date.
  \param timestep specifies the current time step of the simulation
@@ -343,13 +359,6 @@ void EAMForceCompute::computeForces(unsigned int timestep)
     ArrayHandle<Scalar4> h_rphi(m_rphi, access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_drphi(m_drphi, access_location::host, access_mode::read);
 
-    // index and remainder
-    Scalar position;  // look up position, scalar
-    unsigned int int_position;  // look up index for position, integer
-    unsigned int idxs; // look up index in F, rho, rphi array, considering shift, integer
-    Scalar remainder;  // look up remainder in array, integer
-    Scalar4 v, dv;  // value, d(value)
-
     // there are enough other checks on the input data: but it doesn't hurt to be safe
     assert(h_force.data);
     assert(h_virial.data);
@@ -371,219 +380,241 @@ void EAMForceCompute::computeForces(unsigned int timestep)
     // create a temporary copy of r_cut squared
     Scalar r_cut_sq = m_r_cut * m_r_cut;
 
-    // sum up the number of forces calculated
-    int64_t n_calc = 0;
+    const unsigned int N = m_pdata->getN();
+    const unsigned int ntypes = m_pdata->getNTypes();
+    const unsigned int out_of_range = 0xffffffff;
 
-    // parameters for each particle
-    vector<Scalar> atomElectronDensity;
-    atomElectronDensity.resize(m_pdata->getN());
-    vector<Scalar> atomDerivativeEmbeddingFunction;
-    atomDerivativeEmbeddingFunction.resize(m_pdata->getN());
-    vector<Scalar> atomEmbeddingFunction;
-    atomEmbeddingFunction.resize(m_pdata->getN());
-    unsigned int ntypes = m_pdata->getNTypes();
+    // electron density of each particle
+    std::vector<Scalar> atomElectronDensity(N, Scalar(0.0));
 
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    // derivative of the embedding function of each particle, evaluated once and read by all of its neighbors
+    if (m_dFdP.getNumElements() < N)
         {
-        // access the particle's position and type
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int head_i = h_head_list.data[i];
+        GPUArray<Scalar> t_dFdP(N, m_exec_conf);
+        m_dFdP.swap(t_dFdP);
+        }
+    ArrayHandle<Scalar> h_dFdP(m_dFdP, access_location::host, access_mode::overwrite);
 
+    // scratch buffer for the pair geometry
+    const bool use_cache = m_pair_cache_enabled;
+    if (use_cache && m_pair_cache.size() < m_nlist->getNListArray().getNumElements())
+        m_pair_cache.resize(m_nlist->getNListArray().getNumElements());
+
+    // separation, distance and table position of the pair i, k
+    auto pair_geometry = [&](const Scalar3& pi, unsigned int k, PairCacheEntry& pair)
+        {
         // sanity check
-        assert(typei < m_pdata->getNTypes());
+        assert(k < m_pdata->getN());
 
-        // loop over all of the neighbors of this particle
-        const unsigned int size = (unsigned int) h_n_neigh.data[i];
+        // calculate dr and apply periodic boundary conditions
+        Scalar3 pk = make_scalar3(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
+        pair.dx = box.minImage(pi - pk);
 
-        for (unsigned int j = 0; j < size; j++)
+        // only compute the force if the particles are closer than the cut-off
+        Scalar rsq = dot(pair.dx, pair.dx);
+        if (rsq >= r_cut_sq)
             {
-            // increment our calculation counter
-            n_calc++;
+            pair.int_position = out_of_range;
+            return;
+            }
 
-            // access the index of this neighbor
-            unsigned int k = h_nlist.data[head_i + j];
-            // sanity check
-            assert(k < m_pdata->getN());
+        pair.r = sqrt(rsq);
+        Scalar position = pair.r * rdr;
+        unsigned int int_position = (unsigned int) position;
+        pair.int_position = min(int_position, nr - 1);
+        pair.remainder = position - pair.int_position;
+        };
 
-            // calculate dr
-            Scalar3 pk = make_scalar3(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
-            Scalar3 dx = pi - pk;
+    // first pass: calculate P = sum{rho}
+    auto density_pass = [&](unsigned int begin, unsigned int end)
+        {
+        for (unsigned int i = begin; i < end; i++)
+            {
+            // access the particle's position and type
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            const unsigned int head_i = h_head_list.data[i];
 
-            // access the type of the neighbor particle
-            unsigned int typej = __scalar_as_int(h_pos.data[k].w);
             // sanity check
-            assert(typej < m_pdata->getNTypes());
+            assert(typei < m_pdata->getNTypes());
 
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
+            Scalar rho_i = 0.0;
 
-            // start computing the force
-            // calculate r squared
-            Scalar rsq = dot(dx, dx);
-            ;
-            // only compute the force if the particles are closer than the cut-off
-            if (rsq < r_cut_sq)
+            // loop over all of the neighbors of this particle
+            const unsigned int size = (unsigned int) h_n_neigh.data[i];
+            for (unsigned int j = 0; j < size; j++)
                 {
-                // calculate position r for rho(r)
-                position = sqrt(rsq) * rdr;
-                int_position = (unsigned int) position;
-                int_position = min(int_position, nr - 1);
-                remainder = position - int_position;
-                // calculate P = sum{rho}
-                idxs = int_position + nr * (typej * ntypes + typei);
-                v = h_rho.data[idxs];
-                atomElectronDensity[i] += v.w + v.z * remainder + v.y * remainder * remainder
-                        + v.x * remainder * remainder * remainder;
+                unsigned int k = h_nlist.data[head_i + j];
+
+                PairCacheEntry local_pair;
+                PairCacheEntry& pair = use_cache ? m_pair_cache[head_i + j] : local_pair;
+                pair_geometry(pi, k, pair);
+                if (pair.int_position == out_of_range)
+                    continue;
+
+                // access the type of the neighbor particle
+                unsigned int typej = __scalar_as_int(h_pos.data[k].w);
+                assert(typej < m_pdata->getNTypes());
+
+                rho_i += eam_value(h_rho.data[pair.int_position + nr * (typej * ntypes + typei)], pair.remainder);
+
                 // if third_law, pair it
                 if (third_law)
-                    {
-                    idxs = int_position + nr * (typei * ntypes + typej);
-                    v = h_rho.data[idxs];
-                    atomElectronDensity[k] += v.w + v.z * remainder + v.y * remainder * remainder
-                            + v.x * remainder * remainder * remainder;
-                    }
+                    atomElectronDensity[k] += eam_value(h_rho.data[pair.int_position + nr * (typei * ntypes + typej)],
+                                                        pair.remainder);
                 }
+            atomElectronDensity[i] += rho_i;
             }
-        }
+        };
 
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    // second pass: embedding energy F(P) and dF / dP of each particle
+    auto embedding_pass = [&](unsigned int begin, unsigned int end)
         {
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        // calculate position rho for F(rho)
-        position = atomElectronDensity[i] * rdrho;
-        int_position = (unsigned int) position;
-        int_position = min(int_position, nrho - 1);
-        remainder = position - int_position;
-
-        idxs = int_position + typei * nrho;
-        v = h_F.data[idxs];
-        dv = h_dF.data[idxs];
-        // compute dF / dP
-        atomDerivativeEmbeddingFunction[i] = dv.z + dv.y * remainder + dv.x * remainder * remainder;
-        // compute embedded energy F(P), sum up each particle
-        h_force.data[i].w += v.w + v.z * remainder + v.y * remainder * remainder
-                + v.x * remainder * remainder * remainder;
-
-        }
+        for (unsigned int i = begin; i < end; i++)
+            {
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            // calculate position rho for F(rho)
+            Scalar position = atomElectronDensity[i] * rdrho;
+            unsigned int int_position = (unsigned int) position;
+            int_position = min(int_position, nrho - 1);
+            Scalar remainder = position - int_position;
+
+            unsigned int idxs = int_position + typei * nrho;
+            // compute dF / dP
+            h_dFdP.data[i] = eam_derivative(h_dF.data[idxs], remainder);
+            // compute embedded energy F(P), sum up each particle
+            h_force.data[i].w = eam_value(h_F.data[idxs], remainder);
+            }
+        };
 
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    // third pass: pair forces
+    auto force_pass = [&](unsigned int begin, unsigned int end)
         {
-        // access the particle's position and type
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int head_i = h_head_list.data[i];
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
-
-        // initialize current particle force, potential energy, and virial to 0
-        Scalar fxi = 0.0;
-        Scalar fyi = 0.0;
-        Scalar fzi = 0.0;
-        Scalar pei = 0.0;
-        Scalar viriali[6];
-        for (int k = 0; k < 6; k++)
-            viriali[k] = 0.0;
-
-        // loop over all of the neighbors of this particle
-        const unsigned int size = (unsigned int) h_n_neigh.data[i];
-        for (unsigned int j = 0; j < size; j++)
+        for (unsigned int i = begin; i < end; i++)
             {
-            // increment our calculation counter
-            n_calc++;
-
-            // access the index of this neighbor
-            unsigned int k = h_nlist.data[head_i + j];
+            // access the particle's position and type
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            const unsigned int head_i = h_head_list.data[i];
             // sanity check
-            assert(k < m_pdata->getN());
-
-            // calculate \Delta r
-            Scalar3 pk = make_scalar3(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
-            Scalar3 dx = pi - pk;
-
-            // access the type of the neighbor particle
-            unsigned int typej = __scalar_as_int(h_pos.data[k].w);
-            // sanity check
-            assert(typej < m_pdata->getNTypes());
-
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
-
-            // start computing the force
-            // calculate r squared
-            Scalar rsq = dot(dx, dx);
-
-            // calculate position r for phi(r)
-            if (rsq >= r_cut_sq)
-                continue;
-            Scalar r = sqrt(rsq);
-            Scalar inverseR = 1.0 / r;
-            position = r * rdr;
-            int_position = (unsigned int) position;
-            int_position = min(int_position, nr - 1);
-            remainder = position - int_position;
-            // calculate the shift position for type ij
-            int shift =
-                    (typei >= typej) ?
-                            (int) (0.5 * (2 * ntypes - typej - 1) * typej + typei) * nr :
-                            (int) (0.5 * (2 * ntypes - typei - 1) * typei + typej) * nr;
-
-            idxs = int_position + shift;
-            v = h_rphi.data[idxs];
-            dv = h_drphi.data[idxs];
-            // pair_eng = phi
-            Scalar pair_eng = (v.w + v.z * remainder + v.y * remainder * remainder
-                    + v.x * remainder * remainder * remainder) * inverseR;
-            // derivativePhi = (phi + r * dphi/dr - phi) * 1/r = dphi / dr
-            Scalar derivativePhi = (dv.z + dv.y * remainder + dv.x * remainder * remainder - pair_eng) * inverseR;
-            // derivativeRhoI = drho / dr of i
-            idxs = int_position + typei * ntypes * nr + typej * nr;
-            dv = h_drho.data[idxs];
-            Scalar derivativeRhoI = dv.z + dv.y * remainder + dv.x * remainder * remainder;
-            // derivativeRhoJ = drho / dr of j
-            idxs = int_position + typej * ntypes * nr + typei * nr;
-            dv = h_drho.data[idxs];
-            Scalar derivativeRhoJ = dv.z + dv.y * remainder + dv.x * remainder * remainder;
-            // fullDerivativePhi = dF/dP * drho / dr for j + dF/dP * drho / dr for j + phi
-            Scalar fullDerivativePhi = atomDerivativeEmbeddingFunction[i] * derivativeRhoJ
-                    + atomDerivativeEmbeddingFunction[k] * derivativeRhoI + derivativePhi;
-            // compute forces
-            Scalar pairForce = -fullDerivativePhi * inverseR;
-            viriali[0] += dx.x * dx.x * pairForce;
-            viriali[1] += dx.x * dx.y * pairForce;
-            viriali[2] += dx.x * dx.z * pairForce;
-            viriali[3] += dx.y * dx.y * pairForce;
-            viriali[4] += dx.y * dx.z * pairForce;
-            viriali[5] += dx.z * dx.z * pairForce;
-            fxi += dx.x * pairForce;
-            fyi += dx.y * pairForce;
-            fzi += dx.z * pairForce;
-            pei += pair_eng * 0.5;
-
-            if (third_law)
+            assert(typei < m_pdata->getNTypes());
+
+            // initialize current particle force, potential energy, and virial to 0
+            Scalar fxi = 0.0;
+            Scalar fyi = 0.0;
+            Scalar fzi = 0.0;
+            Scalar pei = 0.0;
+            Scalar viriali[6];
+            for (int k = 0; k < 6; k++)
+                viriali[k] = 0.0;
+
+            // loop over all of the neighbors of this particle
+            const unsigned int size = (unsigned int) h_n_neigh.data[i];
+            for (unsigned int j = 0; j < size; j++)
                 {
-                h_force.data[k].x -= dx.x * pairForce;
-                h_force.data[k].y -= dx.y * pairForce;
-                h_force.data[k].z -= dx.z * pairForce;
-                h_force.data[k].w += pair_eng * 0.5;
+                // access the index of this neighbor
+                unsigned int k = h_nlist.data[head_i + j];
+
+                // reuse the geometry of the density pass, or compute it again
+                PairCacheEntry local_pair;
+                if (!use_cache)
+                    pair_geometry(pi, k, local_pair);
+                const PairCacheEntry& pair = use_cache ? m_pair_cache[head_i + j] : local_pair;
+                if (pair.int_position == out_of_range)
+                    continue;
+
+                // access the type of the neighbor particle
+                unsigned int typej = __scalar_as_int(h_pos.data[k].w);
+                assert(typej < m_pdata->getNTypes());
+
+                const Scalar3& dx = pair.dx;
+                Scalar inverseR = 1.0 / pair.r;
+                Scalar remainder = pair.remainder;
+
+                // calculate the shift position for type ij
+                int shift =
+                        (typei >= typej) ?
+                                (int) (0.5 * (2 * ntypes - typej - 1) * typej + typei) * nr :
+                                (int) (0.5 * (2 * ntypes - typei - 1) * typei + typej) * nr;
+
+                unsigned int idxs = pair.int_position + shift;
+                // pair_eng = phi
+                Scalar pair_eng = eam_value(h_rphi.data[idxs], remainder) * inverseR;
+                // derivativePhi = (phi + r * dphi/dr - phi) * 1/r = dphi / dr
+                Scalar derivativePhi = (eam_derivative(h_drphi.data[idxs], remainder) - pair_eng) * inverseR;
+                // derivativeRhoI = drho / dr of i
+                idxs = pair.int_position + typei * ntypes * nr + typej * nr;
+                Scalar derivativeRhoI = eam_derivative(h_drho.data[idxs], remainder);
+                // derivativeRhoJ = drho / dr of j
+                idxs = pair.int_position + typej * ntypes * nr + typei * nr;
+                Scalar derivativeRhoJ = eam_derivative(h_drho.data[idxs], remainder);
+                // fullDerivativePhi = dF/dP * drho / dr for j + dF/dP * drho / dr for j + phi
+                Scalar fullDerivativePhi = h_dFdP.data[i] * derivativeRhoJ
+                        + h_dFdP.data[k] * derivativeRhoI + derivativePhi;
+                // compute forces
+                Scalar pairForce = -fullDerivativePhi * inverseR;
+                viriali[0] += dx.x * dx.x * pairForce;
+                viriali[1] += dx.x * dx.y * pairForce;
+                viriali[2] += dx.x * dx.z * pairForce;
+                viriali[3] += dx.y * dx.y * pairForce;
+                viriali[4] += dx.y * dx.z * pairForce;
+                viriali[5] += dx.z * dx.z * pairForce;
+                fxi += dx.x * pairForce;
+                fyi += dx.y * pairForce;
+                fzi += dx.z * pairForce;
+                pei += pair_eng * 0.5;
+
+                if (third_law)
+                    {
+                    h_force.data[k].x -= dx.x * pairForce;
+                    h_force.data[k].y -= dx.y * pairForce;
+                    h_force.data[k].z -= dx.z * pairForce;
+                    h_force.data[k].w += pair_eng * 0.5;
+                    }
                 }
+            h_force.data[i].x += fxi;
+            h_force.data[i].y += fyi;
+            h_force.data[i].z += fzi;
+            h_force.data[i].w += pei;
+            for (int k = 0; k < 6; k++)
+                h_virial.data[k * virial_pitch + i] += viriali[k];
             }
-        h_force.data[i].x += fxi;
-        h_force.data[i].y += fyi;
-        h_force.data[i].z += fzi;
-        h_force.data[i].w += pei;
-        for (int k = 0; k < 6; k++)
-            h_virial.data[k * virial_pitch + i] += viriali[k];
+        };
+
+    // with a full neighbor list, each pass writes only to particle i
+    #ifdef ENABLE_TBB
+    if (!third_law)
+        {
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+            [&](const tbb::blocked_range<unsigned int>& range) { density_pass(range.begin(), range.end()); });
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+            [&](const tbb::blocked_range<unsigned int>& range) { embedding_pass(range.begin(), range.end()); });
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+            [&](const tbb::blocked_range<unsigned int>& range) { force_pass(range.begin(), range.end()); });
+        }
+    else
+    #endif
+        {
+        density_pass(0, N);
+        embedding_pass(0, N);
+        force_pass(0, N);
         }
 
-    int64_t flops = m_pdata->getN() * 5 + n_calc * (3 + 5 + 9 + 1 + 9 + 6 + 8);
-    if (third_law)
-        flops += n_calc * 8;
-    int64_t mem_transfer = m_pdata->getN() * (5 + 4 + 10) * sizeof(Scalar) + n_calc * (1 + 3 + 1) * sizeof(Scalar);
-    if (third_law)
-        mem_transfer += n_calc * 10 * sizeof(Scalar);
     if (m_prof)
+        {
+        // sum up the number of forces calculated
+        int64_t n_calc = 0;
+        for (unsigned int i = 0; i < N; i++)
+            n_calc += 2 * h_n_neigh.data[i];
+
+        int64_t flops = N * 5 + n_calc * (3 + 5 + 9 + 1 + 9 + 6 + 8);
+        if (third_law)
+            flops += n_calc * 8;
+        int64_t mem_transfer = N * (5 + 4 + 10) * sizeof(Scalar) + n_calc * (1 + 3 + 1) * sizeof(Scalar);
+        if (third_law)
+            mem_transfer += n_calc * 10 * sizeof(Scalar);
         m_prof->pop(flops, mem_transfer);
+        }
     }
 
 void EAMForceCompute::set_neighbor_list(std::shared_ptr<NeighborList> nlist)
@@ -601,5 +632,6 @@ void export_EAMForceCompute(py::module &m)
     {
     py::class_<EAMForceCompute, std::shared_ptr<EAMForceCompute> >(m, "EAMForceCompute", py::base<ForceCompute>()).def(
             py::init<std::shared_ptr<SystemDefinition>, char *, int>()).def("set_neighbor_list",
-            &EAMForceCompute::set_neighbor_list).def("get_r_cut", &EAMForceCompute::get_r_cut);
+            &EAMForceCompute::set_neighbor_list).def("get_r_cut", &EAMForceCompute::get_r_cut).def("setPairCache",
+            &EAMForceCompute::setPairCache);
     }
@@ -42,6 +42,18 @@
  h_dF.data[100].z, h_dF.data[100].y, h_dF.data[100].x, are for interpolating derivative embedded
  function.
 
+ \b Threading
+ The force is computed in three passes: the electron density of each particle, its embedding energy and derivative
+ dF/dP, and the pair forces. dF/dP is evaluated once per particle and stored in m_dFdP, where the force pass reads it
+ for both partners of a pair. With a full neighbor list, every pass writes only to particle i and runs in parallel
+ when built with TBB. A half neighbor list is processed serially.
+
+ \b Pair cache
+ When enabled with setPairCache(), the density pass stores the separation, distance and table position of every
+ neighbor in a scratch buffer indexed like the neighbor list, and the force pass reads them back instead of
+ recomputing them. This trades one buffer entry per neighbor list entry for the second minimum image and square
+ root.
+
  \ingroup computes
  */
 class EAMForceCompute: public ForceCompute
@@ -68,6 +80,14 @@ public:
     //! Load EAM potential file
     virtual void loadFile(char *filename, int type_of_file);
 
+    //! Enable or disable the per-pair scratch buffer
+    void setPairCache(bool enable)
+        {
+        m_pair_cache_enabled = enable;
+        if (!enable)
+            std::vector<PairCacheEntry>().swap(m_pair_cache);
+        }
+
 protected:
     std::shared_ptr<NeighborList> m_nlist; //!< the neighborlist to use for the computation
     Scalar m_r_cut;                        //!< cut-off radius
@@ -93,6 +113,17 @@ protected:
     GPUArray<Scalar4> m_drphi;             //!< derivative pair wise function and its coefficients
     GPUArray<Scalar> m_dFdP;               //!< derivative F / derivative P
 
+    //! Geometry of a neighbor pair, saved between the density and force passes
+    struct PairCacheEntry
+        {
+        Scalar3 dx;                        //!< Minimum image separation
+        Scalar r;                          //!< Distance
+        Scalar remainder;                  //!< Remainder of the table position
+        unsigned int int_position;         //!< Table index, or 0xffffffff if the pair is beyond r_cut
+        };
+    bool m_pair_cache_enabled;             //!< True if the pair geometry is saved between passes
+    std::vector<PairCacheEntry> m_pair_cache;  //!< Pair geometry, indexed like the neighbor list
+
     //! Actually compute the forces
     virtual void computeForces(unsigned int timestep);
 
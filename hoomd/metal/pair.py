@@ -37,6 +37,9 @@ class eam(force._force):
     (commands eam/alloy and eam/fs) here: http://lammps.sandia.gov/doc/pair_eam.html
     and are also described here: http://enpub.fulton.asu.edu/cms/potentials/submain/format.htm
 
+    On the CPU, :py:class:`eam` runs multithreaded when HOOMD is built with TBB and more than one thread is in use.
+    It then switches *nlist* to full storage, so that every thread only writes to its own particles.
+
     .. attention::
         EAM is **NOT** supported in MPI parallel simulations.
 
@@ -89,7 +92,7 @@ class eam(force._force):
 
         #Load neighbor list to compute.
         self.cpp_force.set_neighbor_list(self.nlist.cpp_nlist);
-        if hoomd.context.exec_conf.isCUDAEnabled():
+        if hoomd.context.exec_conf.isCUDAEnabled() or hoomd.context.exec_conf.getNumThreads() > 1:
             self.nlist.cpp_nlist.setStorageMode(_md.NeighborList.storageMode.full);
 
         hoomd.context.msg.notice(2, "Set r_cut = " + str(self.r_cut_new) + " from potential`s file '" +  str(file) + "'.\n");
@@ -111,6 +114,26 @@ class eam(force._force):
                 r_cut_dict.set_pair(type_list[i], type_list[j], self.r_cut_new)
         return r_cut_dict
 
+    def set_params(self, pair_cache=None):
+        R""" Set parameters of the EAM computation.
+
+        Args:
+            pair_cache (bool): When True, save the geometry of each neighbor pair from the electron density pass
+                for the force pass (CPU only).
+
+        The pair cache is enabled by default. It uses one entry (24 bytes in single precision, 48 bytes in double
+        precision) per neighbor list entry. Disable it to save memory in large systems at the cost of computing the
+        distance of each pair twice.
+
+        Example::
+
+            eam.set_params(pair_cache=False)
+        """
+        hoomd.util.print_status_line();
+
+        if pair_cache is not None:
+            self.cpp_force.setPairCache(bool(pair_cache));
+
     def update_coeffs(self):
         # check that the pair coefficients are valid
         pass;
@@ -45,13 +45,14 @@ class eam_tests(unittest.TestCase):
         nl = md.nlist.cell()
         metal.pair.eam(file=potf, type="Alloy", nlist=nl)
 
-    # Unit test: ensure that forces and energies compute correctly
-    def test_force(self):
+    # compute the forces and energies with the pair cache on or off and compare them to the reference values
+    def check_force(self, pair_cache):
         cwd = os.getcwd()
         tmpd = cwd + '/eamtemp/'
         potf = tmpd + 'testpot'
         nl = md.nlist.cell()
         eam = metal.pair.eam(file=potf, type="Alloy", nlist=nl)
+        eam.set_params(pair_cache=pair_cache)
         all = group.all()
         md.integrate.mode_standard(dt=0.2)
         md.integrate.nve(group=all)
@@ -71,6 +72,14 @@ class eam_tests(unittest.TestCase):
 
         os.system('rm -rf ' + tmpd)
 
+    # Unit test: ensure that forces and energies compute correctly
+    def test_force(self):
+        self.check_force(pair_cache=True)
+
+    # Unit test: forces and energies do not depend on the pair cache
+    def test_force_no_pair_cache(self):
+        self.check_force(pair_cache=False)
+
     # tearDown is called at the end of every test method
     def tearDown(self):
         context.initialize()
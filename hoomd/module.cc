@@ -30,6 +30,8 @@
 #include "LogPlainTXT.h"
 #include "LogMatrix.h"
 #include "LogHDF5.h"
+#include "LogBinary.h"
+#include "LogCorrelator.h"
 #include "CallbackAnalyzer.h"
 #include "Updater.h"
 #include "Integrator.h"
@@ -387,6 +389,8 @@ PYBIND11_MODULE(_hoomd, m)
     export_LogPlainTXT(m);
     export_LogMatrix(m);
     export_LogHDF5(m);
+    export_LogBinary(m);
+    export_LogCorrelator(m);
     export_CallbackAnalyzer(m);
     export_ParticleGroup(m);
 
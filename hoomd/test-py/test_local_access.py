@@ -0,0 +1,60 @@
+# -*- coding: iso-8859-1 -*-
+# Maintainer: joaander
+
+import hoomd
+hoomd.context.initialize()
+import unittest
+import numpy
+
+class local_access_tests(unittest.TestCase):
+
+    def setUp(self):
+        self.system = hoomd.init.create_lattice(hoomd.lattice.sc(a=2.0), n=[5,5,4]);
+
+    # test that the local arrays match the per particle proxies
+    def test_read(self):
+        pos = {}
+        with self.system.particles.local_access() as local:
+            self.assertEqual(local.position.shape[1], 3)
+            self.assertEqual(local.position.shape[0], local.tag.shape[0])
+            self.assertEqual(local.mass.shape, local.tag.shape)
+            self.assertFalse(local.position.flags.writeable)
+            for idx, tag in enumerate(local.tag):
+                self.assertEqual(local.rtag[tag], idx)
+                pos[int(tag)] = numpy.array(local.position[idx])
+
+        for tag, p in pos.items():
+            numpy.testing.assert_allclose(p, self.system.particles.get(tag).position)
+
+        if hoomd.comm.get_num_ranks() == 1:
+            self.assertEqual(len(pos), len(self.system.particles))
+
+    # test that modifications through the local arrays are visible to the simulation
+    def test_write(self):
+        with self.system.particles.local_access(readonly=False) as local:
+            local.velocity[:] = (1.0, 2.0, 3.0)
+            local.mass[:] = 2.0
+            tags = numpy.array(local.tag)
+
+        for tag in tags:
+            p = self.system.particles.get(int(tag))
+            numpy.testing.assert_allclose(p.velocity, (1.0, 2.0, 3.0))
+            self.assertAlmostEqual(p.mass, 2.0)
+
+    # test that the arrays are only available inside a with block
+    def test_outside_block(self):
+        access = self.system.particles.local_access()
+        with self.assertRaises(RuntimeError):
+            access.cpp_access.position
+
+        with access as local:
+            with self.assertRaises(RuntimeError):
+                with access:
+                    pass
+
+    def tearDown(self):
+        del self.system
+        hoomd.context.initialize();
+
+if __name__ == '__main__':
+    unittest.main(argv = ['test.py', '-v'])
@@ -6,19 +6,53 @@ import hoomd;
 context.initialize()
 import unittest
 import os
+import numpy
 
 # tests for update.sorter
 class update_sorter_tests (unittest.TestCase):
     def setUp(self):
         print
-        init.create_lattice(lattice.sc(a=2.1878096788957757),n=[5,5,4]); #target a packing fraction of 0.05
+        self.s = init.create_lattice(lattice.sc(a=2.1878096788957757),n=[5,5,4]); #target a packing fraction of 0.05
 
     # test set_params
     def test_set_params(self):
 
         context.current.sorter.set_params(grid=20);
+        context.current.sorter.set_params(key='hilbert', secondary='type');
+        context.current.sorter.set_params(key='grid', secondary='none');
+        self.assertRaises(ValueError, context.current.sorter.set_params, key='morton');
+        self.assertRaises(ValueError, context.current.sorter.set_params, secondary='mass');
+
+    # test that the hilbert key sort keeps the particle data consistent
+    def test_hilbert(self):
+        sorter = context.current.sorter;
+        for secondary in ['none', 'type', 'body']:
+            snap_before = self.s.take_snapshot();
+            sorter.set_params(key='hilbert', secondary=secondary);
+            sorter.set_period(1);
+            run(2);
+            snap_after = self.s.take_snapshot();
+
+            if comm.get_rank() == 0:
+                numpy.testing.assert_array_equal(snap_before.particles.position, snap_after.particles.position);
+                numpy.testing.assert_array_equal(snap_before.particles.typeid, snap_after.particles.typeid);
+
+    # test that the adaptive mode skips sorts of a static system
+    def test_adaptive(self):
+        sorter = context.current.sorter;
+        sorter.set_period(1);
+        sorter.set_params(adaptive=True, threshold=1.2);
+        run(10);
+        self.assertEqual(sorter.get_num_sorts(), 1);
+
+        sorter.set_params(adaptive=False);
+        run(10);
+        self.assertEqual(sorter.get_num_sorts(), 10);
+
+        self.assertRaises(ValueError, sorter.set_params, threshold=0.5);
 
     def tearDown(self):
+        del self.s
         context.initialize();
 
 if __name__ == '__main__':
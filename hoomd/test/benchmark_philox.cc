@@ -0,0 +1,119 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+
+/*! \file benchmark_philox.cc
+    \brief Compares the speed of the Saru and Philox random number generators
+    \ingroup unit_tests
+
+    Both generators draw the numbers that TwoStepBD needs for each particle and step: three uniform numbers in
+    (-1, 1) for the random force and three normal numbers for the velocity. Saru is seeded per particle inside the
+    loop, as TwoStepBD used to do. Philox draws the blocks of all particles with philox_generate() first and converts
+    them in a second loop, as TwoStepBD does now. The time per particle of both and their ratio are printed. This is a
+    benchmark, not a unit test: it is built with the tests but does not check anything.
+*/
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Saru.h"
+#include "hoomd/Philox.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace hoomd::detail;
+
+//! Draw the numbers of one step with Saru
+/*! \param tags Particle tags
+    \param timestep Current timestep
+    \param seed User seed
+    \param out Set to the six numbers of each particle
+*/
+static void draw_saru(const vector<unsigned int>& tags, unsigned int timestep, unsigned int seed, vector<Scalar>& out)
+    {
+    for (unsigned int i = 0; i < tags.size(); i++)
+        {
+        Saru saru(tags[i], timestep, seed);
+        out[6*i+0] = saru.s<Scalar>(-1,1);
+        out[6*i+1] = saru.s<Scalar>(-1,1);
+        out[6*i+2] = saru.s<Scalar>(-1,1);
+        out[6*i+3] = gaussian_rng(saru, Scalar(1.0));
+        out[6*i+4] = gaussian_rng(saru, Scalar(1.0));
+        out[6*i+5] = gaussian_rng(saru, Scalar(1.0));
+        }
+    }
+
+//! Draw the numbers of one step with Philox
+/*! \param tags Particle tags
+    \param timestep Current timestep
+    \param seed User seed
+    \param blocks Scratch space for two blocks per particle
+    \param out Set to the six numbers of each particle
+*/
+static void draw_philox(const vector<unsigned int>& tags, unsigned int timestep, unsigned int seed,
+                        vector<uint4>& blocks, vector<Scalar>& out)
+    {
+    const unsigned int n = tags.size();
+    philox_generate(&blocks[0], PhiloxStream::TwoStepBD, seed, &tags[0], n, 0, timestep, 0);
+    philox_generate(&blocks[n], PhiloxStream::TwoStepBD, seed, &tags[0], n, 0, timestep, 1);
+
+    for (unsigned int i = 0; i < n; i++)
+        {
+        const uint4 u = blocks[i];
+        out[6*i+0] = philox_uniform<Scalar>(u.x, -1, 1);
+        out[6*i+1] = philox_uniform<Scalar>(u.y, -1, 1);
+        out[6*i+2] = philox_uniform<Scalar>(u.z, -1, 1);
+
+        Scalar normal[4];
+        philox_normal4(blocks[n+i], normal);
+        out[6*i+3] = normal[0];
+        out[6*i+4] = normal[1];
+        out[6*i+5] = normal[2];
+        }
+    }
+
+int main(int argc, char **argv)
+    {
+    const unsigned int N = 100000;
+    const unsigned int n_steps = 200;
+    const unsigned int seed = 42;
+
+    vector<unsigned int> tags(N);
+    for (unsigned int i = 0; i < N; i++)
+        tags[i] = i;
+
+    vector<Scalar> out(6*N);
+    vector<uint4> blocks(2*N);
+
+    // keep the results alive, so that the compiler cannot drop the draws
+    double sum = 0.0;
+
+    // warm up
+    draw_saru(tags, 0, seed, out);
+    draw_philox(tags, 0, seed, blocks, out);
+
+    chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now();
+    for (unsigned int timestep = 1; timestep <= n_steps; timestep++)
+        {
+        draw_saru(tags, timestep, seed, out);
+        sum += out[timestep % (6*N)];
+        }
+    chrono::high_resolution_clock::time_point end = chrono::high_resolution_clock::now();
+    double t_saru = chrono::duration<double, nano>(end - start).count() / double(N*n_steps);
+
+    start = chrono::high_resolution_clock::now();
+    for (unsigned int timestep = 1; timestep <= n_steps; timestep++)
+        {
+        draw_philox(tags, timestep, seed, blocks, out);
+        sum += out[timestep % (6*N)];
+        }
+    end = chrono::high_resolution_clock::now();
+    double t_philox = chrono::duration<double, nano>(end - start).count() / double(N*n_steps);
+
+    cout << "Saru:   " << t_saru << " ns per particle" << endl;
+    cout << "Philox: " << t_philox << " ns per particle" << endl;
+    cout << "speedup: " << t_saru / t_philox << " (checksum " << sum << ")" << endl;
+
+    return 0;
+    }
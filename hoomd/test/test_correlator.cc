@@ -0,0 +1,89 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+
+// this include is necessary to get MPI included before anything else to support intel MPI
+#include "hoomd/ExecutionConfiguration.h"
+
+#include <iostream>
+
+#include "upp11_config.h"
+
+HOOMD_UP_MAIN();
+
+
+#include "hoomd/MultipleTauCorrelator.h"
+
+using namespace std;
+
+/*! \file test_correlator.cc
+    \brief Implements unit tests for MultipleTauCorrelator and BlockAverage
+    \ingroup unit_tests
+*/
+
+//! test the lag times covered by the levels
+UP_TEST( MultipleTauCorrelator_lags )
+    {
+    MultipleTauCorrelator corr(1, 16, 2, 4);
+    for (unsigned int t = 0; t < 1000; t++)
+        {
+        double x = 1.0;
+        corr.add(&x);
+        }
+
+    vector<double> lags, values;
+    corr.getResult(lags, values);
+
+    // 16 lags on level 0, 8 on each further level
+    UP_ASSERT_EQUAL(lags.size(), (size_t)40);
+    UP_ASSERT_EQUAL(lags[0], 0.0);
+    UP_ASSERT_EQUAL(lags[15], 15.0);
+    UP_ASSERT_EQUAL(lags[16], 16.0);
+    UP_ASSERT_EQUAL(lags[39], 15.0*8.0);
+    UP_ASSERT_EQUAL(corr.getNumSamples(), (unsigned long)1000);
+
+    // a constant signal correlates perfectly at all lags
+    for (unsigned int i = 0; i < values.size(); i++)
+        MY_CHECK_CLOSE(values[i], 1.0, tol);
+    }
+
+//! test the squared difference of a linear signal on several channels
+UP_TEST( MultipleTauCorrelator_msd )
+    {
+    MultipleTauCorrelator corr(2, 8, 2, 6, MultipleTauCorrelator::squared_difference);
+    for (unsigned int t = 0; t < 2000; t++)
+        {
+        // two channels moving with velocity 1 and 3
+        double x[2] = {double(t), 3.0*t};
+        corr.add(x);
+        }
+
+    vector<double> lags, values;
+    corr.getResult(lags, values);
+
+    // block averages of a linear signal are exact, the channel average of (v*tau)^2 is 5 tau^2
+    for (unsigned int i = 0; i < values.size(); i++)
+        MY_CHECK_CLOSE(values[i] + 1.0, 5.0*lags[i]*lags[i] + 1.0, tol);
+
+    corr.reset();
+    corr.getResult(lags, values);
+    UP_ASSERT_EQUAL(lags.size(), (size_t)0);
+    }
+
+//! test the block average of a signal with a known correlation
+UP_TEST( BlockAverage_basic )
+    {
+    BlockAverage avg(10);
+
+    // alternating signal: fluctuations cancel in blocks of two samples
+    for (unsigned int t = 0; t < 1024; t++)
+        avg.add((t % 2 == 0) ? 1.0 : 3.0);
+
+    MY_CHECK_CLOSE(avg.getMean(), 2.0, tol);
+
+    vector<double> errors;
+    avg.getErrors(errors);
+    UP_ASSERT_EQUAL(errors.size(), (size_t)10);
+    UP_ASSERT(errors[0] > 0.0);
+    MY_CHECK_SMALL(errors[1], tol_small);
+    }
@@ -223,6 +223,67 @@ UP_TEST( ParticleGroup_sort_test )
     }
     }
 
+//! Checks the all and tag range fast paths of ParticleGroup
+UP_TEST( ParticleGroup_all_range_test )
+    {
+    std::shared_ptr<SystemDefinition> sysdef = create_sysdef();
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    std::shared_ptr<ParticleSelector> selector_all(new ParticleSelectorAll(sysdef));
+    ParticleGroup all(sysdef, selector_all);
+    UP_ASSERT(all.isAll());
+    UP_ASSERT(all.isTagRange());
+
+    std::shared_ptr<ParticleSelector> selector25(new ParticleSelectorTag(sysdef, 2, 5));
+    ParticleGroup tags25(sysdef, selector25);
+    UP_ASSERT(!tags25.isAll());
+    UP_ASSERT(tags25.isTagRange());
+
+    std::vector<unsigned int> member_tags;
+    member_tags.push_back(1);
+    member_tags.push_back(3);
+    ParticleGroup tags13(sysdef, member_tags);
+    UP_ASSERT(!tags13.isAll());
+    UP_ASSERT(!tags13.isTagRange());
+
+    // resort the particles in reverse order
+    {
+    ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::readwrite);
+    ArrayHandle<unsigned int> h_rtag(pdata->getRTags(), access_location::host, access_mode::readwrite);
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        {
+        h_tag.data[i] = pdata->getN() - 1 - i;
+        h_rtag.data[i] = pdata->getN() - 1 - i;
+        }
+    }
+
+    pdata->notifyParticleSort();
+
+    // the index list of all particles is unchanged
+    CHECK_EQUAL_UINT(all.getNumMembers(), pdata->getN());
+    {
+    ArrayHandle<unsigned int> h_member_idx(all.getIndexArray(), access_location::host, access_mode::read);
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        {
+        CHECK_EQUAL_UINT(all.getMemberIndex(i), i);
+        CHECK_EQUAL_UINT(h_member_idx.data[i], i);
+        UP_ASSERT(all.isMember(i));
+        }
+    }
+
+    // tags 2-5 are now particles 7-4
+    CHECK_EQUAL_UINT(tags25.getNumMembers(), 4);
+    for (unsigned int i = 0; i < 4; i++)
+        CHECK_EQUAL_UINT(tags25.getMemberIndex(i), i + 4);
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        UP_ASSERT(tags25.isMember(i) == (i >= 4 && i <= 7));
+
+    // tags 1 and 3 are now particles 6 and 8
+    CHECK_EQUAL_UINT(tags13.getNumMembers(), 2);
+    CHECK_EQUAL_UINT(tags13.getMemberIndex(0), 6);
+    CHECK_EQUAL_UINT(tags13.getMemberIndex(1), 8);
+    }
+
 //! Checks that ParticleGroup can initialize by particle type
 UP_TEST( ParticleGroup_type_test )
     {
@@ -617,6 +617,48 @@ UP_TEST( ParticleData_test )
     UP_ASSERT(pdata_type_test.getTypeByName("test") == 1);
     }
 
+//! Tests that the anisotropic particle data is only allocated when needed
+UP_TEST( ParticleData_lazy_anisotropic_test )
+    {
+    BoxDim box(10.0);
+    std::shared_ptr<ExecutionConfiguration> exec_conf(new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    ParticleData pdata(10, box, 1, exec_conf);
+
+    Scalar tol = Scalar(1e-6);
+
+    // a default initialized system has no anisotropic arrays, but reports default values
+    UP_ASSERT(!pdata.hasAnisotropicArrays());
+    UP_ASSERT(pdata.getOrientationArray(false).isNull());
+    Scalar4 q = pdata.getOrientation(3);
+    MY_CHECK_CLOSE(q.x, 1.0, tol);
+    MY_CHECK_SMALL(q.y, tol);
+    Scalar3 I = pdata.getMomentsOfInertia(3);
+    MY_CHECK_SMALL(I.x, tol);
+
+    // setting a value allocates the arrays and leaves the other particles at the defaults
+    pdata.setMomentsOfInertia(3, make_scalar3(1.0, 2.0, 3.0));
+    UP_ASSERT(pdata.hasAnisotropicArrays());
+    UP_ASSERT(pdata.getOrientationArray(false).getNumElements() == pdata.getPositions().getNumElements());
+    MY_CHECK_CLOSE(pdata.getMomentsOfInertia(3).y, 2.0, tol);
+    MY_CHECK_CLOSE(pdata.getOrientation(4).x, 1.0, tol);
+    MY_CHECK_SMALL(pdata.getAngularMomentum(4).x, tol);
+
+    // the values survive a snapshot round trip
+    SnapshotParticleData<Scalar> snap(10);
+    pdata.takeSnapshot(snap);
+    MY_CHECK_CLOSE(snap.inertia[3].z, 3.0, tol);
+    pdata.initializeFromSnapshot(snap);
+    UP_ASSERT(pdata.hasAnisotropicArrays());
+    MY_CHECK_CLOSE(pdata.getMomentsOfInertia(3).z, 3.0, tol);
+
+    // a snapshot with default values releases them again
+    SnapshotParticleData<Scalar> default_snap(10);
+    default_snap.type_mapping.push_back("A");
+    pdata.initializeFromSnapshot(default_snap);
+    UP_ASSERT(!pdata.hasAnisotropicArrays());
+    MY_CHECK_CLOSE(pdata.getOrientation(3).x, 1.0, tol);
+    }
+
 //! Tests the RandomParticleInitializer class
 UP_TEST( Random_test )
     {
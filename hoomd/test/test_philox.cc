@@ -0,0 +1,120 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+
+// this include is necessary to get MPI included before anything else to support intel MPI
+#include "hoomd/ExecutionConfiguration.h"
+
+#include <iostream>
+#include <vector>
+
+#include "upp11_config.h"
+
+HOOMD_UP_MAIN();
+
+
+#include "hoomd/Philox.h"
+
+using namespace std;
+using namespace hoomd::detail;
+
+/*! \file test_philox.cc
+    \brief Implements unit tests for the Philox random number generator
+    \ingroup unit_tests
+*/
+
+//! Check that the block function reproduces the Random123 known-answer vectors
+UP_TEST( philox_known_answers )
+    {
+    uint4 r = philox4x32_10(make_uint4(0, 0, 0, 0), make_uint2(0, 0));
+    CHECK_EQUAL_UINT(r.x, 0x6627e8d5);
+    CHECK_EQUAL_UINT(r.y, 0xe169c58d);
+    CHECK_EQUAL_UINT(r.z, 0xbc57ac4c);
+    CHECK_EQUAL_UINT(r.w, 0x9b00dbd8);
+
+    r = philox4x32_10(make_uint4(0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff), make_uint2(0xffffffff, 0xffffffff));
+    CHECK_EQUAL_UINT(r.x, 0x408f276d);
+    CHECK_EQUAL_UINT(r.y, 0x41c83b0e);
+    CHECK_EQUAL_UINT(r.z, 0xa20bc7c6);
+    CHECK_EQUAL_UINT(r.w, 0x6d5451fd);
+
+    r = philox4x32_10(make_uint4(0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344), make_uint2(0xa4093822, 0x299f31d0));
+    CHECK_EQUAL_UINT(r.x, 0xd16cfe09);
+    CHECK_EQUAL_UINT(r.y, 0x94fdcceb);
+    CHECK_EQUAL_UINT(r.z, 0x5001e420);
+    CHECK_EQUAL_UINT(r.w, 0x24126ea1);
+    }
+
+//! Check that philox_generate() draws the same blocks as PhiloxRNG
+UP_TEST( philox_generate_matches_rng )
+    {
+    const unsigned int n = 37;
+    vector<unsigned int> tags(n);
+    for (unsigned int i = 0; i < n; i++)
+        tags[i] = i*7919 + 3;
+
+    vector<uint4> out(n);
+    philox_generate(&out[0], PhiloxStream::TwoStepBD, 1234, &tags[0], n, 0, 555, 2);
+
+    for (unsigned int i = 0; i < n; i++)
+        {
+        PhiloxRNG rng(PhiloxStream::TwoStepBD, 1234, tags[i], 0, 555);
+        rng.skip(2);
+        uint4 b = rng.block();
+        CHECK_EQUAL_UINT(out[i].x, b.x);
+        CHECK_EQUAL_UINT(out[i].y, b.y);
+        CHECK_EQUAL_UINT(out[i].z, b.z);
+        CHECK_EQUAL_UINT(out[i].w, b.w);
+        }
+    }
+
+//! Check that different streams with the same seed and ids are different
+UP_TEST( philox_streams_differ )
+    {
+    PhiloxRNG a(PhiloxStream::TwoStepLangevin, 42, 7, 0, 100);
+    PhiloxRNG b(PhiloxStream::TwoStepBD, 42, 7, 0, 100);
+    uint4 x = a.block();
+    uint4 y = b.block();
+    UP_ASSERT(x.x != y.x || x.y != y.y || x.z != y.z || x.w != y.w);
+    }
+
+//! Check the moments of the uniform and normal distributions
+UP_TEST( philox_moments )
+    {
+    double s = 0, s2 = 0, s4 = 0;
+    double u = 0, u2 = 0;
+    double umin = 1, umax = -1;
+    const unsigned int n = 100000;
+
+    for (unsigned int i = 0; i < n; i++)
+        {
+        PhiloxRNG rng(PhiloxStream::TwoStepLangevin, 42, i, 0, 7);
+        double r[4];
+        rng.uniform4(r, -1.0, 1.0);
+        for (unsigned int j = 0; j < 4; j++)
+            {
+            u += r[j];
+            u2 += r[j]*r[j];
+            umin = std::min(umin, r[j]);
+            umax = std::max(umax, r[j]);
+            }
+
+        rng.normal4(r);
+        for (unsigned int j = 0; j < 4; j++)
+            {
+            s += r[j];
+            s2 += r[j]*r[j];
+            s4 += r[j]*r[j]*r[j]*r[j];
+            }
+        }
+
+    const double m = 4.0*n;
+    UP_ASSERT(umin > -1.0);
+    UP_ASSERT(umax < 1.0);
+    CHECK_SMALL(u/m, 0.01);
+    MY_CHECK_CLOSE(u2/m, 1.0/3.0, 0.01);
+
+    CHECK_SMALL(s/m, 0.01);
+    MY_CHECK_CLOSE(s2/m, 1.0, 0.01);
+    MY_CHECK_CLOSE(s4/m, 3.0, 0.03);
+    }
@@ -0,0 +1,227 @@
+// Copyright (c) 2009-2018 The Regents of the University of Michigan
+// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
+
+
+// this include is necessary to get MPI included before anything else to support intel MPI
+#include "hoomd/ExecutionConfiguration.h"
+
+#include <iostream>
+#include <random>
+#include <set>
+
+#include <memory>
+
+#include "hoomd/SFCPackUpdater.h"
+
+#ifdef ENABLE_CUDA
+#include "hoomd/SFCPackUpdaterGPU.h"
+#endif
+
+#include "upp11_config.h"
+
+using namespace std;
+
+/*! \file test_sfc_pack_updater.cc
+    \brief Implements unit tests for the memory order produced by SFCPackUpdater and descendants
+    \ingroup unit_tests
+*/
+HOOMD_UP_MAIN();
+
+//! Check that the tag and rtag arrays are consistent after a sort
+static void check_tags(std::shared_ptr<ParticleData> pdata)
+    {
+    ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(pdata->getRTags(), access_location::host, access_mode::read);
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        CHECK_EQUAL_UINT(h_rtag.data[h_tag.data[i]], i);
+    }
+
+//! Place particles uniformly in the box with random types
+static void set_random_positions(std::shared_ptr<ParticleData> pdata, unsigned int n_types)
+    {
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    const BoxDim& box = pdata->getBox();
+    Scalar3 lo = box.getLo();
+    Scalar3 L = box.getL();
+
+    ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::overwrite);
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        {
+        h_pos.data[i].x = lo.x + Scalar(uniform(gen))*L.x;
+        h_pos.data[i].y = lo.y + Scalar(uniform(gen))*L.y;
+        h_pos.data[i].z = lo.z + Scalar(uniform(gen))*L.z;
+        h_pos.data[i].w = __int_as_scalar(i % n_types);
+        }
+    }
+
+//! Check that the Hilbert key sort walks a lattice along a connected curve
+template <class SFC>
+void sfc_hilbert_lattice_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // one particle at the center of every cell of an n^3 grid, in scrambled order
+    const unsigned int n = 8;
+    const unsigned int N = n*n*n;
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(N, BoxDim(Scalar(n)), 1, 0, 0, 0, 0, exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+    {
+    ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::overwrite);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        unsigned int cell = (i*37) % N;
+        h_pos.data[i].x = Scalar(cell % n) + Scalar(0.5) - Scalar(n)/Scalar(2.0);
+        h_pos.data[i].y = Scalar((cell / n) % n) + Scalar(0.5) - Scalar(n)/Scalar(2.0);
+        h_pos.data[i].z = Scalar(cell / (n*n)) + Scalar(0.5) - Scalar(n)/Scalar(2.0);
+        h_pos.data[i].w = __int_as_scalar(0);
+        }
+    }
+
+    std::shared_ptr<SFCPackUpdater> sorter(new SFC(sysdef));
+    sorter->setKeyMode(SFCPackUpdater::hilbert);
+    sorter->update(0);
+
+    check_tags(pdata);
+
+    // the cells along a Hilbert curve share a face, so neighbors in memory are one lattice spacing apart
+    ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+    for (unsigned int i = 1; i < N; i++)
+        {
+        Scalar3 d = make_scalar3(h_pos.data[i].x - h_pos.data[i-1].x,
+                                 h_pos.data[i].y - h_pos.data[i-1].y,
+                                 h_pos.data[i].z - h_pos.data[i-1].z);
+        MY_CHECK_CLOSE(d.x*d.x + d.y*d.y + d.z*d.z, Scalar(1.0), tol);
+        }
+    }
+
+//! Check that the type secondary key keeps the particles of one type contiguous within a grid cell
+template <class SFC>
+void sfc_hilbert_type_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    const unsigned int N = 2000;
+    const unsigned int n_types = 3;
+    const unsigned int grid = 4;
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(N, BoxDim(Scalar(20.0)), n_types, 0, 0, 0, 0,
+                                                                  exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+    set_random_positions(pdata, n_types);
+
+    std::shared_ptr<SFCPackUpdater> sorter(new SFC(sysdef));
+    sorter->setKeyMode(SFCPackUpdater::hilbert);
+    sorter->setSecondaryKey(SFCPackUpdater::type);
+    sorter->setGrid(grid);
+    sorter->update(0);
+
+    check_tags(pdata);
+
+    // every grid cell is one contiguous run of particles, and the types do not decrease within it
+    const BoxDim& box = pdata->getBox();
+    ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+    std::set<unsigned int> visited;
+    unsigned int last_cell = 0;
+    unsigned int last_type = 0;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        Scalar3 f = box.makeFraction(make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z));
+        unsigned int cell = (unsigned int)(f.x*grid) + grid*((unsigned int)(f.y*grid) + grid*(unsigned int)(f.z*grid));
+        unsigned int type = __scalar_as_int(h_pos.data[i].w);
+
+        if (i == 0 || cell != last_cell)
+            {
+            UP_ASSERT(visited.count(cell) == 0);
+            visited.insert(cell);
+            }
+        else
+            {
+            UP_ASSERT(type >= last_type);
+            }
+
+        last_cell = cell;
+        last_type = type;
+        }
+    CHECK_EQUAL_UINT(visited.size(), grid*grid*grid);
+    }
+
+//! Check that the body secondary key places the constituents of a rigid body right after its central particle
+template <class SFC>
+void sfc_hilbert_body_test(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    const unsigned int N = 1000;
+    const unsigned int n_bodies = 50;
+    const unsigned int n_constituents = 4;
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(N, BoxDim(Scalar(20.0)), 1, 0, 0, 0, 0,
+                                                                  exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+    set_random_positions(pdata, 1);
+
+    // tags 0 to n_bodies-1 are central particles, followed by their constituents, the rest are free particles
+    {
+    ArrayHandle<unsigned int> h_body(pdata->getBodies(), access_location::host, access_mode::readwrite);
+    for (unsigned int i = 0; i < n_bodies; i++)
+        {
+        h_body.data[i] = i;
+        for (unsigned int j = 0; j < n_constituents; j++)
+            h_body.data[n_bodies + i*n_constituents + j] = i;
+        }
+    }
+
+    std::shared_ptr<SFCPackUpdater> sorter(new SFC(sysdef));
+    sorter->setKeyMode(SFCPackUpdater::hilbert);
+    sorter->setSecondaryKey(SFCPackUpdater::body);
+    sorter->update(0);
+
+    check_tags(pdata);
+
+    ArrayHandle<unsigned int> h_body(pdata->getBodies(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(pdata->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(pdata->getRTags(), access_location::host, access_mode::read);
+    for (unsigned int b = 0; b < n_bodies; b++)
+        {
+        unsigned int central_idx = h_rtag.data[b];
+        UP_ASSERT(central_idx + n_constituents < N);
+        for (unsigned int j = 1; j <= n_constituents; j++)
+            {
+            CHECK_EQUAL_UINT(h_body.data[central_idx + j], b);
+            UP_ASSERT(h_tag.data[central_idx + j] != b);
+            }
+        }
+    }
+
+//! test case for sfc_hilbert_lattice_test on the CPU
+UP_TEST( SFCPackUpdater_hilbert_lattice )
+    {
+    sfc_hilbert_lattice_test<SFCPackUpdater>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
+//! test case for sfc_hilbert_type_test on the CPU
+UP_TEST( SFCPackUpdater_hilbert_type )
+    {
+    sfc_hilbert_type_test<SFCPackUpdater>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
+//! test case for sfc_hilbert_body_test on the CPU
+UP_TEST( SFCPackUpdater_hilbert_body )
+    {
+    sfc_hilbert_body_test<SFCPackUpdater>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
+#ifdef ENABLE_CUDA
+//! test case for sfc_hilbert_lattice_test on the GPU
+UP_TEST( SFCPackUpdaterGPU_hilbert_lattice )
+    {
+    sfc_hilbert_lattice_test<SFCPackUpdaterGPU>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::GPU)));
+    }
+
+//! test case for sfc_hilbert_type_test on the GPU
+UP_TEST( SFCPackUpdaterGPU_hilbert_type )
+    {
+    sfc_hilbert_type_test<SFCPackUpdaterGPU>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::GPU)));
+    }
+
+//! test case for sfc_hilbert_body_test on the GPU
+UP_TEST( SFCPackUpdaterGPU_hilbert_body )
+    {
+    sfc_hilbert_body_test<SFCPackUpdaterGPU>(std::shared_ptr<ExecutionConfiguration>(new ExecutionConfiguration(ExecutionConfiguration::GPU)));
+    }
+#endif
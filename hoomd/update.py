@@ -262,14 +262,44 @@ class sort(_updater):
 
         self.setupUpdater(default_period);
 
-    def set_params(self, grid=None):
+        self.adaptive = False;
+        self.threshold = 1.5;
+
+    def set_params(self, grid=None, key=None, secondary=None, adaptive=None, threshold=None):
         R""" Change sorter parameters.
 
         Args:
             grid (int): New grid dimension (if set)
+            key (str): Sort key, either ``'grid'`` or ``'hilbert'`` (if set)
+            secondary (str): Secondary sort key for ``key='hilbert'``, one of ``'none'``, ``'type'`` or ``'body'``
+              (if set)
+            adaptive (bool): Only sort when the particle order has lost locality (if set)
+            threshold (float): Relative increase of the locality metric that triggers a sort in adaptive mode (if set)
+
+        With the default ``key='grid'``, particles are ordered by the position of their grid bin along the
+        Hilbert curve. ``key='hilbert'`` orders particles by the Hilbert key of their position at full resolution
+        (21 bits per dimension) using a radix sort. It does not allocate the grid traversal table and also orders
+        particles within each bin.
+
+        The secondary key only applies to ``key='hilbert'``:
+
+        * ``'type'`` - particles of the same type are stored contiguously within each grid bin, *grid* sets the
+          bin size.
+        * ``'body'`` - constituent particles of rigid bodies are stored directly after their central particle.
+
+        In adaptive mode, the sorter period only sets how often the particle order is checked. The check computes
+        the mean distance between particles that are adjacent in memory. The particles are sorted when this distance
+        has grown by more than the factor *threshold* since the last sort. Diffusive systems are sorted much less
+        often than flowing systems. With a notice level of 1 or higher, the number of sorts is printed at the end of
+        each :py:func:`hoomd.run()`. A smaller period makes the adaptive mode more responsive, each check costs
+        about as much as a single pass over the particle positions.
 
         Examples::
+
             sorter.set_params(grid=128)
+            sorter.set_params(key='hilbert', secondary='body')
+            sorter.set_period(20)
+            sorter.set_params(adaptive=True, threshold=1.5)
         """
 
         hoomd.util.print_status_line();
@@ -278,6 +308,44 @@ class sort(_updater):
         if grid is not None:
             self.cpp_updater.setGrid(grid);
 
+        if key is not None:
+            keys = ['grid', 'hilbert'];
+            if key not in keys:
+                hoomd.context.msg.error("update.sort: key must be one of " + str(keys) + "\n");
+                raise ValueError("Invalid sort key");
+            self.cpp_updater.setKeyMode(getattr(_hoomd.SFCPackUpdater.keyMode, key));
+
+        if secondary is not None:
+            secondary_keys = ['none', 'type', 'body'];
+            if secondary not in secondary_keys:
+                hoomd.context.msg.error("update.sort: secondary must be one of " + str(secondary_keys) + "\n");
+                raise ValueError("Invalid secondary sort key");
+            self.cpp_updater.setSecondaryKey(getattr(_hoomd.SFCPackUpdater.secondaryKey, secondary));
+
+        if adaptive is not None or threshold is not None:
+            if adaptive is not None:
+                self.adaptive = adaptive;
+            if threshold is not None:
+                if threshold <= 1.0:
+                    hoomd.context.msg.error("update.sort: threshold must be larger than 1\n");
+                    raise ValueError("Invalid adaptive sort threshold");
+                self.threshold = threshold;
+            self.cpp_updater.setAdaptive(self.adaptive, self.threshold);
+
+    def get_num_sorts(self):
+        R""" Get the number of sorts performed during the last :py:func:`hoomd.run()`.
+
+        Returns:
+            The number of times the particles were sorted.
+
+        Examples::
+
+            sorter.set_params(adaptive=True)
+            run(10000)
+            print(sorter.get_num_sorts())
+        """
+        return self.cpp_updater.getNumSorts();
+
 class box_resize(_updater):
     R""" Rescale the system box size.
 